@@ -7,6 +7,26 @@
 // I2C SCL: Pin 19
 // I2C SDA: Pin 18
 //
+// A second I2C peripheral instance (host-side index 1) operates on Wire1:
+// I2C SCL1: Pin 37
+// I2C SDA1: Pin 38
+//
+// The Depthcharge library uses i2c_t3 on this platform, so `Wire` refers to
+// an i2c_t3 instance here, rather than the generic Arduino TwoWire.
+//
+// Target console UART RX: Pin 0
+// Target console UART TX: Pin 1
+//
+// SPI flash emulation (target is the controller):
+//  CS: Pin 10, SCK: Pin 14, MISO: Pin 11, MOSI: Pin 12
+//
+// The alternate SCK pin is used because pin 13 drives the LED.
+//
+// When built with a USB Type of "Dual Serial", the target's console is bridged
+// to the second USB serial interface, which should then be used as the
+// Depthcharge console device. This allows some operations to be performed
+// on-device, without the latency of host round-trips for each command.
+//
 
 #include <Depthcharge.h>
 
@@ -21,9 +41,33 @@ void setup() {
                  Depthcharge::Companion::default_i2c_addr,
                  Depthcharge::Companion::default_i2c_speed); 
 
+#if DEPTHCHARGE_I2C_MAX_PERIPHS > 1
+    dc.attachI2C(&Wire1,
+                 Depthcharge::Companion::default_i2c_addr,
+                 Depthcharge::Companion::default_i2c_speed);
+#endif
+
+    dc.attachSPI();
+
+#if defined(USB_DUAL_SERIAL) || defined(USB_TRIPLE_SERIAL)
+    Serial1.begin(Depthcharge::Companion::default_uart_baudrate);
+    dc.attachTargetConsole(&Serial1, &SerialUSB1);
+#endif
+
     interrupts();
 }
 
 void loop() {
+#if defined(USB_DUAL_SERIAL) || defined(USB_TRIPLE_SERIAL)
+    // Follow the baud rate the host configures on the bridged interface
+    static uint32_t target_baud = Depthcharge::Companion::default_uart_baudrate;
+    uint32_t baud = SerialUSB1.baud();
+
+    if (baud != 0 && baud != target_baud) {
+        Serial1.begin(baud);
+        target_baud = baud;
+    }
+#endif
+
     dc.processEvents();
 }
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#pragma once
+#include <Arduino.h>
+
+/*
+ * Board-specific firmware configuration
+ *
+ * The sizes of the Companion's buffers and queues, and the peripherals
+ * compiled into it, are chosen here according to the amount of RAM available
+ * on the target board. Any of the DEPTHCHARGE_* values below may instead be
+ * defined via build flags, in order to tailor a build to a particular board.
+ *
+ * The resulting configuration is reported to the host in the
+ * FW_GET_CAPABILITIES response. See Companion.cpp.
+ */
+
+/*
+ * Teensy 3.5 (192 KiB RAM) and Teensy 3.6 (256 KiB RAM) use the large
+ * profile. All other boards use a small profile that fits within the
+ * RAM of a Teensy LC (8 KiB) or similar.
+ */
+#ifndef DEPTHCHARGE_BOARD_LARGE_RAM
+#   if defined(__MK64FX512__) || defined(__MK66FX1M0__)
+#       define DEPTHCHARGE_BOARD_LARGE_RAM 1
+#   else
+#       define DEPTHCHARGE_BOARD_LARGE_RAM 0
+#   endif
+#endif
+
+/*
+ * The generic Arduino Wire API limits transactions to 32 bytes. On Teensy 3.x
+ * we instead use the i2c_t3 library (included with Teensyduino), which
+ * presents a compatible API with larger buffers.
+ *
+ * Define DEPTHCHARGE_I2C_USE_WIRE to force the use of the generic Wire API.
+ */
+#if !defined(DEPTHCHARGE_I2C_USE_WIRE) && \
+    (defined(__MK20DX128__) || defined(__MK20DX256__) || \
+     defined(__MK64FX512__) || defined(__MK66FX1M0__))
+#   define DEPTHCHARGE_I2C_USE_I2C_T3 1
+#endif
+
+/*
+ * SPI peripheral support requires a Kinetis K-series DSPI controller.
+ * Define DEPTHCHARGE_ENABLE_SPI to 0 to omit it, along with its buffers.
+ */
+#ifndef DEPTHCHARGE_ENABLE_SPI
+#   if defined(KINETISK)
+#       define DEPTHCHARGE_ENABLE_SPI 1
+#   else
+#       define DEPTHCHARGE_ENABLE_SPI 0
+#   endif
+#elif DEPTHCHARGE_ENABLE_SPI && !defined(KINETISK)
+#   error "SPI peripheral support is not implemented for this board"
+#endif
+
+// Define to 0 to omit the target console bridge and on-device operations
+#ifndef DEPTHCHARGE_ENABLE_CONSOLE
+#   define DEPTHCHARGE_ENABLE_CONSOLE 1
+#endif
+
+#if DEPTHCHARGE_BOARD_LARGE_RAM
+
+#   ifndef DEPTHCHARGE_COMM_MAX_DATA_SIZE
+#       define DEPTHCHARGE_COMM_MAX_DATA_SIZE 4096
+#   endif
+
+    // Number of received requests that may be awaiting dispatch
+#   ifndef DEPTHCHARGE_COMM_QUEUE_DEPTH
+#       define DEPTHCHARGE_COMM_QUEUE_DEPTH 4
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_WRITE_QUEUE_SIZE
+#       define DEPTHCHARGE_I2C_WRITE_QUEUE_SIZE 16384
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_READ_QUEUE_SIZE
+#       define DEPTHCHARGE_I2C_READ_QUEUE_SIZE 16384
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_SHARED_BUFFER
+#       define DEPTHCHARGE_I2C_SHARED_BUFFER 0
+#   endif
+
+    // Must be a power of two, no larger than 16 KiB
+#   ifndef DEPTHCHARGE_SPI_BUFFER_SIZE
+#       define DEPTHCHARGE_SPI_BUFFER_SIZE 16384
+#   endif
+
+    // Buffers results produced by on-device console operations
+#   ifndef DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE
+#       define DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE 8192
+#   endif
+
+    // Leave room for the core's USB buffers and the stack
+#   ifndef DEPTHCHARGE_BOARD_RAM_BUDGET
+#       define DEPTHCHARGE_BOARD_RAM_BUDGET (160 * 1024)
+#   endif
+
+#else
+
+#   ifndef DEPTHCHARGE_COMM_MAX_DATA_SIZE
+#       define DEPTHCHARGE_COMM_MAX_DATA_SIZE 512
+#   endif
+
+#   ifndef DEPTHCHARGE_COMM_QUEUE_DEPTH
+#       define DEPTHCHARGE_COMM_QUEUE_DEPTH 2
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_WRITE_QUEUE_SIZE
+#       define DEPTHCHARGE_I2C_WRITE_QUEUE_SIZE 512
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_READ_QUEUE_SIZE
+#       define DEPTHCHARGE_I2C_READ_QUEUE_SIZE 512
+#   endif
+
+#   ifndef DEPTHCHARGE_I2C_SHARED_BUFFER
+#       define DEPTHCHARGE_I2C_SHARED_BUFFER 1
+#   endif
+
+#   ifndef DEPTHCHARGE_SPI_BUFFER_SIZE
+#       define DEPTHCHARGE_SPI_BUFFER_SIZE 1024
+#   endif
+
+#   ifndef DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE
+#       define DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE 512
+#   endif
+
+    // Unknown; define this to have the configuration checked against it
+#   ifndef DEPTHCHARGE_BOARD_RAM_BUDGET
+#       define DEPTHCHARGE_BOARD_RAM_BUDGET 0
+#   endif
+
+#endif
+
+/*
+ * Number of bytes requested by each `md` command that the TargetConsole
+ * issues for on-device memory reads. All of a command's output must fit in
+ * the console output queue before it is issued, so this defaults to half of
+ * the queue (up to 1 KiB). The next command can then be issued while the
+ * host drains the previous one's output.
+ */
+#ifndef DEPTHCHARGE_CONSOLE_MD_CHUNK_SIZE
+#   if DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE >= 2048
+#       define DEPTHCHARGE_CONSOLE_MD_CHUNK_SIZE 1024
+#   else
+#       define DEPTHCHARGE_CONSOLE_MD_CHUNK_SIZE (DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE / 2)
+#   endif
+#endif
+
+/*
+ * Number of I2CPeriph instances (i.e. buses) a Companion can operate on.
+ * Each instance has its own write and read queues, so take their sizes
+ * into account when increasing this.
+ */
+#ifndef DEPTHCHARGE_I2C_MAX_PERIPHS
+#   if DEPTHCHARGE_I2C_USE_I2C_T3 && DEPTHCHARGE_BOARD_LARGE_RAM
+#       define DEPTHCHARGE_I2C_MAX_PERIPHS 2
+#   else
+#       define DEPTHCHARGE_I2C_MAX_PERIPHS 1
+#   endif
+#endif
+
+namespace Depthcharge {
+
+    /*
+     * Compile-time view of the above configuration, used by the classes
+     * whose buffers and queues it sizes.
+     */
+    struct Board {
+        static const bool LARGE_RAM = DEPTHCHARGE_BOARD_LARGE_RAM;
+
+        static const size_t COMM_MAX_DATA_SIZE = DEPTHCHARGE_COMM_MAX_DATA_SIZE;
+        static const size_t COMM_QUEUE_DEPTH   = DEPTHCHARGE_COMM_QUEUE_DEPTH;
+
+        static const size_t I2C_MAX_PERIPHS      = DEPTHCHARGE_I2C_MAX_PERIPHS;
+        static const size_t I2C_WRITE_QUEUE_SIZE = DEPTHCHARGE_I2C_WRITE_QUEUE_SIZE;
+        static const size_t I2C_READ_QUEUE_SIZE  = DEPTHCHARGE_I2C_READ_QUEUE_SIZE;
+
+        // Use a single buffer for both directions of I2C transactions
+        static const bool I2C_SHARED_BUFFER = DEPTHCHARGE_I2C_SHARED_BUFFER;
+
+        static const bool   ENABLE_SPI      = DEPTHCHARGE_ENABLE_SPI;
+        static const size_t SPI_BUFFER_SIZE = ENABLE_SPI ? DEPTHCHARGE_SPI_BUFFER_SIZE : 0;
+
+        static const bool   ENABLE_CONSOLE = DEPTHCHARGE_ENABLE_CONSOLE;
+        static const size_t CONSOLE_OUTPUT_QUEUE_SIZE =
+            ENABLE_CONSOLE ? DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE : 0;
+
+        // `md` output is queued in records of up to CONSOLE_MD_RECORD_SIZE
+        // bytes, each preceded by a length byte.
+        static const size_t CONSOLE_MD_CHUNK_SIZE  = DEPTHCHARGE_CONSOLE_MD_CHUNK_SIZE;
+        static const size_t CONSOLE_MD_RECORD_SIZE = 128;
+
+        static_assert(!ENABLE_CONSOLE ||
+                      (CONSOLE_MD_CHUNK_SIZE + (CONSOLE_MD_CHUNK_SIZE / CONSOLE_MD_RECORD_SIZE) + 1)
+                        <= CONSOLE_OUTPUT_QUEUE_SIZE,
+                      "DEPTHCHARGE_CONSOLE_MD_CHUNK_SIZE exceeds the console output queue");
+
+        // Approximate RAM used by the above buffers and queues. I2C
+        // transaction buffers are included at their largest (255 bytes).
+        static const size_t BUFFER_RAM =
+            (COMM_MAX_DATA_SIZE * COMM_QUEUE_DEPTH) +
+            (I2C_MAX_PERIPHS * (I2C_WRITE_QUEUE_SIZE + I2C_READ_QUEUE_SIZE +
+                                (I2C_SHARED_BUFFER ? 1 : 2) * 255)) +
+            (2 * SPI_BUFFER_SIZE) +
+            CONSOLE_OUTPUT_QUEUE_SIZE;
+
+        static const size_t RAM_BUDGET = DEPTHCHARGE_BOARD_RAM_BUDGET;
+
+        static_assert(RAM_BUDGET == 0 || BUFFER_RAM <= RAM_BUDGET,
+                      "Buffer sizes exceed DEPTHCHARGE_BOARD_RAM_BUDGET");
+    };
+}
@@ -3,97 +3,339 @@
 
 #include "Communicator.h"
 #include "Panic.h"
+#include "Stats.h"
 
 #define SET_PANIC_REASON() \
     do { Panic::setReason(Panic::Source::Communicator, __LINE__); } while (0)
 
 namespace Depthcharge {
 
+    const uint8_t Communicator::V2_MAGIC[2] = { 0xdc, 0x02 };
+
+    // CRC-16/CCITT-FALSE (Polynomial = 0x1021), MSB-first lookup table
+    static const uint16_t crc16_table[256] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+        0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+        0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+        0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+        0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+        0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+        0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+        0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+        0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+        0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+        0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+        0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+        0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+        0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+        0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+        0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+        0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+        0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+        0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+        0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+        0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+        0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+        0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+        0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+        0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+        0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+        0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+        0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+        0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+        0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+        0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+        0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0,
+    };
+
     Communicator::Communicator() :
-        m_state(UNINITIALIZED), m_hostPort(NULL) {};
+        m_state(UNINITIALIZED), m_hostPort(NULL), m_rcvd(0), m_sync(-1),
+        m_qhead(0), m_qcount(0),
+        m_protocol(PROTOCOL_V1), m_rx_protocol(PROTOCOL_V1),
+        m_pending_protocol(0) {};
 
     void Communicator::attach(::Stream *port)
     {
         if (m_state == UNINITIALIZED) {
             m_hostPort = port;
-            memset(&m_req,  0, sizeof(m_req));
+            memset(m_queue, 0, sizeof(m_queue));
             m_state = IDLE;
         }
     }
 
-    bool Communicator::hasRequest(msg &req_out)
+    uint16_t Communicator::crc16(uint16_t crc, const uint8_t *data, size_t len)
+    {
+        for (size_t i = 0; i < len; i++) {
+            crc = (crc << 8) ^ crc16_table[((crc >> 8) ^ data[i]) & 0xff];
+        }
+        return crc;
+    }
+
+    bool Communicator::setProtocol(uint8_t version)
+    {
+        if (version != PROTOCOL_V1 && version != PROTOCOL_V2) {
+            return false;
+        }
+
+        // Takes effect after the response to the current request is sent
+        m_pending_protocol = version;
+        return true;
+    }
+
+    void Communicator::decodeHeader(msg &req)
     {
-        switch (this->m_state) {
-            case IDLE:
-                m_data_rcvd = 0;
-                if (m_hostPort->available() >= (int) HEADER_SIZE) {
-                    m_state = READ_REQUEST_HEADER;
+        req.cmd = m_hdr[0];
+
+        if (m_rx_protocol == PROTOCOL_V1) {
+            req.flags  = 0;
+            req.tag    = 0;
+            req.periph = 0;
+            req.len    = m_hdr[1];
+        } else {
+            req.flags  = m_hdr[1];
+            req.len    = m_hdr[2] | (m_hdr[3] << 8);
+            req.tag    = (req.flags & FLAG_TAGGED) ? m_hdr[V2_HEADER_SIZE] : 0;
+            req.periph = (req.flags & FLAG_PERIPH_MASK) >> FLAG_PERIPH_SHIFT;
+        }
+    }
+
+    void Communicator::commitRequest(msg &req)
+    {
+        // Request flags are not currently used beyond this point.
+        req.flags &= (FLAG_TAGGED | FLAG_REVERT_V1);
+        m_qcount++;
+        m_state = IDLE;
+    }
+
+    void Communicator::commitFrameError(msg &req)
+    {
+        // The host will not receive a response to the request it
+        // intended to send, so let it know, in order. We will
+        // re-synchronize upon the next frame's magic bytes.
+        req.flags = (req.flags & FLAG_TAGGED) | FLAG_FRAME_ERROR;
+        req.len   = 0;
+        Stats::counters.host_frame_errors++;
+        m_qcount++;
+        m_state = IDLE;
+    }
+
+    /*
+     * Consume all currently available input, stopping early only if the
+     * request queue fills. Only data reported by available() is read,
+     * so this never blocks on the Stream's timeout.
+     */
+    void Communicator::parse()
+    {
+        if (m_state == UNINITIALIZED) {
+            SET_PANIC_REASON();
+            m_state = PANIC;
+            return;
+        }
+
+        while (m_qcount < QUEUE_DEPTH && m_state != PANIC) {
+            const int avail = m_hostPort->available();
+            if (avail <= 0) {
+                return;
+            }
+
+            msg &req = rxSlot();
+
+            switch (m_state) {
+                case IDLE: {
+                    m_rcvd = 0;
+
+                    if (m_rx_protocol == PROTOCOL_V1) {
+                        m_state = READ_REQUEST_HEADER;
+                        break;
+                    }
+
+                    // Search for the start of a version 2 frame, or a version 1
+                    // FW_GET_VERSION request, discarding anything else.
+                    const int b = m_hostPort->read();
+                    Stats::counters.host_rx_bytes++;
+
+                    if (m_sync == V2_MAGIC[0] && b == V2_MAGIC[1]) {
+                        m_sync = -1;
+                        m_state = READ_REQUEST_HEADER;
+                    } else if (m_sync == 0x00 && b == 0x00) {
+                        // Earlier requests are still answered using
+                        // version 2 framing. See sendResponse().
+                        m_sync = -1;
+                        m_rx_protocol = PROTOCOL_V1;
+                        req.cmd    = 0x00;
+                        req.flags  = FLAG_REVERT_V1;
+                        req.tag    = 0;
+                        req.periph = 0;
+                        req.len    = 0;
+                        commitRequest(req);
+                    } else {
+                        m_sync = b;
+                    }
+                    break;
                 }
-                break;
 
-            case READ_REQUEST_HEADER: {
-                size_t n = m_hostPort->readBytes(
-                                reinterpret_cast<byte*>(&m_req), HEADER_SIZE);
+                case READ_REQUEST_HEADER: {
+                    size_t to_read = headerSize() - m_rcvd;
+                    if (to_read > (size_t) avail) {
+                        to_read = avail;
+                    }
 
-                if (n != HEADER_SIZE) {
-                    SET_PANIC_REASON();
-                    m_state = PANIC;
-                    return false;
+                    const size_t n = m_hostPort->readBytes(&m_hdr[m_rcvd], to_read);
+                    Stats::counters.host_rx_bytes += n;
+                    m_rcvd += n;
+                    if (m_rcvd < headerSize()) {
+                        break;
+                    }
+
+                    decodeHeader(req);
+                    m_rcvd = 0;
+
+                    if (req.len > MAX_DATA_SIZE) {
+                        // Only possible with version 2 framing
+                        commitFrameError(req);
+                    } else if (req.len != 0) {
+                        m_state = READ_REQUEST_DATA;
+                    } else if (m_rx_protocol == PROTOCOL_V1) {
+                        commitRequest(req);
+                    } else {
+                        m_state = READ_REQUEST_CRC;
+                    }
+                    break;
                 }
 
-                if (m_req.len == 0) {
-                    m_state = RETURN_REQUEST;
-                } else if (m_req.len <= MAX_DATA_SIZE) {
-                    m_data_rcvd = 0;
-                    m_state = READ_REQUEST_DATA;
-                } else {
-                    SET_PANIC_REASON();
-                    m_state = PANIC;
-                    return false;
+                case READ_REQUEST_DATA: {
+                    size_t to_read = req.len - m_rcvd;
+                    if (to_read > (size_t) avail) {
+                        to_read = avail;
+                    }
+
+                    const size_t n = m_hostPort->readBytes(&req.data[m_rcvd], to_read);
+                    Stats::counters.host_rx_bytes += n;
+                    m_rcvd += n;
+                    if (m_rcvd < req.len) {
+                        break;
+                    }
+
+                    m_rcvd = 0;
+
+                    if (m_rx_protocol == PROTOCOL_V1) {
+                        commitRequest(req);
+                    } else {
+                        m_state = READ_REQUEST_CRC;
+                    }
+                    break;
                 }
-                break;
-            }
 
-            case READ_REQUEST_DATA: {
-                size_t avail = m_hostPort->available();
-                if (avail > 0) {
-                    size_t data_left = m_req.len - m_data_rcvd;
-                    size_t to_read = (avail < data_left) ? avail : data_left;
-                    uint8_t *ins = &m_req.data[m_data_rcvd];
-
-                    size_t n = m_hostPort->readBytes(ins, to_read);
-                    if (n != to_read) {
-                        SET_PANIC_REASON();
-                        m_state = PANIC;
-                        return false;
+                case READ_REQUEST_CRC: {
+                    size_t to_read = V2_CRC_SIZE - m_rcvd;
+                    if (to_read > (size_t) avail) {
+                        to_read = avail;
                     }
 
-                    m_data_rcvd += to_read;
-                    if (m_data_rcvd >= m_req.len) {
-                        m_state = RETURN_REQUEST;
+                    const size_t n = m_hostPort->readBytes(&m_crc[m_rcvd], to_read);
+                    Stats::counters.host_rx_bytes += n;
+                    m_rcvd += n;
+                    if (m_rcvd < V2_CRC_SIZE) {
+                        break;
+                    }
+
+                    uint16_t crc = crc16(CRC16_INIT, m_hdr, headerSize());
+                    crc = crc16(crc, req.data, req.len);
+
+                    if (crc == (m_crc[0] | (m_crc[1] << 8))) {
+                        commitRequest(req);
+                    } else {
+                        commitFrameError(req);
                     }
+                    break;
                 }
-                break;
+
+                default:
+                    SET_PANIC_REASON();
+                    m_state = PANIC;
+                    return;
             }
+        }
+    }
 
-            case RETURN_REQUEST:
-                memcpy(&req_out, &m_req, HEADER_SIZE + m_req.len);
-                if (m_req.len < MAX_DATA_SIZE) {
-                    size_t len = MAX_DATA_SIZE - m_req.len;
-                    memset(&req_out.data[m_req.len], 0, len);
-                }
-                m_state = IDLE;
-                return true;
+    bool Communicator::hasRequest(msg *&request)
+    {
+        // Continue receiving requests while earlier ones await dispatch
+        parse();
 
-            case PANIC:
-                return false;
+        while (m_qcount > 0) {
+            msg &req = m_queue[m_qhead];
 
-            default:
-                SET_PANIC_REASON();
-                m_state = PANIC;
-                return false;
+            if (!(req.flags & FLAG_FRAME_ERROR)) {
+                request = &req;
+                return true;
+            }
+
+            sendResponse(req);
         }
 
         return false;
     }
+
+    void Communicator::sendResponse(msg &response)
+    {
+        if (response.flags & FLAG_REVERT_V1) {
+            m_protocol = PROTOCOL_V1;
+            m_pending_protocol = 0;
+        }
+
+        if (response.len > maxPayload()) {
+            response.len = maxPayload();
+        }
+
+        if (m_protocol == PROTOCOL_V1) {
+            const uint8_t hdr[V1_HEADER_SIZE] = {
+                response.cmd, static_cast<uint8_t>(response.len)
+            };
+
+            m_hostPort->write(hdr, sizeof(hdr));
+            m_hostPort->write(response.data, response.len);
+            Stats::counters.host_tx_bytes += sizeof(hdr) + response.len;
+        } else {
+            const uint8_t flags = response.flags & (FLAG_TAGGED | FLAG_FRAME_ERROR);
+            const uint8_t hdr[V2_HEADER_SIZE] = {
+                response.cmd, flags,
+                static_cast<uint8_t>(response.len & 0xff),
+                static_cast<uint8_t>(response.len >> 8)
+            };
+
+            uint16_t crc = crc16(CRC16_INIT, hdr, sizeof(hdr));
+            if (flags & FLAG_TAGGED) {
+                crc = crc16(crc, &response.tag, 1);
+            }
+            crc = crc16(crc, response.data, response.len);
+
+            const uint8_t trailer[V2_CRC_SIZE] = {
+                static_cast<uint8_t>(crc & 0xff),
+                static_cast<uint8_t>(crc >> 8)
+            };
+
+            m_hostPort->write(V2_MAGIC, sizeof(V2_MAGIC));
+            m_hostPort->write(hdr, sizeof(hdr));
+            if (flags & FLAG_TAGGED) {
+                m_hostPort->write(&response.tag, 1);
+            }
+            m_hostPort->write(response.data, response.len);
+            m_hostPort->write(trailer, sizeof(trailer));
+
+            Stats::counters.host_tx_bytes += sizeof(V2_MAGIC) + sizeof(hdr) +
+                ((flags & FLAG_TAGGED) ? 1 : 0) + response.len + sizeof(trailer);
+        }
+
+        if (m_qcount > 0 && &response == &m_queue[m_qhead]) {
+            m_qhead = (m_qhead + 1) % QUEUE_DEPTH;
+            m_qcount--;
+        }
+
+        if (m_pending_protocol != 0) {
+            m_protocol = m_pending_protocol;
+            m_rx_protocol = m_pending_protocol;
+            m_pending_protocol = 0;
+        }
+    }
 };
@@ -5,21 +5,84 @@
 
 #include "Arduino.h"
 
+#include "Board.h"
+
 namespace Depthcharge {
     /*
      * Instances of this represent a device <-> host interface handle.
      *
      * This just abstracts away some of the message handling so the Companion
      * code doesn't have to worry about it.
+     *
+     * Two message framings are supported:
+     *
+     *  Version 1: [cmd][len][data...]
+     *
+     *      This is the framing used upon startup. The 1-byte length
+     *      limits payloads to 255 bytes.
+     *
+     *  Version 2: [0xdc][0x02][cmd][flags][len (LE16)][tag]?[data...][crc (LE16)]
+     *
+     *      Selected by the host via setProtocol(). The CRC is a
+     *      CRC-16/CCITT-FALSE computed over all fields following the
+     *      two magic bytes, up to the CRC itself. Corrupted or over-length
+     *      requests are answered with a response with FLAG_FRAME_ERROR set,
+     *      after which the Communicator re-synchronizes on the next
+     *      magic sequence.
+     *
+     *      Bits 1-3 of a request's flags (FLAG_PERIPH_MASK) select the
+     *      peripheral instance that bus-specific commands (e.g. I2C_*)
+     *      operate upon. This is zero for all version 1 requests.
+     *
+     *      The 1-byte tag is present only when FLAG_TAGGED is set. It is
+     *      echoed in the corresponding response, allowing a host to keep
+     *      multiple requests in flight. Requests are always processed and
+     *      answered in the order they are received. Up to QUEUE_DEPTH
+     *      received requests may be buffered while awaiting dispatch.
+     *      The host must not send further requests until it has received
+     *      the response to a setProtocol() request.
+     *
+     * While awaiting a version 2 frame, a version 1 FW_GET_VERSION request
+     * (two zero bytes) reverts the Communicator to version 1 framing. This
+     * allows a host to always begin a session with version 1 framing,
+     * regardless of how a previous session left the device.
      */
     class Communicator {
         public:
-            static const size_t MAX_DATA_SIZE = 64;
+            static const size_t MAX_DATA_SIZE = Board::COMM_MAX_DATA_SIZE;
 
-            struct __attribute__((packed)) msg {
-                uint8_t cmd;
-                uint8_t len;
-                uint8_t data[MAX_DATA_SIZE];
+            static_assert(MAX_DATA_SIZE >= 255 && MAX_DATA_SIZE <= 0xffff,
+                          "Invalid DEPTHCHARGE_COMM_MAX_DATA_SIZE");
+
+            enum Protocol {
+                PROTOCOL_V1 = 1,
+                PROTOCOL_V2 = 2,
+            };
+
+            static const size_t QUEUE_DEPTH = Board::COMM_QUEUE_DEPTH;
+
+            static_assert(QUEUE_DEPTH >= 1 && QUEUE_DEPTH <= 255,
+                          "Invalid DEPTHCHARGE_COMM_QUEUE_DEPTH");
+
+            enum Flags {
+                // Version 2 only: A tag byte follows the length field
+                FLAG_TAGGED      = (1 << 0),
+
+                // Version 2 requests only: Peripheral instance selector
+                FLAG_PERIPH_MASK  = (0x7 << 1),
+                FLAG_PERIPH_SHIFT = 1,
+
+                // Response only: Request was corrupt or malformed
+                FLAG_FRAME_ERROR = (1 << 7),
+            };
+
+            struct msg {
+                uint8_t  cmd;
+                uint8_t  flags;
+                uint8_t  tag;
+                uint8_t  periph;    // See FLAG_PERIPH_MASK
+                uint16_t len;
+                uint8_t  data[MAX_DATA_SIZE];
             };
 
             /**
@@ -39,38 +102,113 @@ namespace Depthcharge {
             /*
              * Check for a new request.
              *
-             * If received, this function will update `request` and return true.
-             *
+             * This consumes all data currently available from the host
+             * port, without blocking. If a complete request has been
+             * received, `request` is pointed to it and true is returned.
              * Otherwise, false is returned and `request` is not modified.
+             *
+             * The request remains owned by the Communicator. The caller may
+             * build its response in place, and must call sendResponse()
+             * before the next request can be returned.
              */
-            bool hasRequest(msg &request);
+            bool hasRequest(msg *&request);
 
-            inline void sendResponse(msg &response) {
-                if (response.len > MAX_DATA_SIZE) {
-                    response.len = MAX_DATA_SIZE;
-                }
+            /*
+             * Send a response to the most recently returned request, and
+             * release the storage associated with that request.
+             *
+             * Only the FLAG_TAGGED bit of response.flags is retained. When
+             * set, response.tag is included in the response.
+             */
+            void sendResponse(msg &response);
 
-                m_hostPort->write(
-                    reinterpret_cast<byte*>(&response),
-                    HEADER_SIZE + response.len
-                );
-            };
+            /*
+             * Select the framing used for all requests and responses
+             * following the response to the current request.
+             *
+             * Returns false if `version` is not supported.
+             */
+            bool setProtocol(uint8_t version);
+
+            inline uint8_t getProtocol() const {
+                return m_protocol;
+            }
+
+            /*
+             * Largest response payload that can be sent using the
+             * currently selected framing.
+             */
+            inline size_t maxPayload() const {
+                return (m_protocol == PROTOCOL_V1) ? 255 : MAX_DATA_SIZE;
+            }
+
+            // CRC-16/CCITT-FALSE, continuing from `crc`
+            static uint16_t crc16(uint16_t crc, const uint8_t *data, size_t len);
+
+            static const uint16_t CRC16_INIT = 0xffff;
 
         private:
+            static const uint8_t V2_MAGIC[2];
+
+            static const size_t V1_HEADER_SIZE = 2;
+            static const size_t V2_HEADER_SIZE = 4;
+            static const size_t V2_CRC_SIZE    = 2;
+
+            // Internal request flag: Respond with, and thereafter use,
+            // version 1 framing. Never sent to the host.
+            static const uint8_t FLAG_REVERT_V1 = (1 << 6);
+
             enum state {
                 UNINITIALIZED,
                 IDLE,
                 READ_REQUEST_HEADER,
                 READ_REQUEST_DATA,
-                RETURN_REQUEST,
+                READ_REQUEST_CRC,
                 PANIC
             } m_state;
 
+            void parse();
+            void decodeHeader(msg &req);
+            void commitRequest(msg &req);
+            void commitFrameError(msg &req);
+
+            // Header size, including the tag of a tagged v2 request
+            inline size_t headerSize() const {
+                if (m_rx_protocol == PROTOCOL_V1) {
+                    return V1_HEADER_SIZE;
+                } else if (m_rcvd >= 2 && (m_hdr[1] & FLAG_TAGGED)) {
+                    return V2_HEADER_SIZE + 1;
+                }
+                return V2_HEADER_SIZE;
+            }
+
+            // Slot the request currently being received is written to
+            inline msg& rxSlot() {
+                return m_queue[(m_qhead + m_qcount) % QUEUE_DEPTH];
+            }
+
             ::Stream *m_hostPort;
-            msg m_req;
-            size_t m_data_rcvd;
 
-            static const size_t HEADER_SIZE =
-                sizeof(m_req.cmd) + sizeof(m_req.len);
+            // Bytes received in the current state
+            size_t m_rcvd;
+
+            // Raw header and CRC of the request being received
+            uint8_t m_hdr[V2_HEADER_SIZE + 1];
+            uint8_t m_crc[V2_CRC_SIZE];
+
+            // Previous byte seen while searching for a v2 frame, or -1
+            int m_sync;
+
+            // FIFO of received requests. A slot is committed by
+            // incrementing m_qcount after it has been fully received.
+            msg m_queue[QUEUE_DEPTH];
+            size_t m_qhead;
+            size_t m_qcount;
+
+            // Framing used for responses, and for parsing requests. These
+            // differ only while earlier requests await their responses.
+            uint8_t m_protocol;
+            uint8_t m_rx_protocol;
+            uint8_t m_pending_protocol;
     };
 };
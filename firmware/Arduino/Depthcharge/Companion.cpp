@@ -4,6 +4,7 @@
 #include "Depthcharge.h"
 #include "Version.h"
 #include "Panic.h"
+#include "Stats.h"
 
 #ifndef DEPTHCHARGE_LED_BLINK_PERIOD_MS
 #   define DEPTHCHARGE_LED_BLINK_PERIOD_MS 1000
@@ -14,7 +15,12 @@
 
 namespace Depthcharge {
 
-    Companion::Companion() : m_caps(0) { }
+    Companion::Companion() :
+        m_caps(CAP_FRAMING_V2 | CAP_TAGGED_REQUESTS | CAP_LOOPBACK | CAP_BOARD_CONFIG),
+        m_i2c_count(0)
+    {
+        Stats::begin();
+    }
 
     void Companion::attachHostInterface(::Stream *port)
     {
@@ -27,15 +33,47 @@ namespace Depthcharge {
         m_led.attach(pin, on_state, off_state);
     }
 
-    void Companion::attachI2C(::TwoWire *bus, uint8_t addr, uint32_t speed)
+    void Companion::attachI2C(I2CBus *bus, uint8_t addr, uint32_t speed)
+    {
+        // Version 1 framing is limited to 255-byte payloads
+        static_assert(I2CPeriph::BUFFER_SIZE <= 255,
+                      "Host messages cannot carry a full I2C transaction!");
+
+        if (m_i2c_count >= I2CPeriph::MAX_INSTANCES) {
+            // Increase DEPTHCHARGE_I2C_MAX_PERIPHS to use additional buses
+            Panic::setReason(Panic::Source::Companion, __LINE__);
+            return;
+        }
+
+        m_i2c[m_i2c_count++].attach(bus, addr, speed);
+        m_caps |= CAP_I2C_PERIPH | CAP_I2C_WRITE_QUEUE | CAP_I2C_READ_QUEUE |
+                  CAP_I2C_MULTI;
+
+        if (I2CPeriph::BUFFER_SIZE > 32) {
+            m_caps |= CAP_I2C_LARGE_XFER;
+        }
+    }
+
+    void Companion::attachSPI()
+    {
+        if (m_spi.attach()) {
+            m_caps |= CAP_SPI_PERIPH;
+        }
+    }
+
+    void Companion::attachTargetConsole(::Stream *target, ::Stream *bridge)
     {
-        m_i2c.attach(bus, addr, speed);
-        m_caps |= CAP_I2C_PERIPH;
+#if DEPTHCHARGE_ENABLE_CONSOLE
+        m_console.attach(target, bridge);
+        m_caps |= CAP_TARGET_CONSOLE;
+#else
+        (void) target;
+        (void) bridge;
+#endif
     }
 
     void Companion::processEvents()
     {
-        static Communicator::msg msg;
         static unsigned long last_led_toggle = 0;
         unsigned long now = millis();
 
@@ -48,13 +86,44 @@ namespace Depthcharge {
             panicLoop(); // Does not return. Emits panic reason via LED.
         }
 
+        Stats::counters.loop_iterations++;
+
+        // The response is built in place and sent by handleHostMessage()
+        Communicator::msg *msg;
         if (m_comm.hasRequest(msg)) {
-            handleHostMessage(msg);
+            handleHostMessage(*msg);
+        }
+
+#if DEPTHCHARGE_ENABLE_CONSOLE
+        m_console.process();
+#endif
+    }
+
+    // Decode a little-endian value of up to 8 bytes
+    static uint64_t readLE(const uint8_t *data, size_t len)
+    {
+        uint64_t value = 0;
+
+        while (len-- > 0) {
+            value = (value << 8) | data[len];
+        }
+
+        return value;
+    }
+
+    // Encode a little-endian value of up to 8 bytes
+    static void writeLE(uint8_t *data, uint64_t value, size_t len)
+    {
+        for (size_t i = 0; i < len; i++) {
+            data[i] = value & 0xff;
+            value >>= 8;
         }
     }
 
     void Companion::handleHostMessage(Communicator::msg &msg)
     {
+        const uint32_t start = Stats::timestamp();
+
         switch (msg.cmd) {
             case FW_GET_VERSION:
                 msg.len = 4;
@@ -64,85 +133,220 @@ namespace Depthcharge {
                 msg.data[3] = VERSION_EXTRA;
                 break;
 
-            case FW_GET_CAPABILITIES:
-                static_assert(sizeof(m_caps) < sizeof(msg.data),
-                              "Broken m_caps -> msg.data copy!");
+            // Request: Optional 1-byte index of first command entry
+            // Response: See Stats::serialize()
+            case FW_GET_STATS:
+                if (msg.len > 1) {
+                    msg.data[0] = Error::INVALID_PARAM;
+                    msg.len = 1;
+                } else {
+                    const uint8_t first = (msg.len == 1) ? msg.data[0] : 0;
+                    msg.len = Stats::serialize(msg.data, m_comm.maxPayload(), first);
+                }
+                break;
 
-                msg.len = sizeof(m_caps);
-                memcpy(msg.data, &m_caps, sizeof(m_caps));
+            case FW_RESET_STATS:
+                Stats::reset();
+                msg.data[0] = Error::SUCCESS;
+                msg.len = 1;
                 break;
 
+            // Response: The request data, unmodified
+            case FW_LOOPBACK:
+                break;
 
-            // TODO: Move I2C_ items into subhandlers to de-dup
-            // attached() logic.
+            // Request:  [Response length LE16][Data (discarded)]
+            // Response: Response length bytes, with data[i] = i & 0xff
+            case FW_SINK: {
+                const size_t len = (msg.len >= 2) ? readLE(msg.data, 2) : 0;
 
-            case I2C_GET_ADDR:
-                msg.len = 1;
-                if (m_i2c.attached()) {
-                    msg.data[0] = m_i2c.getAddress();
+                if (msg.len < 2 || len > m_comm.maxPayload()) {
+                    msg.data[0] = Error::INVALID_PARAM;
+                    msg.len = 1;
                 } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
+                    for (size_t i = 0; i < len; i++) {
+                        msg.data[i] = i & 0xff;
+                    }
+                    msg.len = len;
+                }
+                break;
+            }
+
+            // Response: [Capabilities LE32], followed by the board
+            //           configuration (CAP_BOARD_CONFIG):
+            //
+            //  [Max data size LE16][Request queue depth]
+            //  [I2C peripheral instances][I2C buffer size LE16]
+            //  [I2C write queue size LE32][I2C read queue size LE32]
+            //  [SPI buffer size LE32][Console output queue size LE32]
+            //  [BoardFlags]
+            //
+            // Sizes are 0 for peripherals that are not compiled in. Older
+            // hosts only read the capabilities field.
+            case FW_GET_CAPABILITIES:
+                static_assert(CAPS_RESP_SIZE <= 255,
+                              "FW_GET_CAPABILITIES response is too large!");
+
+                writeLE(&msg.data[0],  m_caps, 4);
+                writeLE(&msg.data[4],  Board::COMM_MAX_DATA_SIZE, 2);
+                msg.data[6] = Board::COMM_QUEUE_DEPTH;
+                msg.data[7] = Board::I2C_MAX_PERIPHS;
+                writeLE(&msg.data[8],  I2CPeriph::BUFFER_SIZE, 2);
+                writeLE(&msg.data[10], Board::I2C_WRITE_QUEUE_SIZE, 4);
+                writeLE(&msg.data[14], Board::I2C_READ_QUEUE_SIZE, 4);
+                writeLE(&msg.data[18], Board::SPI_BUFFER_SIZE, 4);
+                writeLE(&msg.data[22], Board::CONSOLE_OUTPUT_QUEUE_SIZE, 4);
+
+                msg.data[26] = 0;
+                if (Board::I2C_SHARED_BUFFER) {
+                    msg.data[26] |= BOARD_I2C_SHARED_BUFFER;
+                }
+                if (Board::LARGE_RAM) {
+                    msg.data[26] |= BOARD_LARGE_RAM;
                 }
+
+                msg.len = CAPS_RESP_SIZE;
                 break;
 
-            case I2C_SET_ADDR:
-                if (msg.len != 1 || msg.data[0] > 0x7f) {
+            // The response to this request is sent using the current
+            // framing. The requested framing is used thereafter.
+            case FW_SET_PROTOCOL:
+                if (msg.len != 1 || !m_comm.setProtocol(msg.data[0])) {
                     msg.data[0] = Error::INVALID_PARAM;
-                } else if (m_i2c.attached()) {
-                    m_i2c.setAddress(msg.data[0]);
-                    msg.data[0] = SUCCESS;
                 } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
+                    msg.data[0] = Error::SUCCESS;
                 }
                 msg.len = 1;
                 break;
 
+            // Response: 1-byte protocol version, followed by the
+            //           maximum payload size as a LE16 value and the
+            //           number of requests that may be queued.
+            case FW_GET_PROTOCOL: {
+                const size_t max_payload = m_comm.maxPayload();
+                msg.data[0] = m_comm.getProtocol();
+                msg.data[1] = max_payload & 0xff;
+                msg.data[2] = (max_payload >> 8) & 0xff;
+                msg.data[3] = Communicator::QUEUE_DEPTH;
+                msg.len = 4;
+                break;
+            }
+
+
+            case I2C_GET_ADDR:
+            case I2C_SET_ADDR:
             case I2C_GET_SPEED:
-                if (m_i2c.attached()) {
-                    const uint32_t speed = m_i2c.getSpeed();
-                    msg.data[0] = speed         & 0xff;
-                    msg.data[1] = (speed >> 8)  & 0xff;
-                    msg.data[2] = (speed >> 16) & 0xff;
-                    msg.data[3] = (speed >> 24) & 0xff;
-                    msg.len = 4;
+            case I2C_SET_SPEED:
+            case I2C_GET_SUBADDR_LEN:
+            case I2C_SET_SUBADDR_LEN:
+            case I2C_GET_MODE_FLAGS:
+            case I2C_SET_MODE_FLAGS:
+            case I2C_SET_READ_BUFFER:
+            case I2C_GET_WRITE_BUFFER:
+            case I2C_DRAIN_WRITE_QUEUE:
+            case I2C_GET_BUFFER_SIZE:
+            case I2C_QUEUE_READ_BUFFERS:
+                handleI2CMessage(msg);
+                break;
+
+            // Response: Number of attached I2C peripheral instances
+            case I2C_GET_PERIPH_COUNT:
+                msg.data[0] = static_cast<uint8_t>(m_i2c_count);
+                msg.len = 1;
+                break;
+
+            case SPI_GET_INFO:
+            case SPI_SET_READ_BUFFER:
+            case SPI_GET_WRITE_BUFFER:
+            case SPI_GET_STATUS:
+            case SPI_RESET:
+                handleSPIMessage(msg);
+                break;
+
+            case CONSOLE_GET_STATUS:
+            case CONSOLE_SET_PROMPT:
+            case CONSOLE_I2C_READ_MEM:
+            case CONSOLE_READ_RESULTS:
+            case CONSOLE_ABORT:
+            case CONSOLE_MD_READ_MEM:
+                handleConsoleMessage(msg);
+                break;
+
+            default:
+                msg.len = 1;
+                msg.data[0] = Error::INVALID_CMD;
+        }
+
+        // Handler time excludes transmission of the response
+        Stats::recordCommand(msg.cmd, Stats::timestamp() - start);
+
+        // Request flags and tag are retained, such that a tagged
+        // request yields a tagged response.
+        m_comm.sendResponse(msg);
+    }
+
+    void Companion::handleI2CMessage(Communicator::msg &msg)
+    {
+        if (msg.periph >= m_i2c_count) {
+            msg.data[0] = Error::NOT_SUPPORTED;
+            msg.len = 1;
+            return;
+        }
+
+        I2CPeriph &i2c = m_i2c[msg.periph];
+
+        switch (msg.cmd) {
+            case I2C_GET_ADDR:
+                msg.data[0] = i2c.getAddress();
+                msg.len = 1;
+                break;
+
+            case I2C_SET_ADDR:
+                if (msg.len != 1 || msg.data[0] > 0x7f) {
+                    msg.data[0] = Error::INVALID_PARAM;
                 } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
-                    msg.len = 1;
+                    i2c.setAddress(msg.data[0]);
+                    msg.data[0] = SUCCESS;
                 }
+                msg.len = 1;
+                break;
+
+            case I2C_GET_SPEED: {
+                const uint32_t speed = i2c.getSpeed();
+                msg.data[0] = speed         & 0xff;
+                msg.data[1] = (speed >> 8)  & 0xff;
+                msg.data[2] = (speed >> 16) & 0xff;
+                msg.data[3] = (speed >> 24) & 0xff;
+                msg.len = 4;
                 break;
+            }
 
             case I2C_SET_SPEED:
                 if (msg.len != 4 || msg.data[0] == 0) {
                     msg.data[0] = Error::INVALID_PARAM;
-                } else if (m_i2c.attached()) {
+                } else {
                     const uint32_t speed = msg.data[0]        |
                                           (msg.data[1] << 8)  |
                                           (msg.data[2] << 16) |
                                           (msg.data[3] << 24);
 
-                    m_i2c.setSpeed(speed);
+                    i2c.setSpeed(speed);
                     msg.data[0] = Error::SUCCESS;
-                } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
                 }
                 msg.len = 1;
                 break;
 
             case I2C_GET_SUBADDR_LEN:
-                if (m_i2c.attached()) {
-                    msg.data[0] = m_i2c.getSubAddressLength();
-                } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
-                }
+                msg.data[0] = i2c.getSubAddressLength();
                 msg.len = 1;
                 break;
 
             case I2C_SET_SUBADDR_LEN:
-                if (m_i2c.attached()) {
-                    m_i2c.setSubAddressLength(msg.data[0]);
-                    msg.data[0] = Error::SUCCESS;
+                if (msg.len != 1) {
+                    msg.data[0] = Error::INVALID_PARAM;
                 } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
+                    i2c.setSubAddressLength(msg.data[0]);
+                    msg.data[0] = Error::SUCCESS;
                 }
                 msg.len = 1;
                 break;
@@ -163,30 +367,253 @@ namespace Depthcharge {
             case I2C_SET_READ_BUFFER:
                 if (msg.len < 1) {
                     msg.data[0] = Error::INVALID_PARAM;
-                } else if (m_i2c.attached()) {
-                    m_i2c.setReadBuffer(msg.data, msg.len);
-                    msg.data[0] = SUCCESS;
                 } else {
-                    msg.data[0] = Error::NOT_SUPPORTED;
+                    i2c.setReadBuffer(msg.data, msg.len);
+                    msg.data[0] = SUCCESS;
                 }
                 msg.len = 1;
                 break;
 
             case I2C_GET_WRITE_BUFFER:
-                if (m_i2c.attached()) {
-                    msg.len = m_i2c.getWriteBuffer(msg.data, sizeof(msg.data));
+                msg.len = i2c.getWriteBuffer(msg.data, m_comm.maxPayload());
+                break;
+
+            // Response: 1-byte DrainFlags, followed by zero or more
+            //           [1-byte length][data] transaction records.
+            case I2C_DRAIN_WRITE_QUEUE: {
+                uint8_t flags;
+                size_t n = i2c.drainWriteQueue(&msg.data[1],
+                                               m_comm.maxPayload() - 1,
+                                               flags);
+                msg.data[0] = flags;
+                msg.len = 1 + n;
+                break;
+            }
+
+            case I2C_GET_BUFFER_SIZE:
+                msg.data[0] = I2CPeriph::BUFFER_SIZE & 0xff;
+                msg.data[1] = (I2CPeriph::BUFFER_SIZE >> 8) & 0xff;
+                msg.len = 2;
+                break;
+
+            // Request:  1-byte ReadQueueFlags, followed by zero or more
+            //           [1-byte length][data] read buffer records.
+            //
+            // Response: 1-byte SUCCESS or error code, followed by the
+            //           remaining queue space as a LE16 value.
+            //
+            // Records are queued all-or-nothing.
+            case I2C_QUEUE_READ_BUFFERS: {
+                uint8_t status = (msg.len >= 1) ? Error::SUCCESS :
+                                                  Error::INVALID_PARAM;
+                size_t required = 0;
+                size_t i;
+
+                // Validate all records before queueing any of them
+                for (i = 1; status == Error::SUCCESS && i < msg.len; ) {
+                    const size_t rec_len = msg.data[i];
+                    if (rec_len > I2CPeriph::BUFFER_SIZE ||
+                        (i + 1 + rec_len) > msg.len) {
+                        status = Error::INVALID_PARAM;
+                    }
+
+                    required += 1 + rec_len;
+                    i += 1 + rec_len;
+                }
+
+                if (status == Error::SUCCESS) {
+                    if (msg.data[0] & I2CPeriph::READ_QUEUE_CLEAR) {
+                        i2c.clearReadQueue();
+                    }
+
+                    if (required > i2c.readQueueSpace()) {
+                        status = Error::QUEUE_FULL;
+                    }
+                }
+
+                for (i = 1; status == Error::SUCCESS && i < msg.len; ) {
+                    const size_t rec_len = msg.data[i];
+                    i2c.queueReadBuffer(&msg.data[i + 1], rec_len);
+                    i += 1 + rec_len;
+                }
+
+                size_t space = i2c.readQueueSpace();
+                if (space > 0xffff) {
+                    space = 0xffff;
+                }
+
+                msg.data[0] = status;
+                msg.data[1] = space & 0xff;
+                msg.data[2] = (space >> 8) & 0xff;
+                msg.len = 3;
+                break;
+            }
+        }
+    }
+
+#if DEPTHCHARGE_ENABLE_CONSOLE
+    void Companion::handleConsoleMessage(Communicator::msg &msg)
+    {
+        if (!m_console.attached()) {
+            msg.data[0] = Error::NOT_SUPPORTED;
+            msg.len = 1;
+            return;
+        }
+
+        switch (msg.cmd) {
+            // Response: [State][Reason][StatusFlags]
+            case CONSOLE_GET_STATUS:
+                msg.data[0] = m_console.state();
+                msg.data[1] = m_console.reason();
+                msg.data[2] = m_console.statusFlags();
+                msg.len = 3;
+                break;
+
+            case CONSOLE_SET_PROMPT:
+                if (m_console.setPrompt(msg.data, msg.len)) {
+                    msg.data[0] = Error::SUCCESS;
                 } else {
-                    msg.len = 1;
+                    msg.data[0] = Error::INVALID_PARAM;
+                }
+                msg.len = 1;
+                break;
+
+            // Request: [Address LE64][Size LE32][Chunk size]
+            case CONSOLE_I2C_READ_MEM: {
+                if (msg.periph >= m_i2c_count) {
                     msg.data[0] = Error::NOT_SUPPORTED;
+                } else if (msg.len != 13) {
+                    msg.data[0] = Error::INVALID_PARAM;
+                } else {
+                    const uint64_t addr = readLE(&msg.data[0], 8);
+                    const uint32_t size = readLE(&msg.data[8], 4);
+
+                    if (m_console.startI2CRead(m_i2c[msg.periph], addr, size, msg.data[12])) {
+                        msg.data[0] = Error::SUCCESS;
+                    } else {
+                        msg.data[0] = Error::INVALID_PARAM;
+                    }
                 }
+                msg.len = 1;
                 break;
+            }
 
-            default:
+            // Request: [Address LE64][Size LE32][Word size][Flags]
+            //  Flag bit 0: Target is big endian
+            case CONSOLE_MD_READ_MEM: {
+                if (msg.len != 14) {
+                    msg.data[0] = Error::INVALID_PARAM;
+                } else {
+                    const uint64_t addr = readLE(&msg.data[0], 8);
+                    const uint32_t size = readLE(&msg.data[8], 4);
+                    const bool big_endian = (msg.data[13] & (1 << 0)) != 0;
+
+                    if (m_console.startMdRead(addr, size, msg.data[12], big_endian)) {
+                        msg.data[0] = Error::SUCCESS;
+                    } else {
+                        msg.data[0] = Error::INVALID_PARAM;
+                    }
+                }
                 msg.len = 1;
-                msg.data[0] = Error::INVALID_CMD;
+                break;
+            }
+
+            // Response: [State][Reason][DrainFlags], followed by zero or
+            //           more [1-byte length][data] result records.
+            case CONSOLE_READ_RESULTS: {
+                uint8_t flags;
+                size_t n = m_console.drainOutput(&msg.data[3],
+                                                 m_comm.maxPayload() - 3,
+                                                 flags);
+                msg.data[0] = m_console.state();
+                msg.data[1] = m_console.reason();
+                msg.data[2] = flags;
+                msg.len = 3 + n;
+                break;
+            }
+
+            case CONSOLE_ABORT:
+                m_console.abort();
+                msg.data[0] = Error::SUCCESS;
+                msg.len = 1;
+                break;
+        }
+    }
+#else
+    void Companion::handleConsoleMessage(Communicator::msg &msg)
+    {
+        msg.data[0] = Error::NOT_SUPPORTED;
+        msg.len = 1;
+    }
+#endif
+
+    void Companion::handleSPIMessage(Communicator::msg &msg)
+    {
+        if (!m_spi.attached()) {
+            msg.data[0] = Error::NOT_SUPPORTED;
+            msg.len = 1;
+            return;
         }
 
-        m_comm.sendResponse(msg);
+        switch (msg.cmd) {
+            // Response: [JEDEC ID x3][SPI mode][Buffer size LE32]
+            case SPI_GET_INFO:
+                memcpy(msg.data, SPIPeriph::JEDEC_ID, sizeof(SPIPeriph::JEDEC_ID));
+                msg.data[3] = SPIPeriph::MODE;
+                for (int i = 0; i < 4; i++) {
+                    msg.data[4 + i] = (SPIPeriph::BUFFER_SIZE >> (8 * i)) & 0xff;
+                }
+                msg.len = 8;
+                break;
+
+            // Request: [Offset LE32][Data]
+            case SPI_SET_READ_BUFFER:
+                if (msg.len >= 4 &&
+                    m_spi.setReadBuffer(readLE(msg.data, 4), &msg.data[4], msg.len - 4)) {
+                    msg.data[0] = Error::SUCCESS;
+                } else {
+                    msg.data[0] = Error::INVALID_PARAM;
+                }
+                msg.len = 1;
+                break;
+
+            // Request:  [Offset LE32][Length LE16]
+            // Response: [Data]
+            case SPI_GET_WRITE_BUFFER: {
+                const uint32_t offset = readLE(msg.data, 4);
+                const size_t len = readLE(&msg.data[4], 2);
+
+                if (msg.len == 6 && len <= m_comm.maxPayload() &&
+                    m_spi.getWriteBuffer(offset, msg.data, len)) {
+                    msg.len = len;
+                } else {
+                    msg.data[0] = Error::INVALID_PARAM;
+                    msg.len = 1;
+                }
+                break;
+            }
+
+            // Response: [StatusFlags][Bytes programmed LE32][Bytes read LE32]
+            case SPI_GET_STATUS: {
+                uint8_t flags;
+                uint32_t programmed, read;
+
+                m_spi.getStatus(flags, programmed, read);
+                msg.data[0] = flags;
+                for (int i = 0; i < 4; i++) {
+                    msg.data[1 + i] = (programmed >> (8 * i)) & 0xff;
+                    msg.data[5 + i] = (read >> (8 * i)) & 0xff;
+                }
+                msg.len = 9;
+                break;
+            }
+
+            case SPI_RESET:
+                m_spi.reset();
+                msg.data[0] = Error::SUCCESS;
+                msg.len = 1;
+                break;
+        }
     }
 
     void Companion::panicLoop()
@@ -5,14 +5,19 @@
 
 #include <Arduino.h>
 
+#include "Board.h"
 #include "Communicator.h"
 #include "LED.h"
 #include "I2CPeriph.h"
+#include "SPIPeriph.h"
+#include "TargetConsole.h"
+#include "Stats.h"
 
 namespace Depthcharge {
 
     enum Error {
         SUCCESS         = 0x00, // Operation was successful, without error
+        QUEUE_FULL      = 0xfa, // Insufficient space in a firmware queue
         UNIMPLEMENTED   = 0xfb, // Functionality stubbed, but not implemented
         UNINITIALIZED   = 0xfc, // Attempt to use uninitialized functionality
         INVALID_PARAM   = 0xfd, // Invalid parameter in request
@@ -30,8 +35,14 @@ namespace Depthcharge {
             enum Command {
                 FW_GET_VERSION          = 0x00,
                 FW_GET_CAPABILITIES     = 0x01,
+                FW_SET_PROTOCOL         = 0x02,
+                FW_GET_PROTOCOL         = 0x03,
+                FW_GET_STATS            = 0x04,
+                FW_RESET_STATS          = 0x05,
 
-                // 0x02 - 0x07 reserved for future device-level settings
+                // Host link benchmarking. See CAP_LOOPBACK.
+                FW_LOOPBACK             = 0x06,
+                FW_SINK                 = 0x07,
 
                 I2C_GET_ADDR            = 0x08,
                 I2C_SET_ADDR            = 0x09,
@@ -43,8 +54,31 @@ namespace Depthcharge {
                 I2C_SET_MODE_FLAGS      = 0x0f, // TODO: Not implemented
                 I2C_SET_READ_BUFFER     = 0x10,
                 I2C_GET_WRITE_BUFFER    = 0x11,
+                I2C_DRAIN_WRITE_QUEUE   = 0x12,
+                I2C_GET_BUFFER_SIZE     = 0x13,
+                I2C_QUEUE_READ_BUFFERS  = 0x14,
+                I2C_GET_PERIPH_COUNT    = 0x15,
 
-                // 0x20 - 0x2f reserved for SPI peripheral device operation
+                // 0x16 - 0x1f reserved for I2C peripheral device operation
+
+                // SPI peripheral device operation. See SPIPeriph.h.
+                SPI_GET_INFO            = 0x20,
+                SPI_SET_READ_BUFFER     = 0x21,
+                SPI_GET_WRITE_BUFFER    = 0x22,
+                SPI_GET_STATUS          = 0x23,
+                SPI_RESET               = 0x24,
+
+                // 0x25 - 0x2f reserved for SPI peripheral device operation
+
+                // Target console bridge and on-device console operations
+                CONSOLE_GET_STATUS      = 0x30,
+                CONSOLE_SET_PROMPT      = 0x31,
+                CONSOLE_I2C_READ_MEM    = 0x32,
+                CONSOLE_READ_RESULTS    = 0x33,
+                CONSOLE_ABORT           = 0x34,
+                CONSOLE_MD_READ_MEM     = 0x35,
+
+                // 0x36 - 0x3f reserved for future console operations
 
                 // 0x60 - 0x7f reserved for device-level setting blowout
 
@@ -61,7 +95,25 @@ namespace Depthcharge {
 
             enum FirmwareCapabilities {
                 CAP_I2C_PERIPH      = (1 << 0),
-                CAP_SPI_PERIPH      = (1 << 1),  // Reserved
+                CAP_SPI_PERIPH      = (1 << 1),  // See SPIPeriph.h
+                CAP_I2C_WRITE_QUEUE = (1 << 2),
+                CAP_I2C_LARGE_XFER  = (1 << 3),  // See I2C_GET_BUFFER_SIZE
+                CAP_FRAMING_V2      = (1 << 4),  // See Communicator.h
+                CAP_TAGGED_REQUESTS = (1 << 5),  // See Communicator.h
+                CAP_I2C_READ_QUEUE  = (1 << 6),  // See I2C_QUEUE_READ_BUFFERS
+                CAP_TARGET_CONSOLE  = (1 << 7),  // See TargetConsole.h
+                CAP_I2C_MULTI       = (1 << 8),  // See I2C_GET_PERIPH_COUNT
+                CAP_LOOPBACK        = (1 << 9),  // See FW_LOOPBACK, FW_SINK
+                CAP_BOARD_CONFIG    = (1 << 10), // See FW_GET_CAPABILITIES
+            };
+
+            /*
+             * Flags in the board configuration reported by
+             * FW_GET_CAPABILITIES. See Board.h.
+             */
+            enum BoardFlags {
+                BOARD_I2C_SHARED_BUFFER = (1 << 0),
+                BOARD_LARGE_RAM         = (1 << 1),
             };
 
             /* Platform implementations (in ino's) should try to use these
@@ -85,7 +137,26 @@ namespace Depthcharge {
             void attachLED(unsigned int pin,
                            unsigned int on_state, unsigned int off_state);
 
-            void attachI2C(::TwoWire *bus, uint8_t addr, uint32_t speed);
+            /*
+             * Operate as a peripheral device on the specified I2C bus. This
+             * may be called for up to I2CPeriph::MAX_INSTANCES different
+             * buses. The host selects which one a request applies to, in
+             * order of attachment, via Communicator::FLAG_PERIPH_MASK.
+             */
+            void attachI2C(I2CBus *bus, uint8_t addr, uint32_t speed);
+
+            /*
+             * Operate as a SPI flash device, if supported on this platform.
+             * Refer to SPIPeriph.h for pin assignments.
+             */
+            void attachSPI();
+
+            /*
+             * Attach the UART connected to the target's console. If `bridge`
+             * is non-NULL, console traffic is relayed to and from it while
+             * no on-device console operation is running.
+             */
+            void attachTargetConsole(::Stream *target, ::Stream *bridge);
 
             /*
              * TODO
@@ -94,14 +165,25 @@ namespace Depthcharge {
 
         private:
             void handleHostMessage(Communicator::msg &msg);
+            void handleI2CMessage(Communicator::msg &msg);
+            void handleConsoleMessage(Communicator::msg &msg);
+            void handleSPIMessage(Communicator::msg &msg);
             void panicLoop();
 
             static void _handleI2CRead(int n);
 
+            // Capabilities, followed by the board configuration
+            static const size_t CAPS_RESP_SIZE = 27;
+
             uint32_t m_caps;
 
             Communicator m_comm; // Host interface
-            I2CPeriph m_i2c;      // Operate as I2C peripheral device
+            I2CPeriph m_i2c[I2CPeriph::MAX_INSTANCES]; // I2C peripheral devices
+            size_t m_i2c_count;
+            SPIPeriph m_spi;      // Operate as SPI flash device
             LED m_led;           // Blinks panic status
+#if DEPTHCHARGE_ENABLE_CONSOLE
+            TargetConsole m_console; // Target UART; bridged to host when idle
+#endif
     };
 };
@@ -3,35 +3,51 @@
 
 #include "I2CPeriph.h"
 #include "Panic.h"
+#include "Stats.h"
 
 #define SET_PANIC_REASON() \
     do { Panic::setReason(Panic::Source::I2CPeriph , __LINE__); } while (0)
 
 namespace Depthcharge {
 
-    I2CPeriph::I2CPeriph() { };
+    I2CPeriph::I2CPeriph() :
+        m_i2c(NULL), m_addr(0), m_speed(0), m_slot(0),
+        m_rcount(0), m_wcount(0), m_wqueue_overflow(false), m_subaddr_len(1)
+    {
+    };
 
-    void I2CPeriph::attach(::TwoWire *bus, uint8_t addr, uint32_t speed)
+    void I2CPeriph::attach(I2CBus *bus, uint8_t addr, uint32_t speed)
     {
+        bool bus_in_use = false;
+        for (size_t i = 0; i < s_count; i++) {
+            bus_in_use |= (s_instances[i]->m_i2c == bus);
+        }
 
-        if (m_i2c) {
-            /* This class does not currently support multiple buses, so induce
-             * an error as early as possible. See the header file for more
-             * information about what needs to change, if you require support
-             * for multiple I2C buses. */
+        if (m_i2c || bus_in_use || s_count >= MAX_INSTANCES) {
+            /* Each instance requires its own bus and a callback slot, so
+             * induce an error as early as possible. Increase
+             * DEPTHCHARGE_I2C_MAX_PERIPHS to use additional buses. */
             SET_PANIC_REASON();
             return;
         }
 
+        m_slot = s_count;
+        s_instances[s_count++] = this;
+
         m_i2c  = bus;
         m_addr = addr;
 
-        memset(m_rbuf, 0, sizeof(m_rbuf));
+        memset(m_rbuf, 0, BUFFER_SIZE);
         m_rcount = 0;
 
-        memset(m_wbuf, 0, sizeof(m_wbuf));
+        memset(m_wbuf, 0, BUFFER_SIZE);
         m_wcount = 0;
 
+        m_wqueue.clear();
+        m_wqueue_overflow = false;
+
+        m_rqueue.clear();
+
         // setAddress invokes begin() because I see no other API-exposed
         // method for changing an I2C peripheral address at runtime. This
         // must be called prior to setSpeed(). Doing otherwise will hang the
@@ -49,8 +65,8 @@ namespace Depthcharge {
     {
         if (m_i2c) {
             m_i2c->begin(addr);
-            m_i2c->onReceive(_handle_write);
-            m_i2c->onRequest(_handle_read);
+            m_i2c->onReceive(s_write_handlers[m_slot]);
+            m_i2c->onRequest(s_read_handlers[m_slot]);
         }
     }
 
@@ -106,32 +122,143 @@ namespace Depthcharge {
 
         memcpy(buf, m_wbuf, ret);
 
+        // A host using this legacy request is not draining the write queue,
+        // so don't let it fill up with stale transactions.
+        m_wqueue.clear();
+        m_wqueue_overflow = false;
+
         interrupts();
         return ret;
     }
 
+    size_t I2CPeriph::drainWriteQueue(uint8_t *buf, size_t max_len,
+                                      uint8_t &flags)
+    {
+        size_t used = 0;
+        int len;
+
+        flags = 0;
+
+        while ((len = m_wqueue.peekLength()) >= 0) {
+            if ((used + 1 + len) > max_len) {
+                if (used == 0) {
+                    // This record can never fit in `buf`. Drop it and
+                    // let the host know, rather than stalling the queue.
+                    m_wqueue.pop(buf, 0);
+                    flags |= DRAIN_OVERFLOW;
+                    continue;
+                }
+
+                flags |= DRAIN_MORE;
+                break;
+            }
+
+            buf[used] = static_cast<uint8_t>(len);
+            m_wqueue.pop(&buf[used + 1], len);
+            used += 1 + len;
+        }
+
+        noInterrupts();
+        if (m_wqueue_overflow) {
+            flags |= DRAIN_OVERFLOW;
+            m_wqueue_overflow = false;
+        }
+        interrupts();
+
+        return used;
+    }
+
+    int I2CPeriph::popWriteTransaction(uint8_t *buf, size_t max_len,
+                                       bool &overflow)
+    {
+        const int ret = m_wqueue.pop(buf, max_len);
+
+        noInterrupts();
+        overflow = m_wqueue_overflow;
+        m_wqueue_overflow = false;
+        interrupts();
+
+        return ret;
+    }
+
+    void I2CPeriph::clearWriteQueue()
+    {
+        m_wqueue.clear();
+
+        noInterrupts();
+        m_wqueue_overflow = false;
+        interrupts();
+    }
+
     // Fill data buffer for bus controller to read
     void I2CPeriph::setReadBuffer(uint8_t *buf, size_t len)
     {
         noInterrupts();
 
-        if (len > sizeof(m_rbuf)) {
-            len = sizeof(m_rbuf);
+        if (len > BUFFER_SIZE) {
+            len = BUFFER_SIZE;
         }
 
         memcpy(m_rbuf, buf, len);
         m_rcount = static_cast<uint32_t>(len);
 
+        if (Board::I2C_SHARED_BUFFER) {
+            m_wcount = 0;
+        }
+
+        // Otherwise, a staged buffer would replace this one upon the next read
+        m_rqueue.clear();
+
         interrupts();
     }
 
+    bool I2CPeriph::queueReadBuffer(const uint8_t *buf, size_t len)
+    {
+        if (len > BUFFER_SIZE || !m_rqueue.beginRecord(len)) {
+            return false;
+        }
+
+        m_rqueue.putBytes(buf, len);
+        m_rqueue.commitRecord();
+        return true;
+    }
+
+    void I2CPeriph::clearReadQueue()
+    {
+        // clear() is a consumer operation, so keep the ISR out of the way
+        noInterrupts();
+        m_rqueue.clear();
+        interrupts();
+    }
+
+    size_t I2CPeriph::readQueueSpace()
+    {
+        return m_rqueue.space();
+    }
+
+    template <size_t N>
+    void I2CPeriph::_handle_write(I2CRecvCount count)
+    {
+        s_instances[N]->handleWrite(count);
+    }
+
+    template <size_t N>
+    void I2CPeriph::_handle_read()
+    {
+        s_instances[N]->handleRead();
+    }
+
     // ISR callback: Handle controller's write to our buffer
-    void I2CPeriph::_handle_write(int count)
+    void I2CPeriph::handleWrite(I2CRecvCount n)
     {
+        // I2CRecvCount is unsigned for some backends
+        const long count = static_cast<long>(n);
+        const uint32_t start = Stats::timestamp();
+
         if (count < 0) {
             SET_PANIC_REASON();
             return;
-        } else if (static_cast<size_t>(count) > sizeof(m_wbuf)) {
+        } else if (static_cast<size_t>(count) > BUFFER_SIZE) {
             /* The Kinetis I2C driver appears to disallow this, but let's not
              * make assumptions.
              *
@@ -143,38 +270,92 @@ namespace Depthcharge {
              * Ingest some data so it's present for debugging, but otherwise
              * prepare to panic.
              */
+            Stats::counters.i2c_oversize++;
             SET_PANIC_REASON();
-            count = sizeof(m_wbuf);
         }
 
         // U-Boot wants to send a subaddress byte, so let's just toss that.
         // If you need this info setSubAddressLength(0).
-        for (size_t i = 0; i < m_subaddr_len; i++) {
+        // Note that the subaddress is included in `count`.
+        size_t avail = static_cast<size_t>(count);
+        const size_t skip = (m_subaddr_len < avail) ? m_subaddr_len : avail;
+        avail -= skip;
+
+        if (avail > BUFFER_SIZE) {
+            avail = BUFFER_SIZE;
+        }
+
+        m_wcount = avail;
+
+        // Subaddress bytes are discarded without touching m_wbuf, which
+        // may also be the current read buffer. See I2C_SHARED_BUFFER.
+        for (size_t i = 0; i < skip; i++) {
             m_i2c->read();
         }
 
-        m_wcount = static_cast<size_t>(count);
+        if (Board::I2C_SHARED_BUFFER && m_wcount != 0) {
+            m_rcount = 0;
+        }
+
+#if DEPTHCHARGE_I2C_USE_I2C_T3
+        // i2c_t3 has already buffered the entire transaction by the time
+        // we're called, so copy it out in bulk.
+        m_i2c->read(m_wbuf, m_wcount);
+#else
         for (size_t i = 0; i < m_wcount; i++) {
             m_wbuf[i] = m_i2c->read();
         }
+#endif
+
+        Stats::counters.i2c_writes++;
+        Stats::counters.i2c_write_bytes += m_wcount;
+
+        // Subaddress-only writes (e.g. preceding an "i2c read") carry no
+        // data that the host cares about, so don't queue them.
+        if (m_wcount != 0) {
+            if (m_wqueue.beginRecord(m_wcount)) {
+                m_wqueue.putBytes(m_wbuf, m_wcount);
+                m_wqueue.commitRecord();
+            } else {
+                m_wqueue_overflow = true;
+                Stats::counters.i2c_dropped++;
+            }
+        }
+
+        Stats::counters.i2c_write_time += Stats::timestamp() - start;
     }
 
     // ISR Callback: Handle controller's read from our buffer
-    void I2CPeriph::_handle_read()
+    void I2CPeriph::handleRead()
     {
+        const uint32_t start = Stats::timestamp();
+
+        const int n = m_rqueue.pop(m_rbuf, BUFFER_SIZE);
+        if (n >= 0) {
+            m_rcount = n;
+
+            if (Board::I2C_SHARED_BUFFER) {
+                m_wcount = 0;
+            }
+        }
+
         m_i2c->write(m_rbuf, m_rcount);
+
+        Stats::counters.i2c_reads++;
+        Stats::counters.i2c_read_bytes += m_rcount;
+        Stats::counters.i2c_read_time += Stats::timestamp() - start;
     }
 
     // See header file re: static class members.
-    uint8_t I2CPeriph::m_addr = 0;
-    uint32_t I2CPeriph::m_speed = 0;
-    ::TwoWire* I2CPeriph::m_i2c = NULL;
-
-    uint8_t I2CPeriph::m_rbuf[BUFFER_SIZE] = { 0 };
-    size_t  I2CPeriph::m_rcount = 0;
+    I2CPeriph* I2CPeriph::s_instances[4] = { NULL };
+    size_t I2CPeriph::s_count = 0;
 
-    uint8_t I2CPeriph::m_wbuf[BUFFER_SIZE] = { 0 };
-    size_t  I2CPeriph::m_wcount = 0;
+    // Only the first s_count entries are ever used
+    const I2CPeriph::WriteHandler I2CPeriph::s_write_handlers[4] = {
+        _handle_write<0>, _handle_write<1>, _handle_write<2>, _handle_write<3>
+    };
 
-    uint8_t I2CPeriph::m_subaddr_len = 1;
+    const I2CPeriph::ReadHandler I2CPeriph::s_read_handlers[4] = {
+        _handle_read<0>, _handle_read<1>, _handle_read<2>, _handle_read<3>
+    };
 }
@@ -3,16 +3,53 @@
 
 #pragma once
 #include <Arduino.h>
-#include <Wire.h>
+
+// Selects the I2C library used on this board
+#include "Board.h"
+
+#if DEPTHCHARGE_I2C_USE_I2C_T3
+#   include <i2c_t3.h>
+#else
+#   include <Wire.h>
+#endif
+
+#include "RingBuffer.h"
 
 namespace Depthcharge {
 
+#if DEPTHCHARGE_I2C_USE_I2C_T3
+    typedef ::i2c_t3 I2CBus;
+    typedef size_t   I2CRecvCount;
+#else
+    typedef ::TwoWire I2CBus;
+    typedef int       I2CRecvCount;
+#endif
+
+    /*
+     * Operate as a peripheral device on an I2C bus.
+     *
+     * Up to MAX_INSTANCES of these may be attached, each to a different
+     * bus. Because the underlying libraries invoke plain function pointers
+     * from interrupt context, each attached instance is assigned a slot in
+     * a static table, with a corresponding pair of callback trampolines.
+     *
+     * There is no DMA receive path. Every byte is moved by the I2C
+     * library's ISR, so the achievable bus speed is bounded by interrupt
+     * latency. Do not assume operation at 1 MHz or above is reliable.
+     */
     class I2CPeriph {
 
         public:
+            static const size_t MAX_INSTANCES = Board::I2C_MAX_PERIPHS;
+
+            static_assert(MAX_INSTANCES >= 1 && MAX_INSTANCES <= 4,
+                          "Invalid DEPTHCHARGE_I2C_MAX_PERIPHS");
+
             I2CPeriph();
 
-            void attach(::TwoWire *bus, uint8_t addr, uint32_t speed);
+            // Panics if this instance is already attached, or if
+            // MAX_INSTANCES have already been attached.
+            void attach(I2CBus *bus, uint8_t addr, uint32_t speed);
             bool attached();
 
             void setAddress(uint8_t addr);
@@ -25,30 +62,133 @@ namespace Depthcharge {
             uint32_t getSpeed();
 
             uint32_t getWriteBuffer(uint8_t *buf, size_t max_len);
+
+            /*
+             * Set the data returned by all subsequent reads.
+             * This discards any staged read buffers.
+             */
             void setReadBuffer(uint8_t *buf, size_t len);
 
-            // This seems to be an implicit limit Arduino APIs, unfortunately.
-            // Torn between hacking around it and trying to remain portable...
+            /*
+             * Stage data to be returned by a future read transaction.
+             * Each read transaction consumes the oldest staged buffer,
+             * which then remains the current read buffer until another
+             * is staged.
+             *
+             * Returns false if `len` exceeds BUFFER_SIZE or if there is
+             * insufficient space in the queue.
+             */
+            bool queueReadBuffer(const uint8_t *buf, size_t len);
+
+            // Discard all staged read buffers
+            void clearReadQueue();
+
+            // Number of bytes available for staged buffers, including
+            // the 1-byte overhead associated with each.
+            size_t readQueueSpace();
+
+            /*
+             * Flags returned by drainWriteQueue()
+             */
+            enum DrainFlags {
+                // Transactions were dropped due to a full queue since the
+                // previous drain, so the host cannot trust the sequence.
+                DRAIN_OVERFLOW  = (1 << 0),
+
+                // More transactions remain queued than fit in `buf`
+                DRAIN_MORE      = (1 << 1),
+            };
+
+            /*
+             * Flags accepted by the I2C_QUEUE_READ_BUFFERS command
+             */
+            enum ReadQueueFlags {
+                // Discard staged read buffers before queueing new ones
+                READ_QUEUE_CLEAR = (1 << 0),
+            };
+
+            /*
+             * Copy as many complete write transactions as will fit into
+             * `buf`, oldest first. Each is stored as a 1-byte length followed
+             * by the transaction data. Returns the number of bytes used
+             * and updates `flags` with DrainFlags values.
+             */
+            size_t drainWriteQueue(uint8_t *buf, size_t max_len, uint8_t &flags);
+
+            /*
+             * Remove the oldest queued write transaction, copying up to
+             * `max_len` bytes of it to `buf`. Returns the number of bytes
+             * copied or -1 if the queue is empty. Sets `overflow` if
+             * transactions have been dropped since the queue was last drained.
+             */
+            int popWriteTransaction(uint8_t *buf, size_t max_len, bool &overflow);
+
+            // Discard all queued write transactions
+            void clearWriteQueue();
+
+            /*
+             * Maximum number of bytes in a single bus transaction,
+             * including any subaddress bytes.
+             *
+             * 32 seems to be an implicit limit of the Arduino APIs. The i2c_t3
+             * library buffers 259 bytes; we cap this at 255 so that lengths
+             * still fit within a byte in Communicator messages and
+             * RingBuffer records.
+             */
+#if DEPTHCHARGE_I2C_USE_I2C_T3
+            static const size_t BUFFER_SIZE = 255;
+#else
             static const size_t BUFFER_SIZE = 32;
+#endif
+
+            // A queue must be able to hold at least one maximum-size record
+            static_assert(Board::I2C_WRITE_QUEUE_SIZE > BUFFER_SIZE &&
+                          Board::I2C_READ_QUEUE_SIZE > BUFFER_SIZE,
+                          "I2C queue size is smaller than BUFFER_SIZE");
 
         private:
-            static ::TwoWire *m_i2c;
+            I2CBus *m_i2c;
 
-            static uint8_t m_addr;      // Device address in [0x00, 0x7f]
-            static uint32_t m_speed;    // Bus speed, Hz
+            uint8_t m_addr;     // Device address in [0x00, 0x7f]
+            uint32_t m_speed;   // Bus speed, Hz
 
-            // Handle data written from the bus controller to our device buffer
-            static void _handle_write(int count);
+            /*
+             * Handle data written from the bus controller to our device buffer.
+             *
+             * i2c_t3 only supports DMA in controller mode; in peripheral mode
+             * its ISR buffers each byte. Upon the STOP condition, we copy the
+             * completed transaction out of that buffer and into our queue in
+             * bulk, keeping the time spent in this callback short.
+             */
+            void handleWrite(I2CRecvCount count);
 
             // Handle read of data from our device buffer, to the host
-            static void _handle_read();
-
-            /* We have plenty of space on the Teensy 3.6, so no
-             * reason not to simplify things by using different read/write
-             * buffers.  For more memory constrained devices, we might
-             * want to replace this with a single buffer. The host-code
-             * is in control of the target's bus controller, so in theory,
-             * we should not have to worry about concurrent accesses attempts.
+            void handleRead();
+
+            // ISR callback trampolines for the instance in slot N
+            template <size_t N> static void _handle_write(I2CRecvCount count);
+            template <size_t N> static void _handle_read();
+
+            typedef void (*WriteHandler)(I2CRecvCount);
+            typedef void (*ReadHandler)();
+
+            // These are sized for the largest supported MAX_INSTANCES value
+            static I2CPeriph *s_instances[4];
+            static size_t s_count;
+
+            static const WriteHandler s_write_handlers[4];
+            static const ReadHandler  s_read_handlers[4];
+
+            size_t m_slot;  // Index into s_instances
+
+            /* Boards with plenty of RAM use separate read and write
+             * buffers. For more memory constrained boards,
+             * Board::I2C_SHARED_BUFFER replaces these with a single buffer.
+             * The host-code is in control of the target's bus controller,
+             * so in theory, we should not have to worry about concurrent
+             * accesses attempts. However, the current read buffer does not
+             * survive a write transaction carrying data, so the host must
+             * stage another (e.g. via queueReadBuffer) following one.
              *
              * TODO: Arguably these might need to be volatile, since we're
              *       accessing them across normal and interrupt contexts.
@@ -62,13 +202,33 @@ namespace Depthcharge {
              *       are atomic, and no control flows are actively waiting
              *       for a change to occur from the other context.
              */
-            static uint8_t m_rbuf[BUFFER_SIZE];
-            static size_t  m_rcount;
+            uint8_t m_rbuf[BUFFER_SIZE];
+            size_t  m_rcount;
+
+#if DEPTHCHARGE_I2C_SHARED_BUFFER
+            uint8_t * const m_wbuf = m_rbuf;
+#else
+            uint8_t m_wbuf[BUFFER_SIZE];
+#endif
+            size_t  m_wcount;
+
+            /*
+             * Every write transaction is also queued here, so that the host
+             * can retrieve many of them in one request, rather than
+             * retrieving m_wbuf after each one. The ISR is the only producer
+             * and the main loop is the only consumer, so this does not
+             * require interrupts to be disabled.
+             */
+            RingBuffer<Board::I2C_WRITE_QUEUE_SIZE> m_wqueue;
+            volatile bool m_wqueue_overflow;
 
-            static uint8_t m_wbuf[BUFFER_SIZE];
-            static size_t  m_wcount;
+            /*
+             * Read buffers staged by the host, consumed by handleRead().
+             * Here, the main loop is the producer and the ISR is the consumer.
+             */
+            RingBuffer<Board::I2C_READ_QUEUE_SIZE> m_rqueue;
 
             // How many subaddress bytes to throw away and ignore
-            static uint8_t m_subaddr_len;
+            uint8_t m_subaddr_len;
     };
 }
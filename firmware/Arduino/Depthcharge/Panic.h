@@ -10,6 +10,7 @@ namespace Depthcharge {
             enum Source {
                 Communicator = 0x1,
                 I2CPeriph    = 0x2,
+                Companion    = 0x3,
             };
 
             static void setReason(Source source, uint16_t lineno);
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#pragma once
+#include <Arduino.h>
+
+namespace Depthcharge {
+
+    /*
+     * Lock-free, single-producer single-consumer (SPSC) queue of
+     * variable-length records, each up to 255 bytes in length.
+     *
+     * This is intended to pass data from an ISR (producer) to the main loop
+     * (consumer) without disabling interrupts. Only the producer writes
+     * m_head and only the consumer writes m_tail. Both indices free-run and
+     * are masked upon access, so N must be a power of 2.
+     *
+     * Records are stored as a 1-byte length, followed by the record data.
+     * The producer builds a record in-place via beginRecord(), put(), and
+     * commitRecord(). Nothing is visible to the consumer until the record
+     * is committed.
+     */
+    template <size_t N>
+    class RingBuffer {
+        static_assert(N >= 2 && (N & (N - 1)) == 0,
+                      "RingBuffer size must be a power of 2");
+
+        public:
+            static const size_t MAX_RECORD_SIZE = 255;
+
+            RingBuffer() : m_head(0), m_tail(0), m_wpos(0), m_wlen(0) {}
+
+            /*
+             * Producer: Begin a record that will contain at most `max_len`
+             * bytes. Returns false, with no change to the queue, if there
+             * is insufficient space for it.
+             */
+            inline bool beginRecord(size_t max_len) {
+                if (max_len > MAX_RECORD_SIZE || space() < (max_len + 1)) {
+                    return false;
+                }
+
+                m_wpos = m_head + 1;
+                m_wlen = 0;
+                return true;
+            }
+
+            // Producer: Append a byte to the record begun by beginRecord()
+            inline void put(uint8_t b) {
+                m_buf[m_wpos++ & MASK] = b;
+                m_wlen++;
+            }
+
+            /*
+             * Producer: Append `len` bytes to the record begun by
+             * beginRecord(). This is equivalent to calling put() for each
+             * byte, but copies contiguous spans of the buffer at once.
+             */
+            inline void putBytes(const uint8_t *data, size_t len) {
+                copyIn(m_wpos, data, len);
+                m_wpos += len;
+                m_wlen += len;
+            }
+
+            // Producer: Publish the current record to the consumer.
+            inline void commitRecord() {
+                m_buf[m_head & MASK] = static_cast<uint8_t>(m_wlen);
+                barrier();
+                m_head = m_wpos;
+            }
+
+            // Consumer: Is there at least one committed record?
+            inline bool empty() const {
+                return m_head == m_tail;
+            }
+
+            /*
+             * Consumer: Length of the oldest record, or -1 if the
+             * queue is empty.
+             */
+            inline int peekLength() const {
+                if (empty()) {
+                    return -1;
+                }
+
+                barrier();
+                return m_buf[m_tail & MASK];
+            }
+
+            /*
+             * Consumer: Remove the oldest record and copy up to `max_len`
+             * bytes of it into `buf`. Record data beyond `max_len` is
+             * discarded.
+             *
+             * Returns the number of bytes copied, or -1 if the queue is empty.
+             */
+            int pop(uint8_t *buf, size_t max_len) {
+                const int len = peekLength();
+                if (len < 0) {
+                    return -1;
+                }
+
+                const size_t to_copy = (static_cast<size_t>(len) < max_len) ?
+                                        len : max_len;
+
+                copyOut(buf, m_tail + 1, to_copy);
+
+                barrier();
+                m_tail = m_tail + 1 + len;
+                return static_cast<int>(to_copy);
+            }
+
+            // Consumer: Discard all committed records
+            inline void clear() {
+                barrier();
+                m_tail = m_head;
+            }
+
+            // Number of bytes currently available to the producer
+            inline size_t space() const {
+                return N - (m_head - m_tail);
+            }
+
+            static const size_t CAPACITY = N;
+
+        private:
+            static const size_t MASK = N - 1;
+
+            // Prevent record contents and index updates from being
+            // reordered with respect to each other. The targets we care
+            // about are single-core, so a compiler barrier is sufficient.
+            static inline void barrier() {
+                __asm__ __volatile__("" ::: "memory");
+            }
+
+            // Copy data to and from the buffer, starting at the free-running
+            // index `pos`, in at most two spans to account for wrapping.
+            inline void copyIn(size_t pos, const uint8_t *data, size_t len) {
+                const size_t start = pos & MASK;
+                const size_t first = (len < (N - start)) ? len : (N - start);
+
+                memcpy(&m_buf[start], data, first);
+                memcpy(m_buf, &data[first], len - first);
+            }
+
+            inline void copyOut(uint8_t *buf, size_t pos, size_t len) const {
+                const size_t start = pos & MASK;
+                const size_t first = (len < (N - start)) ? len : (N - start);
+
+                memcpy(buf, &m_buf[start], first);
+                memcpy(&buf[first], m_buf, len - first);
+            }
+
+            uint8_t m_buf[N];
+
+            volatile size_t m_head; // Written only by producer
+            volatile size_t m_tail; // Written only by consumer
+
+            // Producer-private state for the in-progress record
+            size_t m_wpos;
+            size_t m_wlen;
+    };
+}
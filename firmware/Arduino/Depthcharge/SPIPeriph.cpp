@@ -0,0 +1,411 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#include "SPIPeriph.h"
+
+static_assert((DEPTHCHARGE_SPI_BUFFER_SIZE & (DEPTHCHARGE_SPI_BUFFER_SIZE - 1)) == 0,
+              "DEPTHCHARGE_SPI_BUFFER_SIZE must be a power of two");
+
+// A single transaction's data must be countable by one DMA major loop
+static_assert(DEPTHCHARGE_SPI_BUFFER_SIZE <= 16384,
+              "DEPTHCHARGE_SPI_BUFFER_SIZE is too large");
+
+namespace Depthcharge {
+
+    const uint8_t SPIPeriph::JEDEC_ID[3] = { 0xc2, 0x20, 0x18 };
+
+    // SPI NOR flash commands we expect U-Boot to issue
+    enum FlashCommand {
+        FLASH_WRSR      = 0x01, // Write status register
+        FLASH_PP        = 0x02, // Page program
+        FLASH_READ      = 0x03,
+        FLASH_WRDI      = 0x04, // Write disable
+        FLASH_RDSR      = 0x05, // Read status register
+        FLASH_WREN      = 0x06, // Write enable
+        FLASH_FAST_READ = 0x0b, // Read, with one dummy byte
+        FLASH_RDCR      = 0x15, // Read configuration register (Macronix)
+        FLASH_SE        = 0x20, // 4 KiB sector erase
+        FLASH_BE_32K    = 0x52,
+        FLASH_RDSFDP    = 0x5a, // Read SFDP tables (we have none)
+        FLASH_CE        = 0x60, // Chip erase
+        FLASH_RSTEN     = 0x66, // Reset enable
+        FLASH_RST       = 0x99, // Reset
+        FLASH_RDID      = 0x9f, // Read JEDEC ID
+        FLASH_RES       = 0xab, // Release from deep power-down
+        FLASH_EN4B      = 0xb7, // Enter 4-byte address mode
+        FLASH_CE_ALT    = 0xc7,
+        FLASH_BE        = 0xd8, // 64 KiB block erase
+        FLASH_EX4B      = 0xe9, // Exit 4-byte address mode
+    };
+
+    SPIPeriph::SPIPeriph() { }
+
+    bool SPIPeriph::attached()
+    {
+        return m_attached;
+    }
+
+    bool SPIPeriph::setReadBuffer(uint32_t offset, const uint8_t *data, size_t len)
+    {
+        if (offset > BUFFER_SIZE || len > (BUFFER_SIZE - offset)) {
+            return false;
+        }
+
+#if DEPTHCHARGE_SPI_KINETIS
+        memcpy(&m_rbuf[offset], data, len);
+        return true;
+#else
+        (void) data;
+        return false;
+#endif
+    }
+
+    bool SPIPeriph::getWriteBuffer(uint32_t offset, uint8_t *buf, size_t len)
+    {
+        if (offset > BUFFER_SIZE || len > (BUFFER_SIZE - offset)) {
+            return false;
+        }
+
+#if DEPTHCHARGE_SPI_KINETIS
+        memcpy(buf, &m_wbuf[offset], len);
+        return true;
+#else
+        (void) buf;
+        return false;
+#endif
+    }
+
+    void SPIPeriph::getStatus(uint8_t &flags, uint32_t &programmed, uint32_t &read)
+    {
+        noInterrupts();
+        flags      = m_flags;
+        programmed = m_programmed;
+        read       = m_read;
+        interrupts();
+    }
+
+    void SPIPeriph::reset()
+    {
+        noInterrupts();
+        m_flags      = 0;
+        m_programmed = 0;
+        m_read       = 0;
+#if DEPTHCHARGE_SPI_KINETIS
+        m_expected   = 0;
+#endif
+        interrupts();
+    }
+
+#if DEPTHCHARGE_SPI_KINETIS
+
+    // Upper bound on the DMA major loop count, without channel linking
+    static const uint16_t DMA_MAX_COUNT = 32767;
+
+    bool SPIPeriph::attach()
+    {
+        if (m_attached) {
+            return true;
+        }
+
+        SIM_SCGC6 |= SIM_SCGC6_SPI0;
+
+        SPI0_MCR = SPI_MCR_HALT | SPI_MCR_CLR_TXF | SPI_MCR_CLR_RXF;
+
+        uint32_t ctar = SPI_CTAR_FMSZ(7);
+        if (MODE & 0x2) {
+            ctar |= SPI_CTAR_CPOL;
+        }
+        if (MODE & 0x1) {
+            ctar |= SPI_CTAR_CPHA;
+        }
+        SPI0_CTAR0_SLAVE = ctar;
+
+        SPI0_RSER = SPI_RSER_RFDF_RE;
+        SPI0_SR = SPI_SR_TCF | SPI_SR_EOQF | SPI_SR_TFUF |
+                  SPI_SR_TFFF | SPI_SR_RFOF | SPI_SR_RFDF;
+
+        // Slave mode (MSTR = 0), running
+        SPI0_MCR = 0;
+
+        CORE_PIN10_CONFIG = PORT_PCR_MUX(2);                // PCS0
+        CORE_PIN11_CONFIG = PORT_PCR_MUX(2) | PORT_PCR_DSE; // SOUT
+        CORE_PIN12_CONFIG = PORT_PCR_MUX(2);                // SIN
+        CORE_PIN14_CONFIG = PORT_PCR_MUX(2);                // SCK (alt)
+
+        m_phase = PHASE_COMMAND;
+        m_count = 0;
+        preload();
+
+        // Transaction completion must not be preempted by, nor preempt,
+        // handling of the next transaction's bytes.
+        attachInterruptVector(IRQ_SPI0, _handle_spi);
+        NVIC_SET_PRIORITY(IRQ_SPI0, 16);
+        NVIC_SET_PRIORITY(IRQ_PORTC, 16);
+        NVIC_ENABLE_IRQ(IRQ_SPI0);
+
+        // The pin interrupt remains functional while muxed to the DSPI
+        attachInterrupt(10, _handle_cs, RISING);
+
+        m_attached = true;
+        return true;
+    }
+
+    inline void SPIPeriph::push(uint8_t b)
+    {
+        SPI0_PUSHR_SLAVE = b;
+    }
+
+    // Queue the bytes shifted out during the first two frames of the next
+    // transaction, before we know what its command is.
+    void SPIPeriph::preload()
+    {
+        push(0xff);
+        push(JEDEC_ID[0]);
+    }
+
+    // ISR callback: Handle the command and address phases
+    void SPIPeriph::_handle_spi()
+    {
+        while ((SPI0_SR & SPI_SR_RXCTR) != 0 && m_phase != PHASE_DMA) {
+            handleByte(SPI0_POPR);
+        }
+
+        SPI0_SR = SPI_SR_RFDF;
+    }
+
+    /*
+     * Handle the byte received in frame `n`, and queue the byte that will
+     * be shifted out during frame `n + 2`.
+     */
+    void SPIPeriph::handleByte(uint8_t b)
+    {
+        const uint8_t n = m_count;
+        uint8_t next = 0x00;
+
+        if (m_count < 0xff) {
+            m_count++;
+        }
+
+        switch (m_phase) {
+            case PHASE_COMMAND:
+                m_cmd = b;
+                m_addr = 0;
+
+                switch (m_cmd) {
+                    case FLASH_RDID:
+                        m_flags |= STATUS_PROBED;
+                        next = JEDEC_ID[1];
+                        m_phase = PHASE_IGNORE;
+                        break;
+
+                    case FLASH_PP:
+                    case FLASH_READ:
+                    case FLASH_FAST_READ:
+                        next = 0xff;
+                        m_phase = PHASE_ADDRESS;
+                        break;
+
+                    case FLASH_WRSR:
+                    case FLASH_WRDI:
+                    case FLASH_RDSR:
+                    case FLASH_WREN:
+                    case FLASH_RDCR:
+                    case FLASH_SE:
+                    case FLASH_BE_32K:
+                    case FLASH_RDSFDP:
+                    case FLASH_CE:
+                    case FLASH_RSTEN:
+                    case FLASH_RST:
+                    case FLASH_RES:
+                    case FLASH_EN4B:
+                    case FLASH_CE_ALT:
+                    case FLASH_BE:
+                    case FLASH_EX4B:
+                        // Status reads yield 0x00: Ready, not write protected
+                        m_phase = PHASE_IGNORE;
+                        break;
+
+                    default:
+                        m_flags |= STATUS_UNSUPPORTED_CMD;
+                        m_phase = PHASE_IGNORE;
+                        break;
+                }
+                break;
+
+            case PHASE_ADDRESS:
+                m_addr = (m_addr << 8) | b;
+
+                if (n == 2 && m_cmd == FLASH_READ) {
+                    // Frame 4 is the first data byte. See header.
+                    next = m_rbuf[m_expected];
+                } else if (n == 3) {
+                    startDataPhase();
+                    return;
+                } else {
+                    next = 0xff;
+                }
+                break;
+
+            case PHASE_IGNORE:
+                if (m_cmd == FLASH_RDID && (size_t) (n + 1) < sizeof(JEDEC_ID)) {
+                    next = JEDEC_ID[n + 1];
+                }
+                break;
+
+            case PHASE_DMA:
+                // Not reachable; remaining bytes are left to DMA
+                return;
+        }
+
+        push(next);
+    }
+
+    // Called upon receipt of the final address byte (frame 3)
+    void SPIPeriph::startDataPhase()
+    {
+        const uint32_t offset = m_addr & (BUFFER_SIZE - 1);
+        uint32_t tx_start;
+
+        // Every byte received from here on is counted (or stored) by the
+        // RX channel, such that we know how much data was transferred.
+        m_rx_dma.source(*(volatile uint8_t *) &SPI0_POPR);
+        m_rx_dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SPI0_RX);
+        m_rx_dma.disableOnCompletion();
+
+        if (m_cmd == FLASH_PP) {
+            m_rx_dma.destinationCircular(m_wbuf, BUFFER_SIZE);
+            m_rx_dma.TCD->DADDR = &m_wbuf[offset];
+            m_rx_dma.transferCount(DMA_MAX_COUNT);
+            m_rx_dma.enable();
+
+            m_phase = PHASE_DMA;
+            SPI0_RSER = SPI_RSER_RFDF_RE | SPI_RSER_RFDF_DIRS;
+            return;
+        }
+
+        // READ:      Frame 4 was queued earlier. Queue frame 5 now.
+        // FAST_READ: Frame 4 is a dummy byte. Queue frame 5 now.
+        if (m_cmd == FLASH_READ) {
+            if (offset != m_expected) {
+                m_flags |= STATUS_READ_MISMATCH;
+            }
+
+            push(m_rbuf[(offset + 1) & (BUFFER_SIZE - 1)]);
+            tx_start = offset + 2;
+        } else {
+            push(m_rbuf[offset]);
+            tx_start = offset + 1;
+        }
+
+        m_rx_dma.destination(m_dummy);
+        m_rx_dma.transferCount(DMA_MAX_COUNT);
+        m_rx_dma.enable();
+
+        m_tx_dma.sourceCircular(m_rbuf, BUFFER_SIZE);
+        m_tx_dma.TCD->SADDR = &m_rbuf[tx_start & (BUFFER_SIZE - 1)];
+        m_tx_dma.destination(*(volatile uint8_t *) &SPI0_PUSHR_SLAVE);
+        m_tx_dma.transferCount(DMA_MAX_COUNT);
+        m_tx_dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SPI0_TX);
+        m_tx_dma.disableOnCompletion();
+        m_tx_dma.enable();
+
+        m_phase = PHASE_DMA;
+        SPI0_RSER = SPI_RSER_RFDF_RE | SPI_RSER_RFDF_DIRS |
+                    SPI_RSER_TFFF_RE | SPI_RSER_TFFF_DIRS;
+    }
+
+    // Pin ISR callback: Chip select deasserted
+    void SPIPeriph::_handle_cs()
+    {
+        // Finish up anything the SPI ISR has not yet gotten to
+        while ((SPI0_SR & SPI_SR_RXCTR) != 0 && m_phase != PHASE_DMA) {
+            handleByte(SPI0_POPR);
+        }
+
+        if (m_phase == PHASE_DMA) {
+            finishTransaction();
+        }
+
+        SPI0_RSER = SPI_RSER_RFDF_RE;
+        SPI0_MCR = SPI_MCR_CLR_TXF | SPI_MCR_CLR_RXF;
+        SPI0_SR = SPI_SR_TCF | SPI_SR_EOQF | SPI_SR_TFUF |
+                  SPI_SR_TFFF | SPI_SR_RFOF | SPI_SR_RFDF;
+
+        m_phase = PHASE_COMMAND;
+        m_count = 0;
+        preload();
+    }
+
+    void SPIPeriph::finishTransaction()
+    {
+        m_rx_dma.disable();
+        m_tx_dma.disable();
+
+        uint32_t n;
+        if (m_rx_dma.complete()) {
+            n = DMA_MAX_COUNT;
+        } else {
+            n = DMA_MAX_COUNT - m_rx_dma.TCD->CITER;
+        }
+
+        if (m_cmd == FLASH_PP) {
+            // Store what DMA did not get to
+            uint32_t i = (static_cast<volatile uint8_t *>(m_rx_dma.TCD->DADDR) - m_wbuf);
+
+            while ((SPI0_SR & SPI_SR_RXCTR) != 0) {
+                m_wbuf[i++ & (BUFFER_SIZE - 1)] = SPI0_POPR;
+                n++;
+            }
+
+            m_programmed += n;
+        } else {
+            while ((SPI0_SR & SPI_SR_RXCTR) != 0) {
+                (void) SPI0_POPR;
+                n++;
+            }
+
+            // Don't count FAST_READ's dummy byte
+            if (m_cmd == FLASH_FAST_READ && n > 0) {
+                n--;
+            }
+
+            m_read += n;
+            m_expected = (m_addr + n) & (BUFFER_SIZE - 1);
+        }
+
+        m_rx_dma.clearComplete();
+        m_tx_dma.clearComplete();
+    }
+
+    volatile SPIPeriph::Phase SPIPeriph::m_phase = PHASE_COMMAND;
+    uint8_t  SPIPeriph::m_cmd = 0;
+    uint8_t  SPIPeriph::m_count = 0;
+    uint32_t SPIPeriph::m_addr = 0;
+    uint32_t SPIPeriph::m_expected = 0;
+
+    DMAChannel SPIPeriph::m_tx_dma;
+    DMAChannel SPIPeriph::m_rx_dma;
+    uint8_t SPIPeriph::m_dummy = 0;
+
+#else
+
+    bool SPIPeriph::attach()
+    {
+        return false;
+    }
+
+#endif
+
+    // See header file re: static class members.
+    bool SPIPeriph::m_attached = false;
+
+    volatile uint8_t  SPIPeriph::m_flags = 0;
+    volatile uint32_t SPIPeriph::m_programmed = 0;
+    volatile uint32_t SPIPeriph::m_read = 0;
+
+#if DEPTHCHARGE_SPI_KINETIS
+    // Alignment is required for the DMA controller's circular addressing
+    uint8_t SPIPeriph::m_rbuf[BUFFER_SIZE] __attribute__((aligned(DEPTHCHARGE_SPI_BUFFER_SIZE)));
+    uint8_t SPIPeriph::m_wbuf[BUFFER_SIZE] __attribute__((aligned(DEPTHCHARGE_SPI_BUFFER_SIZE)));
+#endif
+}
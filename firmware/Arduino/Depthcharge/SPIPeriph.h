@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#pragma once
+#include <Arduino.h>
+
+#include "Board.h"
+
+/*
+ * SPI peripheral support is currently implemented for the Kinetis K-series
+ * DSPI controller used by the Teensy 3.x boards, using its SPI0 instance in
+ * slave mode, along with the eDMA controller (via Teensyduino's DMAChannel).
+ *
+ * It is omitted, along with its buffers, if DEPTHCHARGE_ENABLE_SPI is 0.
+ */
+#if DEPTHCHARGE_ENABLE_SPI
+#   define DEPTHCHARGE_SPI_KINETIS 1
+#   include <DMAChannel.h>
+#endif
+
+// SPI mode (CPOL, CPHA) that the target must use to probe the flash
+#ifndef DEPTHCHARGE_SPI_MODE
+#   define DEPTHCHARGE_SPI_MODE 3
+#endif
+
+namespace Depthcharge {
+
+    /*
+     * Operate as a SPI NOR flash device.
+     *
+     * U-Boot's `sspi` command transfers data from and to the command line,
+     * so it cannot be used to move memory contents. Instead, we present
+     * ourselves as a flash device that `sf probe` will recognize, such that:
+     *
+     *  - `sf read <memaddr> <offset> <len>` copies data we serve from our
+     *    read buffer into the target's memory (i.e. a memory write), and
+     *
+     *  - `sf write <memaddr> <offset> <len>` sends the target's memory to
+     *    us via page program commands (i.e. a memory read), which we store
+     *    in our write buffer.
+     *
+     * Flash offsets map onto each buffer modulo BUFFER_SIZE. Erase and
+     * status register writes are accepted and ignored, and we always
+     * report that we are ready.
+     *
+     * The command and address phases are handled a byte at a time in the
+     * SPI ISR. Because the DSPI controller's TX FIFO determines what we
+     * shift out a couple of frames in advance, response bytes are queued
+     * two frames ahead of the byte just received. The data phase of a read
+     * or page program is then handed off to DMA, and the transaction is
+     * completed when the chip select is deasserted.
+     *
+     * With this pipelining, FAST_READ (0x0b) data is exact. For READ (0x03),
+     * the first data byte must be queued before the address is known, so
+     * we assume that it continues from the end of the previous read (or
+     * offset 0, following reset()) and report STATUS_READ_MISMATCH if not.
+     */
+    class SPIPeriph {
+
+        public:
+            enum StatusFlags {
+                STATUS_PROBED           = (1 << 0), // JEDEC ID has been read
+                STATUS_READ_MISMATCH    = (1 << 1), // See class description
+                STATUS_UNSUPPORTED_CMD  = (1 << 2), // Unrecognized flash command
+            };
+
+            static const size_t BUFFER_SIZE = Board::SPI_BUFFER_SIZE;
+            static const uint8_t MODE = DEPTHCHARGE_SPI_MODE;
+
+            // Macronix MX25L12805 (16 MiB, 3-byte addressing), which is
+            // recognized by both the current and legacy U-Boot SPI flash code.
+            //
+            // Note that until a command is received, we shift out the
+            // manufacturer ID. It therefore doubles as a status register
+            // value and must not have bit 0 (Write In Progress) set.
+            static const uint8_t JEDEC_ID[3];
+
+            SPIPeriph();
+
+            /*
+             * Configure the SPI controller and pins. Returns false if not
+             * supported on this platform.
+             *
+             * Teensy 3.x: CS = 10, SCK = 14, SOUT = 11, SIN = 12. Note that in
+             * slave mode, SOUT (pin 11) is our MISO and SIN (pin 12) is our MOSI.
+             */
+            bool attach();
+            bool attached();
+
+            // Returns false if the specified region exceeds the buffer
+            bool setReadBuffer(uint32_t offset, const uint8_t *data, size_t len);
+            bool getWriteBuffer(uint32_t offset, uint8_t *buf, size_t len);
+
+            /*
+             * Retrieve status flags, the number of bytes received via page
+             * program commands, and the number of bytes sent in response to
+             * read commands, since the last reset().
+             */
+            void getStatus(uint8_t &flags, uint32_t &programmed, uint32_t &read);
+
+            // Clear status and counters, and reset the expected READ offset
+            void reset();
+
+        private:
+#if DEPTHCHARGE_SPI_KINETIS
+            enum Phase {
+                PHASE_COMMAND,  // Awaiting command byte
+                PHASE_ADDRESS,  // Receiving address bytes
+                PHASE_IGNORE,   // Remainder of transaction is ignored
+                PHASE_DMA,      // Data phase handled by DMA
+            };
+
+            static void _handle_spi();
+            static void _handle_cs();
+            static void handleByte(uint8_t b);
+            static void startDataPhase();
+            static void finishTransaction();
+            static void preload();
+
+            static inline void push(uint8_t b);
+
+            static volatile Phase m_phase;
+            static uint8_t  m_cmd;
+            static uint8_t  m_count;    // Bytes received during ISR phases
+            static uint32_t m_addr;
+            static uint32_t m_expected; // Expected READ offset
+
+            static DMAChannel m_tx_dma;
+            static DMAChannel m_rx_dma;
+            static uint8_t m_dummy;
+#endif
+            static bool m_attached;
+
+            static volatile uint8_t  m_flags;
+            static volatile uint32_t m_programmed;
+            static volatile uint32_t m_read;
+
+#if DEPTHCHARGE_SPI_KINETIS
+            static uint8_t m_rbuf[BUFFER_SIZE];
+            static uint8_t m_wbuf[BUFFER_SIZE];
+#endif
+    };
+}
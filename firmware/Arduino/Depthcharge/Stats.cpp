@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#include "Stats.h"
+
+namespace Depthcharge {
+
+    static size_t putLE(uint8_t *buf, uint64_t value, size_t len)
+    {
+        for (size_t i = 0; i < len; i++) {
+            buf[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+
+        return len;
+    }
+
+    void Stats::begin()
+    {
+#if defined(ARM_DWT_CYCCNT) && defined(ARM_DEMCR)
+        // Not all cores enable the cycle counter at startup
+        ARM_DEMCR |= ARM_DEMCR_TRCENA;
+        ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+#endif
+    }
+
+    uint32_t Stats::timebase()
+    {
+#if defined(ARM_DWT_CYCCNT)
+        return F_CPU;
+#else
+        return 1000000;
+#endif
+    }
+
+    void Stats::recordCommand(uint8_t cmd, uint32_t elapsed)
+    {
+        CommandStats *entry = NULL;
+
+        for (size_t i = 0; i < m_num_cmds; i++) {
+            if (m_cmds[i].cmd == cmd) {
+                entry = &m_cmds[i];
+                break;
+            }
+        }
+
+        if (entry == NULL) {
+            if (m_num_cmds == MAX_COMMANDS) {
+                return;
+            }
+
+            entry = &m_cmds[m_num_cmds++];
+            entry->cmd   = cmd;
+            entry->count = 0;
+            entry->min   = UINT32_MAX;
+            entry->max   = 0;
+            entry->total = 0;
+        }
+
+        entry->count++;
+        entry->total += elapsed;
+
+        if (elapsed < entry->min) {
+            entry->min = elapsed;
+        }
+
+        if (elapsed > entry->max) {
+            entry->max = elapsed;
+        }
+    }
+
+    void Stats::reset()
+    {
+        noInterrupts();
+        memset(&counters, 0, sizeof(counters));
+        interrupts();
+
+        m_num_cmds = 0;
+    }
+
+    size_t Stats::serialize(uint8_t *buf, size_t max_len, uint8_t first)
+    {
+        const size_t header_size = 4 + COUNTERS_SIZE + 3;
+        Counters c;
+        size_t n = 0;
+
+        if (max_len < header_size) {
+            return 0;
+        }
+
+        noInterrupts();
+        c = counters;
+        interrupts();
+
+        n += putLE(&buf[n], timebase(), 4);
+        n += putLE(&buf[n], c.loop_iterations, 4);
+        n += putLE(&buf[n], c.host_rx_bytes, 4);
+        n += putLE(&buf[n], c.host_tx_bytes, 4);
+        n += putLE(&buf[n], c.host_frame_errors, 4);
+        n += putLE(&buf[n], c.i2c_writes, 4);
+        n += putLE(&buf[n], c.i2c_write_bytes, 4);
+        n += putLE(&buf[n], c.i2c_write_time, 8);
+        n += putLE(&buf[n], c.i2c_reads, 4);
+        n += putLE(&buf[n], c.i2c_read_bytes, 4);
+        n += putLE(&buf[n], c.i2c_read_time, 8);
+        n += putLE(&buf[n], c.i2c_oversize, 4);
+        n += putLE(&buf[n], c.i2c_dropped, 4);
+
+        buf[n++] = static_cast<uint8_t>(m_num_cmds);
+        buf[n++] = first;
+
+        uint8_t *count = &buf[n++];
+        *count = 0;
+
+        for (size_t i = first; i < m_num_cmds && (n + COMMAND_SIZE) <= max_len; i++) {
+            buf[n++] = m_cmds[i].cmd;
+            n += putLE(&buf[n], m_cmds[i].count, 4);
+            n += putLE(&buf[n], m_cmds[i].min, 4);
+            n += putLE(&buf[n], m_cmds[i].max, 4);
+            n += putLE(&buf[n], m_cmds[i].total, 8);
+            (*count)++;
+        }
+
+        return n;
+    }
+
+    Stats::Counters Stats::counters = { };
+    Stats::CommandStats Stats::m_cmds[MAX_COMMANDS];
+    size_t Stats::m_num_cmds = 0;
+}
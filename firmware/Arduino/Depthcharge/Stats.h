@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#pragma once
+#include <Arduino.h>
+
+// Number of distinct commands for which handler timing is tracked
+#ifndef DEPTHCHARGE_STATS_MAX_COMMANDS
+#   define DEPTHCHARGE_STATS_MAX_COMMANDS 32
+#endif
+
+namespace Depthcharge {
+
+    /*
+     * Firmware instrumentation, reported to the host via FW_GET_STATS.
+     *
+     * Durations are measured in units of timestamp(), whose frequency is
+     * reported by timebase(). This is the CPU cycle counter where one is
+     * available, and micros() otherwise.
+     *
+     * Counters updated from ISR context are only modified there, and are
+     * snapshotted with interrupts disabled.
+     */
+    class Stats {
+        public:
+            struct Counters {
+                uint32_t loop_iterations;   // Companion::processEvents() calls
+
+                uint32_t host_rx_bytes;
+                uint32_t host_tx_bytes;
+                uint32_t host_frame_errors; // Corrupt or oversized requests
+
+                uint32_t i2c_writes;        // Transactions written by target
+                uint32_t i2c_write_bytes;   // ... excluding subaddress bytes
+                uint64_t i2c_write_time;    // Time spent in write ISR
+
+                uint32_t i2c_reads;         // Transactions read by target
+                uint32_t i2c_read_bytes;
+                uint64_t i2c_read_time;     // Time spent in read ISR
+
+                uint32_t i2c_oversize;      // Writes exceeding our buffer
+                uint32_t i2c_dropped;       // Writes lost to a full queue
+            };
+
+            struct CommandStats {
+                uint8_t  cmd;
+                uint32_t count;
+                uint32_t min;
+                uint32_t max;
+                uint64_t total;
+            };
+
+            static const size_t MAX_COMMANDS = DEPTHCHARGE_STATS_MAX_COMMANDS;
+
+            // Size of serialized data, as reported by serialize()
+            static const size_t COUNTERS_SIZE = (10 * 4) + (2 * 8);
+            static const size_t COMMAND_SIZE  = 1 + (3 * 4) + 8;
+
+            static void begin();
+
+            static inline uint32_t timestamp() {
+#if defined(ARM_DWT_CYCCNT)
+                return ARM_DWT_CYCCNT;
+#else
+                return micros();
+#endif
+            }
+
+            static uint32_t timebase();
+
+            static void recordCommand(uint8_t cmd, uint32_t elapsed);
+            static void reset();
+
+            /*
+             * Serialize all counters, followed by as many command entries
+             * as will fit in `max_len` bytes, starting with the entry at
+             * index `first`. Returns the number of bytes written.
+             *
+             * Format, with all values little endian:
+             *   [Timebase Hz u32][Counters][Total entries u8]
+             *   [First entry u8][Entry count u8][Entries]
+             */
+            static size_t serialize(uint8_t *buf, size_t max_len, uint8_t first);
+
+            static Counters counters;
+
+        private:
+            static CommandStats m_cmds[MAX_COMMANDS];
+            static size_t m_num_cmds;
+    };
+}
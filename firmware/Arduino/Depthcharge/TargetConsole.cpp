@@ -0,0 +1,586 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#include <ctype.h>
+
+#include "TargetConsole.h"
+
+namespace Depthcharge {
+
+    // Append `value` to `out` as lowercase hex, using at least `digits` digits.
+    // Avoids reliance upon 64-bit printf support, which not all toolchains have.
+    static size_t formatHex(char *out, uint64_t value, unsigned int digits)
+    {
+        char tmp[16];
+        size_t n = 0;
+
+        do {
+            tmp[n++] = "0123456789abcdef"[value & 0xf];
+            value >>= 4;
+        } while (value != 0 && n < sizeof(tmp));
+
+        while (n < digits && n < sizeof(tmp)) {
+            tmp[n++] = '0';
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            out[i] = tmp[n - 1 - i];
+        }
+
+        return n;
+    }
+
+    static size_t appendStr(char *out, const char *str)
+    {
+        size_t n = strlen(str);
+        memcpy(out, str, n);
+        return n;
+    }
+
+    TargetConsole::TargetConsole() :
+        m_target(NULL), m_bridge(NULL), m_bridge_used(false),
+        m_prompt_len(0),
+        m_state(STATE_IDLE), m_reason(REASON_NONE),
+        m_job(JOB_NONE), m_step(STEP_ISSUE),
+        m_cmd_start(0), m_resp_len(0), m_resp_overflow(false),
+        m_i2c(NULL), m_addr(0), m_remaining(0), m_chunk(0), m_to_read(0),
+        m_width(0), m_big_endian(false), m_echo_pending(false),
+        m_cmd_len(0), m_cmd_left(0), m_line_addr(0), m_rec_len(0) { }
+
+    void TargetConsole::attach(::Stream *target, ::Stream *bridge)
+    {
+        m_target = target;
+        m_bridge = bridge;
+    }
+
+    bool TargetConsole::attached()
+    {
+        return m_target != NULL;
+    }
+
+    bool TargetConsole::setPrompt(const uint8_t *prompt, size_t len)
+    {
+        if (len == 0 || len > sizeof(m_prompt) || m_state == STATE_RUNNING) {
+            return false;
+        }
+
+        memcpy(m_prompt, prompt, len);
+        m_prompt_len = len;
+        return true;
+    }
+
+    uint8_t TargetConsole::statusFlags() const
+    {
+        uint8_t flags = 0;
+
+        if (m_bridge_used) {
+            flags |= STATUS_BRIDGE_USED;
+        }
+
+        if (m_prompt_len != 0) {
+            flags |= STATUS_PROMPT_SET;
+        }
+
+        return flags;
+    }
+
+    bool TargetConsole::startI2CRead(I2CPeriph &i2c, uint64_t addr,
+                                     uint32_t size, uint8_t chunk)
+    {
+        if (!attached() || !i2c.attached() || m_state == STATE_RUNNING ||
+            m_prompt_len == 0 || size == 0 || chunk == 0 ||
+            chunk > (I2CPeriph::BUFFER_SIZE - i2c.getSubAddressLength())) {
+            return false;
+        }
+
+        m_output.clear();
+
+        m_i2c       = &i2c;
+        m_addr      = addr;
+        m_remaining = size;
+        m_chunk     = chunk;
+
+        m_job    = JOB_I2C_READ;
+        m_step   = STEP_ISSUE;
+        m_reason = REASON_NONE;
+        m_state  = STATE_RUNNING;
+
+        return true;
+    }
+
+    bool TargetConsole::startMdRead(uint64_t addr, uint32_t size,
+                                    uint8_t width, bool big_endian)
+    {
+        if (!attached() || m_state == STATE_RUNNING ||
+            m_prompt_len == 0 || size == 0 ||
+            (width != 1 && width != 2 && width != 4 && width != 8) ||
+            (addr % width) != 0) {
+            return false;
+        }
+
+        m_output.clear();
+
+        m_addr       = addr;
+        m_remaining  = size;
+        m_width      = width;
+        m_big_endian = big_endian;
+
+        m_job    = JOB_MD_READ;
+        m_step   = STEP_ISSUE;
+        m_reason = REASON_NONE;
+        m_state  = STATE_RUNNING;
+
+        return true;
+    }
+
+    void TargetConsole::abort()
+    {
+        if (m_state == STATE_RUNNING) {
+            fail(REASON_ABORTED);
+        }
+    }
+
+    void TargetConsole::fail(Reason reason)
+    {
+        m_reason = reason;
+        m_state  = STATE_ERROR;
+        m_job    = JOB_NONE;
+    }
+
+    size_t TargetConsole::drainOutput(uint8_t *buf, size_t max_len,
+                                      uint8_t &flags)
+    {
+        size_t used = 0;
+        int len;
+
+        flags = 0;
+
+        while ((len = m_output.peekLength()) >= 0) {
+            if ((used + 1 + len) > max_len) {
+                flags |= DRAIN_MORE;
+                break;
+            }
+
+            buf[used] = static_cast<uint8_t>(len);
+            m_output.pop(&buf[used + 1], len);
+            used += 1 + len;
+        }
+
+        return used;
+    }
+
+    void TargetConsole::bridge()
+    {
+        if (!m_bridge) {
+            return;
+        }
+
+        uint8_t buf[64];
+        int avail;
+
+        while ((avail = m_bridge->available()) > 0) {
+            size_t n = (avail < (int) sizeof(buf)) ? avail : sizeof(buf);
+            n = m_bridge->readBytes(buf, n);
+            m_target->write(buf, n);
+            m_bridge_used = true;
+        }
+
+        while ((avail = m_target->available()) > 0) {
+            size_t n = (avail < (int) sizeof(buf)) ? avail : sizeof(buf);
+            n = m_target->readBytes(buf, n);
+            m_bridge->write(buf, n);
+        }
+    }
+
+    void TargetConsole::issue(const char *cmd, size_t len)
+    {
+        // Discard anything not associated with this command
+        while (m_target->available() > 0) {
+            m_target->read();
+        }
+
+        m_resp_len = 0;
+        m_resp_overflow = false;
+
+        m_target->write(reinterpret_cast<const uint8_t *>(cmd), len);
+        m_cmd_start = millis();
+        m_step = STEP_WAIT;
+    }
+
+    /*
+     * Consume available console output. Returns true once the prompt has
+     * been received, at which point the response is in m_resp.
+     */
+    bool TargetConsole::collectResponse()
+    {
+        while (m_target->available() > 0) {
+            if (m_resp_len == sizeof(m_resp)) {
+                // Retain just enough to detect the prompt
+                memmove(m_resp, &m_resp[m_resp_len - m_prompt_len], m_prompt_len);
+                m_resp_len = m_prompt_len;
+                m_resp_overflow = true;
+            }
+
+            m_resp[m_resp_len++] = m_target->read();
+
+            if (m_resp_len >= m_prompt_len &&
+                !memcmp(&m_resp[m_resp_len - m_prompt_len], m_prompt, m_prompt_len)) {
+                return true;
+            }
+        }
+
+        if ((millis() - m_cmd_start) > DEPTHCHARGE_CONSOLE_TIMEOUT_MS) {
+            fail(REASON_TIMEOUT);
+        }
+
+        return false;
+    }
+
+    /*
+     * The console echoes our command, which is followed by the command's
+     * output and then the prompt. Is that output empty (i.e. no errors)?
+     */
+    bool TargetConsole::responseIsEmpty() const
+    {
+        if (m_resp_overflow) {
+            return false;
+        }
+
+        const size_t end = m_resp_len - m_prompt_len;
+        size_t i = 0;
+
+        // Skip echoed command
+        while (i < end && m_resp[i] != '\n') {
+            i++;
+        }
+
+        if (i == end) {
+            return false;
+        }
+
+        for (; i < end; i++) {
+            if (!isspace(m_resp[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Equivalent to I2CMemoryReader's host-side command formatting
+    void TargetConsole::issueI2CRead()
+    {
+        if (m_remaining == 0) {
+            m_state = STATE_DONE;
+            m_job = JOB_NONE;
+            return;
+        }
+
+        m_to_read = (m_remaining < m_chunk) ? m_remaining : m_chunk;
+
+        // Wait for the host to make room for the result
+        if (m_output.space() < (size_t) (m_to_read + 1)) {
+            return;
+        }
+
+        char cmd[64];
+        size_t n = 0;
+
+        n += appendStr(&cmd[n], "i2c write 0x");
+        n += formatHex(&cmd[n], m_addr, 8);
+        n += appendStr(&cmd[n], " 0x");
+        n += formatHex(&cmd[n], m_i2c->getAddress(), 2);
+        n += appendStr(&cmd[n], " 0 0x");
+        n += formatHex(&cmd[n], m_to_read, 2);
+        n += appendStr(&cmd[n], " -s\n");
+
+        m_i2c->clearWriteQueue();
+        issue(cmd, n);
+    }
+
+    void TargetConsole::completeI2CRead()
+    {
+        if (!responseIsEmpty()) {
+            fail(REASON_UNEXPECTED_RESPONSE);
+            return;
+        }
+
+        uint8_t buf[I2CPeriph::BUFFER_SIZE];
+        bool overflow;
+        int n = m_i2c->popWriteTransaction(buf, sizeof(buf), overflow);
+
+        // Expect exactly one transaction of the requested size
+        if (n != m_to_read || overflow || m_i2c->popWriteTransaction(buf, 0, overflow) >= 0) {
+            fail(REASON_BAD_TRANSFER);
+            return;
+        }
+
+        // Space was confirmed prior to issuing the command
+        m_output.beginRecord(n);
+        m_output.putBytes(buf, n);
+        m_output.commitRecord();
+
+        m_addr      += m_to_read;
+        m_remaining -= m_to_read;
+        m_step = STEP_ISSUE;
+    }
+
+    void TargetConsole::issueMdRead()
+    {
+        if (m_remaining == 0) {
+            m_state = STATE_DONE;
+            m_job = JOB_NONE;
+            return;
+        }
+
+        const uint32_t chunk = Board::CONSOLE_MD_CHUNK_SIZE -
+                               (Board::CONSOLE_MD_CHUNK_SIZE % m_width);
+
+        const uint32_t len = (m_remaining < chunk) ? m_remaining : chunk;
+
+        // The target won't wait for us, so all of the resulting data, plus
+        // record length bytes, must fit before the command is issued.
+        if (m_output.space() < (len + (len / MD_RECORD_SIZE) + 1)) {
+            return;
+        }
+
+        // Round up to a whole word. The excess is discarded.
+        const uint32_t count = (len + m_width - 1) / m_width;
+
+        char cmd[64];
+        size_t n = 0;
+
+        n += appendStr(&cmd[n], "md.");
+        cmd[n++] = "bw?l???q"[m_width - 1];
+        n += appendStr(&cmd[n], " 0x");
+        n += formatHex(&cmd[n], m_addr, 8);
+        n += appendStr(&cmd[n], " 0x");
+        n += formatHex(&cmd[n], count, 1);
+        cmd[n++] = '\n';
+
+        m_cmd_len      = len;
+        m_cmd_left     = len;
+        m_line_addr    = m_addr;
+        m_echo_pending = true;
+        m_rec_len      = 0;
+
+        issue(cmd, n);
+    }
+
+    // Parse `md` output a line at a time, as it arrives
+    void TargetConsole::receiveMdRead()
+    {
+        while (m_target->available() > 0) {
+            const uint8_t c = m_target->read();
+
+            // Large reads take a while; only time out if output stalls
+            m_cmd_start = millis();
+
+            if (c == '\n') {
+                if (!handleMdLine()) {
+                    return;
+                }
+
+                m_resp_len = 0;
+                continue;
+            }
+
+            if (m_resp_len == sizeof(m_resp)) {
+                fail(REASON_UNEXPECTED_RESPONSE);
+                return;
+            }
+
+            m_resp[m_resp_len++] = c;
+
+            // Some U-Boot builds prefix each line with a '\r'
+            size_t start = 0;
+            while (start < m_resp_len && m_resp[start] == '\r') {
+                start++;
+            }
+
+            if ((m_resp_len - start) == m_prompt_len &&
+                !memcmp(&m_resp[start], m_prompt, m_prompt_len)) {
+                completeMdRead();
+                return;
+            }
+        }
+
+        if ((millis() - m_cmd_start) > DEPTHCHARGE_CONSOLE_TIMEOUT_MS) {
+            fail(REASON_TIMEOUT);
+        }
+    }
+
+    static int hexValue(uint8_t c)
+    {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+
+        return -1;
+    }
+
+    /*
+     * Handle a complete line of `md` output, which takes the form:
+     *
+     *  <address>: <word> <word> ... <word>    <ASCII>
+     *
+     * Words are separated by a single space, and the ASCII representation
+     * is preceded by multiple spaces.
+     */
+    bool TargetConsole::handleMdLine()
+    {
+        size_t len = m_resp_len;
+        size_t i = 0;
+
+        while (len > 0 && isspace(m_resp[len - 1])) {
+            len--;
+        }
+
+        while (i < len && isspace(m_resp[i])) {
+            i++;
+        }
+
+        if (i == len) {
+            return true;
+        }
+
+        if (m_echo_pending) {
+            m_echo_pending = false;
+            if ((len - i) >= 3 && !memcmp(&m_resp[i], "md.", 3)) {
+                return true;
+            }
+
+            fail(REASON_UNEXPECTED_RESPONSE);
+            return false;
+        }
+
+        uint64_t line_addr = 0;
+        size_t digits = 0;
+        int v;
+
+        while (i < len && (v = hexValue(m_resp[i])) >= 0) {
+            line_addr = (line_addr << 4) | v;
+            digits++;
+            i++;
+        }
+
+        if (digits == 0 || digits > 16 || i == len || m_resp[i] != ':') {
+            fail(REASON_UNEXPECTED_RESPONSE);
+            return false;
+        }
+
+        if (line_addr != m_line_addr) {
+            fail(REASON_BAD_TRANSFER);
+            return false;
+        }
+
+        i++;
+
+        const size_t word_digits = 2 * m_width;
+        size_t n_words = 0;
+
+        while ((i + 1 + word_digits) <= len && m_resp[i] == ' ' &&
+               m_resp[i + 1] != ' ') {
+
+            uint64_t word = 0;
+
+            for (size_t d = 1; d <= word_digits; d++) {
+                if ((v = hexValue(m_resp[i + d])) < 0) {
+                    fail(REASON_UNEXPECTED_RESPONSE);
+                    return false;
+                }
+                word = (word << 4) | v;
+            }
+
+            i += 1 + word_digits;
+            if (i < len && m_resp[i] != ' ') {
+                fail(REASON_UNEXPECTED_RESPONSE);
+                return false;
+            }
+
+            if (m_cmd_left == 0) {
+                fail(REASON_BAD_TRANSFER);
+                return false;
+            }
+
+            for (uint8_t b = 0; b < m_width && m_cmd_left != 0; b++) {
+                const uint8_t shift = m_big_endian ? (m_width - 1 - b) : b;
+                emitMdByte(static_cast<uint8_t>(word >> (8 * shift)));
+            }
+
+            n_words++;
+        }
+
+        if (n_words == 0) {
+            fail(REASON_UNEXPECTED_RESPONSE);
+            return false;
+        }
+
+        m_line_addr += n_words * m_width;
+        return true;
+    }
+
+    void TargetConsole::emitMdByte(uint8_t b)
+    {
+        // Space was confirmed prior to issuing the command
+        if (m_rec_len == 0) {
+            m_output.beginRecord((m_cmd_left < MD_RECORD_SIZE) ? m_cmd_left : MD_RECORD_SIZE);
+        }
+
+        m_output.put(b);
+        m_cmd_left--;
+
+        if (++m_rec_len == MD_RECORD_SIZE || m_cmd_left == 0) {
+            m_output.commitRecord();
+            m_rec_len = 0;
+        }
+    }
+
+    void TargetConsole::completeMdRead()
+    {
+        if (m_cmd_left != 0) {
+            fail(REASON_BAD_TRANSFER);
+            return;
+        }
+
+        m_addr      += m_cmd_len;
+        m_remaining -= m_cmd_len;
+        m_step = STEP_ISSUE;
+    }
+
+    void TargetConsole::process()
+    {
+        if (!attached()) {
+            return;
+        }
+
+        if (m_state != STATE_RUNNING) {
+            bridge();
+            return;
+        }
+
+        switch (m_step) {
+            case STEP_ISSUE:
+                if (m_job == JOB_I2C_READ) {
+                    issueI2CRead();
+                } else if (m_job == JOB_MD_READ) {
+                    issueMdRead();
+                }
+                break;
+
+            case STEP_WAIT:
+                if (m_job == JOB_MD_READ) {
+                    receiveMdRead();
+                } else if (collectResponse()) {
+                    if (m_job == JOB_I2C_READ) {
+                        completeI2CRead();
+                    }
+                }
+                break;
+        }
+    }
+}
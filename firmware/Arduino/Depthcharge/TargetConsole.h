@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+
+#pragma once
+#include <Arduino.h>
+
+#include "Board.h"
+#include "I2CPeriph.h"
+#include "RingBuffer.h"
+
+// Maximum time to wait for the prompt to return after issuing a command
+#ifndef DEPTHCHARGE_CONSOLE_TIMEOUT_MS
+#   define DEPTHCHARGE_CONSOLE_TIMEOUT_MS 2000
+#endif
+
+#ifndef DEPTHCHARGE_CONSOLE_MAX_PROMPT_LEN
+#   define DEPTHCHARGE_CONSOLE_MAX_PROMPT_LEN 32
+#endif
+
+namespace Depthcharge {
+
+    /*
+     * Connection to the target's U-Boot console, via a spare UART.
+     *
+     * When idle, all traffic is bridged between the target UART and a
+     * second host-facing stream (e.g. a second USB serial interface), such
+     * that host-side Depthcharge code uses the console as it normally would.
+     *
+     * The host may then hand the console to an on-device operation, which
+     * issues console commands itself and queues the results for retrieval
+     * via drainOutput(). This removes the host's per-command turnaround
+     * from the loop. Bridging is suspended while an operation is running.
+     */
+    class TargetConsole {
+
+        public:
+            enum State {
+                STATE_IDLE      = 0,    // No operation has been started
+                STATE_RUNNING   = 1,    // Operation in progress
+                STATE_DONE      = 2,    // Operation completed successfully
+                STATE_ERROR     = 3,    // Operation failed. See Reason.
+            };
+
+            enum Reason {
+                REASON_NONE                 = 0,
+                REASON_TIMEOUT              = 1,    // Prompt did not return
+                REASON_UNEXPECTED_RESPONSE  = 2,    // Command produced output
+                REASON_BAD_TRANSFER         = 3,    // Data not received as expected
+                REASON_ABORTED              = 4,    // Host requested abort
+            };
+
+            // Flags reported by statusFlags()
+            enum StatusFlags {
+                // Data has been bridged from the host to the target,
+                // indicating that the host is using the bridge as its console.
+                STATUS_BRIDGE_USED  = (1 << 0),
+
+                // A prompt has been configured via setPrompt()
+                STATUS_PROMPT_SET   = (1 << 1),
+            };
+
+            // Flags returned by drainOutput(). Matches I2CPeriph::DrainFlags.
+            enum DrainFlags {
+                DRAIN_MORE = (1 << 1),
+            };
+
+            static const size_t MAX_PROMPT_LEN = DEPTHCHARGE_CONSOLE_MAX_PROMPT_LEN;
+
+            TargetConsole();
+
+            /*
+             * Associate with the target UART and, optionally, a host-facing
+             * stream to bridge it to. The target UART's baud rate must be
+             * configured by the caller.
+             */
+            void attach(::Stream *target, ::Stream *bridge);
+            bool attached();
+
+            // Prompt string used to determine when a command has completed
+            bool setPrompt(const uint8_t *prompt, size_t len);
+
+            /*
+             * Start reading `size` bytes of target memory at `addr`, in
+             * `chunk`-byte increments, via `i2c write` commands directed to
+             * the provided I2C peripheral. The I2C bus must already be
+             * configured on the target.
+             *
+             * Returns false if an operation is already running, a prompt has
+             * not been set, or the parameters are invalid.
+             */
+            bool startI2CRead(I2CPeriph &i2c, uint64_t addr, uint32_t size,
+                              uint8_t chunk);
+
+            /*
+             * Start reading `size` bytes of target memory at `addr` via
+             * `md` commands, using a word size of `width` bytes (1, 2, 4,
+             * or 8). The hex dump is parsed and validated here, and only the
+             * resulting binary data is queued. Words are converted to bytes
+             * in the target's byte order, as specified by `big_endian`.
+             *
+             * Returns false if an operation is already running, a prompt has
+             * not been set, or the parameters are invalid.
+             */
+            bool startMdRead(uint64_t addr, uint32_t size, uint8_t width,
+                             bool big_endian);
+
+            void abort();
+
+            /*
+             * Bridge data while idle, or advance the current operation.
+             * This never blocks waiting on the target.
+             */
+            void process();
+
+            inline State state() const { return m_state; }
+            inline Reason reason() const { return m_reason; }
+            uint8_t statusFlags() const;
+
+            /*
+             * Copy as many complete result records as will fit into `buf`,
+             * oldest first, using the same [length][data] format as
+             * I2CPeriph::drainWriteQueue().
+             */
+            size_t drainOutput(uint8_t *buf, size_t max_len, uint8_t &flags);
+
+        private:
+            enum Job {
+                JOB_NONE,
+                JOB_I2C_READ,
+                JOB_MD_READ,
+            };
+
+            enum Step {
+                STEP_ISSUE,     // Issue the next command
+                STEP_WAIT,      // Wait for the prompt to return
+            };
+
+            void bridge();
+            void fail(Reason reason);
+            void issue(const char *cmd, size_t len);
+            bool collectResponse();
+            bool responseIsEmpty() const;
+
+            void issueI2CRead();
+            void completeI2CRead();
+
+            void issueMdRead();
+            void receiveMdRead();
+            bool handleMdLine();
+            void emitMdByte(uint8_t b);
+            void completeMdRead();
+
+            ::Stream *m_target;
+            ::Stream *m_bridge;
+            bool m_bridge_used;
+
+            uint8_t m_prompt[MAX_PROMPT_LEN];
+            size_t  m_prompt_len;
+
+            State  m_state;
+            Reason m_reason;
+            Job    m_job;
+            Step   m_step;
+
+            unsigned long m_cmd_start;
+
+            // Console output following the most recently issued command.
+            // If this overflows, only the most recent data is retained,
+            // so that the prompt can still be detected.
+            uint8_t m_resp[256];
+            size_t  m_resp_len;
+            bool    m_resp_overflow;
+
+            // JOB_I2C_READ state
+            I2CPeriph *m_i2c;
+            uint64_t   m_addr;
+            uint32_t   m_remaining;
+            uint8_t    m_chunk;
+            uint8_t    m_to_read;
+
+            // JOB_MD_READ state. The m_resp buffer holds the current line.
+            // Data is written directly into m_output records of up to
+            // MD_RECORD_SIZE bytes.
+            static const size_t MD_RECORD_SIZE = Board::CONSOLE_MD_RECORD_SIZE;
+
+            uint8_t  m_width;
+            bool     m_big_endian;
+            bool     m_echo_pending;    // Echoed command not yet received
+            uint32_t m_cmd_len;         // Bytes requested by current command
+            uint32_t m_cmd_left;        // ... and not yet received
+            uint64_t m_line_addr;       // Address expected on next line
+            size_t   m_rec_len;         // Bytes in open m_output record
+
+            RingBuffer<DEPTHCHARGE_CONSOLE_OUTPUT_QUEUE_SIZE> m_output;
+    };
+}
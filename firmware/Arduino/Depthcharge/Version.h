@@ -2,7 +2,7 @@
 #include <stdint.h>
 namespace Depthcharge {
     static const uint8_t VERSION_MAJOR = 0;
-    static const uint8_t VERSION_MINOR = 1;
+    static const uint8_t VERSION_MINOR = 2;
     static const uint8_t VERSION_PATCH = 0;
     static const uint8_t VERSION_EXTRA = 0;
 };
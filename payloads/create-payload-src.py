@@ -2,9 +2,52 @@
 # SPDX-License-Identifier: BSD-3-Clause
 import os
 import re
+import struct
 import sys
 import time
 
+_PT_LOAD = 1
+
+
+def load_elf_metadata(filename, arch):
+    """
+    Returns a dictionary containing the offset of a payload's entry point,
+    relative to the start of its objcopy'd binary, and whether the entry point
+    is a Thumb (rather than ARM) instruction.
+    """
+    with open(filename, 'rb') as infile:
+        elf = infile.read()
+
+    if elf[:4] != b'\x7fELF' or elf[5] != 1:
+        raise ValueError('Expected a little endian ELF file: ' + filename)
+
+    if elf[4] == 2:
+        entry, phoff = struct.unpack_from('<QQ', elf, 0x18)
+        phentsize, phnum = struct.unpack_from('<HH', elf, 0x36)
+        phdr_fmt, paddr_idx, filesz_idx = '<IIQQQQ', 4, 5
+    else:
+        entry, phoff = struct.unpack_from('<II', elf, 0x18)
+        phentsize, phnum = struct.unpack_from('<HH', elf, 0x2a)
+        phdr_fmt, paddr_idx, filesz_idx = '<IIIIII', 3, 4
+
+    # objcopy -O binary output begins at the lowest loadable address
+    base = None
+    for i in range(0, phnum):
+        phdr = struct.unpack_from(phdr_fmt, elf, phoff + i * phentsize)
+        if phdr[0] == _PT_LOAD and phdr[filesz_idx] != 0:
+            paddr = phdr[paddr_idx]
+            base = paddr if base is None else min(base, paddr)
+
+    if base is None:
+        raise ValueError('No loadable segments in ' + filename)
+
+    # Bit 0 of an ARM entry point address denotes Thumb code
+    thumb = arch == 'arm' and (entry & 1) == 1
+    if thumb:
+        entry &= ~1
+
+    return {'entry_offset': entry - base, 'thumb': thumb}
+
 
 def load_payloads(output_dir):
     file_regex = re.compile(r'(?P<arch>\w+)-(?P<payload>[\w-]+)\.bin')
@@ -12,7 +55,7 @@ def load_payloads(output_dir):
     payloads = {}
 
     for root, _, files in os.walk(output_dir):
-        for f in files:
+        for f in sorted(files):
             m = file_regex.match(f)
             if m is None:
                 continue
@@ -23,7 +66,20 @@ def load_payloads(output_dir):
             payload = payloads.get(payload_name, {})
 
             with open(os.path.join(root, f), 'rb') as infile:
-                payload[arch] = infile.read()
+                data = infile.read()
+
+            # Payloads entered at offset 0 in ARM mode are stored as
+            # bytes alone. Otherwise, the required metadata is included.
+            elf_file = os.path.join(root, f[:-len('.bin')] + '.elf')
+            if os.path.exists(elf_file):
+                metadata = load_elf_metadata(elf_file, arch)
+            else:
+                metadata = {'entry_offset': 0, 'thumb': False}
+
+            if metadata['entry_offset'] == 0 and not metadata['thumb']:
+                payload[arch] = data
+            else:
+                payload[arch] = dict(metadata, data=data)
 
             payloads[payload_name] = payload
 
@@ -54,11 +110,13 @@ def _format_bytes(payload: bytes) -> str:
     return ret
 
 
-def write_payload_source(outfile, payloads):
+def write_payload_source(outfile, payloads, toolchain=None):
     outfile.write('# SPDX-License-Identifier: BSD-3-Clause' + os.linesep)
     outfile.write('"""' + os.linesep)
     outfile.write('Built-in Depthcharge payloads' + os.linesep)
     outfile.write('(Autogenerated on ' + time.asctime() + ')' + os.linesep)
+    if toolchain:
+        outfile.write('(Built with ' + toolchain + ')' + os.linesep)
     outfile.write('"""' + os.linesep)
 
     for name in payloads:
@@ -66,8 +124,20 @@ def write_payload_source(outfile, payloads):
         outfile.write(name.upper() + ' = {' + os.linesep)
 
         for arch in payloads[name]:
+            payload = payloads[name][arch]
             outfile.write(' ' * 4 + "'" + arch + "':")
-            outfile.write(_format_bytes(payloads[name][arch]))
+
+            if isinstance(payload, bytes):
+                outfile.write(_format_bytes(payload))
+            else:
+                outfile.write(' {' + os.linesep)
+                outfile.write(' ' * 8 + "'entry_offset': " + hex(payload['entry_offset']))
+                outfile.write(',' + os.linesep)
+                outfile.write(' ' * 8 + "'thumb': " + str(payload['thumb']) + ',' + os.linesep)
+                outfile.write(' ' * 8 + "'data':")
+                outfile.write(_format_bytes(payload['data']).replace(os.linesep, os.linesep + ' ' * 4))
+                outfile.write(',' + os.linesep + ' ' * 4 + '}')
+
             outfile.write(',' + os.linesep)
 
         outfile.write('}' + os.linesep)
@@ -75,10 +145,11 @@ def write_payload_source(outfile, payloads):
 
 if __name__ == '__main__':
     if len(sys.argv) < 3 or '-h' in sys.argv or '--help' in sys.argv:
-        usage = 'Usage: {:s}: <output dir> <output filename>'
+        usage = 'Usage: {:s}: <output dir> <output filename> [toolchain description]'
         print(usage.format(os.path.basename(sys.argv[0])), file=sys.stderr)
         sys.exit(1)
 
     payloads = load_payloads(sys.argv[1])
+    toolchain = sys.argv[3] if len(sys.argv) > 3 else None
     with open(os.path.join(sys.argv[1], sys.argv[2]), 'w') as outfile:
-        write_payload_source(outfile, payloads)
+        write_payload_source(outfile, payloads, toolchain)
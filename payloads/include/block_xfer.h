@@ -0,0 +1,261 @@
+#ifndef BLOCK_XFER_H__
+#define BLOCK_XFER_H__
+
+/*
+ * Block-based transfer protocol shared by the read_memory_blocks and
+ * read_memory_rle payloads. Refer to python/depthcharge/memory/go.py
+ * for the host side. The command_server payload uses the same frame
+ * encoding for its responses.
+ *
+ * After the start sentinel, the payload waits for any character from the host.
+ * Each block is then sent as a frame:
+ *
+ *  FRAME_FLAG, followed by the escaped encoding of:
+ *      [offset: LE32][length: LE16][crc32: LE32][data length: LE16][data]
+ *
+ * The length and CRC32 describe the block's memory contents, while the data
+ * length is the number of data bytes that follow, which are in a
+ * payload-specific encoding.
+ *
+ * Encoded bytes are XOR'd with XOR_MASK, so that the common 0x00 and 0xff fill
+ * values don't need escaping. Encoded values of NUL, LF, CR, FRAME_FLAG, and
+ * ESCAPE are sent as ESCAPE followed by the value XOR'd with ESCAPE_XOR.
+ * This allows frames to be sent with jt->puts() in chunks, rather than calling
+ * jt->putc() per byte, and keeps them unaffected by NL -> CR-NL translation.
+ *
+ * Upon receiving a frame, the host responds with one of the following:
+ *
+ *  'a'              ACK. Send the next block.
+ *  'r<8 hex chars>' Resend, starting from the specified offset.
+ *  'q'              Quit.
+ *
+ * If no response is received within the timeout period, the current block is
+ * resent, up to MAX_RETRIES times. A frame with a length of 0 (and an offset
+ * equal to the memory length) denotes the end of the transfer. The payload
+ * returns after this is ACK'd.
+ *
+ * All functions here are forced inline so that main() remains the first
+ * function in the payload binary.
+ */
+
+#include "u-boot.h"
+
+#define FRAME_FLAG          0x7e
+#define ESCAPE              0x7d
+#define ESCAPE_XOR          0x20
+#define XOR_MASK            0x55
+
+#define DEFAULT_TIMEOUT_MS  1000
+#define MAX_RETRIES         16
+
+#define OUTBUF_SIZE         128
+
+#define BLOCK_XFER_INLINE static inline __attribute__((always_inline))
+
+typedef struct {
+    jt_funcs_t *jt;
+    unsigned long timeout_ms;
+    unsigned int retries;
+    unsigned int crc_table[256];
+    char buf[OUTBUF_SIZE + 1];
+    unsigned int buf_len;
+} block_xfer_t;
+
+/* Values returned by block_xfer_await() */
+enum {
+    BLOCK_XFER_CONTINUE,    /* Send the block at the (possibly updated) offset */
+    BLOCK_XFER_DONE,        /* End of transfer ACK'd */
+    BLOCK_XFER_QUIT,        /* Host requested that we quit */
+    BLOCK_XFER_FAILED,      /* Exceeded MAX_RETRIES */
+};
+
+BLOCK_XFER_INLINE
+void block_xfer_init(block_xfer_t *s, jt_funcs_t *jt, unsigned long timeout_ms)
+{
+    unsigned int i, j, c;
+
+    s->jt = jt;
+    s->timeout_ms = timeout_ms;
+    s->retries = 0;
+    s->buf_len = 0;
+
+    for (i = 0; i < 256; i++) {
+        c = i;
+        for (j = 0; j < 8; j++) {
+            c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+        }
+        s->crc_table[i] = c;
+    }
+}
+
+/*
+ * Update a running CRC32 value with a single byte. The running value should be
+ * initialized to 0xffffffff, and the final result XOR'd with 0xffffffff.
+ */
+BLOCK_XFER_INLINE
+unsigned int block_xfer_crc32_update(const block_xfer_t *s, unsigned int c, unsigned char b)
+{
+    return s->crc_table[(c ^ b) & 0xff] ^ (c >> 8);
+}
+
+BLOCK_XFER_INLINE
+unsigned int block_xfer_crc32(const block_xfer_t *s,
+                              volatile const unsigned char *data, unsigned int len)
+{
+    unsigned int c = 0xffffffff;
+    unsigned int i;
+
+    for (i = 0; i < len; i++) {
+        c = block_xfer_crc32_update(s, c, data[i]);
+    }
+
+    return c ^ 0xffffffff;
+}
+
+BLOCK_XFER_INLINE
+void block_xfer_flush(block_xfer_t *s)
+{
+    s->buf[s->buf_len] = '\0';
+    s->jt->puts(s->buf);
+    s->buf_len = 0;
+}
+
+BLOCK_XFER_INLINE
+void block_xfer_put_encoded(block_xfer_t *s, unsigned char c)
+{
+    c ^= XOR_MASK;
+
+    /* Leave room for an escaped pair without an intermediate check */
+    if (s->buf_len >= (OUTBUF_SIZE - 1)) {
+        block_xfer_flush(s);
+    }
+
+    if (c == 0x00 || c == '\n' || c == '\r' || c == FRAME_FLAG || c == ESCAPE) {
+        s->buf[s->buf_len++] = ESCAPE;
+        c ^= ESCAPE_XOR;
+    }
+
+    s->buf[s->buf_len++] = c;
+}
+
+BLOCK_XFER_INLINE
+void block_xfer_put_le(block_xfer_t *s, unsigned int value, unsigned int n)
+{
+    while (n--) {
+        block_xfer_put_encoded(s, value & 0xff);
+        value >>= 8;
+    }
+}
+
+BLOCK_XFER_INLINE
+void block_xfer_send(block_xfer_t *s, unsigned int offset, unsigned int len, unsigned int crc,
+                     volatile const unsigned char *data, unsigned int data_len)
+{
+    unsigned int i;
+
+    if (s->buf_len >= OUTBUF_SIZE) {
+        block_xfer_flush(s);
+    }
+    s->buf[s->buf_len++] = FRAME_FLAG;
+
+    block_xfer_put_le(s, offset, 4);
+    block_xfer_put_le(s, len, 2);
+    block_xfer_put_le(s, crc, 4);
+    block_xfer_put_le(s, data_len, 2);
+
+    for (i = 0; i < data_len; i++) {
+        block_xfer_put_encoded(s, data[i]);
+    }
+
+    block_xfer_flush(s);
+}
+
+/* Returns the next character from the host, or -1 on timeout */
+BLOCK_XFER_INLINE
+int block_xfer_getc(block_xfer_t *s)
+{
+    unsigned long start = s->jt->get_timer(0);
+
+    while (!s->jt->tstc()) {
+        if (s->jt->get_timer(start) >= s->timeout_ms) {
+            return -1;
+        }
+    }
+
+    return s->jt->getc();
+}
+
+/* Returns 0 on success, and -1 on timeout or invalid input */
+BLOCK_XFER_INLINE
+int block_xfer_get_hex32(block_xfer_t *s, unsigned int *value)
+{
+    unsigned int i;
+    int c;
+
+    *value = 0;
+
+    for (i = 0; i < 8; i++) {
+        c = block_xfer_getc(s);
+        if (c >= '0' && c <= '9') {
+            c -= '0';
+        } else if (c >= 'a' && c <= 'f') {
+            c = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            c = c - 'A' + 10;
+        } else {
+            return -1;
+        }
+
+        *value = (*value << 4) | c;
+    }
+
+    return 0;
+}
+
+/*
+ * Wait for the host's response to the block of `len` bytes just sent
+ * from `*offset`, and update `*offset` to the next block to send.
+ */
+BLOCK_XFER_INLINE
+int block_xfer_await(block_xfer_t *s, unsigned int *offset,
+                     unsigned int len, unsigned int mem_len)
+{
+    unsigned int new_offset;
+    int c;
+
+    /* Discard anything unexpected (e.g. line noise) while awaiting a response */
+    do {
+        c = block_xfer_getc(s);
+    } while (c >= 0 && c != 'a' && c != 'r' && c != 'q');
+
+    switch (c) {
+        case 'a':
+            if (len == 0) {
+                return BLOCK_XFER_DONE;
+            }
+            *offset += len;
+            s->retries = 0;
+            return BLOCK_XFER_CONTINUE;
+
+        case 'r':
+            if (block_xfer_get_hex32(s, &new_offset) == 0 && new_offset <= mem_len) {
+                *offset = new_offset;
+            }
+            break;
+
+        case 'q':
+            return BLOCK_XFER_QUIT;
+
+        default:
+            /* Timed out. Resend the current block. */
+            break;
+    }
+
+    if (++s->retries >= MAX_RETRIES) {
+        return BLOCK_XFER_FAILED;
+    }
+
+    return BLOCK_XFER_CONTINUE;
+}
+
+#endif
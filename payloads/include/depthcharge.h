@@ -5,7 +5,10 @@
 
 #ifdef ARCH_arm
 #   define DECLARE_GLOBAL_DATA_VOID_PTR(gd) \
-        register volatile void *gd asm("r9")
+        volatile void *gd; __asm__ volatile ("mov %0, r9" : "=r" (gd))
+#elif defined(ARCH_aarch64)
+#   define DECLARE_GLOBAL_DATA_VOID_PTR(gd) \
+        volatile void *gd; __asm__ volatile ("mov %0, x18" : "=r" (gd))
 #else
 #   error "Unsupported architechture"
 #endif
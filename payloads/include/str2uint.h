@@ -4,9 +4,9 @@
 #include <stdbool.h>
 #include "strlen.h"
 
-static inline unsigned int str2uint_hex(const char *s)
+static inline unsigned long str2ulong_hex(const char *s)
 {
-    unsigned int value = 0;
+    unsigned long value = 0;
 
     while (*s) {
         value <<= 4;
@@ -29,9 +29,9 @@ static inline unsigned int str2uint_hex(const char *s)
     return value;
 }
 
-static inline unsigned int str2uint_dec(const char *s)
+static inline unsigned long str2ulong_dec(const char *s)
 {
-    unsigned int value = 0;
+    unsigned long value = 0;
 
     while (*s) {
         value *= 10;
@@ -50,17 +50,26 @@ static inline unsigned int str2uint_dec(const char *s)
     return value;
 }
 
-// Simple string to unsigned int conversion with an atoi-esque lack of proper
+// Simple string to unsigned long conversion with an atoi-esque lack of proper
 // input validation and overflow checks. Returns 0 on invalid input and will
-// overflow if input exceeds the size of an unsigned int.
-static inline unsigned int str2uint(const char *s)
+// overflow if input exceeds the size of an unsigned long.
+//
+// An unsigned long is pointer-sized on both ARM and AArch64, so this should
+// be used to parse addresses.
+static inline unsigned long str2ulong(const char *s)
 {
     size_t len = strlen(s);
     if (len > 2 && s[0] == '0' && s[1] == 'x') {
         s += 2;
-        return str2uint_hex(s);
+        return str2ulong_hex(s);
     }
-    return str2uint_dec(s);
+    return str2ulong_dec(s);
+}
+
+// As above, but for an unsigned int
+static inline unsigned int str2uint(const char *s)
+{
+    return (unsigned int) str2ulong(s);
 }
 
 
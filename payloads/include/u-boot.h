@@ -4,8 +4,17 @@
 #include <stdlib.h>
 #include <stdarg.h>
 
+/*
+ * Copy the global data pointer out of its reserved register, rather than
+ * relying upon a local register variable, which not all compilers treat
+ * as being initialized with the register's current value.
+ */
 #ifdef ARCH_arm
-#   define DECLARE_GLOBAL_DATA_PTR(gd) register volatile global_data_t *gd asm("r9");
+#   define DECLARE_GLOBAL_DATA_PTR(gd) \
+        volatile global_data_t *gd; __asm__ volatile ("mov %0, r9" : "=r" (gd));
+#elif defined(ARCH_aarch64)
+#   define DECLARE_GLOBAL_DATA_PTR(gd) \
+        volatile global_data_t *gd; __asm__ volatile ("mov %0, x18" : "=r" (gd));
 #else
 #   error "Unsupported architechture"
 #endif
@@ -0,0 +1,83 @@
+/*
+ * Compute the CRC32 checksum of each block in a memory range.
+ * Refer to Depthcharge.block_crc32() for the host side.
+ *
+ * Usage: go <payload addr> <jt addr> <mem addr> <mem len> <block size>
+ *
+ * After the start sentinel, the payload waits for any character from the host.
+ * It then prints one checksum per line, in hex, followed by the end sentinel.
+ * The final block may be smaller than <block size>.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+
+int main(int argc, char *argv[])
+{
+    int status;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long mem_addr, mem_len, block_size;
+    unsigned int crc_table[256];
+    unsigned int i, j, c, len;
+    unsigned long offset;
+    volatile const unsigned char *mem;
+
+    if (argc != 5) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &mem_addr);
+    if (status != 0) {
+        jt->printf("Invalid memory address: %s\n", argv[2]);
+        return 3;
+    }
+
+    status = jt->strict_strtoul(argv[3], 0, &mem_len);
+    if (status != 0) {
+        jt->printf("Invalid memory length: %s\n", argv[3]);
+        return 4;
+    }
+
+    status = jt->strict_strtoul(argv[4], 0, &block_size);
+    if (status != 0 || block_size == 0) {
+        jt->printf("Invalid block size: %s\n", argv[4]);
+        return 5;
+    }
+
+    for (i = 0; i < 256; i++) {
+        c = i;
+        for (j = 0; j < 8; j++) {
+            c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+        }
+        crc_table[i] = c;
+    }
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    for (offset = 0; offset < mem_len; offset += len) {
+        len = mem_len - offset;
+        if (len > block_size) {
+            len = block_size;
+        }
+
+        mem = (volatile const unsigned char *) (mem_addr + offset);
+
+        c = 0xffffffff;
+        for (i = 0; i < len; i++) {
+            c = crc_table[(c ^ mem[i]) & 0xff] ^ (c >> 8);
+        }
+
+        jt->printf("%08x\n", c ^ 0xffffffff);
+    }
+
+    jt->puts("-:[|END|]:-");
+    return 0;
+}
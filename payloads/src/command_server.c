@@ -0,0 +1,289 @@
+/*
+ * Resident command server that remains running after a single "go" invocation,
+ * servicing binary requests from the host until instructed to exit.
+ * Refer to python/depthcharge/memory/resident.py for the host side.
+ *
+ * Usage: go <payload addr> [jt addr] [timeout ms]
+ *
+ * If the jump table address is omitted (or 0), gd->jt is used. After the
+ * start sentinel, the payload waits for any character from the host and then
+ * begins servicing requests, which are sent as raw bytes:
+ *
+ *  [command: u8][sequence: LE32][arg0: LE32][arg1: LE32][arg2: LE32][arg3: LE32]
+ *  [data: arg1 bytes, CMD_WRITE only][crc32 of all preceding bytes: LE32]
+ *
+ * Bytes that are not a valid command are discarded while awaiting a request,
+ * allowing the host to resynchronize with the payload after line noise.
+ * A Ctrl-C (0x03) in place of a command causes the payload to return, such
+ * that a console interrupt alone is sufficient to return to the U-Boot prompt.
+ * If the remainder of a request is not received within the timeout, it is
+ * discarded without a response.
+ *
+ * Each response is sent as a block_xfer.h frame, with its fields used as follows:
+ *
+ *  offset:  The request's sequence number
+ *  length:  Status code (STATUS_*)
+ *  crc32:   CRC32 of the response data
+ *  data:    Command-specific response data, sent as-is
+ *
+ * Commands:
+ *
+ *  CMD_READ        Read arg1 bytes at arg0. Responds with the data read.
+ *  CMD_WRITE       Write arg1 bytes of request data to arg0. No response data.
+ *  CMD_READ_WORD   Read an arg1-byte value (1, 2, 4, or 8 on 64-bit targets)
+ *                  at arg0, using a single access of that width. Responds with
+ *                  the value in little endian.
+ *  CMD_CRC32       Compute the CRC32 of arg1 bytes at arg0. Responds with LE32.
+ *  CMD_CALL        Call the function at index arg0 in the jump table, with
+ *                  arg1 - arg3 as its arguments. Responds with the return
+ *                  value (unsigned long) in little endian.
+ *  CMD_EXIT        Respond and return 0.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+#include "block_xfer.h"
+
+#define CMD_READ            0x10
+#define CMD_WRITE           0x11
+#define CMD_READ_WORD       0x12
+#define CMD_CRC32           0x13
+#define CMD_CALL            0x14
+#define CMD_EXIT            0x1f
+
+#define CTRL_C              0x03
+
+#define STATUS_OK           0
+#define STATUS_BAD_CRC      1
+#define STATUS_BAD_ARGS     2
+
+#define NUM_ARGS            4
+#define MAX_READ_LEN        0xffff
+#define MAX_WRITE_LEN       4096
+
+#define NUM_JT_FUNCS        (sizeof(jt_funcs_t) / sizeof(void *))
+
+typedef unsigned long (*jt_call_t)(unsigned long, unsigned long, unsigned long);
+
+/*
+ * Returns 0 on success, and -1 on timeout.
+ * The running CRC32 value is updated if crc is non-NULL.
+ */
+static inline __attribute__((always_inline))
+int get_le32(block_xfer_t *s, unsigned int *crc, unsigned int *value)
+{
+    unsigned int i;
+    int c;
+
+    *value = 0;
+
+    for (i = 0; i < 32; i += 8) {
+        c = block_xfer_getc(s);
+        if (c < 0) {
+            return -1;
+        }
+
+        if (crc != NULL) {
+            *crc = block_xfer_crc32_update(s, *crc, c);
+        }
+
+        *value |= ((unsigned int) c) << i;
+    }
+
+    return 0;
+}
+
+static inline __attribute__((always_inline))
+void send_value(block_xfer_t *s, unsigned int seq, unsigned long value, unsigned int len)
+{
+    union {
+        unsigned long value;
+        unsigned char bytes[sizeof(unsigned long)];
+    } v;
+
+    v.value = value;
+    block_xfer_send(s, seq, STATUS_OK, block_xfer_crc32(s, v.bytes, len), v.bytes, len);
+}
+
+static inline __attribute__((always_inline))
+void send_status(block_xfer_t *s, unsigned int seq, unsigned int status)
+{
+    /* CRC32 of no data is 0 */
+    block_xfer_send(s, seq, status, 0, NULL, 0);
+}
+
+int main(int argc, char *argv[])
+{
+    DECLARE_GLOBAL_DATA_PTR(gd);
+
+    int status;
+    block_xfer_t s;
+    jt_funcs_t *jt;
+    unsigned long jt_u = 0;
+    unsigned long timeout_ms = DEFAULT_TIMEOUT_MS;
+
+    unsigned char write_buf[MAX_WRITE_LEN];
+    unsigned int cmd, seq, args[NUM_ARGS];
+    unsigned int crc, req_crc, i;
+    unsigned long value;
+    int c;
+
+    if (argc > 3) {
+        return 1;
+    }
+
+    if (argc > 1) {
+        jt_u = str2ulong(argv[1]);
+    }
+
+    jt = (jt_u != 0) ? (jt_funcs_t *) jt_u : gd->jt;
+    if (jt == NULL) {
+        return 2;
+    }
+
+    if (argc > 2) {
+        status = jt->strict_strtoul(argv[2], 0, &timeout_ms);
+        if (status != 0 || timeout_ms == 0) {
+            jt->printf("Invalid timeout: %s\n", argv[2]);
+            return 3;
+        }
+    }
+
+    block_xfer_init(&s, jt, timeout_ms);
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    while (1) {
+        cmd = jt->getc();
+
+        if (cmd == CTRL_C) {
+            return 0;
+        } else if (cmd != CMD_EXIT && (cmd < CMD_READ || cmd > CMD_CALL)) {
+            continue;
+        }
+
+        crc = block_xfer_crc32_update(&s, 0xffffffff, cmd);
+
+        if (get_le32(&s, &crc, &seq) != 0) {
+            continue;
+        }
+
+        for (i = 0; i < NUM_ARGS; i++) {
+            if (get_le32(&s, &crc, &args[i]) != 0) {
+                break;
+            }
+        }
+
+        if (i != NUM_ARGS) {
+            continue;
+        }
+
+        if (cmd == CMD_WRITE) {
+            if (args[1] > MAX_WRITE_LEN) {
+                send_status(&s, seq, STATUS_BAD_ARGS);
+                continue;
+            }
+
+            for (i = 0; i < args[1]; i++) {
+                c = block_xfer_getc(&s);
+                if (c < 0) {
+                    break;
+                }
+
+                write_buf[i] = c;
+                crc = block_xfer_crc32_update(&s, crc, c);
+            }
+
+            if (i != args[1]) {
+                continue;
+            }
+        }
+
+        crc ^= 0xffffffff;
+        if (get_le32(&s, NULL, &req_crc) != 0) {
+            continue;
+        }
+
+        if (req_crc != crc) {
+            send_status(&s, seq, STATUS_BAD_CRC);
+            continue;
+        }
+
+        switch (cmd) {
+            case CMD_READ:
+                if (args[1] > MAX_READ_LEN) {
+                    send_status(&s, seq, STATUS_BAD_ARGS);
+                } else {
+                    volatile const unsigned char *data =
+                        (volatile const unsigned char *) (unsigned long) args[0];
+
+                    block_xfer_send(&s, seq, STATUS_OK,
+                                    block_xfer_crc32(&s, data, args[1]), data, args[1]);
+                }
+                break;
+
+            case CMD_WRITE: {
+                volatile unsigned char *data =
+                    (volatile unsigned char *) (unsigned long) args[0];
+
+                for (i = 0; i < args[1]; i++) {
+                    data[i] = write_buf[i];
+                }
+
+                send_status(&s, seq, STATUS_OK);
+                break;
+            }
+
+            case CMD_READ_WORD:
+                if (args[0] & (args[1] - 1)) {
+                    send_status(&s, seq, STATUS_BAD_ARGS);
+                    break;
+                }
+
+                switch (args[1]) {
+                    case 1:
+                        value = *(volatile unsigned char *) (unsigned long) args[0];
+                        break;
+                    case 2:
+                        value = *(volatile unsigned short *) (unsigned long) args[0];
+                        break;
+                    case 4:
+                        value = *(volatile unsigned int *) (unsigned long) args[0];
+                        break;
+#if defined(ARCH_aarch64)
+                    case 8:
+                        value = *(volatile unsigned long *) (unsigned long) args[0];
+                        break;
+#endif
+                    default:
+                        send_status(&s, seq, STATUS_BAD_ARGS);
+                        continue;
+                }
+
+                send_value(&s, seq, value, args[1]);
+                break;
+
+            case CMD_CRC32:
+                value = block_xfer_crc32(&s,
+                                         (volatile const unsigned char *) (unsigned long) args[0],
+                                         args[1]);
+                send_value(&s, seq, value, 4);
+                break;
+
+            case CMD_CALL:
+                if (args[0] >= NUM_JT_FUNCS) {
+                    send_status(&s, seq, STATUS_BAD_ARGS);
+                } else {
+                    jt_call_t fn = ((jt_call_t *) jt)[args[0]];
+                    value = fn(args[1], args[2], args[3]);
+                    send_value(&s, seq, value, sizeof(unsigned long));
+                }
+                break;
+
+            case CMD_EXIT:
+                send_status(&s, seq, STATUS_OK);
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * Search a memory range for one or more byte patterns, printing only the
+ * locations of matches. Refer to Depthcharge.find_patterns() for the host side.
+ *
+ * Usage: go <payload addr> <jt addr> <mem addr> <mem len> <alignment> <hex pattern> [hex pattern ...]
+ *
+ * Only offsets that are a multiple of <alignment> are checked. After the start
+ * sentinel, the payload waits for any character from the host before searching.
+ * Each match is printed on its own line as:
+ *
+ *      <pattern index>:<address>
+ *
+ * The search ends early if the host sends any character while it is running,
+ * or if MAX_MATCHES have been reported. The end sentinel is then printed.
+ *
+ * Note that the number and length of patterns is limited by U-Boot's
+ * CONFIG_SYS_MAXARGS and CONFIG_SYS_CBSIZE settings.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+#include "strlen.h"
+
+#define MAX_PATTERNS        16
+#define PATTERN_BUF_SIZE    256
+#define MAX_MATCHES         4096
+
+/* Check for a host interrupt at this interval (bytes) */
+#define POLL_INTERVAL       0x100000
+
+static inline __attribute__((always_inline))
+int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+int main(int argc, char *argv[])
+{
+    int status;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long mem_addr, mem_len, alignment;
+
+    unsigned char buf[PATTERN_BUF_SIZE];
+    unsigned int pat_off[MAX_PATTERNS];
+    unsigned int pat_len[MAX_PATTERNS];
+    unsigned int n_patterns, buf_used;
+
+    unsigned long offset, next_poll;
+    unsigned int i, j, n_matches;
+    volatile const unsigned char *mem;
+
+    if (argc < 6 || argc > (5 + MAX_PATTERNS)) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &mem_addr);
+    if (status != 0) {
+        jt->printf("Invalid memory address: %s\n", argv[2]);
+        return 3;
+    }
+
+    status = jt->strict_strtoul(argv[3], 0, &mem_len);
+    if (status != 0) {
+        jt->printf("Invalid memory length: %s\n", argv[3]);
+        return 4;
+    }
+
+    status = jt->strict_strtoul(argv[4], 0, &alignment);
+    if (status != 0 || alignment == 0) {
+        jt->printf("Invalid alignment: %s\n", argv[4]);
+        return 5;
+    }
+
+    n_patterns = 0;
+    buf_used = 0;
+
+    for (i = 5; i < (unsigned int) argc; i++) {
+        const char *hex = argv[i];
+        unsigned int len = strlen(hex);
+        int hi, lo;
+
+        if (len == 0 || (len & 1) || (buf_used + (len >> 1)) > PATTERN_BUF_SIZE) {
+            jt->printf("Invalid pattern: %s\n", hex);
+            return 6;
+        }
+
+        pat_off[n_patterns] = buf_used;
+        pat_len[n_patterns] = len >> 1;
+
+        for (j = 0; j < len; j += 2) {
+            hi = hex_nibble(hex[j]);
+            lo = hex_nibble(hex[j + 1]);
+            if (hi < 0 || lo < 0) {
+                jt->printf("Invalid pattern: %s\n", hex);
+                return 6;
+            }
+            buf[buf_used++] = (hi << 4) | lo;
+        }
+
+        n_patterns++;
+    }
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    mem = (volatile const unsigned char *) mem_addr;
+    n_matches = 0;
+    next_poll = POLL_INTERVAL;
+
+    for (offset = 0; offset < mem_len && n_matches < MAX_MATCHES; offset += alignment) {
+        if (offset >= next_poll) {
+            if (jt->tstc()) {
+                jt->getc();
+                break;
+            }
+            next_poll += POLL_INTERVAL;
+        }
+
+        for (i = 0; i < n_patterns; i++) {
+            const unsigned char *pat = &buf[pat_off[i]];
+
+            /* Check the first byte up front to keep the common case fast */
+            if (mem[offset] != pat[0] || pat_len[i] > (mem_len - offset)) {
+                continue;
+            }
+
+            for (j = 1; j < pat_len[i] && mem[offset + j] == pat[j]; j++);
+
+            if (j == pat_len[i]) {
+                jt->printf("%u:%08lx\n", i, mem_addr + offset);
+                n_matches++;
+            }
+        }
+    }
+
+    jt->puts("-:[|END|]:-");
+    return 0;
+}
@@ -6,14 +6,14 @@ int main(int argc, char *argv[])
 {
     int status;
     jt_funcs_t *jt;
-    unsigned int jt_u;
+    unsigned long jt_u;
     unsigned long mem_addr, mem_len;
 
     if (argc != 4) {
         return 1;
     }
 
-    jt_u = str2uint(argv[1]);
+    jt_u = str2ulong(argv[1]);
     if (jt_u == 0) {
         return 2;
     }
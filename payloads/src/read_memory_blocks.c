@@ -0,0 +1,96 @@
+/*
+ * Block-based memory read payload with per-block CRC32 and host-driven
+ * retransmission. Refer to include/block_xfer.h for a description of the
+ * protocol. Block data is sent as-is.
+ *
+ * Usage: go <payload addr> <jt addr> <mem addr> <mem len> [block size] [timeout ms]
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+#include "block_xfer.h"
+
+#define DEFAULT_BLOCK_SIZE  4096
+#define MAX_BLOCK_SIZE      0xffff
+
+int main(int argc, char *argv[])
+{
+    int status;
+    block_xfer_t s;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long mem_addr, mem_len;
+    unsigned long block_size = DEFAULT_BLOCK_SIZE;
+    unsigned long timeout_ms = DEFAULT_TIMEOUT_MS;
+    unsigned int offset, len;
+    volatile const unsigned char *data;
+
+    if (argc < 4 || argc > 6) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &mem_addr);
+    if (status != 0) {
+        jt->printf("Invalid memory address: %s\n", argv[2]);
+        return 3;
+    }
+
+    status = jt->strict_strtoul(argv[3], 0, &mem_len);
+    if (status != 0) {
+        jt->printf("Invalid memory length: %s\n", argv[3]);
+        return 4;
+    }
+
+    if (argc > 4) {
+        status = jt->strict_strtoul(argv[4], 0, &block_size);
+        if (status != 0 || block_size == 0 || block_size > MAX_BLOCK_SIZE) {
+            jt->printf("Invalid block size: %s\n", argv[4]);
+            return 5;
+        }
+    }
+
+    if (argc > 5) {
+        status = jt->strict_strtoul(argv[5], 0, &timeout_ms);
+        if (status != 0 || timeout_ms == 0) {
+            jt->printf("Invalid timeout: %s\n", argv[5]);
+            return 6;
+        }
+    }
+
+    block_xfer_init(&s, jt, timeout_ms);
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    offset = 0;
+
+    while (1) {
+        len = mem_len - offset;
+        if (len > block_size) {
+            len = block_size;
+        }
+
+        data = (volatile const unsigned char *) (mem_addr + offset);
+        block_xfer_send(&s, offset, len, block_xfer_crc32(&s, data, len), data, len);
+
+        switch (block_xfer_await(&s, &offset, len, mem_len)) {
+            case BLOCK_XFER_CONTINUE:
+                break;
+
+            case BLOCK_XFER_DONE:
+                return 0;
+
+            case BLOCK_XFER_QUIT:
+                return 7;
+
+            default:
+                return 8;
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * Variant of read_memory_blocks that run-length encodes each block, which
+ * greatly reduces the time spent transferring erased flash (0xff), zeroed
+ * memory, and padding. Refer to include/block_xfer.h for a description of
+ * the protocol.
+ *
+ * Usage: go <payload addr> <jt addr> <mem addr> <mem len> [block size] [timeout ms]
+ *
+ * Block data consists of a sequence of runs, each beginning with a control byte:
+ *
+ *  0x00 - 0x7f:    Literal run. (control + 1) bytes follow.
+ *  0x80 - 0xff:    Repeat the following byte (control - 0x80 + 3) times.
+ *
+ * The CRC32 in each frame is computed over the decoded data.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+#include "block_xfer.h"
+
+#define DEFAULT_BLOCK_SIZE  4096
+
+/* Blocks are staged on the stack, so keep this modest. */
+#define MAX_BLOCK_SIZE      8192
+
+#define MAX_LITERAL         128
+#define MIN_REPEAT          3
+#define MAX_REPEAT          (0x7f + MIN_REPEAT)
+
+/* Worst case, incompressible data requires a control byte every MAX_LITERAL bytes */
+#define MAX_ENCODED_SIZE    (MAX_BLOCK_SIZE + (MAX_BLOCK_SIZE / MAX_LITERAL) + 1)
+
+/* Returns the number of encoded bytes written to `out` */
+static inline __attribute__((always_inline))
+unsigned int rle_encode(const unsigned char *in, unsigned int len, unsigned char *out)
+{
+    unsigned int i = 0, o = 0;
+    unsigned int run, n, start;
+
+    while (i < len) {
+        run = 1;
+        while ((i + run) < len && run < MAX_REPEAT && in[i + run] == in[i]) {
+            run++;
+        }
+
+        if (run >= MIN_REPEAT) {
+            out[o++] = 0x80 + (run - MIN_REPEAT);
+            out[o++] = in[i];
+            i += run;
+            continue;
+        }
+
+        /* Gather literals until the next run worth encoding */
+        start = i;
+        n = 0;
+        while (i < len && n < MAX_LITERAL) {
+            if ((i + 2) < len && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                break;
+            }
+            i++;
+            n++;
+        }
+
+        out[o++] = n - 1;
+        while (n--) {
+            out[o++] = in[start++];
+        }
+    }
+
+    return o;
+}
+
+int main(int argc, char *argv[])
+{
+    int status;
+    block_xfer_t s;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long mem_addr, mem_len;
+    unsigned long block_size = DEFAULT_BLOCK_SIZE;
+    unsigned long timeout_ms = DEFAULT_TIMEOUT_MS;
+    unsigned int i, offset, len, enc_len, crc;
+    volatile const unsigned char *mem;
+
+    /* Memory is copied once per block, so that the CRC32 and encoded
+     * data remain consistent, even if the contents are changing. */
+    unsigned char block[MAX_BLOCK_SIZE];
+    unsigned char encoded[MAX_ENCODED_SIZE];
+
+    if (argc < 4 || argc > 6) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &mem_addr);
+    if (status != 0) {
+        jt->printf("Invalid memory address: %s\n", argv[2]);
+        return 3;
+    }
+
+    status = jt->strict_strtoul(argv[3], 0, &mem_len);
+    if (status != 0) {
+        jt->printf("Invalid memory length: %s\n", argv[3]);
+        return 4;
+    }
+
+    if (argc > 4) {
+        status = jt->strict_strtoul(argv[4], 0, &block_size);
+        if (status != 0 || block_size == 0 || block_size > MAX_BLOCK_SIZE) {
+            jt->printf("Invalid block size: %s\n", argv[4]);
+            return 5;
+        }
+    }
+
+    if (argc > 5) {
+        status = jt->strict_strtoul(argv[5], 0, &timeout_ms);
+        if (status != 0 || timeout_ms == 0) {
+            jt->printf("Invalid timeout: %s\n", argv[5]);
+            return 6;
+        }
+    }
+
+    block_xfer_init(&s, jt, timeout_ms);
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    offset = 0;
+
+    while (1) {
+        len = mem_len - offset;
+        if (len > block_size) {
+            len = block_size;
+        }
+
+        mem = (volatile const unsigned char *) (mem_addr + offset);
+        for (i = 0; i < len; i++) {
+            block[i] = mem[i];
+        }
+
+        crc = block_xfer_crc32(&s, block, len);
+        enc_len = rle_encode(block, len, encoded);
+        block_xfer_send(&s, offset, len, crc, encoded, enc_len);
+
+        switch (block_xfer_await(&s, &offset, len, mem_len)) {
+            case BLOCK_XFER_CONTINUE:
+                break;
+
+            case BLOCK_XFER_DONE:
+                return 0;
+
+            case BLOCK_XFER_QUIT:
+                return 7;
+
+            default:
+                return 8;
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Print a snapshot of the register file, along with select fields of U-Boot's
+ * global data structure, in a single invocation. Refer to
+ * GoRegisterSnapshotReader for the host side.
+ *
+ * Usage: go <payload addr>
+ *
+ * The jump table is located via gd->jt, so its address need not be known by
+ * the host in advance. After the start sentinel, the payload waits for any
+ * character from the host. It then prints one "<name>:<hex value>" line per
+ * entry, followed by the end sentinel.
+ *
+ * Registers are captured upon entry to main(). As with return_register.c,
+ * those used to pass arguments or by the compiler-generated prologue are
+ * tainted; the callee-saved registers and gd are the values of interest.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+
+#if defined(ARCH_arm)
+
+#define NUM_GPRS    13      /* r0 - r12 */
+#define GPR_FMT     "r%u:%08lx\n"
+#define REG_FMT     "%s:%08lx\n"
+
+#define CAPTURE_REGS(gprs, sp, lr, pc, status) do { \
+    asm volatile ( \
+        "stmia %4, {r0-r12}\n\t" \
+        "mov   %0, sp\n\t" \
+        "mov   %1, lr\n\t" \
+        "mov   %2, pc\n\t" \
+        "mrs   %3, cpsr" \
+        : "=r" (sp), "=r" (lr), "=r" (pc), "=r" (status) \
+        : "r" (gprs) \
+        : "memory"); \
+} while (0)
+
+#define PRINT_SPECIAL_REGS(jt, sp, lr, pc, status) do { \
+    jt->printf(REG_FMT, "sp",   sp); \
+    jt->printf(REG_FMT, "lr",   lr); \
+    jt->printf(REG_FMT, "pc",   pc); \
+    jt->printf(REG_FMT, "cpsr", status); \
+} while (0)
+
+#elif defined(ARCH_aarch64)
+
+#define NUM_GPRS    30      /* x0 - x29. x30 (lr) is reported separately. */
+#define GPR_FMT     "x%u:%016lx\n"
+#define REG_FMT     "%s:%016lx\n"
+
+#define CAPTURE_REGS(gprs, sp, lr, pc, status) do { \
+    asm volatile ( \
+        "stp x0,  x1,  [%4, #0]\n\t" \
+        "stp x2,  x3,  [%4, #16]\n\t" \
+        "stp x4,  x5,  [%4, #32]\n\t" \
+        "stp x6,  x7,  [%4, #48]\n\t" \
+        "stp x8,  x9,  [%4, #64]\n\t" \
+        "stp x10, x11, [%4, #80]\n\t" \
+        "stp x12, x13, [%4, #96]\n\t" \
+        "stp x14, x15, [%4, #112]\n\t" \
+        "stp x16, x17, [%4, #128]\n\t" \
+        "stp x18, x19, [%4, #144]\n\t" \
+        "stp x20, x21, [%4, #160]\n\t" \
+        "stp x22, x23, [%4, #176]\n\t" \
+        "stp x24, x25, [%4, #192]\n\t" \
+        "stp x26, x27, [%4, #208]\n\t" \
+        "stp x28, x29, [%4, #224]\n\t" \
+        "mov %0, sp\n\t" \
+        "mov %1, x30\n\t" \
+        "adr %2, .\n\t" \
+        "mrs %3, CurrentEL" \
+        : "=r" (sp), "=r" (lr), "=r" (pc), "=r" (status) \
+        : "r" (gprs) \
+        : "memory"); \
+} while (0)
+
+#define PRINT_SPECIAL_REGS(jt, sp, lr, pc, status) do { \
+    unsigned long nzcv, daif; \
+    asm volatile ("mrs %0, nzcv" : "=r" (nzcv)); \
+    asm volatile ("mrs %0, daif" : "=r" (daif)); \
+    jt->printf(REG_FMT, "sp",        sp); \
+    jt->printf(REG_FMT, "lr",        lr); \
+    jt->printf(REG_FMT, "pc",        pc); \
+    jt->printf(REG_FMT, "nzcv",      nzcv); \
+    jt->printf(REG_FMT, "daif",      daif); \
+    jt->printf(REG_FMT, "currentel", status); \
+} while (0)
+
+#else
+#   error "read_registers: Unsupported architecture"
+#endif
+
+int main(int argc, char *argv[])
+{
+    /* Declared first and captured before anything else, to minimize taint */
+    unsigned long gprs[NUM_GPRS];
+    unsigned long sp, lr, pc, status;
+    unsigned int i;
+    jt_funcs_t *jt;
+
+    DECLARE_GLOBAL_DATA_PTR(gd);
+
+    CAPTURE_REGS(gprs, sp, lr, pc, status);
+
+    UNUSED(argc);
+    UNUSED(argv);
+
+    jt = gd->jt;
+    if (jt == NULL) {
+        return 1;
+    }
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    for (i = 0; i < NUM_GPRS; i++) {
+        jt->printf(GPR_FMT, i, gprs[i]);
+    }
+
+    PRINT_SPECIAL_REGS(jt, sp, lr, pc, status);
+
+    jt->printf(REG_FMT, "gd",          (unsigned long) gd);
+    jt->printf(REG_FMT, "gd.jt",       (unsigned long) jt);
+    jt->printf(REG_FMT, "gd.baudrate", (unsigned long) gd->baudrate);
+
+    jt->puts("-:[|END|]:-");
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Print the values of many (possibly scattered) 32-bit words in a single
+ * invocation. Refer to Depthcharge.read_words() for the host side.
+ *
+ * Usage: go <payload addr> <jt addr> <addr>[:<count>] [<addr>[:<count>] ...]
+ *
+ * Each argument specifies a word-aligned address and the number of consecutive
+ * words to read from it (default: 1). After the start sentinel, the payload
+ * waits for any character from the host. It then prints one line per argument,
+ * containing the words' values in hex (8 characters each), followed by the
+ * end sentinel.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+
+int main(int argc, char *argv[])
+{
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long addr, count;
+    char *end;
+    int i;
+    volatile const unsigned int *word;
+
+    if (argc < 3) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    /* Validate all arguments before printing anything */
+    for (i = 2; i < argc; i++) {
+        addr = jt->simple_strtoul(argv[i], &end, 0);
+        count = 1;
+
+        if (*end == ':') {
+            count = jt->simple_strtoul(end + 1, &end, 0);
+        }
+
+        if (*end != '\0' || count == 0 || (addr & 0x3) != 0) {
+            jt->printf("Invalid argument: %s\n", argv[i]);
+            return 3;
+        }
+    }
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    for (i = 2; i < argc; i++) {
+        addr = jt->simple_strtoul(argv[i], &end, 0);
+        count = 1;
+
+        if (*end == ':') {
+            count = jt->simple_strtoul(end + 1, &end, 0);
+        }
+
+        word = (volatile const unsigned int *) addr;
+        while (count--) {
+            jt->printf("%08x", *word++);
+        }
+
+        jt->putc('\n');
+    }
+
+    jt->puts("-:[|END|]:-");
+    return 0;
+}
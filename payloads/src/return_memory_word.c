@@ -3,15 +3,17 @@
 #include "depthcharge.h"
 #include "str2uint.h"
 
-int main(int argc, char * argv[])
+// U-Boot's "go" command reports our return value as an unsigned long,
+// allowing a full word to be returned on AArch64 as well as ARM.
+unsigned long main(int argc, char * argv[])
 {
     DECLARE_GLOBAL_DATA_VOID_PTR(gd);
-    unsigned int *ret_p;
+    unsigned long *ret_p;
 
     if (argc < 2) {
-        return (int) gd;
+        return (unsigned long) gd;
     }
 
-    ret_p = (unsigned int *) str2uint(argv[1]);
-    return (int) (*ret_p);
+    ret_p = (unsigned long *) str2ulong(argv[1]);
+    return *ret_p;
 }
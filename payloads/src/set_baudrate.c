@@ -0,0 +1,147 @@
+/*
+ * Switch the console UART to a different baud rate, verifying that the host
+ * is able to communicate at the new rate before committing to it.
+ * Refer to Depthcharge.set_baudrate() for the host side.
+ *
+ * Usage: go <payload addr> <jt addr> <baudrate> [timeout ms]
+ *
+ *  1. The start sentinel is sent at the current rate. The payload then waits
+ *     for the host to respond with any character, after which both sides
+ *     switch to the new rate.
+ *
+ *  2. The sync sentinel is sent periodically at the new rate, until the host
+ *     responds with 'k' or the timeout elapses.
+ *
+ *  3. If the host responded, the end sentinel is sent and 0 is returned.
+ *     Otherwise, the original baud rate is restored and a non-zero value
+ *     is returned.
+ *
+ * The switch itself is performed by setting the "baudrate" environment
+ * variable, whose callback updates gd->baudrate and reconfigures the UART.
+ * This does not modify the environment stored in non-volatile memory.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+
+#define DEFAULT_TIMEOUT_MS  2000
+#define SYNC_INTERVAL_MS    50
+
+/* Enough for a 32-bit value in decimal, plus a NUL terminator */
+#define UINT_STR_LEN        11
+
+/* Convert value to a decimal string, without relying upon division */
+static inline __attribute__((always_inline))
+void uint2str(unsigned int value, char *buf)
+{
+    static const unsigned int pow10[UINT_STR_LEN - 1] = {
+        1000000000, 100000000, 10000000, 1000000, 100000,
+        10000, 1000, 100, 10, 1
+    };
+
+    unsigned int i, digit;
+    unsigned int j = 0;
+
+    for (i = 0; i < (UINT_STR_LEN - 1); i++) {
+        digit = 0;
+        while (value >= pow10[i]) {
+            value -= pow10[i];
+            digit++;
+        }
+
+        /* Skip leading zeros, but always emit the final digit */
+        if (digit != 0 || j != 0 || i == (UINT_STR_LEN - 2)) {
+            buf[j++] = '0' + digit;
+        }
+    }
+
+    buf[j] = '\0';
+}
+
+static inline __attribute__((always_inline))
+int wait_for_sync(jt_funcs_t *jt, unsigned long timeout_ms)
+{
+    unsigned long start = jt->get_timer(0);
+    unsigned long last_sync;
+
+    jt->puts("-:[SYNC]:-");
+    last_sync = jt->get_timer(0);
+
+    while (jt->get_timer(start) < timeout_ms) {
+        if (jt->tstc()) {
+            if (jt->getc() == 'k') {
+                return 0;
+            }
+        } else if (jt->get_timer(last_sync) >= SYNC_INTERVAL_MS) {
+            jt->puts("-:[SYNC]:-");
+            last_sync = jt->get_timer(0);
+        }
+    }
+
+    return -1;
+}
+
+int main(int argc, char *argv[])
+{
+    DECLARE_GLOBAL_DATA_PTR(gd);
+
+    int status;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long baudrate;
+    unsigned long timeout_ms = DEFAULT_TIMEOUT_MS;
+    char orig_baudrate[UINT_STR_LEN];
+    char new_baudrate[UINT_STR_LEN];
+
+    if (argc < 3 || argc > 4) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &baudrate);
+    if (status != 0 || baudrate == 0) {
+        jt->printf("Invalid baud rate: %s\n", argv[2]);
+        return 3;
+    }
+
+    if (argc > 3) {
+        status = jt->strict_strtoul(argv[3], 0, &timeout_ms);
+        if (status != 0 || timeout_ms == 0) {
+            jt->printf("Invalid timeout: %s\n", argv[3]);
+            return 4;
+        }
+    }
+
+    /* The environment callback expects decimal values */
+    uint2str(gd->baudrate, orig_baudrate);
+    uint2str(baudrate, new_baudrate);
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    /* Give the host a moment to reconfigure its side of the link */
+    jt->udelay(10000);
+
+    if (gd->baudrate != baudrate) {
+        status = jt->env_set("baudrate", new_baudrate);
+        if (status != 0 || gd->baudrate != baudrate) {
+            /* The new rate was rejected (e.g. not in CONFIG_SYS_BAUDRATE_TABLE),
+             * so we're still at the original rate. The host won't see our
+             * sync sentinel and will revert its own configuration. */
+            return 5;
+        }
+    }
+
+    if (wait_for_sync(jt, timeout_ms) != 0) {
+        jt->env_set("baudrate", orig_baudrate);
+        return 6;
+    }
+
+    jt->puts("-:[|END|]:-");
+    return 0;
+}
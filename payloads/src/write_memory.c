@@ -0,0 +1,206 @@
+/*
+ * Streamed memory write payload with per-block CRC32 and host-driven
+ * retransmission. Refer to GoMemoryWriter for the host side.
+ *
+ * Usage: go <payload addr> <jt addr> <mem addr> <mem len> [block size] [timeout ms]
+ *
+ * After the start sentinel, the payload waits for any character from the host.
+ * The host then sends each block as raw bytes:
+ *
+ *      [offset: LE32][length: LE16][crc32: LE32][data]
+ *
+ * The offset and length must match those of the next expected block, given the
+ * block size. The data is written directly to its destination, and the block
+ * is ACK'd once its CRC32 has been verified. Otherwise, any remaining input is
+ * discarded and the payload requests that the host resend data starting from
+ * the next expected offset. Responses are sent as a single line:
+ *
+ *      a<8 hex chars>      ACK. Send the block at the specified offset.
+ *      r<8 hex chars>      Resend, starting from the specified offset.
+ *      d<8 hex chars>      Done. Sent in response to a block with a length of 0
+ *                          (and an offset equal to the memory length).
+ *
+ * A block header with an offset of 0xffffffff causes the payload to quit.
+ * If no data is received within the timeout period MAX_RETRIES consecutive
+ * times, the payload gives up.
+ */
+#include "depthcharge.h"
+#include "u-boot.h"
+#include "str2uint.h"
+#include "block_xfer.h"
+
+#define DEFAULT_BLOCK_SIZE  4096
+#define MAX_BLOCK_SIZE      0xffff
+
+#define QUIT_OFFSET         0xffffffff
+
+/* Input must be quiet for this long (ms) before we request a resend */
+#define DRAIN_MS            20
+
+/* Returns 0 on success, and -1 on timeout */
+static inline __attribute__((always_inline))
+int get_le(block_xfer_t *s, unsigned int *value, unsigned int n)
+{
+    unsigned int i;
+    int c;
+
+    *value = 0;
+
+    for (i = 0; i < (n << 3); i += 8) {
+        c = block_xfer_getc(s);
+        if (c < 0) {
+            return -1;
+        }
+        *value |= ((unsigned int) c) << i;
+    }
+
+    return 0;
+}
+
+/* Discard input until none has been received for DRAIN_MS */
+static inline __attribute__((always_inline))
+void drain(jt_funcs_t *jt)
+{
+    unsigned long start = jt->get_timer(0);
+
+    while (jt->get_timer(start) < DRAIN_MS) {
+        if (jt->tstc()) {
+            jt->getc();
+            start = jt->get_timer(0);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int status;
+    block_xfer_t s;
+    jt_funcs_t *jt;
+    unsigned long jt_u;
+    unsigned long mem_addr, mem_len;
+    unsigned long block_size = DEFAULT_BLOCK_SIZE;
+    unsigned long timeout_ms = DEFAULT_TIMEOUT_MS;
+
+    unsigned int offset, expected_len;
+    unsigned int blk_offset, blk_len, blk_crc;
+    unsigned int crc, i, retries;
+    volatile unsigned char *dest;
+    int c;
+
+    if (argc < 4 || argc > 6) {
+        return 1;
+    }
+
+    jt_u = str2ulong(argv[1]);
+    if (jt_u == 0) {
+        return 2;
+    }
+    jt = (jt_funcs_t*) jt_u;
+
+    status = jt->strict_strtoul(argv[2], 0, &mem_addr);
+    if (status != 0) {
+        jt->printf("Invalid memory address: %s\n", argv[2]);
+        return 3;
+    }
+
+    status = jt->strict_strtoul(argv[3], 0, &mem_len);
+    if (status != 0) {
+        jt->printf("Invalid memory length: %s\n", argv[3]);
+        return 4;
+    }
+
+    if (argc > 4) {
+        status = jt->strict_strtoul(argv[4], 0, &block_size);
+        if (status != 0 || block_size == 0 || block_size > MAX_BLOCK_SIZE) {
+            jt->printf("Invalid block size: %s\n", argv[4]);
+            return 5;
+        }
+    }
+
+    if (argc > 5) {
+        status = jt->strict_strtoul(argv[5], 0, &timeout_ms);
+        if (status != 0 || timeout_ms == 0) {
+            jt->printf("Invalid timeout: %s\n", argv[5]);
+            return 6;
+        }
+    }
+
+    block_xfer_init(&s, jt, timeout_ms);
+
+    jt->puts("-:[START]:-");
+    jt->getc();
+
+    offset = 0;
+    retries = 0;
+
+    while (1) {
+        expected_len = mem_len - offset;
+        if (expected_len > block_size) {
+            expected_len = block_size;
+        }
+
+        /* Nothing received - remain silent, but don't wait forever */
+        c = block_xfer_getc(&s);
+        if (c < 0) {
+            if (++retries >= MAX_RETRIES) {
+                return 8;
+            }
+            continue;
+        }
+
+        blk_offset = c;
+        if (get_le(&s, &i, 3) != 0) {
+            goto resend;
+        }
+        blk_offset |= i << 8;
+
+        if (blk_offset == QUIT_OFFSET) {
+            return 7;
+        }
+
+        if (get_le(&s, &blk_len, 2) != 0 || get_le(&s, &blk_crc, 4) != 0) {
+            goto resend;
+        }
+
+        /* Only ever write to the expected location */
+        if (blk_offset != offset || blk_len != expected_len) {
+            goto resend;
+        }
+
+        dest = (volatile unsigned char *) (mem_addr + offset);
+        crc = 0xffffffff;
+
+        for (i = 0; i < blk_len; i++) {
+            c = block_xfer_getc(&s);
+            if (c < 0) {
+                break;
+            }
+
+            dest[i] = c;
+            crc = block_xfer_crc32_update(&s, crc, c);
+        }
+
+        if (i != blk_len || (crc ^ 0xffffffff) != blk_crc) {
+            goto resend;
+        }
+
+        retries = 0;
+
+        if (blk_len == 0) {
+            jt->printf("d%08x\n", offset);
+            return 0;
+        }
+
+        offset += blk_len;
+        jt->printf("a%08x\n", offset);
+        continue;
+
+resend:
+        if (++retries >= MAX_RETRIES) {
+            return 8;
+        }
+
+        drain(jt);
+        jt->printf("r%08x\n", offset);
+    }
+}
@@ -24,7 +24,7 @@ from . import uboot
 
 from .context   import Depthcharge
 from .console   import Console
-from .companion import Companion
+from .companion import Companion, CompanionI2CHandle
 
 from .operation import (Operation,
                         OperationSet,
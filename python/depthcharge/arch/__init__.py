@@ -9,4 +9,5 @@ Support for various target architectures
 from .arch import Architecture
 
 from .arm import ARM
+from .aarch64 import AArch64
 from .generic import Generic, GenericBE, Generic64, Generic64BE
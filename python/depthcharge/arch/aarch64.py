@@ -0,0 +1,33 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+"""
+ARM 64-bit support
+"""
+
+from .arch import Architecture
+
+
+class AArch64(Architecture):
+    """
+    ARMv8 (or later) AArch64 target information - 64-bit little-endian
+    """
+    _desc = 'ARM 64-bit, little-endian'
+    _alignment = 8
+    _word_size = 8
+    _phys_size = 8
+    _word_mask = 0xffffffff_ffffffff
+    _endianness = 'little'
+    _supports_64bit_data = True
+
+    # Names match those reported by the READ_REGISTERS payload
+    _regs = {
+        **{'x{:d}'.format(i): {} for i in range(0, 29)},
+        'x18':          {'gd': True},
+        'x29':          {'alias': 'fp'},
+        'lr':           {'alias': 'x30'},
+        'sp':           {},
+        'pc':           {},
+        'nzcv':         {},
+        'daif':         {},
+        'currentel':    {},
+    }
@@ -40,6 +40,7 @@ class ARM(Architecture):
         'r13': {'ident': 0x6e, 'alias': 'sp'},
         'r14': {'ident': 0x6f, 'alias': 'lr'},
         'r15': {'ident': 0x70, 'alias': 'pc'},
+        'cpsr': {'ident': 0x71},
     }
 
     _DA_ENTRY = re.compile(r"""
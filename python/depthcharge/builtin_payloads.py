@@ -1,83 +1,3876 @@
 # SPDX-License-Identifier: BSD-3-Clause
 """
 Built-in Depthcharge payloads
-(Autogenerated on Mon May 11 21:36:31 2020)
+(Autogenerated on Wed Oct 14 07:23:07 2026)
+(Built with Debian clang version 14.0.6)
 """
 
-READ_MEMORY = {
+BLOCK_CRC32 = {
+    'aarch64':
+        b'\xfd\x7b\xbc\xa9\xfc\x5f\x01\xa9\xfd\x03\x00\x91\xf6\x57\x02\xa9'
+        b'\xf4\x4f\x03\xa9\xff\x83\x10\xd1\x1f\x14\x00\x71\xa1\x05\x00\x54'
+        b'\x2a\x04\x40\xf9\xf3\x03\x01\xaa\x48\x01\x40\x39\x88\x08\x00\x34'
+        b'\xe9\x03\x1f\xaa\x4b\x05\x00\x91\x2c\x05\x00\x91\x6d\x69\x69\x38'
+        b'\xe9\x03\x0c\xaa\xad\xff\xff\x35\x9f\x0d\x00\xf1\x63\x04\x00\x54'
+        b'\x1f\xc1\x00\x71\x21\x04\x00\x54\x49\x05\x40\x39\x3f\xe1\x01\x71'
+        b'\xc1\x03\x00\x54\x49\x09\x40\x39\xa9\x06\x00\x34\xeb\x05\x80\x12'
+        b'\xf4\x03\x1f\xaa\x48\x0d\x00\x91\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1'
+        b'\x07\x00\x00\x14\x29\x1d\x40\x92\x8d\xee\x7c\xd3\x8c\x01\x09\x0b'
+        b'\x09\x15\x40\x38\x94\x01\x0d\x8b\x69\x03\x00\x34\xec\x05\x80\x12'
+        b'\x2d\xc1\x00\x51\xbf\x29\x00\x71\xe3\xfe\xff\x54\xec\x03\x0a\xaa'
+        b'\x2d\x85\x01\x51\xbf\x19\x00\x71\x63\xfe\xff\x54\xec\x03\x0b\xaa'
+        b'\x2d\x05\x01\x51\xbf\x15\x00\x71\xe9\xfd\xff\x54\x1c\x00\x00\x14'
+        b'\x20\x00\x80\x52\x1b\x00\x00\x14\xf4\x03\x1f\xaa\xe9\x05\x80\x12'
+        b'\x4a\x05\x00\x91\x4b\x01\x80\x52\x0c\xc1\x00\x51\x9f\x25\x00\x71'
+        b'\x68\x02\x00\x54\x28\x01\x28\x0b\x94\x22\x0b\x9b\x48\x15\x40\x38'
+        b'\x48\xff\xff\x35\xd4\x01\x00\xb4\x88\x46\x40\xf9\xa2\x23\x00\xd1'
+        b'\x60\x0a\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\xe0\x01\x00\x34'
+        b'\x00\x00\x00\x90\x88\x16\x40\xf9\x61\x0a\x40\xf9\x00\x8c\x0e\x91'
+        b'\x00\x01\x3f\xd6\x60\x00\x80\x52\x02\x00\x00\x14\x40\x00\x80\x52'
+        b'\xff\x83\x10\x91\xf4\x4f\x43\xa9\xf6\x57\x42\xa9\xfc\x5f\x41\xa9'
+        b'\xfd\x7b\xc4\xa8\xc0\x03\x5f\xd6\x88\x46\x40\xf9\xa2\x43\x00\xd1'
+        b'\x60\x0e\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x00\x01\x00\x34'
+        b'\x00\x00\x00\x90\x88\x16\x40\xf9\x61\x0e\x40\xf9\x00\x20\x0e\x91'
+        b'\x00\x01\x3f\xd6\x80\x00\x80\x52\xee\xff\xff\x17\x88\x46\x40\xf9'
+        b'\xa2\x63\x00\xd1\x60\x12\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6'
+        b'\x00\x0c\x00\x35\xa8\x83\x5e\xf8\xc8\x0b\x00\xb4\x09\x00\x00\x90'
+        b'\x0a\x64\x90\x52\x0a\xb7\xbd\x72\xe8\x03\x1f\xaa\x20\x04\x00\x4f'
+        b'\x81\x04\x00\x4f\x22\xd9\xc0\x3d\xe9\x23\x00\x91\x43\x0d\x04\x4e'
+        b'\x44\x1c\x20\x4e\x45\x04\x3f\x6f\x42\x84\xa1\x4e\x84\x98\xa0\x4e'
+        b'\xa6\x1c\x23\x6e\xa4\x1c\x66\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x24\x69\xa8\x3c\x08\x41\x00\x91\x1f\x01\x10\xf1'
+        b'\x81\xfa\xff\x54\x00\x00\x00\x90\x88\x12\x40\xf9\x00\x2c\x0f\x91'
+        b'\x00\x01\x3f\xd6\x88\x06\x40\xf9\x00\x01\x3f\xd6\xa8\x03\x5f\xf8'
+        b'\xe8\x04\x00\xb4\x13\x00\x00\x90\xf5\x03\x1f\xaa\xf6\x23\x00\x91'
+        b'\x73\x5e\x0f\x91\x0a\x00\x00\x14\x08\x00\x80\x12\x89\x16\x40\xf9'
+        b'\xe1\x03\x28\x2a\xe0\x03\x13\xaa\x20\x01\x3f\xd6\xa8\x03\x5f\xf8'
+        b'\xb5\x42\x37\x8b\x1f\x01\x15\xeb\x29\x03\x00\x54\xa9\x83\x5e\xf8'
+        b'\x08\x01\x15\xcb\x3f\x41\x28\xeb\x37\x31\x88\x9a\x77\xfe\xff\x34'
+        b'\xa8\x83\x5f\xf8\xea\x7e\x40\x92\x09\x01\x15\x8b\x08\x00\x80\x12'
+        b'\x2b\x15\x40\x38\x0c\x1d\x00\x12\x4a\x05\x00\xf1\x8b\x01\x0b\x4a'
+        b'\xcb\x5a\x6b\xb8\x68\x21\x48\x4a\x41\xff\xff\x54\xe8\xff\xff\x17'
+        b'\x00\x00\x00\x90\x88\x16\x40\xf9\x61\x12\x40\xf9\x00\xc0\x0d\x91'
+        b'\x00\x01\x3f\xd6\xa0\x00\x80\x52\x82\xff\xff\x17\x00\x00\x00\x90'
+        b'\x88\x12\x40\xf9\x00\xfc\x0e\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a'
+        b'\x7c\xff\xff\x17\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00'
+        b'\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69'
+        b'\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25'
+        b'\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72'
+        b'\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x2d'
+        b'\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d\x3a\x5b\x53\x54'
+        b'\x41\x52\x54\x5d\x3a\x2d\x00\x25\x30\x38\x78\x0a\x00',
     'arm':
-        b'\xf0\x40\x2d\xe9\x04\x00\x50\xe3\x01\x60\xa0\x13\x0c\xd0\x4d\xe2'
-        b'\x03\x00\x00\x0a\x06\x00\xa0\xe1\x0c\xd0\x8d\xe2\xf0\x40\xbd\xe8'
-        b'\x1e\xff\x2f\xe1\x01\x50\xa0\xe1\x04\x10\x91\xe5\x01\xc0\xa0\xe1'
-        b'\x01\x30\xdc\xe4\x00\x00\x53\xe3\x17\x00\x00\x0a\x0c\x00\xa0\xe1'
-        b'\x00\x20\xa0\xe3\x01\x40\xd0\xe4\x00\x00\x54\xe3\x01\x20\x82\xe2'
-        b'\xfb\xff\xff\x1a\x02\x00\x52\xe3\x04\x00\x00\x9a\x30\x00\x53\xe3'
-        b'\x02\x00\x00\x1a\x01\x20\xd1\xe5\x78\x00\x52\xe3\x3c\x00\x00\x0a'
-        b'\x00\x40\xa0\xe3\x03\x00\x00\xea\x01\x30\xf1\xe5\x00\x00\x53\xe3'
-        b'\x02\x40\x84\xe0\x06\x00\x00\x0a\x30\x20\x43\xe2\x04\x41\x84\xe0'
-        b'\x09\x00\x52\xe3\x84\x40\xa0\xe1\xf6\xff\xff\x9a\x02\x60\xa0\xe3'
-        b'\xdb\xff\xff\xea\x00\x00\x54\xe3\xfb\xff\xff\x0a\x00\x10\xa0\xe3'
-        b'\x0d\x20\xa0\xe1\x44\x30\x94\xe5\x08\x00\x95\xe5\x0f\xe0\xa0\xe1'
-        b'\x13\xff\x2f\xe1\x00\x10\x50\xe2\x32\x00\x00\x1a\x44\x30\x94\xe5'
-        b'\x0c\x00\x95\xe5\x04\x20\x8d\xe2\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
-        b'\x00\x60\x50\xe2\x33\x00\x00\x1a\xe8\x00\x9f\xe5\x10\x30\x94\xe5'
-        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x04\x30\x94\xe5'
-        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x04\x30\x9d\xe5\x00\x00\x53\xe3'
-        b'\x00\x70\x9d\xe5\x08\x00\x00\x0a\x06\x50\xa0\xe1\x05\x00\xd7\xe7'
-        b'\x0c\x30\x94\xe5\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x04\x30\x9d\xe5'
-        b'\x01\x50\x85\xe2\x05\x00\x53\xe1\xf7\xff\xff\x8a\x98\x00\x9f\xe5'
-        b'\x10\x30\x94\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
-        b'\xaf\xff\xff\xea\x05\x00\x52\xe3\xcf\xff\xff\x8a\x37\x20\x43\xe2'
-        b'\x02\x40\x84\xe0\x01\x30\xfc\xe5\x00\x00\x53\xe3\x30\x20\x43\xe2'
-        b'\x61\x10\x43\xe2\xca\xff\xff\x0a\x09\x00\x52\xe3\x04\x42\xa0\xe1'
-        b'\xf6\xff\xff\x9a\x05\x00\x51\xe3\x41\x20\x43\xe2\x57\x20\x43\x92'
-        b'\xf2\xff\xff\x9a\xee\xff\xff\xea\x40\x00\x9f\xe5\x14\x30\x94\xe5'
-        b'\x04\x10\x95\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
-        b'\x03\x60\xa0\xe3\x96\xff\xff\xea\x24\x00\x9f\xe5\x14\x30\x94\xe5'
-        b'\x08\x10\x95\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
-        b'\x04\x60\xa0\xe3\x8e\xff\xff\xea\x28\x01\x00\x00\xe0\x00\x00\x00'
-        b'\x3c\x00\x00\x00\x38\x00\x00\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
-        b'\x6d\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20'
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x41\xde\x4d\xe2\x01\x40\xa0\xe1'
+        b'\x00\x10\xa0\xe1\x01\x00\xa0\xe3\x05\x00\x51\xe3\xb8\x00\x00\x1a'
+        b'\x04\x30\x94\xe5\x02\x00\xa0\xe3\x00\x10\xd3\xe5\x00\x00\x51\xe3'
+        b'\xb3\x00\x00\x0a\x01\x20\x83\xe2\x00\x70\xa0\xe3\x07\x60\xd2\xe7'
+        b'\x01\x70\x87\xe2\x00\x00\x56\xe3\xfb\xff\xff\x1a\x03\x00\x57\xe3'
+        b'\x03\x00\x00\x3a\x30\x00\x51\xe3\x01\x70\xd3\x05\x78\x00\x57\x03'
+        b'\x1b\x00\x00\x0a\x00\x50\xa0\xe3\x30\x30\x41\xe2\x09\x00\x53\xe3'
+        b'\xa3\x00\x00\x8a\x05\x31\x85\xe0\x83\x10\x81\xe0\x30\x50\x41\xe2'
+        b'\x01\x10\xd2\xe4\x00\x00\x51\xe3\xf6\xff\xff\x1a\x00\x00\x55\xe3'
+        b'\x9b\x00\x00\x0a\x08\x00\x94\xe5\x44\x30\x95\xe5\x20\x20\x4b\xe2'
+        b'\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x20\x00\x00\x0a\x08\x10\x94\xe5\x14\x20\x95\xe5\x50\x02\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x03\x00\xa0\xe3'
+        b'\x8b\x00\x00\xea\x02\x10\xd3\xe5\x00\x00\x51\xe3\x88\x00\x00\x0a'
+        b'\x03\x20\x83\xe2\x00\x50\xa0\xe3\x05\x00\x00\xea\x05\x72\xa0\xe1'
+        b'\x01\x10\x87\xe0\x03\x50\x81\xe0\x01\x10\xd2\xe4\x00\x00\x51\xe3'
+        b'\xe1\xff\xff\x0a\x30\x70\x41\xe2\x2f\x30\xe0\xe3\x0a\x00\x57\xe3'
+        b'\xf5\xff\xff\x3a\x61\x70\x41\xe2\x56\x30\xe0\xe3\x06\x00\x57\xe3'
+        b'\xf1\xff\xff\x3a\x41\x70\x41\xe2\x36\x30\xe0\xe3\x05\x00\x57\xe3'
+        b'\xed\xff\xff\x9a\x72\x00\x00\xea\x0c\x00\x94\xe5\x44\x30\x95\xe5'
+        b'\x24\x20\x4b\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x07\x00\x00\x0a\x0c\x10\x94\xe5\x14\x20\x95\xe5'
+        b'\xb0\x01\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x04\x00\xa0\xe3\x62\x00\x00\xea\x10\x00\x94\xe5\x44\x30\x95\xe5'
+        b'\x28\x20\x4b\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x4c\x00\x00\x1a\x28\x00\x1b\xe5\x00\x00\x50\xe3'
+        b'\x49\x00\x00\x0a\x64\x11\x9f\xe5\x00\x00\xa0\xe3\x0d\xa0\xa0\xe1'
+        b'\xa0\x20\x21\xe0\x01\x00\x10\xe3\xa0\x20\xa0\x01\xa2\x30\x21\xe0'
+        b'\x01\x00\x12\xe3\xa2\x30\xa0\x01\xa3\x20\x21\xe0\x01\x00\x13\xe3'
+        b'\xa3\x20\xa0\x01\xa2\x30\x21\xe0\x01\x00\x12\xe3\xa2\x30\xa0\x01'
+        b'\xa3\x20\x21\xe0\x01\x00\x13\xe3\xa3\x20\xa0\x01\xa2\x30\x21\xe0'
+        b'\x01\x00\x12\xe3\xa2\x30\xa0\x01\xa3\x20\x21\xe0\x01\x00\x13\xe3'
+        b'\xa3\x20\xa0\x01\xa2\x30\x21\xe0\x01\x00\x12\xe3\xa2\x30\xa0\x01'
+        b'\x00\x31\x8a\xe7\x01\x00\x80\xe2\x01\x0c\x50\xe3\xe3\xff\xff\x1a'
+        b'\x10\x10\x95\xe5\xf0\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x95\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x24\x00\x1b\xe5\x00\x00\x50\xe3\x27\x00\x00\x0a\xcc\x80\x9f\xe5'
+        b'\x00\x70\xa0\xe3\x08\x80\x8f\xe0\x09\x00\x00\xea\x00\x00\xe0\xe3'
+        b'\x14\x20\x95\xe5\x00\x10\xe0\xe1\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x24\x00\x1b\xe5\x07\x70\x84\xe0\x07\x00\x50\xe1'
+        b'\x19\x00\x00\x9a\x07\x40\x40\xe0\x28\x00\x1b\xe5\x00\x00\x54\xe1'
+        b'\x00\x40\xa0\x81\x00\x00\x54\xe3\xef\xff\xff\x0a\x20\x00\x1b\xe5'
+        b'\x04\x20\xa0\xe1\x07\x10\x80\xe0\x00\x00\xe0\xe3\x01\x30\xd1\xe4'
+        b'\xff\x60\x00\xe2\x01\x20\x52\xe2\x03\x30\x26\xe0\x03\x31\x9a\xe7'
+        b'\x20\x04\x23\xe0\xf8\xff\xff\x1a\xe4\xff\xff\xea\x10\x10\x94\xe5'
+        b'\x14\x20\x95\xe5\x4c\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x05\x00\xa0\xe3\x05\x00\x00\xea\x10\x10\x95\xe5'
+        b'\x2c\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x00\xa0\xe3\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8\x1e\xff\x2f\xe1'
+        b'\x20\x83\xb8\xed\x97\x02\x00\x00\xd8\x01\x00\x00\x57\x01\x00\x00'
+        b'\x37\x01\x00\x00\x7f\x00\x00\x00\x4c\x00\x00\x00\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69\x7a\x65\x3a\x20'
         b'\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f'
-        b'\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25\x73\x0a\x00\x00'
-        b'\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x2d\x3a\x5b\x7c'
-        b'\x45\x4e\x44\x7c\x5d\x3a\x2d\x00',
+        b'\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25\x73\x0a\x00\x49'
+        b'\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x61\x64'
+        b'\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x2d\x3a\x5b\x7c\x45'
+        b'\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d'
+        b'\x3a\x2d\x00\x25\x30\x38\x78\x0a\x00',
+}
+
+COMMAND_SERVER = {
+    'aarch64':
+        b'\xfd\x7b\xba\xa9\xfc\x6f\x01\xa9\xfd\x03\x00\x91\xfa\x67\x02\xa9'
+        b'\xf8\x5f\x03\xa9\xf6\x57\x04\xa9\xf4\x4f\x05\xa9\xff\x07\x40\xd1'
+        b'\xff\xc3\x13\xd1\x09\x7d\x80\x52\x1f\x0c\x00\x71\xe8\x03\x12\xaa'
+        b'\xe9\x17\x08\xf9\x6d\x00\x00\x54\x20\x00\x80\x52\x4a\x0e\x00\x14'
+        b'\xf3\x03\x01\xaa\x1f\x08\x00\x71\x0b\x07\x00\x54\x6b\x06\x40\xf9'
+        b'\x69\x01\x40\x39\xa9\x06\x00\x34\xea\x03\x1f\xaa\x6c\x05\x00\x91'
+        b'\x4d\x05\x00\x91\x8e\x69\x6a\x38\xea\x03\x0d\xaa\xae\xff\xff\x35'
+        b'\xbf\x0d\x00\xf1\x23\x04\x00\x54\x3f\xc1\x00\x71\xe1\x03\x00\x54'
+        b'\x6a\x05\x40\x39\x5f\xe1\x01\x71\x81\x03\x00\x54\x6a\x09\x40\x39'
+        b'\xca\x04\x00\x34\xec\x05\x80\x12\xf8\x03\x1f\xaa\x69\x0d\x00\x91'
+        b'\x8b\x9d\x00\xd1\x8c\x1d\x00\xd1\x07\x00\x00\x14\x4a\x1d\x40\x92'
+        b'\x0e\xef\x7c\xd3\xad\x01\x0a\x0b\x2a\x15\x40\x38\xb8\x01\x0e\x8b'
+        b'\x2a\x03\x00\x34\xed\x05\x80\x12\x4e\xc1\x00\x51\xdf\x29\x00\x71'
+        b'\xe3\xfe\xff\x54\xed\x03\x0b\xaa\x4e\x85\x01\x51\xdf\x19\x00\x71'
+        b'\x63\xfe\xff\x54\xed\x03\x0c\xaa\x4e\x05\x01\x51\xdf\x15\x00\x71'
+        b'\xe9\xfd\xff\x54\x0d\x00\x00\x14\xf8\x03\x1f\xaa\xea\x05\x80\x12'
+        b'\x6b\x05\x00\x91\x4c\x01\x80\x52\x2d\xc1\x00\x51\xbf\x25\x00\x71'
+        b'\xc8\x00\x00\x54\x49\x01\x29\x0b\x18\x27\x0c\x9b\x69\x15\x40\x38'
+        b'\x49\xff\xff\x35\x58\x00\x00\xb5\x18\x71\x40\xf9\x78\x02\x00\xb4'
+        b'\x1f\x0c\x00\x71\x6b\x02\x00\x54\xe2\x07\x40\x91\x08\x47\x40\xf9'
+        b'\x60\x0a\x40\xf9\x42\xa0\x00\x91\xe1\x03\x1f\x2a\x00\x01\x3f\xd6'
+        b'\x60\x00\x00\x35\xe9\x17\x48\xf9\x69\x01\x00\xb5\x00\x00\x00\xf0'
+        b'\x08\x17\x40\xf9\x61\x0a\x40\xf9\x00\x30\x28\x91\x00\x01\x3f\xd6'
+        b'\x60\x00\x80\x52\xfc\x0d\x00\x14\x40\x00\x80\x52\xfa\x0d\x00\x14'
+        b'\x09\x7d\x80\x52\xe9\x1f\x08\xf9\x09\x00\x00\xf0\x0b\x64\x90\x52'
+        b'\xea\x07\x40\x91\x0b\xb7\xbd\x72\x4a\xc1\x00\x91\x20\x04\x00\x4f'
+        b'\xe8\x03\x1f\xaa\x81\x04\x00\x4f\x22\x65\xc2\x3d\x49\x51\x00\x91'
+        b'\x63\x0d\x04\x4e\xf8\x1b\x08\xf9\xff\x43\x10\xb9\xff\xcb\x14\xb9'
+        b'\x44\x1c\x20\x4e\x45\x04\x3f\x6f\x42\x84\xa1\x4e\x84\x98\xa0\x4e'
+        b'\xa6\x1c\x23\x6e\xa4\x1c\x66\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x24\x69\xa8\x3c\x08\x41\x00\x91\x1f\x01\x10\xf1'
+        b'\x81\xfa\xff\x54\x00\x00\x00\xf0\x08\x13\x40\xf9\x00\x00\x28\x91'
+        b'\x00\x01\x3f\xd6\x08\x07\x40\xf9\x00\x01\x3f\xd6\xfa\x07\x40\x91'
+        b'\x5a\xc3\x00\x91\x48\x53\x10\x91\xe8\x0b\x00\xf9\x08\x07\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf5\x03\x00\x2a\x1f\x7c\x00\x71\xc0\x00\x00\x54'
+        b'\xbf\x0e\x00\x71\x60\xb5\x01\x54\xa8\x56\x00\x51\x1f\x15\x00\x31'
+        b'\xe3\xfe\xff\x54\xa8\x1e\x00\x52\xe9\x1b\x48\xf9\xe0\x03\x1f\xaa'
+        b'\x48\x4b\x28\x8b\x08\x15\x40\xb9\x13\x5d\x00\x52\x28\x2d\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf4\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x14\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\xe2\xff\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\xfb\xff\x37\x08\x00\x13\x4a\xe9\x1b\x48\xf9\x08\x1d\x00\x12'
+        b'\xf4\x03\x00\x2a\xe0\x03\x1f\xaa\x48\x4b\x28\x8b\x08\x15\x40\xb9'
+        b'\x13\x21\x53\x4a\x28\x2d\x40\xf9\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\xe8\x1b\x48\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6\xe8\x1b\x48\xf9'
+        b'\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6'
+        b'\xe8\x1f\x48\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54\xc8\xff\xff\x17'
+        b'\x08\x05\x40\xf9\x00\x01\x3f\xd6\xa0\xf8\xff\x37\x08\x00\x13\x4a'
+        b'\xe9\x1b\x48\xf9\x08\x1d\x00\x12\x9b\x22\x00\x2a\xe0\x03\x1f\xaa'
+        b'\x48\x4b\x28\x8b\x08\x15\x40\xb9\x13\x21\x53\x4a\x28\x2d\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\xae\xff\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\x60\xf5\xff\x37\x08\x00\x13\x4a\xe9\x1b\x48\xf9\x08\x1d\x00\x12'
+        b'\x79\x43\x00\x2a\xe0\x03\x1f\xaa\x48\x4b\x28\x8b\x08\x15\x40\xb9'
+        b'\x17\x21\x53\x4a\x28\x2d\x40\xf9\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\xe8\x1b\x48\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6\xe8\x1b\x48\xf9'
+        b'\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6'
+        b'\xe8\x1f\x48\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54\x94\xff\xff\x17'
+        b'\x08\x05\x40\xf9\x00\x01\x3f\xd6\x20\xf2\xff\x37\x08\x00\x17\x4a'
+        b'\xf3\x03\x1f\xaa\x08\x1d\x00\x12\x48\x4b\x28\x8b\x08\x15\x40\xb9'
+        b'\x1c\x21\x57\x4a\x28\x63\x00\x2a\xe8\x0f\x00\xb9\xe8\x1b\x48\xf9'
+        b'\xe0\x03\x1f\xaa\xe9\x63\x00\x91\x08\x2d\x40\xf9\x3f\x79\x33\xb8'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x64\x00\x00\x14\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\x20\x0c\xf8\x37\x08\x00\x1c\x4a\xe9\x1b\x48\xf9\x08\x1d\x00\x12'
+        b'\xf6\x03\x00\x2a\x48\x4b\x28\x8b\x08\x15\x40\xb9\x1c\x21\x5c\x4a'
+        b'\x28\x2d\x40\xf9\xe9\x63\x00\x91\x20\x79\x33\xb8\xe0\x03\x1f\xaa'
+        b'\x00\x01\x3f\xd6\xf7\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x17\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x48\x00\x00\x14\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\xa0\x08\xf8\x37\x08\x00\x1c\x4a\xe9\x1b\x48\xf9\x08\x1d\x00\x12'
+        b'\xd7\x22\x00\x2a\xe0\x03\x1f\xaa\x48\x4b\x28\x8b\x08\x15\x40\xb9'
+        b'\x1c\x21\x5c\x4a\x28\x2d\x40\xf9\xe9\x63\x00\x91\x37\x79\x33\xb8'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x2c\x00\x00\x14\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\x20\x05\xf8\x37\x08\x00\x1c\x4a\xe9\x1b\x48\xf9\x08\x1d\x00\x12'
+        b'\xf7\x42\x00\x2a\xe0\x03\x1f\xaa\x48\x4b\x28\x8b\x08\x15\x40\xb9'
+        b'\x1c\x21\x5c\x4a\x28\x2d\x40\xf9\xe9\x63\x00\x91\x37\x79\x33\xb8'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x10\x00\x00\x14\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\xa0\x01\xf8\x37\x08\x00\x1c\x4a\xe9\x62\x00\x2a\x08\x1d\x00\x12'
+        b'\x48\x4b\x28\x8b\x08\x15\x40\xb9\x1c\x21\x5c\x4a\xe8\x63\x00\x91'
+        b'\x09\x79\x33\xb8\x73\x06\x00\x91\x7f\x12\x00\xf1\x81\xf1\xff\x54'
+        b'\x03\x00\x00\x14\x7f\x12\x00\x71\x21\xe2\xff\x54\xbf\x46\x00\x71'
+        b'\x21\x26\x00\x54\xf3\x1f\x40\xb9\x7f\x06\x40\x71\x49\x21\x00\x54'
+        b'\xe8\xcb\x54\xb9\xb5\x0a\x80\x52\xf3\x0b\x40\xf9\x1f\x01\x02\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xb6\x0f\x80\x52\xb7\x0e\x80\x52'
+        b'\x3c\x00\x80\x52\xe9\xcb\x14\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x89\x02\x15\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xa8\x00\x00\x54\x8b\x23\xca\x1a\x2c\x80\x84\x52'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x89\x02\x17\x4a\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xf4\x0f\x40\xb9\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x22\x5b\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xa8\x00\x00\x54\x8b\x23\xca\x1a\x2c\x80\x84\x52'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xe9\x22\x5b\x4a\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x42\x59\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xa8\x00\x00\x54\x8b\x23\xca\x1a\x2c\x80\x84\x52\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xe9\x42\x59\x4a'
+        b'\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x62\x54\x4a\x3f\x35\x00\x71\xa8\x00\x00\x54\x8a\x23\xc9\x1a'
+        b'\x2b\x80\x84\x52\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xe9\x62\x54\x4a\x16\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xe9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x15\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x15\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x15\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x15\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x15\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x15\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x4a\x53\x10\x91\xe0\x03\x13\xaa'
+        b'\xe9\xcb\x14\xb9\xe9\x1b\x48\xf9\x55\x49\x28\x38\xe8\xcb\x54\xb9'
+        b'\x5f\x69\x28\x38\x28\x11\x40\xf9\x00\x01\x3f\xd6\xff\xcb\x14\xb9'
+        b'\x03\xfe\xff\x17\x33\x04\x00\x34\xf7\x03\x1f\xaa\xe8\x1b\x48\xf9'
+        b'\xe0\x03\x1f\xaa\x08\x2d\x40\xf9\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\xe8\x1b\x48\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6\xe8\x1b\x48\xf9'
+        b'\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6'
+        b'\xe8\x1f\x48\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54\x10\x00\x00\x14'
+        b'\x08\x05\x40\xf9\x00\x01\x3f\xd6\xa0\x01\xf8\x37\x08\x00\x1c\x4a'
+        b'\xe9\xa3\x00\x91\x08\x1d\x00\x12\x20\x69\x37\x38\xf7\x06\x00\x91'
+        b'\x48\x4b\x28\x8b\xff\x02\x13\xeb\x08\x15\x40\xb9\x1c\x21\x5c\x4a'
+        b'\x61\xfc\xff\x54\x04\x00\x00\x14\xf7\x03\x1f\x2a\xff\x02\x13\x6b'
+        b'\xe1\xbb\xff\x54\xe8\x1b\x48\xf9\xe0\x03\x1f\xaa\xf3\x03\x3c\x2a'
+        b'\x08\x2d\x40\xf9\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9'
+        b'\x08\x09\x40\xf9\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35'
+        b'\x08\x2d\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9'
+        b'\x1f\x00\x08\xeb\xc3\xfe\xff\x54\xcd\xfd\xff\x17\x08\x05\x40\xf9'
+        b'\x00\x01\x3f\xd6\x40\xb9\xff\x37\xe8\x1b\x48\xf9\xf6\x03\x00\x2a'
+        b'\xe0\x03\x1f\xaa\x08\x2d\x40\xf9\x00\x01\x3f\xd6\xf7\x03\x00\xaa'
+        b'\xe8\x1b\x48\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6\xe8\x1b\x48\xf9'
+        b'\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x17\xaa\x00\x01\x3f\xd6'
+        b'\xe8\x1f\x48\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54\xb8\xfd\xff\x17'
+        b'\x08\x05\x40\xf9\x00\x01\x3f\xd6\xa0\xb6\xff\x37\xe8\x1b\x48\xf9'
+        b'\xd7\x22\x00\x2a\xe0\x03\x1f\xaa\x08\x2d\x40\xf9\x00\x01\x3f\xd6'
+        b'\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x16\xaa'
+        b'\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54'
+        b'\xa3\xfd\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6\x00\xb4\xff\x37'
+        b'\xe8\x1b\x48\xf9\xf7\x42\x00\x2a\xe0\x03\x1f\xaa\x08\x2d\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\xe8\x1b\x48\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x48\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\xe8\x1f\x48\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x8e\xfd\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\x60\xb1\xff\x37\xe8\x62\x00\x2a\x1f\x01\x13\x6b\x81\x03\x00\x54'
+        b'\xa8\x42\x00\x51\x1f\x3d\x00\x71\xa8\xb0\xff\x54\x1f\x20\x03\xd5'
+        b'\x8b\x68\x01\x10\x09\x00\x00\x10\x6a\x79\xa8\xb8\x29\x01\x0a\x8b'
+        b'\x20\x01\x1f\xd6\xf5\x1f\x40\xb9\xbf\x42\x40\x71\x62\x72\x00\x54'
+        b'\xf6\x1b\x40\xb9\x55\xcd\x00\x34\x08\x00\x80\x12\xe9\x03\x16\xaa'
+        b'\xea\x03\x15\xaa\x2b\x15\x40\x38\x0c\x1d\x00\x12\x4a\x05\x00\xf1'
+        b'\x8b\x01\x0b\x4a\x4b\x4b\x2b\x8b\x6b\x15\x40\xb9\x68\x21\x48\x4a'
+        b'\x21\xff\xff\x54\xf7\x03\x28\x2a\x5e\x06\x00\x14\xe8\xcb\x54\xb9'
+        b'\xf3\x0b\x40\xf9\x1f\x01\x02\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xb5\x0a\x80\x52\xb6\x0f\x80\x52\xb7\x0e\x80\x52\x3c\x00\x80\x52'
+        b'\xe9\xcb\x14\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x89\x02\x15\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xa8\x00\x00\x54\x8b\x23\xca\x1a\x2c\x80\x84\x52\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x89\x02\x17\x4a'
+        b'\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xf4\x0f\x40\xb9\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x22\x5b\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xa8\x00\x00\x54\x8b\x23\xca\x1a\x2c\x80\x84\x52\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xe9\x22\x5b\x4a'
+        b'\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x42\x59\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xa8\x00\x00\x54'
+        b'\x8b\x23\xca\x1a\x2c\x80\x84\x52\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xe9\x42\x59\x4a\x16\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x62\x54\x4a'
+        b'\x3f\x35\x00\x71\xa8\x00\x00\x54\x8a\x23\xc9\x1a\x2b\x80\x84\x52'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xe9\x62\x54\x4a\x16\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x89\x0a\x80\x52\x61\xfe\xff\x17\xe8\x1f\x40\xb9\xe8\x00\x00\x34'
+        b'\xe9\x1b\x40\xb9\xea\xa3\x00\x91\x4b\x15\x40\x38\x08\x05\x00\xf1'
+        b'\x2b\x15\x00\x38\xa1\xff\xff\x54\xe8\xcb\x54\xb9\x1f\x01\x02\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xc9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x89\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x89\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x5b\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x21\x5b\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x59\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x41\x59\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xea\x0f\x40\xb9\xa9\x0a\x80\x52\x29\x61\x4a\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x42\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xe9\x0f\x40\xb9\xa8\x0e\x80\x52'
+        b'\x09\x61\x49\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52'
+        b'\xdc\x02\x00\x14\xe8\x57\x43\x29\xa9\x06\x00\x51\x3f\x01\x08\x6a'
+        b'\xc1\x45\x00\x54\xa9\x06\x00\x51\x3f\x1d\x00\x71\x68\x45\x00\x54'
+        b'\x0c\x00\x00\xd0\x8c\x81\x27\x91\x0a\x00\x00\x10\x8b\x79\xa9\xb8'
+        b'\x4a\x01\x0b\x8b\x40\x01\x1f\xd6\x09\x01\x40\x39\xba\x06\x00\x14'
+        b'\xe8\x1f\x40\xb9\x88\x01\x00\x34\xe9\x1b\x40\xb9\x0a\x00\x80\x12'
+        b'\x2b\x15\x40\x38\x4c\x1d\x00\x12\x08\x05\x00\xf1\x8b\x01\x0b\x4a'
+        b'\x4b\x4b\x2b\x8b\x6b\x15\x40\xb9\x6a\x21\x4a\x4a\x21\xff\xff\x54'
+        b'\xe8\x03\x2a\x2a\xac\x73\x00\xd1\xe9\x03\x08\x2a\x2a\xfd\x48\xd3'
+        b'\x2b\xfd\x50\xd3\xb7\x73\x00\xd1\x88\x31\x00\x39\x28\xfd\x58\xd3'
+        b'\x8a\x21\x00\x39\x49\x53\x00\x91\x8b\x11\x00\x39\x88\x01\x00\x39'
+        b'\x88\x31\x40\x39\xe8\x03\x28\x2a\x08\x1d\x40\x92\x28\x79\x68\xb8'
+        b'\x8a\x21\x40\x39\x08\x5d\x00\x52\x0b\x1d\x00\x12\x6a\x01\x0a\x4a'
+        b'\x2a\x59\x6a\xb8\x8b\x11\x40\x39\x48\x21\x48\x4a\x0a\x1d\x00\x12'
+        b'\x4a\x01\x0b\x4a\x2a\x59\x6a\xb8\x8b\x01\x40\x39\x55\x21\x48\x4a'
+        b'\xa8\x1e\x00\x12\x0a\x01\x0b\x4a\xe8\xcb\x54\xb9\x36\x59\x6a\xb8'
+        b'\x1f\x01\x02\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xc9\x0f\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x89\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x89\x02\x08\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x21\x5b\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x5b\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x59\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x41\x59\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xea\x0f\x40\xb9\xa9\x0a\x80\x52\x29\x61\x4a\x4a'
+        b'\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x42\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xe9\x0f\x40\xb9'
+        b'\xa8\x0e\x80\x52\x09\x61\x49\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xd3\x22\x75\x4a'
+        b'\xa9\x0a\x80\x52\x69\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x69\x02\x08\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x21\x53\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x53\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x53\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x41\x53\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x61\x53\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x61\x53\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x29\x0a\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39\xf3\x32\x40\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x69\x02\x09\x4a'
+        b'\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x69\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xf3\x22\x40\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x69\x02\x09\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x69\x02\x08\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xf3\x12\x40\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x69\x02\x09\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a'
+        b'\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x69\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xf3\x02\x40\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x69\x02\x09\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x69\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x4b\x53\x10\x91\xea\xcb\x14\xb9\x69\x49\x28\x38\xe9\x1b\x48\xf9'
+        b'\xe8\xcb\x54\xb9\x7f\x69\x28\x38\x1b\x01\x00\x14\xe8\x1b\x40\xb9'
+        b'\x1f\x59\x00\x71\x63\x23\x00\x54\xe8\xcb\x54\xb9\x1f\x01\x02\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xc9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x89\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x89\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x5b\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x21\x5b\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x59\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x41\x59\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xea\x0f\x40\xb9\xa9\x0a\x80\x52\x29\x61\x4a\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x42\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xe9\x0f\x40\xb9\xa8\x0e\x80\x52'
+        b'\x09\x61\x49\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xe9\x0a\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x4a\x53\x10\x91\xe9\xcb\x14\xb9'
+        b'\xa9\x0a\x80\x52\x49\x49\x28\x38\xe8\xcb\x54\xb9\xe9\x1b\x48\xf9'
+        b'\x5f\x69\x28\x38\x28\x11\x40\xf9\xe0\x0b\x40\xf9\xcb\xfa\xff\x17'
+        b'\x08\x7b\x68\xf8\xe0\x87\x43\x29\xe2\x27\x40\xb9\x00\x01\x3f\xd6'
+        b'\xac\x73\x00\xd1\xa0\x03\x1f\xf8\x49\x53\x00\x91\x88\x31\x40\x39'
+        b'\xe8\x03\x28\x2a\x08\x1d\x40\x92\x28\x79\x68\xb8\x8a\x35\x40\x39'
+        b'\x08\x5d\x00\x52\x0b\x1d\x00\x12\x6a\x01\x0a\x4a\x2a\x59\x6a\xb8'
+        b'\x8b\x39\x40\x39\x48\x21\x48\x4a\x0a\x1d\x00\x12\x4a\x01\x0b\x4a'
+        b'\x2a\x59\x6a\xb8\x8b\x3d\x40\x39\x48\x21\x48\x4a\x0a\x1d\x00\x12'
+        b'\x4a\x01\x0b\x4a\x2a\x59\x6a\xb8\x8b\x41\x40\x39\x48\x21\x48\x4a'
+        b'\x0a\x1d\x00\x12\x4a\x01\x0b\x4a\x2a\x59\x6a\xb8\x8b\x45\x40\x39'
+        b'\x48\x21\x48\x4a\x0a\x1d\x00\x12\x4a\x01\x0b\x4a\x2a\x59\x6a\xb8'
+        b'\x8b\x49\x40\x39\x48\x21\x48\x4a\x0a\x1d\x00\x12\x4a\x01\x0b\x4a'
+        b'\x2a\x59\x6a\xb8\x8b\x4d\x40\x39\x55\x21\x48\x4a\xa8\x1e\x00\x12'
+        b'\x0a\x01\x0b\x4a\xe8\xcb\x54\xb9\x36\x59\x6a\xb8\x1f\x01\x02\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xc9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x89\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x89\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x5b\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x21\x5b\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x59\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x41\x59\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xea\x0f\x40\xb9\xa9\x0a\x80\x52\x29\x61\x4a\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x42\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xe9\x0f\x40\xb9\xa8\x0e\x80\x52'
+        b'\x09\x61\x49\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xd3\x22\x75\x4a\xa9\x0a\x80\x52'
+        b'\x69\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x69\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x53\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x21\x53\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x53\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x41\x53\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x61\x53\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a'
+        b'\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x61\x53\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0b\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xf3\x03\x1f\xaa'
+        b'\xb6\x0a\x80\x52\xf5\x0b\x40\xf9\xb7\x0f\x80\x52\xb9\x0e\x80\x52'
+        b'\x3b\x00\x80\x52\xbc\x43\x00\xd1\xe9\xcb\x14\xb9\x16\x51\x10\x39'
+        b'\x0e\x00\x00\x14\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x89\x02\x19\x4a\x17\x51\x10\x39\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\x73\x06\x00\x91\x7f\x22\x00\xf1\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe0\x02\x00\x54\x94\x6b\x73\x38\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x03\x15\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x89\x02\x16\x4a\x2b\x80\x84\x52\x3f\x35\x00\x71'
+        b'\x6a\x23\xc9\x1a\x4a\x01\x0b\x0a\x44\x99\x40\x7a\x41\xfc\xff\x54'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\xe3\xfb\xff\x54\xe4\xff\xff\x17'
+        b'\xe8\xcb\x54\xb9\xe0\x03\x15\xaa\x84\x03\x00\x14\xf7\x03\x1f\x2a'
+        b'\xe8\xcb\x54\xb9\x1f\x01\x02\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x89\x02\x09\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x89\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x21\x5b\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x5b\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x41\x59\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x41\x59\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xea\x0f\x40\xb9\xa9\x0a\x80\x52'
+        b'\x29\x61\x4a\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\x42\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xe9\x0f\x40\xb9\xa8\x0e\x80\x52\x09\x61\x49\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\xe9\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\xe9\x02\x08\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x21\x57\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x57\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x41\x57\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x41\x57\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x61\x57\x4a\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x61\x57\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\xa9\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\xa9\x02\x08\x4a\xe8\xcb\x54\xb9'
+        b'\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x55\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x21\x55\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xf4\x0b\x40\xf9\xb7\x0a\x80\x52\xb9\x0f\x80\x52'
+        b'\xbb\x0e\x80\x52\x3c\x00\x80\x52\xea\xcb\x14\xb9\x09\x51\x10\x39'
+        b'\x15\x03\x00\x35\xe8\xcb\x54\xb9\xe0\x03\x14\xaa\xef\x01\x00\x14'
+        b'\x69\x02\x17\x4a\x3f\x35\x00\x71\xc8\x03\x00\x54\x8a\x23\xc9\x1a'
+        b'\x2b\x80\x84\x52\x5f\x01\x0b\x6a\x40\x03\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x69\x02\x1b\x4a\x19\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xb5\x06\x00\xf1'
+        b'\xd6\x06\x00\x91\xea\xcb\x14\xb9\x09\x51\x10\x39\x40\xfd\xff\x54'
+        b'\xd3\x02\x40\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x23\xfd\xff\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x14\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xe1\xff\xff\x17'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\xa3\xfc\xff\x54\xea\xff\xff\x17'
+        b'\x09\x01\x40\x79\x04\x00\x00\x14\x09\x01\x40\xb9\x02\x00\x00\x14'
+        b'\x09\x01\x40\xf9\x16\x00\x80\x12\xa8\x43\x00\xd1\xea\x03\x15\xaa'
+        b'\xa9\x03\x1f\xf8\x09\x15\x40\x38\xcb\x1e\x00\x12\x4a\x05\x00\xf1'
+        b'\x69\x01\x09\x4a\x49\x4b\x29\x8b\x29\x15\x40\xb9\x36\x21\x56\x4a'
+        b'\x21\xff\xff\x54\xe8\xcb\x54\xb9\x1f\x01\x02\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x89\x02\x09\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x89\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x5b\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x21\x5b\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x41\x59\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x41\x59\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xea\x0f\x40\xb9'
+        b'\xa9\x0a\x80\x52\x29\x61\x4a\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a'
+        b'\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71\x42\x01\x00\x54'
+        b'\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xe9\x0f\x40\xb9\xa8\x0e\x80\x52\x09\x61\x49\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0a\x80\x52\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xf3\x03\x36\x2a\xa9\x0a\x80\x52\x69\x02\x09\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x69\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x53\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x21\x53\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x41\x53\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x41\x53\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xea\xcb\x14\xb9'
+        b'\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x61\x53\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x61\x53\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\xa9\x02\x09\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xe9\xcb\x14\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\xa9\x02\x08\x4a\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b'
+        b'\xea\xcb\x14\xb9\x09\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x21\x55\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x48\x43\x28\x8b\xe9\xcb\x14\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x55\x4a'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xb3\x43\x00\xd1'
+        b'\xf6\x0b\x40\xf9\xb7\x0a\x80\x52\xb9\x0f\x80\x52\xbb\x0e\x80\x52'
+        b'\x3c\x00\x80\x52\xea\xcb\x14\xb9\x09\x51\x10\x39\x15\x00\x00\x14'
+        b'\x89\x02\x17\x4a\x3f\x35\x00\x71\xc8\x03\x00\x54\x8a\x23\xc9\x1a'
+        b'\x2b\x80\x84\x52\x5f\x01\x0b\x6a\x40\x03\x00\x54\x09\x05\x00\x11'
+        b'\x48\x43\x28\x8b\xe9\xcb\x14\xb9\x89\x02\x1b\x4a\x19\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x0a\x05\x00\x11\x48\x43\x28\x8b\xb5\x06\x00\xf1'
+        b'\x73\x06\x00\x91\xea\xcb\x14\xb9\x09\x51\x10\x39\x20\x02\x00\x54'
+        b'\x74\x02\x40\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x23\xfd\xff\x54'
+        b'\x48\x03\x08\x8b\xe9\x1b\x48\xf9\xe0\x03\x16\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xe1\xff\xff\x17'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\xa3\xfc\xff\x54\xea\xff\xff\x17'
+        b'\xe8\xcb\x54\xb9\xe0\x03\x16\xaa\xe9\x1b\x48\xf9\x48\x03\x08\x8b'
+        b'\x1f\x51\x10\x39\x84\xf5\xff\x17\xe8\xcb\x54\xb9\x1f\x01\x02\x71'
+        b'\x43\x01\x00\x54\xe9\x07\x40\x91\xe0\x0b\x40\xf9\x29\xc1\x00\x91'
+        b'\x28\x01\x08\x8b\xe9\x1b\x48\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xe9\x07\x40\x91\x0a\x05\x00\x11'
+        b'\x29\xc1\x00\x91\xcb\x0f\x80\x52\x28\x41\x28\x8b\xea\xcb\x14\xb9'
+        b'\xaa\x0a\x80\x52\x93\x02\x0a\x4a\x0b\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x28\x01\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x69\x1e\x00\x12\x3f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a'
+        b'\x81\x00\x00\x54\x29\xf5\x01\x51\x3f\x09\x00\x71\x62\x01\x00\x54'
+        b'\xea\x07\x40\x91\x09\x05\x00\x11\x4a\xc1\x00\x91\x48\x41\x28\x8b'
+        b'\xaa\x0f\x80\x52\xe9\xcb\x14\xb9\x0a\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x93\x02\x08\x4a\xe8\xcb\x54\xb9\xe9\x07\x40\x91\x0a\x05\x00\x11'
+        b'\x29\xc1\x00\x91\x28\x41\x28\x8b\xea\xcb\x14\xb9\xaa\x0a\x80\x52'
+        b'\x13\x51\x10\x39\x53\x21\x5b\x4a\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x28\x01\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x69\x1e\x00\x12\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x29\xf5\x01\x51\x3f\x09\x00\x71\x62\x01\x00\x54\xea\x07\x40\x91'
+        b'\x09\x05\x00\x11\x4a\xc1\x00\x91\x48\x41\x28\x8b\xaa\x0f\x80\x52'
+        b'\xe9\xcb\x14\xb9\x0a\x51\x10\x39\xa8\x0e\x80\x52\x13\x21\x5b\x4a'
+        b'\xe8\xcb\x54\xb9\xe9\x07\x40\x91\x0a\x05\x00\x11\x29\xc1\x00\x91'
+        b'\x28\x41\x28\x8b\xea\xcb\x14\xb9\xaa\x0a\x80\x52\x13\x51\x10\x39'
+        b'\x53\x41\x59\x4a\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x28\x01\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x69\x1e\x00\x12'
+        b'\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54\x29\xf5\x01\x51'
+        b'\x3f\x09\x00\x71\x62\x01\x00\x54\xea\x07\x40\x91\x09\x05\x00\x11'
+        b'\x4a\xc1\x00\x91\x48\x41\x28\x8b\xaa\x0f\x80\x52\xe9\xcb\x14\xb9'
+        b'\x0a\x51\x10\x39\xa8\x0e\x80\x52\x13\x41\x59\x4a\xe8\xcb\x54\xb9'
+        b'\xe9\x07\x40\x91\x0a\x05\x00\x11\x29\xc1\x00\x91\xeb\x0f\x40\xb9'
+        b'\x28\x41\x28\x8b\xea\xcb\x14\xb9\xaa\x0a\x80\x52\x13\x51\x10\x39'
+        b'\x53\x61\x4b\x4a\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x28\x01\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x7f\x36\x00\x71'
+        b'\xc8\x00\x00\x54\x29\x00\x80\x52\x2a\x80\x84\x52\x29\x21\xd3\x1a'
+        b'\x3f\x01\x0a\x6a\x81\x00\x00\x54\x69\xf6\x01\x51\x3f\x09\x00\x71'
+        b'\x82\x01\x00\x54\x09\x05\x00\x11\xea\x07\x40\x91\x4a\xc1\x00\x91'
+        b'\x48\x41\x28\x8b\xaa\x0f\x80\x52\xe9\xcb\x14\xb9\xe9\x0f\x40\xb9'
+        b'\x0a\x51\x10\x39\xa8\x0e\x80\x52\x13\x61\x49\x4a\xe8\xcb\x54\xb9'
+        b'\xf4\x07\x40\x91\x09\x05\x00\x11\x94\xc2\x00\x91\x88\x42\x28\x8b'
+        b'\xe9\xcb\x14\xb9\x13\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x88\x02\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\x09\x05\x00\x11\x88\x42\x28\x8b\xb3\x0a\x80\x52\xe9\xcb\x14\xb9'
+        b'\x13\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x43\x01\x00\x54'
+        b'\xe9\x07\x40\x91\xe0\x0b\x40\xf9\x29\xc1\x00\x91\x28\x01\x08\x8b'
+        b'\xe9\x1b\x48\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xf4\x07\x40\x91\x09\x05\x00\x11\x94\xc2\x00\x91'
+        b'\x88\x42\x28\x8b\xe9\xcb\x14\xb9\x13\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x88\x02\x08\x8b\xe9\x1b\x48\xf9'
+        b'\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x05\x00\x11\x88\x42\x28\x8b\xb3\x0a\x80\x52'
+        b'\xe9\xcb\x14\xb9\x13\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71'
+        b'\x43\x01\x00\x54\xe9\x07\x40\x91\xe0\x0b\x40\xf9\x29\xc1\x00\x91'
+        b'\x28\x01\x08\x8b\xe9\x1b\x48\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xf4\x07\x40\x91\x09\x05\x00\x11'
+        b'\x94\xc2\x00\x91\x88\x42\x28\x8b\xe9\xcb\x14\xb9\x13\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x88\x02\x08\x8b'
+        b'\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x88\x42\x28\x8b'
+        b'\xb3\x0a\x80\x52\xe9\xcb\x14\xb9\x13\x51\x10\x39\xe8\xcb\x54\xb9'
+        b'\x1f\xfd\x01\x71\x43\x01\x00\x54\xe9\x07\x40\x91\xe0\x0b\x40\xf9'
+        b'\x29\xc1\x00\x91\x28\x01\x08\x8b\xe9\x1b\x48\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xf4\x07\x40\x91'
+        b'\x09\x05\x00\x11\x94\xc2\x00\x91\x88\x42\x28\x8b\xe9\xcb\x14\xb9'
+        b'\x13\x51\x10\x39\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x88\x02\x08\x8b\xe9\x1b\x48\xf9\xe0\x0b\x40\xf9\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11'
+        b'\x88\x42\x28\x8b\xb3\x0a\x80\x52\xe9\xcb\x14\xb9\x13\x51\x10\x39'
+        b'\xe8\xcb\x54\xb9\x1f\xfd\x01\x71\x43\x01\x00\x54\xe9\x07\x40\x91'
+        b'\xe0\x0b\x40\xf9\x29\xc1\x00\x91\x28\x01\x08\x8b\xe9\x1b\x48\xf9'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xea\x07\x40\x91\x09\x05\x00\x11\x4a\xc1\x00\x91\xe0\x0b\x40\xf9'
+        b'\x4a\x51\x10\x91\xe9\xcb\x14\xb9\xe9\x1b\x48\xf9\x53\x49\x28\x38'
+        b'\xe8\xcb\x54\xb9\x5f\x69\x28\x38\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\x03\x1f\x2a\xff\x07\x40\x91\xff\xc3\x13\x91\xf4\x4f\x45\xa9'
+        b'\xf6\x57\x44\xa9\xf8\x5f\x43\xa9\xfa\x67\x42\xa9\xfc\x6f\x41\xa9'
+        b'\xfd\x7b\xc6\xa8\xc0\x03\x5f\xd6\x00\x00\x00\x00\x00\x00\x00\x00'
+        b'\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00'
+        b'\x10\x00\x00\x00\xd4\x02\x00\x00\xa0\x05\x00\x00\xdc\x05\x00\x00'
+        b'\x58\x0e\x00\x00\x08\xf6\xff\xff\x08\xf6\xff\xff\x08\xf6\xff\xff'
+        b'\x08\xf6\xff\xff\x08\xf6\xff\xff\x08\xf6\xff\xff\x08\xf6\xff\xff'
+        b'\x08\xf6\xff\xff\x08\xf6\xff\xff\x08\xf6\xff\xff\xe4\x27\x00\x00'
+        b'\x10\x00\x00\x00\xe8\x1a\x00\x00\xa0\x08\x00\x00\xf0\x1a\x00\x00'
+        b'\xa0\x08\x00\x00\xa0\x08\x00\x00\xa0\x08\x00\x00\xf8\x1a\x00\x00'
+        b'\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a'
+        b'\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x4d\xde\x4d\xe2\x01\xda\x4d\xe2'
+        b'\x01\x40\xa0\xe1\xfa\x2f\xa0\xe3\x01\x50\xa0\xe3\x03\x00\x50\xe3'
+        b'\x09\x10\xa0\xe1\xbc\x24\x0b\xe5\x61\x0d\x00\xca\x02\x00\x50\xe3'
+        b'\x37\x00\x00\xba\x04\x70\x94\xe5\x00\x20\xd7\xe5\x00\x00\x52\xe3'
+        b'\x33\x00\x00\x0a\x01\x30\x87\xe2\x00\x60\xa0\xe3\x06\x50\xd3\xe7'
+        b'\x01\x60\x86\xe2\x00\x00\x55\xe3\xfb\xff\xff\x1a\x03\x00\x56\xe3'
+        b'\x03\x00\x00\x3a\x30\x00\x52\xe3\x01\x60\xd7\x05\x78\x00\x56\x03'
+        b'\x0f\x00\x00\x0a\x00\x80\xa0\xe3\x30\x70\x42\xe2\x09\x00\x57\xe3'
+        b'\x23\x00\x00\x8a\x08\x71\x88\xe0\x87\x20\x82\xe0\x30\x80\x42\xe2'
+        b'\x01\x20\xd3\xe4\x00\x00\x52\xe3\xf6\xff\xff\x1a\x00\x00\x58\xe3'
+        b'\x70\x80\x91\x05\x00\x00\x58\xe3\x1c\x00\x00\x1a\x02\x50\xa0\xe3'
+        b'\x3f\x0d\x00\xea\x02\x20\xd7\xe5\x00\x00\x52\xe3\x14\x00\x00\x0a'
+        b'\x03\x30\x87\xe2\x00\x80\xa0\xe3\x05\x00\x00\xea\x08\x62\xa0\xe1'
+        b'\x02\x20\x86\xe0\x07\x80\x82\xe0\x01\x20\xd3\xe4\x00\x00\x52\xe3'
+        b'\xed\xff\xff\x0a\x30\x60\x42\xe2\x2f\x70\xe0\xe3\x0a\x00\x56\xe3'
+        b'\xf5\xff\xff\x3a\x61\x60\x42\xe2\x56\x70\xe0\xe3\x06\x00\x56\xe3'
+        b'\xf1\xff\xff\x3a\x41\x60\x42\xe2\x36\x70\xe0\xe3\x05\x00\x56\xe3'
+        b'\xed\xff\xff\x9a\x70\x80\x91\xe5\x00\x00\x58\xe3\xe2\xff\xff\x0a'
+        b'\xfa\x1f\xa0\xe3\x03\x00\x50\xe3\x0b\x00\x00\xba\x08\x00\x94\xe5'
+        b'\x44\x30\x98\xe5\x01\xeb\x4b\xe2\x00\x10\xa0\xe3\xbc\x20\x4e\xe2'
+        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3\x11\x0d\x00\x1a'
+        b'\xbc\x14\x1b\xe5\x00\x00\x51\xe3\x0e\x0d\x00\x0a\xb4\x14\x0b\xe5'
+        b'\xb8\x1d\x9f\xe5\x01\xeb\x4b\xe2\x00\x00\xa0\xe3\xb8\x84\x0b\xe5'
+        b'\xb8\x40\x4e\xe2\x28\x00\x0b\xe5\xb0\x04\x0b\xe5\x0c\x70\x84\xe2'
+        b'\xa0\x20\x21\xe0\x01\x00\x10\xe3\xa0\x20\xa0\x01\xa2\x30\x21\xe0'
+        b'\x01\x00\x12\xe3\xa2\x30\xa0\x01\xa3\x20\x21\xe0\x01\x00\x13\xe3'
+        b'\xa3\x20\xa0\x01\xa2\x30\x21\xe0\x01\x00\x12\xe3\xa2\x30\xa0\x01'
+        b'\xa3\x20\x21\xe0\x01\x00\x13\xe3\xa3\x20\xa0\x01\xa2\x30\x21\xe0'
+        b'\x01\x00\x12\xe3\xa2\x30\xa0\x01\xa3\x20\x21\xe0\x01\x00\x13\xe3'
+        b'\xa3\x20\xa0\x01\xa2\x30\x21\xe0\x01\x00\x12\xe3\xa2\x30\xa0\x01'
+        b'\x00\x31\x87\xe7\x01\x00\x80\xe2\x01\x0c\x50\xe3\xe3\xff\xff\x1a'
+        b'\x08\x70\x8d\xe5\x10\x10\x98\xe5\x9c\x0f\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x98\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x0c\x00\x84\xe2\x01\x0b\x80\xe2\x0c\x00\x8d\xe5'
+        b'\x04\x00\x98\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x60\xa0\xe1'
+        b'\x1f\x00\x50\xe3\x04\x00\x00\x0a\x03\x00\x56\xe3\xd3\x0c\x00\x0a'
+        b'\x15\x00\x46\xe2\x05\x00\x70\xe3\xf4\xff\xff\x3a\x01\xeb\x4b\xe2'
+        b'\xff\x00\x26\xe2\xb8\x10\x4e\xe2\x00\x01\x81\xe0\xff\x14\xe0\xe3'
+        b'\x0c\x00\x90\xe5\x01\x40\x20\xe0\xb8\x04\x1b\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\xd8\xff\xff\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\xd3\xff\xff\x4a'
+        b'\x00\x50\xa0\xe1\x04\x00\x20\xe0\x01\xeb\x4b\xe2\xff\x00\x00\xe2'
+        b'\xb8\x10\x4e\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5\x24\x44\x20\xe0'
+        b'\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x70\xa0\xe1\xb8\x04\x1b\xe5\x08\x00\x90\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5\x00\x00\x50\xe3'
+        b'\x07\x00\x00\x1a\x2c\x10\x91\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a'
+        b'\xb6\xff\xff\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\xb1\xff\xff\x4a\x00\x14\x85\xe1\x04\x00\x20\xe0'
+        b'\x01\xeb\x4b\xe2\x18\x10\x8d\xe5\xff\x00\x00\xe2\xb8\x10\x4e\xe2'
+        b'\x00\x01\x81\xe0\x0c\x00\x90\xe5\x24\x44\x20\xe0\xb8\x04\x1b\xe5'
+        b'\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x70\xa0\xe1\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a'
+        b'\x2c\x10\x91\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\xb4\x14\x1b\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a\x93\xff\xff\xea'
+        b'\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x8e\xff\xff\x4a\x18\x10\x9d\xe5\x01\xeb\x4b\xe2\x00\x18\x81\xe1'
+        b'\x04\x00\x20\xe0\x14\x10\x8d\xe5\xff\x00\x00\xe2\xb8\x10\x4e\xe2'
+        b'\x00\x01\x81\xe0\x0c\x00\x90\xe5\x24\x44\x20\xe0\xb8\x04\x1b\xe5'
+        b'\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x70\xa0\xe1\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a'
+        b'\x2c\x10\x91\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\xb4\x14\x1b\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a\x6f\xff\xff\xea'
+        b'\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x6a\xff\xff\x4a\x14\x10\x9d\xe5\x01\xeb\x4b\xe2\x00\xa0\xa0\xe3'
+        b'\x00\x1c\x81\xe1\x04\x00\x20\xe0\x04\x10\x8d\xe5\xff\x00\x00\xe2'
+        b'\xb8\x10\x4e\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5\x24\x04\x20\xe0'
+        b'\x10\x00\x8d\xe5\x00\x00\xa0\xe3\x1c\x10\x8d\xe2\x0a\x01\x81\xe7'
+        b'\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x40\xa0\xe1\xb8\x04\x1b\xe5\x08\x00\x90\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5\x00\x00\x50\xe3'
+        b'\x07\x00\x00\x1a\x2c\x10\x91\xe5\x04\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a'
+        b'\x86\x00\x00\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x81\x00\x00\x4a\x10\x20\x9d\xe5\x00\x70\xa0\xe1'
+        b'\x1c\x00\x8d\xe2\x01\xeb\x4b\xe2\x0a\x71\x80\xe7\xb8\x10\x4e\xe2'
+        b'\x02\x00\x27\xe0\xff\x00\x00\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5'
+        b'\x22\x24\x20\xe0\xb8\x04\x1b\xe5\x10\x20\x8d\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x40\xa0\xe1'
+        b'\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x04\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x60\x00\x00\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x5b\x00\x00\x4a'
+        b'\x10\x20\x9d\xe5\x00\x44\x87\xe1\x1c\x10\x8d\xe2\x01\xeb\x4b\xe2'
+        b'\x0a\x41\x81\xe7\xb8\x10\x4e\xe2\x02\x00\x20\xe0\xff\x00\x00\xe2'
+        b'\x00\x01\x81\xe0\x0c\x00\x90\xe5\x22\x24\x20\xe0\xb8\x04\x1b\xe5'
+        b'\x10\x20\x8d\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x70\xa0\xe1\xb8\x04\x1b\xe5\x08\x00\x90\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5\x00\x00\x50\xe3'
+        b'\x07\x00\x00\x1a\x2c\x10\x91\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a'
+        b'\x3a\x00\x00\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x35\x00\x00\x4a\x10\x20\x9d\xe5\x00\x48\x84\xe1'
+        b'\x1c\x10\x8d\xe2\x01\xeb\x4b\xe2\x0a\x41\x81\xe7\xb8\x10\x4e\xe2'
+        b'\x02\x00\x20\xe0\xff\x00\x00\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5'
+        b'\x22\x24\x20\xe0\xb8\x04\x1b\xe5\x10\x20\x8d\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x70\xa0\xe1'
+        b'\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x14\x00\x00\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x0f\x00\x00\x4a'
+        b'\x00\x1c\x84\xe1\x1c\x20\x8d\xe2\x01\xeb\x4b\xe2\x0a\x11\x82\xe7'
+        b'\x10\x20\x9d\xe5\xb8\x10\x4e\xe2\x01\xa0\x8a\xe2\x04\x00\x5a\xe3'
+        b'\x02\x00\x20\xe0\xff\x00\x00\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5'
+        b'\x22\x24\x20\xe0\x10\x20\x8d\xe5\x61\xff\xff\x1a\x01\x00\x00\xea'
+        b'\x04\x00\x5a\xe3\xbd\xfe\xff\x1a\x11\x00\x56\xe3\x3f\x00\x00\x1a'
+        b'\x20\xa0\x9d\xe5\x01\x0a\x5a\xe3\x0e\x00\x00\x9a\x28\x40\x1b\xe5'
+        b'\x01\xeb\x4b\xe2\xb8\x60\x4e\xe2\x80\x00\x54\xe3\x69\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x70\x9d\xe5\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x60\x00\x00\xea\x00\x70\xa0\xe3\x00\x00\x5a\xe3'
+        b'\x28\x00\x00\x0a\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x40\xa0\xe1\xb8\x04\x1b\xe5'
+        b'\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5'
+        b'\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5\x04\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1'
+        b'\xf1\xff\xff\x3a\x13\x00\x00\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\x0e\x00\x00\x4a\x10\x20\x9d\xe5'
+        b'\x2c\x10\x8d\xe2\x01\xeb\x4b\xe2\x07\x00\xc1\xe7\xb8\x10\x4e\xe2'
+        b'\x01\x70\x87\xe2\x0a\x00\x57\xe1\x02\x00\x20\xe0\xff\x00\x00\xe2'
+        b'\x00\x01\x81\xe0\x0c\x00\x90\xe5\x22\x24\x20\xe0\x10\x20\x8d\xe5'
+        b'\xd7\xff\xff\x1a\x01\x00\x00\xea\x0a\x00\x57\xe1\x7b\xfe\xff\x1a'
+        b'\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x70\xa0\xe1\x10\x00\x9d\xe5\x00\xa0\xe0\xe1'
+        b'\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x64\xfe\xff\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x5f\xfe\xff\x4a'
+        b'\x00\x70\xa0\xe1\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x40\xa0\xe1\xb8\x04\x1b\xe5'
+        b'\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5'
+        b'\x00\x00\x50\xe3\x19\x01\x00\x1a\x2c\x10\x91\xe5\x04\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1'
+        b'\xf1\xff\xff\x3a\x49\xfe\xff\xea\x0c\x70\x9d\xe5\x01\x00\x84\xe2'
+        b'\x7e\x10\xa0\xe3\x01\xa0\xa0\xe3\x28\x00\x0b\xe5\x04\x00\x86\xe0'
+        b'\x09\xab\x8a\xe3\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\x25\xe2\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x02\x00\x00\x8a\x01\x20\xa0\xe3\x12\x01\x1a\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x06\x00\x00\x2a\x01\x00\x84\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\x04\x00\x86\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x25\xe2\x28\x40\x1b\xe5\x01\x10\x84\xe2\x55\x50\xa0\xe3'
+        b'\x28\x10\x0b\xe5\x04\x10\x86\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5'
+        b'\x7f\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x00\x9d\xe5\x20\x04\x25\xe0'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x02\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x12\x01\x1a\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x10\x84\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\x04\x10\x86\xe0\x0c\x24\xc1\xe5\x28\x40\x1b\xe5'
+        b'\x20\x04\xa0\xe1\x75\x00\x20\xe2\x01\x10\x84\xe2\x28\x10\x0b\xe5'
+        b'\x04\x10\x86\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x14\x00\x9d\xe5\x20\x08\x25\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x02\x00\x00\x8a\x01\x20\xa0\xe3\x12\x01\x1a\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x14\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\x04\x10\x86\xe0\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x20\x08\xa0\xe1'
+        b'\x75\x00\x20\xe2\x01\x10\x84\xe2\x28\x10\x0b\xe5\x04\x10\x86\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x04\x20\x9d\xe5\x22\x0c\x25\xe0\x0d\x00\x50\xe3\x02\x00\x00\x8a'
+        b'\x01\x10\xa0\xe3\x11\x00\x1a\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2'
+        b'\x02\x00\x51\xe3\x07\x00\x00\x2a\x01\x10\x84\xe2\x22\x0c\xa0\xe1'
+        b'\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\x04\x10\x86\xe0\x75\x00\x20\xe2'
+        b'\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x01\x10\x84\xe2\x28\x10\x0b\xe5'
+        b'\x04\x10\x86\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x57\x10\xa0\xe3\x28\x00\x0b\xe5'
+        b'\x04\x00\x86\xe0\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x28\x00\x0b\xe5\x04\x00\x86\xe0'
+        b'\x0c\x54\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x01\x00\x84\xe2\x28\x00\x0b\xe5\x04\x00\x86\xe0\x0c\x54\xc0\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x86\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2'
+        b'\x28\x00\x0b\xe5\x04\x00\x86\xe0\x0c\x54\xc0\xe5\x28\x40\x1b\xe5'
+        b'\x7f\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x28\x00\x0b\xe5'
+        b'\x04\x00\x86\xe0\x0c\x54\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x28\x00\x0b\xe5\x04\x00\x86\xe0'
+        b'\x0c\x54\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x01\x00\x84\xe2\x28\x00\x0b\xe5\x04\x00\x86\xe0\x0c\x54\xc0\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x86\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2'
+        b'\x28\x00\x0b\xe5\x04\x50\xc7\xe7\x00\x40\xa0\xe3\x28\x00\x1b\xe5'
+        b'\x00\x40\xc7\xe7\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x28\x40\x0b\xe5\x37\xfd\xff\xea'
+        b'\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x32\xfd\xff\x4a\x00\x44\x87\xe1\xb8\x04\x1b\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x70\xa0\xe1'
+        b'\xb8\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb8\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x1c\xfd\xff\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x17\xfd\xff\x4a'
+        b'\x00\x48\x84\xe1\xb8\x04\x1b\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x70\xa0\xe1\xb8\x04\x1b\xe5'
+        b'\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\xb8\x14\x1b\xe5'
+        b'\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5\x07\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb4\x14\x1b\xe5\x01\x00\x50\xe1'
+        b'\xf1\xff\xff\x3a\x01\xfd\xff\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\xfc\xfc\xff\x4a\x00\x0c\x84\xe1'
+        b'\x0a\x00\x50\xe1\x2a\x00\x00\x1a\x10\x00\x46\xe2\x0f\x00\x50\xe3'
+        b'\xf6\xfc\xff\x8a\x04\x10\x8f\xe2\x00\x01\x91\xe7\x00\xf0\x81\xe0'
+        b'\x40\x00\x00\x00\x50\x03\x00\x00\xb4\x06\x00\x00\xe8\x06\x00\x00'
+        b'\x2c\x07\x00\x00\xd0\xf3\xff\xff\xd0\xf3\xff\xff\xd0\xf3\xff\xff'
+        b'\xd0\xf3\xff\xff\xd0\xf3\xff\xff\xd0\xf3\xff\xff\xd0\xf3\xff\xff'
+        b'\xd0\xf3\xff\xff\xd0\xf3\xff\xff\xd0\xf3\xff\xff\x74\x27\x00\x00'
+        b'\x20\xa0\x9d\xe5\x01\x08\x5a\xe3\xba\x01\x00\x2a\x1c\x60\x9d\xe5'
+        b'\x00\x00\x5a\xe3\x91\x05\x00\x0a\x01\xeb\x4b\xe2\x00\x00\xe0\xe3'
+        b'\x06\x10\xa0\xe1\x0a\x20\xa0\xe1\xb8\x40\x4e\xe2\x01\x30\xd1\xe4'
+        b'\xff\x70\x00\xe2\x01\x20\x52\xe2\x03\x30\x27\xe0\x03\x31\x84\xe0'
+        b'\x0c\x30\x93\xe5\x20\x04\x23\xe0\xf7\xff\xff\x1a\x00\x40\xe0\xe1'
+        b'\x83\x05\x00\xea\x28\x40\x1b\xe5\x01\xeb\x4b\xe2\xb8\x60\x4e\xe2'
+        b'\x80\x00\x54\xe3\x0a\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x70\x9d\xe5\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x00\xea'
+        b'\x20\x83\xb8\xed\x0c\x70\x9d\xe5\x01\x00\x84\xe2\x7e\x10\xa0\xe3'
+        b'\x01\xa0\xa0\xe3\x28\x00\x0b\xe5\x04\x00\x86\xe0\x09\xab\x8a\xe3'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\x25\xe2\xff\x10\x00\xe2\x0d\x00\x51\xe3\x02\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x12\x01\x1a\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x06\x00\x00\x2a\x01\x00\x84\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\x04\x00\x86\xe0\x0c\x14\xc0\xe5\x75\x00\x25\xe2'
+        b'\x28\x40\x1b\xe5\x01\x10\x84\xe2\x55\x50\xa0\xe3\x28\x10\x0b\xe5'
+        b'\x04\x10\x86\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x07\x00\x00\x3a\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x18\x00\x9d\xe5\x20\x04\x25\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x02\x00\x00\x8a\x01\x20\xa0\xe3\x12\x01\x1a\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\x04\x10\x86\xe0\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x20\x04\xa0\xe1'
+        b'\x75\x00\x20\xe2\x01\x10\x84\xe2\x28\x10\x0b\xe5\x04\x10\x86\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x14\x00\x9d\xe5\x20\x08\x25\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x02\x00\x00\x8a\x01\x20\xa0\xe3\x12\x01\x1a\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x10\x84\xe2'
+        b'\x14\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\x04\x10\x86\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2'
+        b'\x01\x10\x84\xe2\x28\x10\x0b\xe5\x04\x10\x86\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x86\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x20\x9d\xe5'
+        b'\x22\x0c\x25\xe0\x0d\x00\x50\xe3\x02\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x11\x00\x1a\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x07\x00\x00\x2a\x01\x10\x84\xe2\x22\x0c\xa0\xe1\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\x04\x10\x86\xe0\x75\x00\x20\xe2\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x01\x10\x84\xe2\x28\x10\x0b\xe5\x04\x10\x86\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x86\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x01\x00\x84\xe2\x54\x10\xa0\xe3\x73\xfe\xff\xea\x48\x39\x00\x00'
+        b'\x20\x00\x9d\xe5\x00\x00\x50\xe3\x05\x00\x00\x0a\x1c\x10\x9d\xe5'
+        b'\x2c\x20\x8d\xe2\x01\x30\xd2\xe4\x01\x00\x50\xe2\x01\x30\xc1\xe4'
+        b'\xfb\xff\xff\x1a\x28\x40\x1b\xe5\x80\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x40\x1b\xe5\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x20\x04\xa0\xe1\x75\x00\x20\xe2\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x14\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x40\x1b\xe5'
+        b'\x20\x0c\xa0\xe1\x75\x00\x20\xe2\x01\x10\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\xef\x00\x00\xea\x20\xa0\x9d\xe5\x1c\x00\x9d\xe5\x01\x10\x4a\xe2'
+        b'\x00\x00\x11\xe1\x1b\x00\x00\x1a\x04\x00\x5a\xe3\x02\x06\x00\x0a'
+        b'\x02\x00\x5a\xe3\x02\x06\x00\x0a\x01\x00\x5a\xe3\x15\x00\x00\x1a'
+        b'\x00\x00\xd0\xe5\xff\x05\x00\xea\x20\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x74\x01\x00\x0a\x1c\x20\x9d\xe5\x01\xeb\x4b\xe2\x00\x10\xe0\xe3'
+        b'\xb8\x60\x4e\xe2\x01\x30\xd2\xe4\xff\x70\x01\xe2\x01\x00\x50\xe2'
+        b'\x03\x30\x27\xe0\x03\x31\x86\xe0\x0c\x30\x93\xe5\x21\x14\x23\xe0'
+        b'\xf7\xff\xff\x1a\x01\x00\xe0\xe1\x67\x01\x00\xea\x1c\x00\x9d\xe5'
+        b'\x16\x00\x50\xe3\x5d\x01\x00\x3a\x28\x40\x1b\xe5\x80\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x40\x1b\xe5'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x04\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x0a\x00\x00\x2a\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5'
+        b'\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x20\x04\xa0\xe1\x75\x00\x20\xe2'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x04\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x14\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x0a\x00\x00\x2a\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5'
+        b'\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x40\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x04\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a'
+        b'\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x20\x0c\xa0\xe1\x75\x00\x20\xe2\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x57\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\x0c\x00\x9d\xe5\x04\x10\xc0\xe7\x75\x02\x00\xea'
+        b'\x20\x20\x8d\xe2\x00\x31\x98\xe7\x07\x00\x92\xe8\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x00\xea\x00\x00\xa0\xe3\x20\x14\xa0\xe1'
+        b'\x24\x00\x4b\xe5\x1d\x10\x4b\xe5\x20\x18\xa0\xe1\x20\x0c\xa0\xe1'
+        b'\x1e\x10\x4b\xe5\x1f\x00\x4b\xe5\xff\x14\xe0\xe3\x24\x00\x5b\xe5'
+        b'\x08\x30\x9d\xe5\xff\x00\x20\xe2\x00\x01\x93\xe7\x1d\x20\x5b\xe5'
+        b'\x01\x00\x20\xe0\xff\x10\x00\xe2\x02\x10\x21\xe0\x01\x11\x93\xe7'
+        b'\x1e\x20\x5b\xe5\x20\x04\x21\xe0\xff\x10\x00\xe2\x02\x10\x21\xe0'
+        b'\x01\x11\x93\xe7\x20\x44\x21\xe0\x1f\x10\x5b\xe5\x28\x70\x1b\xe5'
+        b'\xff\x00\x04\xe2\x01\x00\x20\xe0\x80\x00\x57\xe3\x00\x61\x93\xe7'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x00\x70\xa0\xe3\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x87\xe2'
+        b'\x01\xeb\x4b\xe2\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x07\x00\x80\xe0\x0c\x14\xc0\xe5\x28\x70\x1b\xe5\x7f\x00\x57\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x00\x70\xa0\xe3\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x87\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x07\x00\x80\xe0\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x70\x1b\xe5'
+        b'\x01\x10\x87\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x07\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x0a\x00\x00\x2a\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5'
+        b'\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x20\x04\xa0\xe1\x75\x00\x20\xe2'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x14\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x0a\x00\x00\x2a\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5'
+        b'\x7d\x20\xa0\xe3\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x10\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x21\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a'
+        b'\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x20\x0c\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x55\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x24\x04\x26\xe0\x00\x40\xe0\xe1'
+        b'\x55\x00\x24\xe2\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a'
+        b'\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3\x28\x00\x0b\xe5'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5\x75\x00\x24\xe2'
+        b'\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5'
+        b'\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2'
+        b'\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\xa0\xe3\x24\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x09\x00\x00\x2a\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3'
+        b'\x24\x04\xa0\xe1\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2'
+        b'\x05\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x08\x20\xe0'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x24\x08\xa0\xe1\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5'
+        b'\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2'
+        b'\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\xa0\xe3\x24\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a'
+        b'\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x24\x0c\xa0\xe1'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x05\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x51\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x24\x50\x5b\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x12\x00\x11\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x25\xe2\x28\x40\x1b\xe5\x01\x10\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x1d\x50\x5b\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x12\x00\x11\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x25\xe2\x28\x40\x1b\xe5\x01\x10\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x1e\x50\x5b\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x12\x00\x11\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x25\xe2\x28\x40\x1b\xe5\x01\x10\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x1f\x50\x5b\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x20\x25\xe2\x0d\x00\x52\xe3'
+        b'\x04\x00\x00\x8a\x01\x00\xa0\xe3\x01\x10\xa0\xe3\x09\x0b\x80\xe3'
+        b'\x11\x02\x10\xe1\x02\x00\x00\x1a\x7d\x10\x42\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3'
+        b'\x75\x20\x25\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x40\x1b\xe5\x0c\x00\x9d\xe5\x01\x10\x84\xe2'
+        b'\x28\x10\x0b\xe5\x04\x20\xc0\xe7\x28\x10\x1b\xe5\x00\x40\xa0\xe3'
+        b'\x01\x40\xc0\xe7\xb8\x14\x1b\xe5\x10\x10\x91\xe5\x0f\xfa\xff\xea'
+        b'\x00\x40\xa0\xe3\x28\x70\x1b\xe5\x80\x00\x57\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x87\xe2\x01\xeb\x4b\xe2'
+        b'\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x70\x1b\xe5\x7f\x00\x57\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x87\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x70\x1b\xe5\x01\x10\x87\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x07\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x20\x04\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x14\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x50\x1b\xe5'
+        b'\x20\x0c\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\x24\xe2\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x08\x00\x00\x2a\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x24\xe2\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x04\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x09\x00\x00\x2a\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x20\xa0\xe3\x24\x04\xa0\xe1\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x75\x00\x20\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x50\x1b\xe5'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3'
+        b'\x24\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x24\x08\xa0\xe1'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x05\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x0c\x20\xe0\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x12\x00\x11\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x09\x00\x00\x2a\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3'
+        b'\x24\x0c\xa0\xe1\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2'
+        b'\x05\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x2a\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x2a\xe2\x28\x50\x1b\xe5\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x2a\x04\x20\xe0'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x2a\x04\xa0\xe1\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x01\xeb\x4b\xe2\x01\x10\x85\xe2\x00\x00\x5a\xe3'
+        b'\xb8\x40\x4e\xe2\x28\x10\x0b\xe5\x05\x10\x84\xe0\x0c\x04\xc1\xe5'
+        b'\x1a\x00\x00\x1a\x28\x00\x1b\xe5\x00\x00\x84\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x26\xf8\xff\xea\x01\x10\xa0\xe3\x01\x20\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x12\x00\x11\xe1\x1c\x00\x00\x0a\x01\x00\x85\xe2\x7d\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\x05\x00\x84\xe0\x0c\x14\xc0\xe5\x75\x00\x27\xe2'
+        b'\x28\x50\x1b\xe5\x01\x10\x85\xe2\x01\x60\x86\xe2\x01\xa0\x5a\xe2'
+        b'\x28\x10\x0b\xe5\x05\x10\x84\xe0\x0c\x04\xc1\xe5\xe4\xff\xff\x0a'
+        b'\x00\x70\xd6\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x07\x00\x00\x3a'
+        b'\x05\x00\x84\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\x27\xe2\x0d\x00\x50\xe3\xdd\xff\xff\x9a\x7d\x10\x40\xe2'
+        b'\x02\x00\x51\xe3\xdf\xff\xff\x3a\xe5\xff\xff\xea\x00\x00\x90\xe5'
+        b'\x00\x00\x00\xea\xb0\x00\xd0\xe1\x01\xeb\x4b\xe2\x24\x00\x0b\xe5'
+        b'\x00\x60\xe0\xe3\x00\x00\xa0\xe3\x24\x70\x4b\xe2\xb8\x30\x4e\xe2'
+        b'\x00\x10\xd7\xe7\xff\x20\x06\xe2\x01\x00\x80\xe2\x00\x00\x5a\xe1'
+        b'\x01\x10\x22\xe0\x01\x11\x83\xe0\x0c\x10\x91\xe5\x26\x64\x21\xe0'
+        b'\xf6\xff\xff\x1a\x28\x70\x1b\xe5\x80\x00\x57\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x87\xe2\x01\xeb\x4b\xe2'
+        b'\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x28\x70\x1b\xe5\x7f\x00\x57\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x07\x00\x80\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x87\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x70\x1b\xe5\x01\x10\x87\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x07\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x18\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x20\x04\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x14\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x20\x08\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x10\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x21\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x1b\x81\xe3\x12\x00\x11\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\x0a\x00\x00\x2a\x01\x10\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x50\x1b\xe5'
+        b'\x20\x0c\xa0\xe1\x75\x00\x20\xe2\x01\x10\x85\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x05\x10\x81\xe0\x0c\x04\xc1\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x55\x10\xa0\xe3'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x14\xc0\xe5'
+        b'\x28\x70\x1b\xe5\x7f\x00\x57\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x07\x00\x80\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x06\x50\xe0\xe1\x55\x00\x25\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x87\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x07\x00\x80\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x28\x70\x1b\xe5\x01\x10\x87\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x07\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x60\x1b\xe5\x7f\x00\x56\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x06\x00\x80\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x25\x04\x20\xe0'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a\x01\x10\x86\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x25\x04\xa0\xe1\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x06\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x60\x1b\xe5\x01\x10\x86\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x06\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2'
+        b'\x06\x00\x80\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\xa0\xe3\x25\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x13\x01\x12\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\x09\x00\x00\x2a\x01\x10\x86\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3'
+        b'\x25\x08\xa0\xe1\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2'
+        b'\x06\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x06\x10\x81\xe0'
+        b'\x0c\x04\xc1\xe5\x28\x60\x1b\xe5\x7f\x00\x56\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x06\x00\x80\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x25\x0c\x20\xe0'
+        b'\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x1b\x81\xe3\x12\x00\x11\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2'
+        b'\x02\x00\x51\xe3\x09\x00\x00\x2a\x01\x10\x86\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x20\xa0\xe3\x25\x0c\xa0\xe1\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x75\x00\x20\xe2\x06\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x60\x1b\xe5'
+        b'\x01\x10\x86\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x06\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x2a\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x08\x00\x00\x2a\x01\x00\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x05\x00\x80\xe0\x0c\x14\xc0\xe5\x75\x00\x2a\xe2\x28\x50\x1b\xe5'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x28\x10\x0b\xe5\xb8\x10\x4e\xe2'
+        b'\x05\x10\x81\xe0\x0c\x04\xc1\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3'
+        b'\x2a\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x30\xa0\xe3\x09\x2b\x82\xe3\x13\x01\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x00\x00\x2a'
+        b'\x01\x10\x85\xe2\x01\xeb\x4b\xe2\x7d\x20\xa0\xe3\x2a\x04\xa0\xe1'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x75\x00\x20\xe2\x05\x10\x81\xe0'
+        b'\x0c\x24\xc1\xe5\x28\x50\x1b\xe5\x01\xeb\x4b\xe2\x01\x10\x85\xe2'
+        b'\xb8\x40\x4e\xe2\x28\x10\x0b\xe5\x05\x10\x84\xe0\x24\x50\x4b\xe2'
+        b'\x0c\x04\xc1\xe5\x12\x00\x00\xea\x01\x10\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x1b\x81\xe3\x12\x00\x11\xe1\x1c\x00\x00\x0a\x01\x00\x86\xe2'
+        b'\x7d\x10\xa0\xe3\x28\x00\x0b\xe5\x06\x00\x84\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x27\xe2\x28\x60\x1b\xe5\x01\x10\x86\xe2\x01\x50\x85\xe2'
+        b'\x01\xa0\x5a\xe2\x28\x10\x0b\xe5\x06\x10\x84\xe0\x0c\x04\xc1\xe5'
+        b'\xcb\xfd\xff\x0a\x00\x70\xd5\xe5\x28\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x07\x00\x00\x3a\x06\x00\x84\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\x27\xe2\x0d\x00\x50\xe3\xdd\xff\xff\x9a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\xdf\xff\xff\x3a\xe5\xff\xff\xea'
+        b'\x00\x50\xa0\xe3\x06\x00\x00\xea\x08\x10\x94\xe5\x14\x20\x98\xe5'
+        b'\xa0\x05\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x03\x50\xa0\xe3\x05\x00\xa0\xe1\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8'
+        b'\x1e\xff\x2f\xe1\x28\x40\x1b\xe5\x80\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x7e\x10\xa0\xe3\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x55\x40\x25\xe2\x0c\x14\xc0\xe5\x28\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x06\x00\x80\xe0'
+        b'\x00\x60\xa0\xe3\x0c\x64\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xff\x00\x04\xe2'
+        b'\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x10\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x11\x00\x12\xe1\x02\x00\x00\x1a\x7d\x00\x40\xe2'
+        b'\x02\x00\x50\xe3\x08\x00\x00\x2a\x01\x00\x86\xe2\x01\xeb\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x75\x40\x25\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x06\x00\x80\xe0\x0c\x14\xc0\xe5\x28\x60\x1b\xe5\x01\x00\x86\xe2'
+        b'\x01\xeb\x4b\xe2\x18\x10\x9d\xe5\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x06\x00\x80\xe0\x0c\x44\xc0\xe5\x55\x00\xa0\xe3\x28\x40\x1b\xe5'
+        b'\x21\x54\x20\xe0\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\xff\x00\x05\xe2\x0d\x00\x50\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3\x11\x00\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x00\x40\xe2\x02\x00\x50\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x18\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x20\x04\xa0\xe1\x75\x50\x20\xe2\x01\x00\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x14\x10\x9d\xe5\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x0c\x54\xc0\xe5\x55\x00\xa0\xe3\x28\x40\x1b\xe5'
+        b'\x21\x58\x20\xe0\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\xff\x00\x05\xe2\x0d\x00\x50\xe3\x04\x00\x00\x8a'
+        b'\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3\x11\x00\x12\xe1'
+        b'\x02\x00\x00\x1a\x7d\x00\x40\xe2\x02\x00\x50\xe3\x0a\x00\x00\x2a'
+        b'\x01\x10\x84\xe2\x01\xeb\x4b\xe2\x14\x00\x9d\xe5\x7d\x20\xa0\xe3'
+        b'\x28\x10\x0b\xe5\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5'
+        b'\x28\x40\x1b\xe5\x20\x08\xa0\xe1\x75\x50\x20\xe2\x01\x00\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x04\x10\x9d\xe5\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x0c\x54\xc0\xe5\x55\x00\xa0\xe3\x28\x40\x1b\xe5'
+        b'\x21\x5c\x20\xe0\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x0d\x00\x55\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x01\x00\xa0\xe3\x09\x1b\x81\xe3\x10\x05\x11\xe1\x02\x00\x00\x1a'
+        b'\x7d\x00\x45\xe2\x02\x00\x50\xe3\x0a\x00\x00\x2a\x01\x10\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x04\x00\x9d\xe5\x7d\x20\xa0\xe3\x28\x10\x0b\xe5'
+        b'\xb8\x10\x4e\xe2\x04\x10\x81\xe0\x0c\x24\xc1\xe5\x28\x40\x1b\xe5'
+        b'\x20\x0c\xa0\xe1\x75\x50\x20\xe2\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x0c\x54\xc0\xe5'
+        b'\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x28\x00\x0b\xe5'
+        b'\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x55\x40\xa0\xe3\x0c\x44\xc0\xe5'
+        b'\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5'
+        b'\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x28\x00\x0b\xe5'
+        b'\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x0c\x44\xc0\xe5\x28\x40\x1b\xe5'
+        b'\x7f\x00\x54\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x01\x00\x84\xe2\x01\xeb\x4b\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x04\x00\x80\xe0\x55\x40\xa0\xe3\x0c\x44\xc0\xe5\x28\x50\x1b\xe5'
+        b'\x7f\x00\x55\xe3\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2'
+        b'\x05\x00\x80\xe0\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x01\x00\x85\xe2\x01\xeb\x4b\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2'
+        b'\x05\x00\x80\xe0\x0c\x44\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0'
+        b'\x55\x40\xa0\xe3\x0c\x44\xc0\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3'
+        b'\x09\x00\x00\x3a\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x00\x50\xa0\xe3\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x0c\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x85\xe2'
+        b'\x01\xeb\x4b\xe2\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x05\x00\x80\xe0'
+        b'\x0c\x44\xc0\xe5\x28\x40\x1b\xe5\x7f\x00\x54\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x01\xeb\x4b\xe2'
+        b'\x28\x00\x0b\xe5\xb8\x00\x4e\xe2\x04\x00\x80\xe0\x55\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\x28\x50\x1b\xe5\x7f\x00\x55\xe3\x09\x00\x00\x3a'
+        b'\x01\xeb\x4b\xe2\xb8\x00\x4e\xe2\x05\x00\x80\xe0\x00\x50\xa0\xe3'
+        b'\x0c\x54\xc0\xe5\xb8\x04\x1b\xe5\x10\x10\x90\xe5\x0c\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x85\xe2\x28\x00\x0b\xe5'
+        b'\x0c\x00\x9d\xe5\x05\x40\xc0\xe7\x00\x50\xa0\xe3\x28\x10\x1b\xe5'
+        b'\x01\x50\xc0\xe7\xb8\x14\x1b\xe5\x10\x10\x91\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x9a\xfe\xff\xea\xac\x05\x00\x00\x2d\x3a\x5b\x53'
+        b'\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00',
+}
+
+FIND_PATTERNS = {
+    'aarch64':
+        b'\xfd\x7b\xba\xa9\xfc\x6f\x01\xa9\xfd\x03\x00\x91\xfa\x67\x02\xa9'
+        b'\xf8\x5f\x03\xa9\xf6\x57\x04\xa9\xf4\x4f\x05\xa9\xff\xc3\x06\xd1'
+        b'\x08\x58\x00\x51\x1f\x41\x00\x31\x62\x00\x00\x54\x20\x00\x80\x52'
+        b'\x48\x00\x00\x14\x2a\x04\x40\xf9\xf3\x03\x01\xaa\x48\x01\x40\x39'
+        b'\x68\x08\x00\x34\xf4\x03\x00\x2a\xe9\x03\x1f\xaa\x4b\x05\x00\x91'
+        b'\x2c\x05\x00\x91\x6d\x69\x69\x38\xe9\x03\x0c\xaa\xad\xff\xff\x35'
+        b'\x9f\x0d\x00\xf1\x23\x04\x00\x54\x1f\xc1\x00\x71\xe1\x03\x00\x54'
+        b'\x49\x05\x40\x39\x3f\xe1\x01\x71\x81\x03\x00\x54\x49\x09\x40\x39'
+        b'\x69\x06\x00\x34\xeb\x05\x80\x12\xf5\x03\x1f\xaa\x48\x0d\x00\x91'
+        b'\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1\x07\x00\x00\x14\x29\x1d\x40\x92'
+        b'\xad\xee\x7c\xd3\x8c\x01\x09\x0b\x09\x15\x40\x38\x95\x01\x0d\x8b'
+        b'\x29\x03\x00\x34\xec\x05\x80\x12\x2d\xc1\x00\x51\xbf\x29\x00\x71'
+        b'\xe3\xfe\xff\x54\xec\x03\x0a\xaa\x2d\x85\x01\x51\xbf\x19\x00\x71'
+        b'\x63\xfe\xff\x54\xec\x03\x0b\xaa\x2d\x05\x01\x51\xbf\x15\x00\x71'
+        b'\xe9\xfd\xff\x54\x1a\x00\x00\x14\xf5\x03\x1f\xaa\xe9\x05\x80\x12'
+        b'\x4a\x05\x00\x91\x4b\x01\x80\x52\x0c\xc1\x00\x51\x9f\x25\x00\x71'
+        b'\x68\x02\x00\x54\x28\x01\x28\x0b\xb5\x22\x0b\x9b\x48\x15\x40\x38'
+        b'\x48\xff\xff\x35\xd5\x01\x00\xb4\xa8\x46\x40\xf9\xa2\x43\x00\xd1'
+        b'\x60\x0a\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x20\x02\x00\x34'
+        b'\x00\x00\x00\x90\xa8\x16\x40\xf9\x61\x0a\x40\xf9\x00\x9c\x12\x91'
+        b'\x00\x01\x3f\xd6\x60\x00\x80\x52\x02\x00\x00\x14\x40\x00\x80\x52'
+        b'\xff\xc3\x06\x91\xf4\x4f\x45\xa9\xf6\x57\x44\xa9\xf8\x5f\x43\xa9'
+        b'\xfa\x67\x42\xa9\xfc\x6f\x41\xa9\xfd\x7b\xc6\xa8\xc0\x03\x5f\xd6'
+        b'\xa8\x46\x40\xf9\xa2\x63\x00\xd1\x60\x0e\x40\xf9\xe1\x03\x1f\x2a'
+        b'\x00\x01\x3f\xd6\x00\x01\x00\x34\x00\x00\x00\x90\xa8\x16\x40\xf9'
+        b'\x61\x0e\x40\xf9\x00\x30\x12\x91\x00\x01\x3f\xd6\x80\x00\x80\x52'
+        b'\xec\xff\xff\x17\xa8\x46\x40\xf9\xa2\x83\x00\xd1\x60\x12\x40\xf9'
+        b'\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x40\x09\x00\x35\xa8\x03\x5e\xf8'
+        b'\x08\x09\x00\xb4\x9f\x1a\x00\x71\xa3\x09\x00\x54\x8a\x16\x00\x51'
+        b'\xe8\x03\x1f\xaa\xe9\x03\x1f\x2a\xeb\x43\x01\x91\xec\x43\x00\x91'
+        b'\xed\x43\x02\x91\xea\x03\x00\xf9\xaa\x00\x80\x52\x61\x5a\x6a\xf8'
+        b'\x30\x00\x40\x39\xb0\x11\x00\x34\xee\x03\x1f\xaa\x2f\x00\x0e\x8b'
+        b'\xce\x05\x00\x91\xef\x05\x40\x39\xaf\xff\xff\x35\xee\x10\x00\x34'
+        b'\xce\x10\x00\x37\xd1\x7d\x41\xd3\x2f\x02\x09\x0b\xff\x05\x04\x71'
+        b'\x42\x10\x00\x54\x00\xf5\x7e\xd3\x4f\x00\x80\x52\x69\x69\x20\xb8'
+        b'\x91\x69\x20\xb8\x11\xc2\x00\x51\x3f\x26\x00\x71\x49\x01\x00\x54'
+        b'\x11\x86\x01\x51\x3f\x16\x00\x71\x68\x00\x00\x54\x11\x5e\x01\x51'
+        b'\x05\x00\x00\x14\x11\x06\x01\x51\x10\xde\x00\x51\x3f\x1a\x00\x71'
+        b'\x11\x32\x9f\x5a\xf0\x05\x00\x51\x20\x48\x70\x38\x10\xc0\x00\x51'
+        b'\x1f\x26\x00\x71\x49\x01\x00\x54\x10\x84\x01\x51\x1f\x16\x00\x71'
+        b'\x68\x00\x00\x54\x10\x5c\x01\x51\x05\x00\x00\x14\x10\x04\x01\x51'
+        b'\x00\xdc\x00\x51\x1f\x1a\x00\x71\x10\x30\x9f\x5a\x71\x0c\xf8\x37'
+        b'\x50\x0c\xf8\x37\x10\x12\x11\x2a\xff\x01\x0e\x6b\xb0\x49\x29\x38'
+        b'\xa2\x00\x00\x54\x30\x48\x6f\x38\xef\x09\x00\x11\x29\x05\x00\x11'
+        b'\xdd\xff\xff\x17\xee\x03\x40\xf9\x08\x05\x00\x91\x4a\x05\x00\x11'
+        b'\x29\x05\x00\x11\x1f\x01\x0e\xeb\xa1\xf8\xff\x54\x09\x00\x00\x14'
+        b'\x00\x00\x00\x90\xa8\x16\x40\xf9\x61\x12\x40\xf9\x00\x80\x11\x91'
+        b'\x00\x01\x3f\xd6\xa0\x00\x80\x52\x96\xff\xff\x17\xff\x03\x00\xf9'
+        b'\x00\x00\x00\x90\xa8\x12\x40\xf9\x00\x64\x13\x91\x00\x01\x3f\xd6'
+        b'\xa8\x06\x40\xf9\x00\x01\x3f\xd6\xa8\x83\x5e\xf8\x68\x09\x00\xb4'
+        b'\xe8\x03\x40\xf9\xf7\x03\x1f\xaa\xf8\x03\x1f\x2a\xb9\x03\x5f\xf8'
+        b'\x14\x02\xa0\x52\xfc\x43\x01\x91\xfa\x03\x08\x2a\xf6\x43\x02\x91'
+        b'\xf3\x43\x00\x91\xff\x02\x14\xeb\xa3\x00\x00\x54\xa8\x0a\x40\xf9'
+        b'\x00\x01\x3f\xd6\x60\x07\x00\x35\x94\x02\x44\x91\xe8\x03\x40\xf9'
+        b'\xf4\x07\x00\xf9\x28\x05\x00\x34\xf4\x03\x1f\xaa\x3b\x03\x17\x8b'
+        b'\x0c\x00\x00\x14\xa8\x03\x5f\xf8\x00\x00\x00\x90\xa9\x16\x40\xf9'
+        b'\x00\x3c\x13\x91\xe1\x03\x14\x2a\x02\x01\x17\x8b\x20\x01\x3f\xd6'
+        b'\x18\x07\x00\x11\x94\x06\x00\x91\x9f\x02\x1a\xeb\x60\x03\x00\x54'
+        b'\x89\x7b\x74\xb8\x28\x6b\x77\x38\xca\x6a\x69\x38\x1f\x01\x0a\x6b'
+        b'\x21\xff\xff\x54\x68\x7a\x74\xb8\xaa\x83\x5e\xf8\x4a\x01\x17\xcb'
+        b'\x5f\x01\x08\xeb\x83\xfe\xff\x54\x1f\x09\x00\x71\x63\x01\x00\x54'
+        b'\xca\x02\x09\x8b\x29\x00\x80\x52\x6b\x6b\x69\x38\x4c\x69\x69\x38'
+        b'\x7f\x01\x0c\x6b\xc1\x00\x00\x54\x29\x05\x00\x91\x1f\x01\x09\xeb'
+        b'\x41\xff\xff\x54\xe0\xff\xff\x17\x29\x00\x80\x52\x3f\x01\x08\x6b'
+        b'\xa0\xfb\xff\x54\xe4\xff\xff\x17\xa8\x27\x7e\xa9\xf4\x07\x40\xf9'
+        b'\x17\x01\x17\x8b\xff\x02\x09\xeb\x82\x01\x00\x54\x1f\x07\x40\x71'
+        b'\x23\xf9\xff\x54\x09\x00\x00\x14\x00\x00\x00\x90\xa8\x16\x40\xf9'
+        b'\x00\xdc\x11\x91\x00\x01\x3f\xd6\xc0\x00\x80\x52\x45\xff\xff\x17'
+        b'\xa8\x06\x40\xf9\x00\x01\x3f\xd6\x00\x00\x00\x90\xa8\x12\x40\xf9'
+        b'\x00\x0c\x13\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\x3d\xff\xff\x17'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x61\x6c\x69\x67\x6e\x6d\x65\x6e'
+        b'\x74\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x70'
+        b'\x61\x74\x74\x65\x72\x6e\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74'
+        b'\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d'
+        b'\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25'
+        b'\x73\x0a\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x25'
+        b'\x75\x3a\x25\x30\x38\x6c\x78\x0a\x00\x2d\x3a\x5b\x53\x54\x41\x52'
+        b'\x54\x5d\x3a\x2d\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x1a\xde\x4d\xe2\x01\x40\xa0\xe1'
+        b'\x16\x10\x40\xe2\x00\x50\xa0\xe1\x01\x00\xa0\xe3\x10\x00\x71\xe3'
+        b'\x24\x01\x00\x3a\x04\x30\x94\xe5\x02\x00\xa0\xe3\x00\x10\xd3\xe5'
+        b'\x00\x00\x51\xe3\x1f\x01\x00\x0a\x01\x20\x83\xe2\x00\x70\xa0\xe3'
+        b'\x07\x60\xd2\xe7\x01\x70\x87\xe2\x00\x00\x56\xe3\xfb\xff\xff\x1a'
+        b'\x03\x00\x57\xe3\x03\x00\x00\x3a\x30\x00\x51\xe3\x01\x70\xd3\x05'
+        b'\x78\x00\x57\x03\x1b\x00\x00\x0a\x00\x60\xa0\xe3\x30\x30\x41\xe2'
+        b'\x09\x00\x53\xe3\x0f\x01\x00\x8a\x06\x31\x86\xe0\x83\x10\x81\xe0'
+        b'\x30\x60\x41\xe2\x01\x10\xd2\xe4\x00\x00\x51\xe3\xf6\xff\xff\x1a'
+        b'\x00\x00\x56\xe3\x07\x01\x00\x0a\x08\x00\x94\xe5\x44\x30\x96\xe5'
+        b'\x20\x20\x4b\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x20\x00\x00\x0a\x08\x10\x94\xe5\x14\x20\x96\xe5'
+        b'\xfc\x03\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x03\x00\xa0\xe3\xf7\x00\x00\xea\x02\x10\xd3\xe5\x00\x00\x51\xe3'
+        b'\xf4\x00\x00\x0a\x03\x20\x83\xe2\x00\x60\xa0\xe3\x05\x00\x00\xea'
+        b'\x06\x72\xa0\xe1\x01\x10\x87\xe0\x03\x60\x81\xe0\x01\x10\xd2\xe4'
+        b'\x00\x00\x51\xe3\xe1\xff\xff\x0a\x30\x70\x41\xe2\x2f\x30\xe0\xe3'
+        b'\x0a\x00\x57\xe3\xf5\xff\xff\x3a\x61\x70\x41\xe2\x56\x30\xe0\xe3'
+        b'\x06\x00\x57\xe3\xf1\xff\xff\x3a\x41\x70\x41\xe2\x36\x30\xe0\xe3'
+        b'\x05\x00\x57\xe3\xed\xff\xff\x9a\xde\x00\x00\xea\x0c\x00\x94\xe5'
+        b'\x44\x30\x96\xe5\x24\x20\x4b\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\x07\x00\x00\x0a\x0c\x10\x94\xe5'
+        b'\x14\x20\x96\xe5\x5c\x03\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x04\x00\xa0\xe3\xce\x00\x00\xea\x10\x00\x94\xe5'
+        b'\x44\x30\x96\xe5\x28\x20\x4b\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\xae\x00\x00\x1a\x28\x00\x1b\xe5'
+        b'\x00\x00\x50\xe3\xab\x00\x00\x0a\x00\xc0\xa0\xe3\x06\x00\x55\xe3'
+        b'\x4e\x00\x00\x3a\x05\xc0\x45\xe2\x00\x00\xa0\xe3\x05\x30\xa0\xe3'
+        b'\x90\xa0\x8d\xe2\x00\x50\xa0\xe3\x0c\x00\x8d\xe5\x08\xc0\x8d\xe5'
+        b'\x03\x11\x94\xe7\x00\x70\xd1\xe5\x00\x00\x57\xe3\xa5\x00\x00\x0a'
+        b'\x00\x00\xa0\xe3\x00\x20\x81\xe0\x01\x00\x80\xe2\x01\x20\xd2\xe5'
+        b'\x00\x00\x52\xe3\xfa\xff\xff\x1a\x00\x00\x50\xe3\x9d\x00\x00\x0a'
+        b'\x01\x20\x10\xe2\x9b\x00\x00\x1a\xa0\x20\x85\xe0\x01\x0c\x52\xe3'
+        b'\x98\x00\x00\x8a\x0c\xc0\x9d\xe5\x04\x30\x8d\xe5\xa0\x20\xa0\xe1'
+        b'\x10\x30\x8d\xe2\x0c\x21\x83\xe7\x50\x20\x8d\xe2\x0c\x51\x82\xe7'
+        b'\x00\x20\xa0\xe3\x30\xc0\x47\xe2\x09\x00\x5c\xe3\x08\x00\x00\x9a'
+        b'\x61\x30\x47\xe2\x05\x00\x53\xe3\x01\x00\x00\x8a\x57\xc0\x47\xe2'
+        b'\x03\x00\x00\xea\x41\x30\x47\xe2\x00\xc0\xe0\xe3\x06\x00\x53\xe3'
+        b'\x37\xc0\x47\x32\x02\x70\x81\xe0\x01\x80\xd7\xe5\x30\xe0\x48\xe2'
+        b'\x09\x00\x5e\xe3\x08\x00\x00\x9a\x61\x30\x48\xe2\x05\x00\x53\xe3'
+        b'\x01\x00\x00\x8a\x57\xe0\x48\xe2\x03\x00\x00\xea\x41\x30\x48\xe2'
+        b'\x00\xe0\xe0\xe3\x06\x00\x53\xe3\x37\xe0\x48\x32\x00\x00\x5c\xe3'
+        b'\x74\x00\x00\x4a\x01\x00\x7e\xe3\x72\x00\x00\xda\x02\x20\x82\xe2'
+        b'\x0c\x32\x8e\xe1\x00\x00\x52\xe1\x05\x30\xca\xe7\x02\x00\x00\x2a'
+        b'\x02\x70\xd7\xe5\x01\x50\x85\xe2\xd9\xff\xff\xea\x0c\x00\x9d\xe5'
+        b'\x04\x30\x9d\xe5\x08\xc0\x9d\xe5\x01\x50\x85\xe2\x01\x00\x80\xe2'
+        b'\x01\x30\x83\xe2\x0c\x00\x50\xe1\x0c\x00\x8d\xe5\xb7\xff\xff\x1a'
+        b'\x08\xc0\x8d\xe5\x10\x10\x96\xe5\xd0\x01\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x96\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x24\x00\x1b\xe5\x08\xc0\x9d\xe5\x00\x00\x50\xe3'
+        b'\x5e\x00\x00\x0a\x20\xa0\x1b\xe5\x00\x00\xa0\xe3\x01\x46\xa0\xe3'
+        b'\x00\x80\xa0\xe3\x50\xe0\x8d\xe2\x90\x30\x8d\xe2\x0c\x00\x8d\xe5'
+        b'\x07\x00\x00\xea\x28\x00\x1b\xe5\x04\x40\x9d\xe5\x08\x80\x80\xe0'
+        b'\x24\x00\x1b\xe5\x00\x00\x58\xe1\x0c\x00\x9d\x35\x01\x0a\x50\x33'
+        b'\x4e\x00\x00\x2a\x04\x00\x58\xe1\x08\x00\x00\x3a\x08\x00\x96\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x44\x00\x00\x1a'
+        b'\x08\xc0\x9d\xe5\x01\x46\x84\xe2\x50\xe0\x8d\xe2\x90\x30\x8d\xe2'
+        b'\x00\x00\x5c\xe3\x04\x40\x8d\xe5\xe9\xff\xff\x0a\x08\x70\x8a\xe0'
+        b'\x00\x50\xa0\xe3\x10\x00\x00\xea\x20\x00\x1b\xe5\x14\x30\x96\xe5'
+        b'\x05\x10\xa0\xe1\x08\x20\x80\xe0\x14\x01\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x0c\x00\x9d\xe5\x08\xc0\x9d\xe5'
+        b'\x50\xe0\x8d\xe2\x01\x00\x80\xe2\x0c\x00\x8d\xe5\x90\x30\x8d\xe2'
+        b'\x01\x50\x85\xe2\x0c\x00\x55\xe1\xd5\xff\xff\x0a\x08\x00\xda\xe7'
+        b'\x05\x21\x9e\xe7\x02\x10\xd3\xe7\x01\x00\x50\xe1\xf7\xff\xff\x1a'
+        b'\x10\x00\x8d\xe2\x24\x10\x1b\xe5\x05\x01\x90\xe7\x08\x10\x41\xe0'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x8a\x01\x10\xa0\xe3\x02\x00\x50\xe3'
+        b'\x09\x00\x00\x3a\x02\x20\x83\xe0\x01\x10\xa0\xe3\x01\x30\xd2\xe7'
+        b'\x01\x40\xd7\xe7\x03\x00\x54\xe1\x03\x00\x00\x1a\x01\x10\x81\xe2'
+        b'\x01\x00\x50\xe1\xf8\xff\xff\x1a\xd6\xff\xff\xea\x00\x00\x51\xe1'
+        b'\xd4\xff\xff\x0a\xe0\xff\xff\xea\x10\x10\x94\xe5\x14\x20\x96\xe5'
+        b'\x74\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x05\x00\xa0\xe3\x0f\x00\x00\xea\x14\x20\x96\xe5\x48\x00\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x06\x00\xa0\xe3'
+        b'\x08\x00\x00\xea\x04\x00\x96\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x10\x10\x96\xe5\x2c\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x00\xa0\xe3\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8'
+        b'\x1e\xff\x2f\xe1\x5b\x04\x00\x00\x9c\x03\x00\x00\x6f\x00\x00\x00'
+        b'\x55\x02\x00\x00\x8b\x01\x00\x00\x93\x00\x00\x00\x74\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x61\x6c\x69\x67\x6e\x6d\x65\x6e'
+        b'\x74\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x70'
+        b'\x61\x74\x74\x65\x72\x6e\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74'
+        b'\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d'
+        b'\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25'
+        b'\x73\x0a\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x25'
+        b'\x75\x3a\x25\x30\x38\x6c\x78\x0a\x00\x2d\x3a\x5b\x53\x54\x41\x52'
+        b'\x54\x5d\x3a\x2d\x00',
+}
+
+READ_MEMORY = {
+    'aarch64':
+        b'\xff\x03\x01\xd1\x1f\x10\x00\x71\xfd\x7b\x01\xa9\xf5\x13\x00\xf9'
+        b'\xfd\x43\x00\x91\xf4\x4f\x03\xa9\xa1\x05\x00\x54\x2a\x04\x40\xf9'
+        b'\xf3\x03\x01\xaa\x48\x01\x40\x39\x88\x08\x00\x34\xe9\x03\x1f\xaa'
+        b'\x4b\x05\x00\x91\x2c\x05\x00\x91\x6d\x69\x69\x38\xe9\x03\x0c\xaa'
+        b'\xad\xff\xff\x35\x9f\x0d\x00\xf1\x63\x04\x00\x54\x1f\xc1\x00\x71'
+        b'\x21\x04\x00\x54\x49\x05\x40\x39\x3f\xe1\x01\x71\xc1\x03\x00\x54'
+        b'\x49\x09\x40\x39\xa9\x06\x00\x34\xeb\x05\x80\x12\xf4\x03\x1f\xaa'
+        b'\x48\x0d\x00\x91\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1\x07\x00\x00\x14'
+        b'\x29\x1d\x40\x92\x8d\xee\x7c\xd3\x8c\x01\x09\x0b\x09\x15\x40\x38'
+        b'\x94\x01\x0d\x8b\x69\x03\x00\x34\xec\x05\x80\x12\x2d\xc1\x00\x51'
+        b'\xbf\x29\x00\x71\xe3\xfe\xff\x54\xec\x03\x0a\xaa\x2d\x85\x01\x51'
+        b'\xbf\x19\x00\x71\x63\xfe\xff\x54\xec\x03\x0b\xaa\x2d\x05\x01\x51'
+        b'\xbf\x15\x00\x71\xe9\xfd\xff\x54\x1c\x00\x00\x14\x20\x00\x80\x52'
+        b'\x1b\x00\x00\x14\xf4\x03\x1f\xaa\xe9\x05\x80\x12\x4a\x05\x00\x91'
+        b'\x4b\x01\x80\x52\x0c\xc1\x00\x51\x9f\x25\x00\x71\x68\x02\x00\x54'
+        b'\x28\x01\x28\x0b\x94\x22\x0b\x9b\x48\x15\x40\x38\x48\xff\xff\x35'
+        b'\xd4\x01\x00\xb4\x88\x46\x40\xf9\xa2\x63\x00\x91\x60\x0a\x40\xf9'
+        b'\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\xc0\x01\x00\x34\x00\x00\x00\x90'
+        b'\x88\x16\x40\xf9\x61\x06\x40\xf9\x00\xec\x07\x91\x00\x01\x3f\xd6'
+        b'\x60\x00\x80\x52\x02\x00\x00\x14\x40\x00\x80\x52\xf4\x4f\x43\xa9'
+        b'\xfd\x7b\x41\xa9\xf5\x13\x40\xf9\xff\x03\x01\x91\xc0\x03\x5f\xd6'
+        b'\x88\x46\x40\xf9\xe2\x23\x00\x91\x60\x0e\x40\xf9\xe1\x03\x1f\x2a'
+        b'\x00\x01\x3f\xd6\x00\x01\x00\x34\x00\x00\x00\x90\x88\x16\x40\xf9'
+        b'\x61\x0a\x40\xf9\x00\x80\x07\x91\x00\x01\x3f\xd6\x80\x00\x80\x52'
+        b'\xef\xff\xff\x17\x00\x00\x00\x90\x88\x12\x40\xf9\x00\x8c\x08\x91'
+        b'\x00\x01\x3f\xd6\x88\x06\x40\xf9\x00\x01\x3f\xd6\xe8\x07\x40\xf9'
+        b'\x48\x01\x00\xb4\xf3\x03\x1f\xaa\xb5\x0f\x40\xf9\x88\x0e\x40\xf9'
+        b'\xa0\x6a\x73\x38\x00\x01\x3f\xd6\xe8\x07\x40\xf9\x73\x06\x00\x11'
+        b'\x1f\x01\x13\xeb\x48\xff\xff\x54\x00\x00\x00\x90\x88\x12\x40\xf9'
+        b'\x00\x5c\x08\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\xd8\xff\xff\x17'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c'
+        b'\x65\x6e\x67\x74\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73'
+        b'\x73\x3a\x20\x25\x73\x0a\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d'
+        b'\x3a\x2d\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00',
+    'arm':
+        b'\x70\x4c\x2d\xe9\x10\xb0\x8d\xe2\x08\xd0\x4d\xe2\x01\x40\xa0\xe1'
+        b'\x00\x10\xa0\xe1\x01\x00\xa0\xe3\x04\x00\x51\xe3\x70\x00\x00\x1a'
+        b'\x04\x30\x94\xe5\x02\x00\xa0\xe3\x00\x10\xd3\xe5\x00\x00\x51\xe3'
+        b'\x6b\x00\x00\x0a\x01\x20\x83\xe2\x00\x60\xa0\xe3\x06\x50\xd2\xe7'
+        b'\x01\x60\x86\xe2\x00\x00\x55\xe3\xfb\xff\xff\x1a\x03\x00\x56\xe3'
+        b'\x03\x00\x00\x3a\x30\x00\x51\xe3\x01\x60\xd3\x05\x78\x00\x56\x03'
+        b'\x1b\x00\x00\x0a\x00\x50\xa0\xe3\x30\x30\x41\xe2\x09\x00\x53\xe3'
+        b'\x5b\x00\x00\x8a\x05\x31\x85\xe0\x83\x10\x81\xe0\x30\x50\x41\xe2'
+        b'\x01\x10\xd2\xe4\x00\x00\x51\xe3\xf6\xff\xff\x1a\x00\x00\x55\xe3'
+        b'\x53\x00\x00\x0a\x08\x00\x94\xe5\x44\x30\x95\xe5\x04\x20\x8d\xe2'
+        b'\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x20\x00\x00\x0a\x04\x10\x94\xe5\x14\x20\x95\xe5\x2c\x01\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x03\x00\xa0\xe3'
+        b'\x43\x00\x00\xea\x02\x10\xd3\xe5\x00\x00\x51\xe3\x40\x00\x00\x0a'
+        b'\x03\x20\x83\xe2\x00\x50\xa0\xe3\x05\x00\x00\xea\x05\x62\xa0\xe1'
+        b'\x01\x10\x86\xe0\x03\x50\x81\xe0\x01\x10\xd2\xe4\x00\x00\x51\xe3'
+        b'\xe1\xff\xff\x0a\x30\x60\x41\xe2\x2f\x30\xe0\xe3\x0a\x00\x56\xe3'
+        b'\xf5\xff\xff\x3a\x61\x60\x41\xe2\x56\x30\xe0\xe3\x06\x00\x56\xe3'
+        b'\xf1\xff\xff\x3a\x41\x60\x41\xe2\x36\x30\xe0\xe3\x05\x00\x56\xe3'
+        b'\xed\xff\xff\x9a\x2a\x00\x00\xea\x0c\x00\x94\xe5\x44\x30\x95\xe5'
+        b'\x0d\x20\xa0\xe1\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x07\x00\x00\x0a\x08\x10\x94\xe5\x14\x20\x95\xe5'
+        b'\x8c\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x04\x00\xa0\xe3\x1a\x00\x00\xea\x10\x10\x95\xe5\x74\x00\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x95\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x09\x00\x00\x0a\x04\x40\x9d\xe5\x00\x60\xa0\xe3\x0c\x10\x95\xe5'
+        b'\x06\x00\xd4\xe7\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x00\x9d\xe5'
+        b'\x01\x60\x86\xe2\x00\x00\x56\xe1\xf7\xff\xff\x3a\x10\x10\x95\xe5'
+        b'\x24\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x00\xa0\xe3\x10\xd0\x4b\xe2\x70\x4c\xbd\xe8\x1e\xff\x2f\xe1'
+        b'\x53\x01\x00\x00\x94\x00\x00\x00\xbb\x00\x00\x00\x5b\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c'
+        b'\x65\x6e\x67\x74\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73'
+        b'\x73\x3a\x20\x25\x73\x0a\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d'
+        b'\x3a\x2d\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00',
+}
+
+READ_MEMORY_BLOCKS = {
+    'aarch64':
+        b'\xfd\x7b\xba\xa9\xfc\x6f\x01\xa9\xfd\x03\x00\x91\xfa\x67\x02\xa9'
+        b'\xf8\x5f\x03\xa9\xf6\x57\x04\xa9\xf4\x4f\x05\xa9\xff\x43\x13\xd1'
+        b'\x08\x00\x82\x52\x09\x7d\x80\x52\x0a\x1c\x00\x51\x5f\x0d\x00\x31'
+        b'\xe9\xa3\x00\xa9\x62\x00\x00\x54\x35\x00\x80\x52\x46\x00\x00\x14'
+        b'\x2a\x04\x40\xf9\xf3\x03\x01\xaa\x48\x01\x40\x39\x28\x08\x00\x34'
+        b'\xf4\x03\x00\x2a\xe9\x03\x1f\xaa\x4b\x05\x00\x91\x2c\x05\x00\x91'
+        b'\x6d\x69\x69\x38\xe9\x03\x0c\xaa\xad\xff\xff\x35\x9f\x0d\x00\xf1'
+        b'\x23\x04\x00\x54\x1f\xc1\x00\x71\xe1\x03\x00\x54\x49\x05\x40\x39'
+        b'\x3f\xe1\x01\x71\x81\x03\x00\x54\x49\x09\x40\x39\x29\x06\x00\x34'
+        b'\xeb\x05\x80\x12\xf6\x03\x1f\xaa\x48\x0d\x00\x91\x6a\x9d\x00\xd1'
+        b'\x6b\x1d\x00\xd1\x07\x00\x00\x14\x29\x1d\x40\x92\xcd\xee\x7c\xd3'
+        b'\x8c\x01\x09\x0b\x09\x15\x40\x38\x96\x01\x0d\x8b\x29\x03\x00\x34'
+        b'\xec\x05\x80\x12\x2d\xc1\x00\x51\xbf\x29\x00\x71\xe3\xfe\xff\x54'
+        b'\xec\x03\x0a\xaa\x2d\x85\x01\x51\xbf\x19\x00\x71\x63\xfe\xff\x54'
+        b'\xec\x03\x0b\xaa\x2d\x05\x01\x51\xbf\x15\x00\x71\xe9\xfd\xff\x54'
+        b'\x18\x00\x00\x14\xf6\x03\x1f\xaa\xe9\x05\x80\x12\x4a\x05\x00\x91'
+        b'\x4b\x01\x80\x52\x0c\xc1\x00\x51\x9f\x25\x00\x71\x28\x02\x00\x54'
+        b'\x28\x01\x28\x0b\xd6\x22\x0b\x9b\x48\x15\x40\x38\x48\xff\xff\x35'
+        b'\x96\x01\x00\xb4\xf7\x03\x13\xaa\xc8\x46\x40\xf9\xe2\x83\x00\x91'
+        b'\xe1\x03\x1f\x2a\xe0\x0e\x41\xf8\x00\x01\x3f\xd6\xe0\x01\x00\x34'
+        b'\x00\x00\x00\x90\x75\x00\x80\x52\x00\xcc\x30\x91\x15\x00\x00\x14'
+        b'\x55\x00\x80\x52\xe0\x03\x15\x2a\xff\x43\x13\x91\xf4\x4f\x45\xa9'
+        b'\xf6\x57\x44\xa9\xf8\x5f\x43\xa9\xfa\x67\x42\xa9\xfc\x6f\x41\xa9'
+        b'\xfd\x7b\xc6\xa8\xc0\x03\x5f\xd6\xf7\x03\x13\xaa\xc8\x46\x40\xf9'
+        b'\xe2\x63\x00\x91\xe1\x03\x1f\x2a\xe0\x8e\x41\xf8\x00\x01\x3f\xd6'
+        b'\x00\x01\x00\x34\x00\x00\x00\x90\x95\x00\x80\x52\x00\x60\x30\x91'
+        b'\xc8\x16\x40\xf9\xe1\x02\x40\xf9\x00\x01\x3f\xd6\xea\xff\xff\x17'
+        b'\x9f\x16\x00\x71\xeb\x03\x00\x54\xf7\x03\x13\xaa\xc8\x46\x40\xf9'
+        b'\xe2\x43\x00\x91\xe1\x03\x1f\x2a\xe0\x0e\x42\xf8\x00\x01\x3f\xd6'
+        b'\xe8\x03\x00\x2a\x00\x00\x00\x90\xb5\x00\x80\x52\x00\x00\x30\x91'
+        b'\x08\xfe\xff\x35\xe8\x0b\x40\xf9\xc8\xfd\xff\xb4\x08\xfd\x50\xd3'
+        b'\x88\xfd\xff\xb5\x9f\x1a\x00\x71\xc3\x01\x00\x54\x60\x8e\x42\xf8'
+        b'\xc8\x46\x40\xf9\xe2\x23\x00\x91\xe1\x03\x1f\x2a\xf7\x03\x13\xaa'
+        b'\x00\x01\x3f\xd6\xe8\x03\x00\x2a\x00\x00\x00\x90\xd5\x00\x80\x52'
+        b'\x00\x6c\x31\x91\xe8\xfb\xff\x35\xe8\x07\x40\xf9\xa8\xfb\xff\xb4'
+        b'\xe9\x07\x40\xf9\x0a\x00\x00\x90\x0c\x64\x90\x52\xeb\xa3\x00\x91'
+        b'\x0c\xb7\xbd\x72\xe8\x03\x1f\xaa\x20\x04\x00\x4f\xf6\xa7\x02\xa9'
+        b'\x81\x04\x00\x4f\x42\xfd\xc2\x3d\x69\x51\x00\x91\x83\x0d\x04\x4e'
+        b'\xff\x3b\x00\xb9\xff\xc3\x04\xb9\x44\x1c\x20\x4e\x45\x04\x3f\x6f'
+        b'\x42\x84\xa1\x4e\x84\x98\xa0\x4e\xa6\x1c\x23\x6e\xa4\x1c\x66\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x24\x69\xa8\x3c'
+        b'\x08\x41\x00\x91\x1f\x01\x10\xf1\x81\xfa\xff\x54\x00\x00\x00\x90'
+        b'\xc8\x12\x40\xf9\x00\x3c\x31\x91\x00\x01\x3f\xd6\xc8\x06\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf7\xa3\x00\x91\xfc\x03\x1f\x2a\xf3\x52\x10\x91'
+        b'\xb9\x0a\x80\x52\xba\x0f\x80\x52\xbb\x0e\x80\x52\x07\x00\x00\x14'
+        b'\xe8\x3b\x40\xb9\x15\x01\x80\x52\x08\x05\x00\x11\x1f\x3d\x00\x71'
+        b'\xe8\x3b\x00\xb9\x88\xef\xff\x54\xe8\x1b\x40\xb9\xe9\x0b\x40\xf9'
+        b'\xea\x13\x40\xf9\x08\x01\x1c\x4b\x3f\x01\x08\xeb\x35\x31\x88\x1a'
+        b'\x54\x41\x3c\x8b\xd5\x01\x00\x34\x08\x00\x80\x12\xe9\x03\x14\xaa'
+        b'\xea\x03\x15\xaa\x2b\x15\x40\x38\x0c\x1d\x00\x12\x4a\x05\x00\xf1'
+        b'\x8b\x01\x0b\x4a\xeb\x4a\x2b\x8b\x6b\x15\x40\xb9\x68\x21\x48\x4a'
+        b'\x21\xff\xff\x54\xf6\x03\x28\x2a\x02\x00\x00\x14\xf6\x03\x1f\x2a'
+        b'\xe8\xc3\x44\xb9\x1f\x01\x02\x71\x03\x01\x00\x54\xe8\x02\x08\x8b'
+        b'\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\xe8\x42\x28\x8b'
+        b'\xe9\xc3\x04\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x89\x03\x19\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xe9\xc3\x04\xb9'
+        b'\x89\x03\x1b\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x0a\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xea\xc3\x04\xb9\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x29\x23\x5c\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xe9\xc3\x04\xb9'
+        b'\x69\x23\x5c\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x0a\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xea\xc3\x04\xb9\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x29\x43\x5c\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xe9\xc3\x04\xb9'
+        b'\x69\x43\x5c\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x0a\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xea\xc3\x04\xb9\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x29\x63\x5c\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a'
+        b'\x81\x00\x00\x54\x2a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54'
+        b'\x09\x05\x00\x11\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\x69\x63\x5c\x4a'
+        b'\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x0a\x05\x00\x11\xe8\x42\x28\x8b'
+        b'\xfc\x03\x00\xb9\xea\xc3\x04\xb9\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xbc\x02\x19\x4a\x89\x1f\x00\x12\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x29\xf5\x01\x51\x3f\x09\x00\x71'
+        b'\xc2\x2b\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xe9\xc3\x04\xb9'
+        b'\xa9\x02\x1b\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x0a\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xea\xc3\x04\xb9\x09\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x38\x23\x55\x4a\x6a\x23\x55\x4a\x09\x1f\x00\x12'
+        b'\x3f\x35\x00\x71\xea\x07\x00\xb9\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x29\xf5\x01\x51\x3f\x09\x00\x71\xc2\x27\x00\x54\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\xe9\x07\x40\xb9\x1a\x51\x10\x39'
+        b'\xe8\xc3\x44\xb9\x0a\x05\x00\x11\xe8\x42\x28\x8b\xea\xc3\x04\xb9'
+        b'\x09\x51\x10\x39\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\xe8\x02\x08\x8b\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xc9\x02\x19\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\xc9\x02\x1b\x4a\x1a\x51\x10\x39'
+        b'\xe8\xc3\x44\xb9\x0a\x05\x00\x11\xe8\x42\x28\x8b\xea\xc3\x04\xb9'
+        b'\x09\x51\x10\x39\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\xe8\x02\x08\x8b\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x29\x23\x56\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\x69\x23\x56\x4a\x1a\x51\x10\x39'
+        b'\xe8\xc3\x44\xb9\x0a\x05\x00\x11\xe8\x42\x28\x8b\xea\xc3\x04\xb9'
+        b'\x09\x51\x10\x39\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\xe8\x02\x08\x8b\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x29\x43\x56\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\x69\x43\x56\x4a\x1a\x51\x10\x39'
+        b'\xe8\xc3\x44\xb9\x0a\x05\x00\x11\xe8\x42\x28\x8b\xea\xc3\x04\xb9'
+        b'\x09\x51\x10\x39\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\xe8\x02\x08\x8b\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x29\x63\x56\x4a'
+        b'\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b'
+        b'\xe9\xc3\x04\xb9\x69\x63\x56\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x0a\x05\x00\x11\xe8\x42\x28\x8b\xea\xc3\x04\xb9\x09\x51\x10\x39'
+        b'\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b'
+        b'\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x89\x1f\x00\x12\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x29\xf5\x01\x51\x3f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xbc\x02\x1b\x4a'
+        b'\xe9\xc3\x04\xb9\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\x1c\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\xe8\x02\x08\x8b\xe9\x17\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\x09\x1f\x00\x12\xfc\x03\x40\xb9\x3f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x81\x00\x00\x54\x29\xf5\x01\x51\x3f\x09\x00\x71'
+        b'\xe2\x00\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b\xf8\x07\x40\xb9'
+        b'\xe9\xc3\x04\xb9\x1a\x51\x10\x39\xe8\xc3\x44\xb9\x09\x05\x00\x11'
+        b'\xe8\x42\x28\x8b\xe9\xc3\x04\xb9\x18\x51\x10\x39\x15\x05\x00\x34'
+        b'\xf6\x03\x15\xaa\x16\x00\x00\x14\x09\x03\x19\x4a\x3f\x35\x00\x71'
+        b'\xe8\x03\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52\x4a\x21\xc9\x1a'
+        b'\x5f\x01\x0b\x6a\x40\x03\x00\x54\x09\x05\x00\x11\xe8\x42\x28\x8b'
+        b'\xe9\xc3\x04\xb9\x09\x03\x1b\x4a\x1a\x51\x10\x39\xe8\xc3\x44\xb9'
+        b'\x0a\x05\x00\x11\xe8\x42\x28\x8b\xd6\x06\x00\xf1\x94\x06\x00\x91'
+        b'\xea\xc3\x04\xb9\x09\x51\x10\x39\x20\x02\x00\x54\x98\x02\x40\x39'
+        b'\xe8\xc3\x44\xb9\x1f\xfd\x01\x71\x03\xfd\xff\x54\xe8\x02\x08\x8b'
+        b'\xe9\x17\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xe0\xff\xff\x17\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\xa3\xfc\xff\x54\xea\xff\xff\x17\xe8\xc3\x44\xb9'
+        b'\xe0\x03\x13\xaa\xe9\x17\x40\xf9\xe8\x02\x08\x8b\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xf6\x1b\x40\xb9\xff\xc3\x04\xb9'
+        b'\xe8\x17\x40\xf9\xe0\x03\x1f\xaa\x08\x2d\x40\xf9\x00\x01\x3f\xd6'
+        b'\xf4\x03\x00\xaa\xe8\x17\x40\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x17\x40\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x14\xaa'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x40\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54'
+        b'\x14\xfe\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6\x20\xc2\xff\x37'
+        b'\x1f\x84\x01\x71\x20\x06\x00\x54\x1f\xc4\x01\x71\x60\x06\x00\x54'
+        b'\x1f\xc8\x01\x71\xe1\xfc\xff\x54\xf5\x03\x1f\x2a\xf8\x03\x1f\x2a'
+        b'\xe8\x17\x40\xf9\xe0\x03\x1f\xaa\x08\x2d\x40\xf9\x00\x01\x3f\xd6'
+        b'\xf4\x03\x00\xaa\xe8\x17\x40\xf9\x08\x09\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x17\x40\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9\xe0\x03\x14\xaa'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x40\xf9\x1f\x00\x08\xeb\xc3\xfe\xff\x54'
+        b'\xf8\xfd\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6\x08\xc0\x00\x51'
+        b'\x1f\x29\x00\x71\x43\x01\x00\x54\x08\x84\x01\x51\x1f\x15\x00\x71'
+        b'\x68\x00\x00\x54\x08\x5c\x01\x51\x05\x00\x00\x14\x08\x04\x01\x51'
+        b'\x1f\x15\x00\x71\x68\xbd\xff\x54\x08\xdc\x00\x51\x15\x11\x15\x2a'
+        b'\x18\x07\x00\x11\x1f\x23\x00\x71\xc1\xfb\xff\x54\xbf\x02\x16\x6b'
+        b'\x9c\x83\x95\x1a\xe3\xfd\xff\x17\xe9\x03\x1c\x2a\xa8\xfe\xff\x17'
+        b'\xe9\x03\x18\x2a\xc8\xfe\xff\x17\xf5\xab\xff\x34\xbc\x02\x1c\x0b'
+        b'\xff\x3b\x00\xb9\xe1\xfd\xff\x17\xf5\x00\x80\x52\x5a\xfd\xff\x17'
+        b'\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69'
+        b'\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25'
+        b'\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72'
+        b'\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x2d'
+        b'\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x13\xdd\x4d\xe2\x00\x60\xa0\xe1'
+        b'\x01\x0a\xa0\xe3\x01\x50\xa0\xe3\x1c\x00\x8d\xe5\xfa\x0f\xa0\xe3'
+        b'\x18\x00\x8d\xe5\x07\x00\x46\xe2\x03\x00\x70\xe3\x53\x00\x00\x3a'
+        b'\x04\x20\x91\xe5\x01\x40\xa0\xe1\x02\x50\xa0\xe3\x00\x00\xd2\xe5'
+        b'\x00\x00\x50\xe3\x4d\x00\x00\x0a\x01\x10\x82\xe2\x00\x30\xa0\xe3'
+        b'\x03\x70\xd1\xe7\x01\x30\x83\xe2\x00\x00\x57\xe3\xfb\xff\xff\x1a'
+        b'\x03\x00\x53\xe3\x03\x00\x00\x3a\x30\x00\x50\xe3\x01\x30\xd2\x05'
+        b'\x78\x00\x53\x03\x18\x00\x00\x0a\x00\x70\xa0\xe3\x30\x20\x40\xe2'
+        b'\x09\x00\x52\xe3\x3d\x00\x00\x8a\x07\x21\x87\xe0\x82\x00\x80\xe0'
+        b'\x30\x70\x40\xe2\x01\x00\xd1\xe4\x00\x00\x50\xe3\xf6\xff\xff\x1a'
+        b'\x00\x00\x57\xe3\x35\x00\x00\x0a\x04\x80\xa0\xe1\x44\x30\x97\xe5'
+        b'\x24\x20\x8d\xe2\x00\x10\xa0\xe3\x08\x00\xb8\xe5\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\x1c\x00\x00\x0a\xec\x0b\x9f\xe5'
+        b'\x03\x50\xa0\xe3\x00\x00\x8f\xe0\x24\x00\x00\xea\x02\x00\xd2\xe5'
+        b'\x00\x00\x50\xe3\x25\x00\x00\x0a\x03\x10\x82\xe2\x00\x70\xa0\xe3'
+        b'\x05\x00\x00\xea\x07\x32\xa0\xe1\x00\x00\x83\xe0\x02\x70\x80\xe0'
+        b'\x01\x00\xd1\xe4\x00\x00\x50\xe3\xe4\xff\xff\x0a\x30\x30\x40\xe2'
+        b'\x2f\x20\xe0\xe3\x0a\x00\x53\xe3\xf5\xff\xff\x3a\x61\x30\x40\xe2'
+        b'\x56\x20\xe0\xe3\x06\x00\x53\xe3\xf1\xff\xff\x3a\x41\x30\x40\xe2'
+        b'\x36\x20\xe0\xe3\x05\x00\x53\xe3\xed\xff\xff\x9a\x0f\x00\x00\xea'
+        b'\x04\x80\xa0\xe1\x44\x30\x97\xe5\x20\x20\x8d\xe2\x00\x10\xa0\xe3'
+        b'\x0c\x00\xb8\xe5\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x0a\x00\x00\x0a\x58\x0b\x9f\xe5\x04\x50\xa0\xe3\x00\x00\x8f\xe0'
+        b'\x00\x10\x98\xe5\x14\x20\x97\xe5\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x05\x00\xa0\xe1\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8\x1e\xff\x2f\xe1'
+        b'\x05\x00\x56\xe3\x24\x00\x00\xba\x04\x80\xa0\xe1\x44\x30\x97\xe5'
+        b'\x1c\x20\x8d\xe2\x00\x10\xa0\xe3\x10\x00\xb8\xe5\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x10\xa0\xe1\x08\x0b\x9f\xe5\x05\x50\xa0\xe3'
+        b'\x00\x00\x51\xe3\x00\x00\x8f\xe0\xe8\xff\xff\x1a\x1c\x10\x9d\xe5'
+        b'\x00\x00\x51\xe3\xe5\xff\xff\x0a\x00\x20\xa0\xe3\x21\x08\x52\xe1'
+        b'\xe2\xff\xff\x1a\x06\x00\x56\xe3\x0f\x00\x00\x3a\x14\x00\xb4\xe5'
+        b'\x44\x30\x97\xe5\x18\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x10\xa0\xe1\xbc\x0a\x9f\xe5\x06\x50\xa0\xe3'
+        b'\x00\x00\x51\xe3\x00\x00\x8f\xe0\xa3\x02\x00\x1a\x18\x10\x9d\xe5'
+        b'\x04\x80\xa0\xe1\x00\x00\x51\xe3\xd0\xff\xff\x0a\x18\x10\x9d\xe5'
+        b'\x84\x2a\x9f\xe5\x28\xa0\x8d\xe2\x00\x00\xa0\xe3\x28\x70\x8d\xe5'
+        b'\xb8\x04\x8d\xe5\x30\x00\x8d\xe5\x2c\x10\x8d\xe5\x0c\x10\x8a\xe2'
+        b'\xa0\x30\x22\xe0\x01\x00\x10\xe3\xa0\x30\xa0\x01\xa3\x60\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x60\xa0\x01\xa6\x30\x22\xe0\x01\x00\x16\xe3'
+        b'\xa6\x30\xa0\x01\xa3\x60\x22\xe0\x01\x00\x13\xe3\xa3\x60\xa0\x01'
+        b'\xa6\x30\x22\xe0\x01\x00\x16\xe3\xa6\x30\xa0\x01\xa3\x60\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x60\xa0\x01\xa6\x30\x22\xe0\x01\x00\x16\xe3'
+        b'\xa6\x30\xa0\x01\xa3\x60\x22\xe0\x01\x00\x13\xe3\xa3\x60\xa0\x01'
+        b'\x00\x61\x81\xe7\x01\x00\x80\xe2\x01\x0c\x50\xe3\xe3\xff\xff\x1a'
+        b'\x10\x10\x97\xe5\x04\x0a\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x97\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x0c\x00\x8a\xe2\x00\x40\xa0\xe3\x01\x8b\x80\xe2\x24\x00\x9d\xe5'
+        b'\x00\x60\xa0\xe3\x04\x50\x80\xe0\x20\x00\x9d\xe5\x04\x10\x40\xe0'
+        b'\x1c\x00\x9d\xe5\x00\x00\x51\xe1\x00\x10\xa0\x81\x00\x00\x51\xe3'
+        b'\x14\x10\x8d\xe5\x0b\x00\x00\x0a\x14\x20\x9d\xe5\x00\x00\xe0\xe3'
+        b'\x05\x10\xa0\xe1\x01\x30\xd1\xe4\xff\x70\x00\xe2\x01\x20\x52\xe2'
+        b'\x03\x30\x27\xe0\x03\x31\x8a\xe0\x0c\x30\x93\xe5\x20\x04\x23\xe0'
+        b'\xf7\xff\xff\x1a\x00\x60\xe0\xe1\x10\x40\x8d\xe5\xb8\x44\x9d\xe5'
+        b'\x80\x00\x54\xe3\x07\x00\x00\x3a\x04\x00\x8a\xe0\x00\x40\xa0\xe3'
+        b'\x0c\x44\xc0\xe5\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\x00\x84\xe2\x7e\x10\xa0\xe3'
+        b'\xb8\x04\x8d\xe5\x04\x00\x8a\xe0\x0c\x14\xc0\xe5\xb8\x74\x9d\xe5'
+        b'\x7f\x00\x57\xe3\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x10\x40\x9d\xe5\x55\x00\x24\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x06\x00\x00\x2a\x01\x00\x87\xe2'
+        b'\x7d\x10\xa0\xe3\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x24\xe2\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x04\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3'
+        b'\x24\x04\xa0\xe1\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2'
+        b'\x0c\x24\xc1\xe5\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x08\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3'
+        b'\x24\x08\xa0\xe1\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2'
+        b'\x0c\x24\xc1\xe5\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x0c\x20\xe0\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x11\x00\x12\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3\x24\x0c\xa0\xe1'
+        b'\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2\x0c\x24\xc1\xe5'
+        b'\xb8\x74\x9d\xe5\x01\x10\x87\xe2\x14\x40\x9d\xe5\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\x24\xe2\xff\x20\x00\xe2\x04\x00\x8d\xe5'
+        b'\x0d\x00\x52\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x00\xa0\xe3'
+        b'\x09\x1b\x81\xe3\x10\x02\x11\xe1\x02\x00\x00\x1a\x7d\x00\x42\xe2'
+        b'\x02\x00\x50\xe3\x8f\x01\x00\x2a\x01\x00\x87\xe2\x7d\x10\xa0\xe3'
+        b'\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5\x75\x00\x24\xe2'
+        b'\xb8\x74\x9d\xe5\x01\x10\x87\xe2\x08\x20\x8d\xe5\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x24\x24\xa0\xe1\x24\x04\x20\xe0'
+        b'\xff\x40\x00\xe2\x00\x00\x8d\xe5\x0d\x00\x54\xe3\x04\x00\x00\x8a'
+        b'\x01\x10\xa0\xe3\x01\x00\xa0\xe3\x09\x1b\x81\xe3\x10\x04\x11\xe1'
+        b'\x02\x00\x00\x1a\x7d\x00\x44\xe2\x02\x00\x50\xe3\x6b\x01\x00\x2a'
+        b'\x01\x00\x87\xe2\x7d\x10\xa0\xe3\xb8\x04\x8d\xe5\x07\x00\x8a\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x22\xe2\xb8\x74\x9d\xe5\x01\x10\x87\xe2'
+        b'\x0c\x20\x8d\xe5\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x0c\x04\xc1\xe5'
+        b'\xb8\x74\x9d\xe5\x7f\x00\x57\xe3\x07\x00\x00\x3a\x07\x00\x8a\xe0'
+        b'\x00\x70\xa0\xe3\x0c\x74\xc0\xe5\x28\x00\x9d\xe5\x10\x10\x90\xe5'
+        b'\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x26\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x06\x00\x00\x2a\x01\x00\x87\xe2'
+        b'\x7d\x10\xa0\xe3\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x26\xe2\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x26\x04\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3'
+        b'\x26\x04\xa0\xe1\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2'
+        b'\x0c\x24\xc1\xe5\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x26\x08\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3'
+        b'\x26\x08\xa0\xe1\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2'
+        b'\x0c\x24\xc1\xe5\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5'
+        b'\x07\x10\x8a\xe0\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3'
+        b'\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5'
+        b'\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x26\x0c\x20\xe0\x0d\x00\x50\xe3'
+        b'\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x11\x00\x12\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2\x02\x00\x51\xe3'
+        b'\x07\x00\x00\x2a\x01\x10\x87\xe2\x7d\x20\xa0\xe3\x26\x0c\xa0\xe1'
+        b'\xb8\x14\x8d\xe5\x07\x10\x8a\xe0\x75\x00\x20\xe2\x0c\x24\xc1\xe5'
+        b'\xb8\x74\x9d\xe5\x01\x10\x87\xe2\xb8\x14\x8d\xe5\x07\x10\x8a\xe0'
+        b'\x0c\x04\xc1\xe5\xb8\x74\x9d\xe5\x7f\x00\x57\xe3\x07\x00\x00\x3a'
+        b'\x07\x00\x8a\xe0\x00\x70\xa0\xe3\x0c\x74\xc0\xe5\x28\x00\x9d\xe5'
+        b'\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x08\x20\x9d\xe5\x0d\x00\x52\xe3\x04\x00\x00\x8a\x01\x10\xa0\xe3'
+        b'\x01\x00\xa0\xe3\x09\x1b\x81\xe3\x10\x02\x11\xe1\x02\x00\x00\x1a'
+        b'\x7d\x00\x42\xe2\x02\x00\x50\xe3\xbe\x00\x00\x2a\x01\x00\x87\xe2'
+        b'\x7d\x10\xa0\xe3\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5'
+        b'\x14\x00\x9d\xe5\xb8\x74\x9d\xe5\x75\x10\x20\xe2\x01\x00\x87\xe2'
+        b'\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5\xb8\x74\x9d\xe5'
+        b'\x7f\x00\x57\xe3\x07\x00\x00\x3a\x07\x00\x8a\xe0\x00\x70\xa0\xe3'
+        b'\x0c\x74\xc0\xe5\x28\x00\x9d\xe5\x10\x10\x90\xe5\x08\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x0c\x20\x9d\xe5\x0d\x00\x54\xe3'
+        b'\x04\x00\x00\x8a\x01\x10\xa0\xe3\x01\x00\xa0\xe3\x09\x1b\x81\xe3'
+        b'\x10\x04\x11\xe1\x02\x00\x00\x1a\x7d\x00\x44\xe2\x02\x00\x50\xe3'
+        b'\x9e\x00\x00\x2a\x01\x00\x87\xe2\x7d\x10\xa0\xe3\xb8\x04\x8d\xe5'
+        b'\x07\x00\x8a\xe0\x0c\x14\xc0\xe5\x75\x10\x22\xe2\xb8\x74\x9d\xe5'
+        b'\x01\x00\x87\xe2\xb8\x04\x8d\xe5\x07\x00\x8a\xe0\x0c\x14\xc0\xe5'
+        b'\x14\x00\x9d\xe5\x00\x00\x50\xe3\x27\x00\x00\x0a\x14\x70\x9d\xe5'
+        b'\x12\x00\x00\xea\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x11\x00\x12\xe1\x1c\x00\x00\x0a\x01\x00\x84\xe2\x7d\x10\xa0\xe3'
+        b'\xb8\x04\x8d\xe5\x04\x00\x8a\xe0\x0c\x14\xc0\xe5\x75\x00\x26\xe2'
+        b'\xb8\x44\x9d\xe5\x01\x10\x84\xe2\x01\x50\x85\xe2\x01\x70\x57\xe2'
+        b'\xb8\x14\x8d\xe5\x04\x10\x8a\xe0\x0c\x04\xc1\xe5\x12\x00\x00\x0a'
+        b'\x00\x60\xd5\xe5\xb8\x44\x9d\xe5\x7f\x00\x54\xe3\x07\x00\x00\x3a'
+        b'\x04\x00\x8a\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\x28\x00\x9d\xe5'
+        b'\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x55\x00\x26\xe2\x0d\x00\x50\xe3\xdd\xff\xff\x9a\x7d\x10\x40\xe2'
+        b'\x02\x00\x51\xe3\xdf\xff\xff\x3a\xe5\xff\xff\xea\xb8\x04\x9d\xe5'
+        b'\x00\x50\xa0\xe3\x00\x00\x8a\xe0\x0c\x54\xc0\xe5\x28\x00\x9d\xe5'
+        b'\x10\x10\x90\xe5\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x20\x70\x9d\xe5\x00\x40\xa0\xe3\xb8\x54\x8d\xe5\x28\x00\x9d\xe5'
+        b'\x2c\x10\x90\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x50\xa0\xe1\x28\x00\x9d\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x28\x10\x9d\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a'
+        b'\x2c\x10\x91\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x2c\x10\x9d\xe5\x01\x00\x50\xe1\xf1\xff\xff\x3a\x39\x00\x00\xea'
+        b'\x04\x00\x91\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x34\x00\x00\x4a\x61\x00\x50\xe3\x42\x00\x00\x0a\x71\x00\x50\xe3'
+        b'\x47\x00\x00\x0a\x72\x00\x50\xe3\xdf\xff\xff\x1a\x00\x40\xa0\xe3'
+        b'\x00\x60\xa0\xe3\x28\x00\x9d\xe5\x2c\x10\x90\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1\x28\x00\x9d\xe5'
+        b'\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x28\x10\x9d\xe5'
+        b'\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5\x05\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x2c\x10\x9d\xe5\x01\x00\x50\xe1'
+        b'\xf1\xff\xff\x3a\x17\x00\x00\xea\x04\x00\x91\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x30\x10\x40\xe2\x0a\x00\x51\xe3\x08\x00\x00\x3a'
+        b'\x61\x10\x40\xe2\x05\x00\x51\xe3\x01\x00\x00\x8a\x57\x10\x40\xe2'
+        b'\x03\x00\x00\xea\x41\x10\x40\xe2\x05\x00\x51\xe3\x09\x00\x00\x8a'
+        b'\x37\x10\x40\xe2\x01\x60\x86\xe2\x04\x42\x81\xe1\x08\x00\x56\xe3'
+        b'\xd7\xff\xff\x1a\x07\x00\x54\xe1\x10\x00\x9d\xe5\x04\x00\xa0\x91'
+        b'\x00\x40\xa0\xe1\x00\x00\x00\xea\x10\x40\x9d\xe5\x30\x00\x9d\xe5'
+        b'\x08\x50\xa0\xe3\x01\x00\x80\xe2\x0f\x00\x50\xe3\x30\x00\x8d\xe5'
+        b'\xa1\xfd\xff\x9a\x45\xfd\xff\xea\x04\x00\x9d\xe5\x74\xfe\xff\xea'
+        b'\x00\x00\x9d\xe5\x98\xfe\xff\xea\x04\x10\x9d\xe5\x46\xff\xff\xea'
+        b'\x00\x10\x9d\xe5\x65\xff\xff\xea\x14\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x07\x00\x00\x0a\x30\x40\x8d\xe5\x10\x40\x9d\xe5\x04\x40\x80\xe0'
+        b'\x91\xfd\xff\xea\x07\x50\xa0\xe3\x34\xfd\xff\xea\x04\x80\xa0\xe1'
+        b'\x2e\xfd\xff\xea\x00\x50\xa0\xe3\x30\xfd\xff\xea\x20\x83\xb8\xed'
+        b'\x2b\x0c\x00\x00\x78\x0b\x00\x00\x08\x0b\x00\x00\x13\x0b\x00\x00'
+        b'\x53\x0a\x00\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63'
+        b'\x6b\x20\x73\x69\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74'
+        b'\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d'
+        b'\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25'
+        b'\x73\x0a\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49'
+        b'\x6e\x76\x61\x6c\x69\x64\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20'
+        b'\x25\x73\x0a\x00',
+}
+
+READ_MEMORY_RLE = {
+    'aarch64':
+        b'\xfd\x7b\xba\xa9\xfc\x6f\x01\xa9\xfd\x03\x00\x91\xfa\x67\x02\xa9'
+        b'\xf8\x5f\x03\xa9\xf6\x57\x04\xa9\xf4\x4f\x05\xa9\xff\x13\x40\xd1'
+        b'\xff\x43\x14\xd1\xf6\x13\x40\x91\x08\x00\x82\x52\x09\x7d\x80\x52'
+        b'\x0a\x1c\x00\x51\x5f\x0d\x00\x31\xc9\xa2\x84\xa9\x62\x00\x00\x54'
+        b'\x35\x00\x80\x52\x47\x00\x00\x14\x2a\x04\x40\xf9\xf3\x03\x01\xaa'
+        b'\x48\x01\x40\x39\x48\x08\x00\x34\xf4\x03\x00\x2a\xe9\x03\x1f\xaa'
+        b'\x4b\x05\x00\x91\x2c\x05\x00\x91\x6d\x69\x69\x38\xe9\x03\x0c\xaa'
+        b'\xad\xff\xff\x35\x9f\x0d\x00\xf1\x23\x04\x00\x54\x1f\xc1\x00\x71'
+        b'\xe1\x03\x00\x54\x49\x05\x40\x39\x3f\xe1\x01\x71\x81\x03\x00\x54'
+        b'\x49\x09\x40\x39\x49\x06\x00\x34\xeb\x05\x80\x12\xf7\x03\x1f\xaa'
+        b'\x48\x0d\x00\x91\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1\x07\x00\x00\x14'
+        b'\x29\x1d\x40\x92\xed\xee\x7c\xd3\x8c\x01\x09\x0b\x09\x15\x40\x38'
+        b'\x97\x01\x0d\x8b\x29\x03\x00\x34\xec\x05\x80\x12\x2d\xc1\x00\x51'
+        b'\xbf\x29\x00\x71\xe3\xfe\xff\x54\xec\x03\x0a\xaa\x2d\x85\x01\x51'
+        b'\xbf\x19\x00\x71\x63\xfe\xff\x54\xec\x03\x0b\xaa\x2d\x05\x01\x51'
+        b'\xbf\x15\x00\x71\xe9\xfd\xff\x54\x19\x00\x00\x14\xf7\x03\x1f\xaa'
+        b'\xe9\x05\x80\x12\x4a\x05\x00\x91\x4b\x01\x80\x52\x0c\xc1\x00\x51'
+        b'\x9f\x25\x00\x71\x48\x02\x00\x54\x28\x01\x28\x0b\xf7\x22\x0b\x9b'
+        b'\x48\x15\x40\x38\x48\xff\xff\x35\xb7\x01\x00\xb4\xf8\x03\x13\xaa'
+        b'\xe2\x13\x40\x91\xe8\x46\x40\xf9\x42\x80\x01\x91\xe1\x03\x1f\x2a'
+        b'\x00\x0f\x41\xf8\x00\x01\x3f\xd6\x00\x02\x00\x34\x00\x00\x00\x90'
+        b'\x75\x00\x80\x52\x00\x4c\x3c\x91\x17\x00\x00\x14\x55\x00\x80\x52'
+        b'\xe0\x03\x15\x2a\xff\x13\x40\x91\xff\x43\x14\x91\xf4\x4f\x45\xa9'
+        b'\xf6\x57\x44\xa9\xf8\x5f\x43\xa9\xfa\x67\x42\xa9\xfc\x6f\x41\xa9'
+        b'\xfd\x7b\xc6\xa8\xc0\x03\x5f\xd6\xf8\x03\x13\xaa\xe2\x13\x40\x91'
+        b'\xe8\x46\x40\xf9\x42\x60\x01\x91\xe1\x03\x1f\x2a\x00\x8f\x41\xf8'
+        b'\x00\x01\x3f\xd6\x00\x01\x00\x34\x00\x00\x00\x90\x95\x00\x80\x52'
+        b'\x00\xe0\x3b\x91\xe8\x16\x40\xf9\x01\x03\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\xff\xff\x17\x9f\x16\x00\x71\x2b\x04\x00\x54\xf8\x03\x13\xaa'
+        b'\xe2\x13\x40\x91\xe8\x46\x40\xf9\x42\x40\x01\x91\xe1\x03\x1f\x2a'
+        b'\x00\x0f\x42\xf8\x00\x01\x3f\xd6\xe8\x03\x00\x2a\x00\x00\x00\x90'
+        b'\xb5\x00\x80\x52\x00\x80\x3b\x91\xe8\xfd\xff\x35\xc8\x06\x40\xf9'
+        b'\xa8\xfd\xff\xb4\x1f\x09\x40\xf1\x68\xfd\xff\x54\x9f\x1a\x00\x71'
+        b'\xe3\x01\x00\x54\xe2\x13\x40\x91\xe8\x46\x40\xf9\x60\x8e\x42\xf8'
+        b'\x42\x20\x01\x91\xe1\x03\x1f\x2a\xf8\x03\x13\xaa\x00\x01\x3f\xd6'
+        b'\xe8\x03\x00\x2a\x00\x00\x00\x90\xd5\x00\x80\x52\x00\xec\x3c\x91'
+        b'\xa8\xfb\xff\x35\xc8\x02\x40\xf9\x68\xfb\xff\xb4\xc9\x02\x40\xf9'
+        b'\x0a\x00\x00\x90\x0c\x64\x90\x52\xeb\x13\x40\x91\x0c\xb7\xbd\x72'
+        b'\x6b\xa1\x01\x91\x20\x04\x00\x4f\xe8\x03\x1f\xaa\x81\x04\x00\x4f'
+        b'\xd7\x26\x02\xa9\x42\xb5\xc3\x3d\x69\x51\x00\x91\x83\x0d\x04\x4e'
+        b'\xdf\x32\x00\xb9\xdf\xba\x04\xb9\x44\x1c\x20\x4e\x45\x04\x3f\x6f'
+        b'\x42\x84\xa1\x4e\x84\x98\xa0\x4e\xa6\x1c\x23\x6e\xa4\x1c\x66\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x24\x69\xa8\x3c'
+        b'\x08\x41\x00\x91\x1f\x01\x10\xf1\x81\xfa\xff\x54\x00\x00\x00\x90'
+        b'\xe8\x12\x40\xf9\x00\xbc\x3c\x91\x00\x01\x3f\xd6\xe8\x06\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf8\x13\x40\x91\xf9\x0b\x40\x91\x18\xa3\x01\x91'
+        b'\xfb\x03\x1f\x2a\x13\x53\x10\x91\x39\x23\x01\x91\xf7\x13\x00\x91'
+        b'\xfa\x1f\x80\x52\x07\x00\x00\x14\xc8\x32\x40\xb9\x15\x01\x80\x52'
+        b'\x08\x05\x00\x11\x1f\x3d\x00\x71\xc8\x32\x00\xb9\xa8\xee\xff\x54'
+        b'\xc8\x12\x40\xb9\xc9\x06\x40\xf9\x08\x01\x1b\x4b\x3f\x01\x08\xeb'
+        b'\x35\x31\x88\x1a\xb5\x12\x00\x34\xc8\x0e\x40\xf9\xe9\x0b\x40\x91'
+        b'\x29\x21\x01\x91\xea\x03\x15\xaa\x08\x41\x3b\x8b\x0b\x15\x40\x38'
+        b'\x4a\x05\x00\xf1\x2b\x15\x00\x38\xa1\xff\xff\x54\x75\x11\x00\x34'
+        b'\xe8\x0b\x40\x91\x09\x00\x80\x12\x08\x21\x01\x91\xea\x03\x15\xaa'
+        b'\x0b\x15\x40\x38\x2c\x1d\x00\x12\x4a\x05\x00\xf1\x8b\x01\x0b\x4a'
+        b'\x0b\x4b\x2b\x8b\x6b\x15\x40\xb9\x69\x21\x49\x4a\x21\xff\xff\x54'
+        b'\xf4\x03\x1f\x2a\xe8\x03\x1f\x2a\xfc\x03\x29\x2a\x07\x00\x00\x14'
+        b'\xfa\x4a\x34\x38\x94\x06\x00\x11\xe9\x03\x08\x2a\xe8\x03\x09\x2a'
+        b'\x3f\x01\x15\x6b\xe2\x0e\x00\x54\x09\x05\x00\x11\x3f\x01\x15\x6b'
+        b'\x62\x02\x00\x54\xe9\x03\x08\x2a\x2c\x00\x80\x52\x2a\x6b\x69\x38'
+        b'\x2b\x01\x0c\x0b\x2b\x4b\x6b\x38\x7f\x01\x0a\x6b\x01\x06\x00\x54'
+        b'\x8b\x05\x00\x91\x9f\x01\x02\xf1\xc8\x00\x00\x54\x2d\x01\x0c\x0b'
+        b'\xec\x03\x0b\xaa\xad\x05\x00\x11\xbf\x01\x15\x6b\xa3\xfe\xff\x54'
+        b'\x29\x01\x0b\x0b\x7f\x09\x00\x71\x28\x05\x00\x54\x1f\x01\x15\x6b'
+        b'\x82\xfc\xff\x54\xeb\x03\x1f\x2a\xec\x03\x08\x2a\x8a\x09\x00\x11'
+        b'\x5f\x01\x15\x6b\x42\x01\x00\x54\x89\x05\x00\x91\x2d\x6b\x6c\x38'
+        b'\x2e\x6b\x69\x38\xbf\x01\x0e\x6b\xc1\x00\x00\x54\x2a\x4b\x6a\x38'
+        b'\xbf\x01\x0a\x6b\x61\x00\x00\x54\x49\x00\x00\x14\x89\x05\x00\x91'
+        b'\x6a\x05\x00\x11\x3f\x01\x15\xeb\xa2\x00\x00\x54\x7f\xfd\x01\x71'
+        b'\xec\x03\x09\xaa\xeb\x03\x0a\x2a\xa3\xfd\xff\x54\x4b\x05\x00\x51'
+        b'\xeb\x4a\x34\x38\x94\x06\x00\x11\x5f\x81\x00\x71\x42\x02\x00\x54'
+        b'\x2b\x4b\x68\x38\x08\x05\x00\x11\x4a\x05\x00\x71\xeb\x4a\x34\x38'
+        b'\x94\x06\x00\x11\x61\xff\xff\x54\xc5\xff\xff\x17\x29\x01\x0c\x0b'
+        b'\xeb\x03\x0c\xaa\x7f\x09\x00\x71\x29\xfb\xff\x54\x68\xf5\x01\x11'
+        b'\x8b\x06\x00\x11\xe8\x4a\x34\x38\x94\x0a\x00\x11\xea\x4a\x2b\x38'
+        b'\xbb\xff\xff\x17\x4b\x05\x00\x51\x1f\x01\x0b\x2b\xec\x37\x9f\x1a'
+        b'\x9f\x02\x0b\x2b\xeb\x37\x9f\x1a\x4c\xfd\x07\x37\x2b\xfd\x07\x37'
+        b'\x2b\x43\x28\x8b\xec\x42\x34\x8b\x60\x05\x40\xad\x4b\x69\x1b\x12'
+        b'\x7f\x81\x00\x71\x80\x05\x00\xad\xe0\x02\x00\x54\x0c\x81\x00\x11'
+        b'\x8d\x82\x00\x11\x2c\x03\x0c\x8b\xed\x02\x0d\x8b\x7f\x01\x01\x71'
+        b'\x80\x05\x40\xad\xa0\x05\x00\xad\xe0\x01\x00\x54\x0c\x01\x01\x11'
+        b'\x8d\x02\x01\x11\x2c\x03\x0c\x8b\xed\x02\x0d\x8b\x7f\x81\x01\x71'
+        b'\x80\x05\x40\xad\xa0\x05\x00\xad\xe0\x00\x00\x54\x0c\x81\x01\x11'
+        b'\x8d\x82\x01\x11\x2c\x03\x0c\x8b\xed\x02\x0d\x8b\x80\x05\x40\xad'
+        b'\xa0\x05\x00\xad\x94\x02\x0b\x0b\x5f\x01\x0b\x6b\x80\xf2\xff\x54'
+        b'\x08\x01\x0b\x0b\x4a\x11\x00\x12\xc6\xff\xff\x17\x69\x05\x00\x51'
+        b'\xea\x03\x0b\x2a\xe9\x4a\x34\x38\x94\x06\x00\x11\xe9\x03\x0c\x2a'
+        b'\xcb\xf7\xff\x35\x8a\xff\xff\x17\xfc\x03\x1f\x2a\xf4\x03\x1f\x2a'
+        b'\xc8\xba\x44\xb9\x1f\x01\x02\x71\x03\x01\x00\x54\x08\x03\x08\x8b'
+        b'\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xc9\x0f\x80\x52\x09\x51\x10\x39\xc8\xba\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x69\x03\x09\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x69\x03\x08\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x21\x5b\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b\xc9\xba\x04\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x5b\x4a'
+        b'\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b\xca\xba\x04\xb9'
+        b'\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x41\x5b\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x08\x43\x28\x8b\xc9\xba\x04\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x41\x5b\x4a\xc8\xba\x44\xb9'
+        b'\x0a\x05\x00\x11\x08\x43\x28\x8b\xca\xba\x04\xb9\x09\x51\x10\x39'
+        b'\xc8\xba\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x08\x03\x08\x8b'
+        b'\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x61\x5b\x4a'
+        b'\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54\x2a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x61\x5b\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\xa9\x02\x09\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b\xc9\xba\x04\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\xa9\x02\x08\x4a'
+        b'\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b\xca\xba\x04\xb9'
+        b'\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x21\x55\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54'
+        b'\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a'
+        b'\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54'
+        b'\x09\x05\x00\x11\x08\x43\x28\x8b\xc9\xba\x04\xb9\xa9\x0f\x80\x52'
+        b'\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x21\x55\x4a\xc8\xba\x44\xb9'
+        b'\x0a\x05\x00\x11\x08\x43\x28\x8b\xca\xba\x04\xb9\x09\x51\x10\x39'
+        b'\xc8\xba\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54\x08\x03\x08\x8b'
+        b'\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x89\x03\x09\x4a'
+        b'\x2a\x1d\x00\x12\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52'
+        b'\x2c\x80\x84\x52\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54'
+        b'\x4a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x08\x43\x28\x8b\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x89\x03\x08\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11'
+        b'\x08\x43\x28\x8b\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x29\x21\x5c\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x21\x5c\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\x29\x41\x5c\x4a\x2a\x1d\x00\x12\x5f\x35\x00\x71'
+        b'\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52\x6b\x21\xca\x1a'
+        b'\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b\xc9\xba\x04\xb9'
+        b'\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52\x09\x41\x5c\x4a'
+        b'\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b\xca\xba\x04\xb9'
+        b'\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71\x03\x01\x00\x54'
+        b'\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa\x1f\x51\x10\x39'
+        b'\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a\xa9\x0a\x80\x52'
+        b'\x29\x61\x5c\x4a\x3f\x35\x00\x71\xc8\x00\x00\x54\x2a\x00\x80\x52'
+        b'\x2b\x80\x84\x52\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x81\x00\x00\x54'
+        b'\x2a\xf5\x01\x51\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11'
+        b'\x08\x43\x28\x8b\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x09\x61\x5c\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11'
+        b'\x08\x43\x28\x8b\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9'
+        b'\x1f\xfd\x01\x71\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xa9\x0a\x80\x52\x89\x02\x09\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x89\x02\x08\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xca\xba\x04\xb9\x09\x51\x10\x39\xc8\xba\x44\xb9\x1f\xfd\x01\x71'
+        b'\x03\x01\x00\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9\xe0\x03\x13\xaa'
+        b'\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6\xe8\x03\x1f\x2a'
+        b'\xa9\x0a\x80\x52\xfa\x03\x1b\x2a\x29\x21\x54\x4a\x2a\x1d\x00\x12'
+        b'\x5f\x35\x00\x71\xc8\x00\x00\x54\x2b\x00\x80\x52\x2c\x80\x84\x52'
+        b'\x6b\x21\xca\x1a\x7f\x01\x0c\x6a\x81\x00\x00\x54\x4a\xf5\x01\x51'
+        b'\x5f\x09\x00\x71\x22\x01\x00\x54\x09\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39\xa8\x0e\x80\x52'
+        b'\x09\x21\x54\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11\x08\x43\x28\x8b'
+        b'\xca\xba\x04\xb9\x09\x51\x10\x39\x94\x05\x00\x34\xf4\x03\x14\x2a'
+        b'\xfb\x13\x00\x91\x19\x00\x00\x14\xa9\x0a\x80\x52\x89\x03\x09\x4a'
+        b'\x3f\x35\x00\x71\x28\x04\x00\x54\x2a\x00\x80\x52\x2b\x80\x84\x52'
+        b'\x4a\x21\xc9\x1a\x5f\x01\x0b\x6a\x80\x03\x00\x54\x09\x05\x00\x11'
+        b'\x08\x43\x28\x8b\xc9\xba\x04\xb9\xa9\x0f\x80\x52\x09\x51\x10\x39'
+        b'\xa8\x0e\x80\x52\x89\x03\x08\x4a\xc8\xba\x44\xb9\x0a\x05\x00\x11'
+        b'\x08\x43\x28\x8b\x7b\x07\x00\x91\x94\x06\x00\xf1\xca\xba\x04\xb9'
+        b'\x09\x51\x10\x39\x20\x02\x00\x54\x7c\x03\x40\x39\xc8\xba\x44\xb9'
+        b'\x1f\xfd\x01\x71\xa3\xfc\xff\x54\x08\x03\x08\x8b\xc9\x12\x40\xf9'
+        b'\xe0\x03\x13\xaa\x1f\x51\x10\x39\x28\x11\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe8\x03\x1f\x2a\xdd\xff\xff\x17\x2a\xf5\x01\x51\x5f\x09\x00\x71'
+        b'\x63\xfc\xff\x54\xea\xff\xff\x17\xc8\xba\x44\xb9\xe0\x03\x13\xaa'
+        b'\xc9\x12\x40\xf9\x08\x03\x08\x8b\x1f\x51\x10\x39\x28\x11\x40\xf9'
+        b'\x00\x01\x3f\xd6\xdc\x12\x40\xb9\xfb\x03\x1a\x2a\xfa\x1f\x80\x52'
+        b'\xdf\xba\x04\xb9\xc8\x12\x40\xf9\xe0\x03\x1f\xaa\x08\x2d\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf4\x03\x00\xaa\xc8\x12\x40\xf9\x08\x09\x40\xf9'
+        b'\x00\x01\x3f\xd6\xc8\x12\x40\xf9\x00\x01\x00\x35\x08\x2d\x40\xf9'
+        b'\xe0\x03\x14\xaa\x00\x01\x3f\xd6\xc8\x16\x40\xf9\x1f\x00\x08\xeb'
+        b'\xc3\xfe\xff\x54\x65\xfd\xff\x17\x08\x05\x40\xf9\x00\x01\x3f\xd6'
+        b'\x40\xac\xff\x37\x1f\x84\x01\x71\xe0\x05\x00\x54\x1f\xc4\x01\x71'
+        b'\x20\x06\x00\x54\x1f\xc8\x01\x71\xe1\xfc\xff\x54\xe8\x03\x1f\x2a'
+        b'\xf5\x03\x1f\x2a\xe8\x03\x00\xb9\xc8\x12\x40\xf9\xe0\x03\x1f\xaa'
+        b'\x08\x2d\x40\xf9\x00\x01\x3f\xd6\xf4\x03\x00\xaa\xc8\x12\x40\xf9'
+        b'\x08\x09\x40\xf9\x00\x01\x3f\xd6\xc8\x12\x40\xf9\x00\x01\x00\x35'
+        b'\x08\x2d\x40\xf9\xe0\x03\x14\xaa\x00\x01\x3f\xd6\xc8\x16\x40\xf9'
+        b'\x1f\x00\x08\xeb\xc3\xfe\xff\x54\x48\xfd\xff\x17\x08\x05\x40\xf9'
+        b'\x00\x01\x3f\xd6\x08\xc0\x00\x51\x1f\x29\x00\x71\x43\x01\x00\x54'
+        b'\x08\x84\x01\x51\x1f\x15\x00\x71\x68\x00\x00\x54\x08\x5c\x01\x51'
+        b'\x05\x00\x00\x14\x08\x04\x01\x51\x1f\x15\x00\x71\x68\xa7\xff\x54'
+        b'\x08\xdc\x00\x51\xe9\x03\x40\xb9\xb5\x06\x00\x11\xbf\x22\x00\x71'
+        b'\x08\x11\x09\x2a\x81\xfb\xff\x54\x1f\x01\x1c\x6b\x7b\x83\x88\x1a'
+        b'\x32\xfd\xff\x17\x75\x95\xff\x34\xbb\x02\x1b\x0b\xdf\x32\x00\xb9'
+        b'\x34\xfd\xff\x17\xf5\x00\x80\x52\xa6\xfc\xff\x17\x00\x00\x00\x00'
+        b'\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69'
+        b'\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25'
+        b'\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72'
+        b'\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x2d'
+        b'\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x45\xdc\x4d\xe2\x00\x60\xa0\xe1'
+        b'\x01\x0a\xa0\xe3\x01\x50\xa0\xe3\xbc\x04\x0b\xe5\xfa\x0f\xa0\xe3'
+        b'\xc0\x04\x0b\xe5\x07\x00\x46\xe2\x03\x00\x70\xe3\x55\x00\x00\x3a'
+        b'\x04\x20\x91\xe5\x01\x40\xa0\xe1\x02\x50\xa0\xe3\x00\x00\xd2\xe5'
+        b'\x00\x00\x50\xe3\x4f\x00\x00\x0a\x01\x10\x82\xe2\x00\x30\xa0\xe3'
+        b'\x03\x70\xd1\xe7\x01\x30\x83\xe2\x00\x00\x57\xe3\xfb\xff\xff\x1a'
+        b'\x03\x00\x53\xe3\x03\x00\x00\x3a\x30\x00\x50\xe3\x01\x30\xd2\x05'
+        b'\x78\x00\x53\x03\x19\x00\x00\x0a\x00\x70\xa0\xe3\x30\x20\x40\xe2'
+        b'\x09\x00\x52\xe3\x3f\x00\x00\x8a\x07\x21\x87\xe0\x82\x00\x80\xe0'
+        b'\x30\x70\x40\xe2\x01\x00\xd1\xe4\x00\x00\x50\xe3\xf6\xff\xff\x1a'
+        b'\x00\x00\x57\xe3\x37\x00\x00\x0a\x04\x80\xa0\xe1\x44\x30\x97\xe5'
+        b'\x01\xeb\x4b\xe2\x00\x10\xa0\xe3\x08\x00\xb8\xe5\xb4\x20\x4e\xe2'
+        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3\x1c\x00\x00\x0a'
+        b'\x3c\x0e\x9f\xe5\x03\x50\xa0\xe3\x00\x00\x8f\xe0\x25\x00\x00\xea'
+        b'\x02\x00\xd2\xe5\x00\x00\x50\xe3\x26\x00\x00\x0a\x03\x10\x82\xe2'
+        b'\x00\x70\xa0\xe3\x05\x00\x00\xea\x07\x32\xa0\xe1\x00\x00\x83\xe0'
+        b'\x02\x70\x80\xe0\x01\x00\xd1\xe4\x00\x00\x50\xe3\xe3\xff\xff\x0a'
+        b'\x30\x30\x40\xe2\x2f\x20\xe0\xe3\x0a\x00\x53\xe3\xf5\xff\xff\x3a'
+        b'\x61\x30\x40\xe2\x56\x20\xe0\xe3\x06\x00\x53\xe3\xf1\xff\xff\x3a'
+        b'\x41\x30\x40\xe2\x36\x20\xe0\xe3\x05\x00\x53\xe3\xed\xff\xff\x9a'
+        b'\x10\x00\x00\xea\x04\x80\xa0\xe1\x44\x30\x97\xe5\x01\xeb\x4b\xe2'
+        b'\x00\x10\xa0\xe3\x0c\x00\xb8\xe5\xb8\x20\x4e\xe2\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\x0a\x00\x00\x0a\xa4\x0d\x9f\xe5'
+        b'\x04\x50\xa0\xe3\x00\x00\x8f\xe0\x00\x10\x98\xe5\x14\x20\x97\xe5'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x05\x00\xa0\xe1\x18\xd0\x4b\xe2'
+        b'\xf0\x4d\xbd\xe8\x1e\xff\x2f\xe1\x05\x00\x56\xe3\x24\x00\x00\xba'
+        b'\x04\x80\xa0\xe1\x44\x30\x97\xe5\x01\xeb\x4b\xe2\x00\x10\xa0\xe3'
+        b'\x10\x00\xb8\xe5\xbc\x20\x4e\xe2\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x10\xa0\xe1\x50\x0d\x9f\xe5\x05\x50\xa0\xe3\x00\x00\x51\xe3'
+        b'\x00\x00\x8f\xe0\xe7\xff\xff\x1a\xbc\x14\x1b\xe5\x00\x00\x51\xe3'
+        b'\xe4\xff\xff\x0a\x02\x0a\x51\xe3\xe2\xff\xff\x8a\x06\x00\x56\xe3'
+        b'\x0f\x00\x00\x3a\x14\x00\xb4\xe5\x44\x30\x97\xe5\x13\x2d\x4b\xe2'
+        b'\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x10\xa0\xe1'
+        b'\x08\x0d\x9f\xe5\x06\x50\xa0\xe3\x00\x00\x51\xe3\x00\x00\x8f\xe0'
+        b'\x36\x03\x00\x1a\xc0\x14\x1b\xe5\x04\x80\xa0\xe1\x00\x00\x51\xe3'
+        b'\xd0\xff\xff\x0a\xc0\x14\x1b\xe5\xd0\x2c\x9f\xe5\x00\x00\xa0\xe3'
+        b'\xb0\x74\x0b\xe5\x20\x00\x0b\xe5\xa8\x04\x0b\xe5\xac\x14\x0b\xe5'
+        b'\x4b\x1e\x4b\xe2\x0c\x10\x81\xe2\xa0\x30\x22\xe0\x01\x00\x10\xe3'
+        b'\xa0\x30\xa0\x01\xa3\x60\x22\xe0\x01\x00\x13\xe3\xa3\x60\xa0\x01'
+        b'\xa6\x30\x22\xe0\x01\x00\x16\xe3\xa6\x30\xa0\x01\xa3\x60\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x60\xa0\x01\xa6\x30\x22\xe0\x01\x00\x16\xe3'
+        b'\xa6\x30\xa0\x01\xa3\x60\x22\xe0\x01\x00\x13\xe3\xa3\x60\xa0\x01'
+        b'\xa6\x30\x22\xe0\x01\x00\x16\xe3\xa6\x30\xa0\x01\xa3\x60\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x60\xa0\x01\x00\x61\x81\xe7\x01\x00\x80\xe2'
+        b'\x01\x0c\x50\xe3\xe3\xff\xff\x1a\x10\x10\x97\xe5\x50\x0c\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x97\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x4b\xce\x4b\xe2\x02\xea\x8d\xe2'
+        b'\x0c\x00\x8c\xe2\x58\x80\x8e\xe2\x01\x0b\x80\xe2\x01\xe0\x88\xe2'
+        b'\x10\x00\x8d\xe5\x00\x00\xa0\xe3\x04\xe0\x8d\xe5\x08\x00\x8d\xe5'
+        b'\x07\x00\x00\xea\xa8\x04\x1b\xe5\x04\xe0\x9d\xe5\x4b\xce\x4b\xe2'
+        b'\x08\x50\xa0\xe3\x01\x00\x80\xe2\x0f\x00\x50\xe3\xa8\x04\x0b\xe5'
+        b'\x94\xff\xff\x8a\xb8\x04\x1b\xe5\x08\x10\x9d\xe5\x00\x50\xa0\xe3'
+        b'\x01\xa0\x40\xe0\xbc\x04\x1b\xe5\x00\x00\x5a\xe1\x00\xa0\xa0\x81'
+        b'\x00\x00\xa0\xe3\x00\x00\x5a\xe3\x0c\x00\x8d\xe5\x70\x00\x00\x0a'
+        b'\xb4\x04\x1b\xe5\x08\x10\x9d\xe5\x0a\x20\xa0\xe1\x01\x00\x80\xe0'
+        b'\x08\x10\xa0\xe1\x01\x30\xd0\xe4\x01\x20\x52\xe2\x01\x30\xc1\xe4'
+        b'\xfb\xff\xff\x1a\x00\x00\xa0\xe3\x00\x00\x5a\xe3\x00\x50\xa0\xe3'
+        b'\x0c\x00\x8d\xe5\x62\x00\x00\x0a\x00\x00\xe0\xe3\x0a\x10\xa0\xe1'
+        b'\x08\x20\xa0\xe1\x01\x30\xd2\xe4\xff\x60\x00\xe2\x01\x10\x51\xe2'
+        b'\x03\x30\x26\xe0\x03\x31\x8c\xe0\x0c\x30\x93\xe5\x20\x04\x23\xe0'
+        b'\xf7\xff\xff\x1a\x00\x00\xe0\xe1\x00\x50\xa0\xe3\x00\x10\xa0\xe3'
+        b'\x0c\x00\x8d\xe5\x06\x00\x00\xea\x17\x10\x8d\xe2\xff\x20\xa0\xe3'
+        b'\x05\x20\xc1\xe7\x01\x50\x85\xe2\x00\x10\xa0\xe1\x0a\x00\x51\xe1'
+        b'\x4b\x00\x00\x2a\x01\x00\xa0\xe1\x01\x10\x81\xe2\x0a\x00\x51\xe1'
+        b'\x1b\x00\x00\x2a\x00\x20\xd8\xe7\x00\x10\x8e\xe0\x00\x30\xa0\xe3'
+        b'\x03\x40\xd1\xe7\x01\x60\x83\xe2\x02\x00\x54\xe1\x09\x00\x00\x1a'
+        b'\x80\x00\x56\xe3\x04\x00\x00\x8a\x03\x30\x80\xe0\x02\x30\x83\xe2'
+        b'\x0a\x00\x53\xe1\x06\x30\xa0\xe1\xf4\xff\xff\x3a\x06\x10\x80\xe0'
+        b'\x01\x60\x86\xe2\x00\x00\x00\xea\x03\x10\x80\xe0\x01\x10\x81\xe2'
+        b'\x02\x00\x56\xe3\x06\x00\x00\x9a\x7d\x00\x86\xe2\x17\x30\x8d\xe2'
+        b'\x05\x00\xc3\xe7\x05\x00\x83\xe0\x02\x50\x85\xe2\x01\x20\xc0\xe5'
+        b'\xdd\xff\xff\xea\x0a\x00\x50\xe1\xd6\xff\xff\x2a\x00\x60\xa0\xe3'
+        b'\x00\x10\xa0\xe1\x02\x30\x81\xe2\x0a\x00\x53\xe1\x07\x00\x00\x2a'
+        b'\x01\x20\x81\xe2\x01\x40\xd8\xe7\x02\x70\xd8\xe7\x07\x00\x54\xe1'
+        b'\x03\x30\xd8\x07\x03\x00\x54\x01\x01\x00\x00\x1a\x13\x00\x00\xea'
+        b'\x01\x20\x81\xe2\x01\x30\x86\xe2\x0a\x00\x52\xe1\x03\x00\x00\x2a'
+        b'\x7f\x00\x56\xe3\x03\x60\xa0\xe1\x02\x10\xa0\xe1\xec\xff\xff\x3a'
+        b'\x01\x10\x43\xe2\x17\x40\x8d\xe2\x05\x10\xc4\xe7\x01\x50\x85\xe2'
+        b'\x00\x00\x88\xe0\x01\x10\xd0\xe4\x01\x30\x53\xe2\x05\x10\xc4\xe7'
+        b'\x01\x50\x85\xe2\xfa\xff\xff\x1a\x02\x10\xa0\xe1\xba\xff\xff\xea'
+        b'\x01\x20\x46\xe2\x17\x40\x8d\xe2\x00\x00\x56\xe3\x06\x30\xa0\xe1'
+        b'\x05\x20\xc4\xe7\x01\x50\x85\xe2\x01\x20\xa0\xe1\xef\xff\xff\x1a'
+        b'\xb1\xff\xff\xea\x20\x40\x1b\xe5\x80\x00\x54\xe3\x08\x00\x00\x3a'
+        b'\x04\x00\x8c\xe0\x00\x40\xa0\xe3\x0c\x44\xc0\xe5\xb0\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x4b\xce\x4b\xe2\x01\x00\x84\xe2\x7e\x10\xa0\xe3\x20\x00\x0b\xe5'
+        b'\x04\x00\x8c\xe0\x0c\x14\xc0\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x07\x00\x00\x3a\x06\x00\x8c\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x08\x70\x9d\xe5\x55\x00\x27\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x2c\x02\x00\x2a\x01\x00\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x20\x00\x0b\xe5\x06\x00\x82\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x27\xe2\x20\x60\x1b\xe5\x01\x10\x86\xe2\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x08\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x08\x70\x9d\xe5\x55\x00\xa0\xe3\x27\x04\x20\xe0'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x09\x02\x00\x2a\x01\x10\x86\xe2'
+        b'\x4b\x2e\x4b\xe2\x7d\x30\xa0\xe3\x27\x04\xa0\xe1\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x75\x00\x20\xe2\x0c\x34\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x01\x10\x86\xe2\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5'
+        b'\x20\x60\x1b\xe5\x7f\x00\x56\xe3\x08\x00\x00\x3a\x06\x00\x82\xe0'
+        b'\x00\x60\xa0\xe3\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x08\x70\x9d\xe5'
+        b'\x55\x00\xa0\xe3\x27\x08\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3'
+        b'\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3\x09\x3b\x83\xe3'
+        b'\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3'
+        b'\xe5\x01\x00\x2a\x01\x10\x86\xe2\x4b\x2e\x4b\xe2\x7d\x30\xa0\xe3'
+        b'\x27\x08\xa0\xe1\x20\x10\x0b\xe5\x06\x10\x82\xe0\x75\x00\x20\xe2'
+        b'\x0c\x34\xc1\xe5\x20\x60\x1b\xe5\x01\x10\x86\xe2\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x08\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x08\x70\x9d\xe5\x55\x00\xa0\xe3\x27\x0c\x20\xe0'
+        b'\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3\x01\x10\xa0\xe3'
+        b'\x09\x2b\x82\xe3\x11\x00\x12\xe1\x02\x00\x00\x1a\x7d\x10\x40\xe2'
+        b'\x02\x00\x51\xe3\xc2\x01\x00\x2a\x01\x10\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x30\xa0\xe3\x27\x0c\xa0\xe1\x20\x10\x0b\xe5\x06\x10\x82\xe0'
+        b'\x75\x00\x20\xe2\x0c\x34\xc1\xe5\x20\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x07\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x2a\xe2\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\xa0\x01\x00\x2a\x01\x00\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x20\x00\x0b\xe5\x06\x00\x82\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x2a\xe2\x20\x60\x1b\xe5\x01\x10\x86\xe2\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x07\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x2a\x04\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x7e\x01\x00\x2a\x01\x10\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x30\xa0\xe3\x2a\x04\xa0\xe1\x20\x10\x0b\xe5\x06\x10\x82\xe0'
+        b'\x75\x00\x20\xe2\x0c\x34\xc1\xe5\x20\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x07\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x0c\x70\x9d\xe5\x55\x00\x27\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\x5b\x01\x00\x2a\x01\x00\x86\xe2'
+        b'\x4b\x2e\x4b\xe2\x7d\x10\xa0\xe3\x20\x00\x0b\xe5\x06\x00\x82\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x27\xe2\x20\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x08\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x0c\x70\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x27\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x30\xa0\xe3\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\x38\x01\x00\x2a'
+        b'\x01\x10\x86\xe2\x4b\x2e\x4b\xe2\x7d\x30\xa0\xe3\x27\x04\xa0\xe1'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x75\x00\x20\xe2\x0c\x34\xc1\xe5'
+        b'\x20\x60\x1b\xe5\x01\x10\x86\xe2\x20\x10\x0b\xe5\x06\x10\x82\xe0'
+        b'\x0c\x04\xc1\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3\x08\x00\x00\x3a'
+        b'\x06\x00\x82\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5'
+        b'\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x0c\x70\x9d\xe5\x55\x00\xa0\xe3\x27\x08\x20\xe0\xff\x10\x00\xe2'
+        b'\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3\x01\x20\xa0\xe3'
+        b'\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a\x7d\x10\x41\xe2'
+        b'\x02\x00\x51\xe3\x14\x01\x00\x2a\x01\x10\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x30\xa0\xe3\x27\x08\xa0\xe1\x20\x10\x0b\xe5\x06\x10\x82\xe0'
+        b'\x75\x00\x20\xe2\x0c\x34\xc1\xe5\x20\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x08\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x0c\x70\x9d\xe5\x55\x00\xa0\xe3'
+        b'\x27\x0c\x20\xe0\x0d\x00\x50\xe3\x04\x00\x00\x8a\x01\x20\xa0\xe3'
+        b'\x01\x10\xa0\xe3\x09\x2b\x82\xe3\x11\x00\x12\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\xf1\x00\x00\x2a\x01\x10\x86\xe2'
+        b'\x4b\x2e\x4b\xe2\x7d\x30\xa0\xe3\x27\x0c\xa0\xe1\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x75\x00\x20\xe2\x0c\x34\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x01\x10\x86\xe2\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5'
+        b'\x20\x60\x1b\xe5\x7f\x00\x56\xe3\x07\x00\x00\x3a\x06\x00\x82\xe0'
+        b'\x00\x60\xa0\xe3\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5'
+        b'\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\x25\xe2'
+        b'\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a\x01\x30\xa0\xe3'
+        b'\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1\x02\x00\x00\x1a'
+        b'\x7d\x10\x41\xe2\x02\x00\x51\xe3\xcf\x00\x00\x2a\x01\x00\x86\xe2'
+        b'\x4b\x2e\x4b\xe2\x7d\x10\xa0\xe3\x20\x00\x0b\xe5\x06\x00\x82\xe0'
+        b'\x0c\x14\xc0\xe5\x75\x00\x25\xe2\x20\x60\x1b\xe5\x01\x10\x86\xe2'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x20\x60\x1b\xe5'
+        b'\x7f\x00\x56\xe3\x07\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3'
+        b'\x0c\x64\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x55\x00\xa0\xe3\x08\x70\xa0\xe1'
+        b'\x25\x04\x20\xe0\xff\x10\x00\xe2\x0d\x00\x51\xe3\x04\x00\x00\x8a'
+        b'\x01\x30\xa0\xe3\x01\x20\xa0\xe3\x09\x3b\x83\xe3\x12\x01\x13\xe1'
+        b'\x02\x00\x00\x1a\x7d\x10\x41\xe2\x02\x00\x51\xe3\xac\x00\x00\x2a'
+        b'\x01\x10\x86\xe2\x4b\x2e\x4b\xe2\x7d\x30\xa0\xe3\x25\x04\xa0\xe1'
+        b'\x20\x10\x0b\xe5\x06\x10\x82\xe0\x75\x00\x20\xe2\x0c\x34\xc1\xe5'
+        b'\x20\x60\x1b\xe5\x01\x10\x86\xe2\x00\x00\x55\xe3\x20\x10\x0b\xe5'
+        b'\x06\x10\x82\xe0\x0c\x04\xc1\xe5\x29\x00\x00\x0a\x17\x80\x8d\xe2'
+        b'\x13\x00\x00\xea\x01\x20\xa0\xe3\x01\x10\xa0\xe3\x09\x2b\x82\xe3'
+        b'\x11\x00\x12\xe1\x1d\x00\x00\x0a\x01\x00\x86\xe2\x4b\x2e\x4b\xe2'
+        b'\x7d\x10\xa0\xe3\x20\x00\x0b\xe5\x06\x00\x82\xe0\x0c\x14\xc0\xe5'
+        b'\x75\x00\x24\xe2\x20\x60\x1b\xe5\x01\x10\x86\xe2\x01\x50\x55\xe2'
+        b'\x01\x80\x88\xe2\x20\x10\x0b\xe5\x06\x10\x82\xe0\x0c\x04\xc1\xe5'
+        b'\x13\x00\x00\x0a\x00\x40\xd8\xe5\x20\x60\x1b\xe5\x7f\x00\x56\xe3'
+        b'\x07\x00\x00\x3a\x06\x00\x82\xe0\x00\x60\xa0\xe3\x0c\x64\xc0\xe5'
+        b'\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x55\x00\x24\xe2\x0d\x00\x50\xe3\xdc\xff\xff\x9a'
+        b'\x7d\x10\x40\xe2\x02\x00\x51\xe3\xde\xff\xff\x3a\x4b\x2e\x4b\xe2'
+        b'\xe4\xff\xff\xea\x20\x00\x1b\xe5\x00\x50\xa0\xe3\x00\x00\x82\xe0'
+        b'\x0c\x54\xc0\xe5\xb0\x04\x1b\xe5\x10\x10\x90\xe5\x10\x00\x9d\xe5'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xb8\x64\x1b\xe5\x00\x40\xa0\xe3'
+        b'\x07\x80\xa0\xe1\x20\x50\x0b\xe5\xb0\x04\x1b\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\xb0\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb0\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xac\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x61\xfd\xff\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x5c\xfd\xff\x4a'
+        b'\x04\xe0\x9d\xe5\x61\x00\x50\xe3\x4b\xce\x4b\xe2\x4a\x00\x00\x0a'
+        b'\x71\x00\x50\xe3\x4f\x00\x00\x0a\x72\x00\x50\xe3\xdd\xff\xff\x1a'
+        b'\x00\x40\xa0\xe3\x00\xa0\xa0\xe3\xb0\x04\x1b\xe5\x2c\x10\x90\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\xb0\x04\x1b\xe5\x08\x00\x90\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\xb0\x14\x1b\xe5\x00\x00\x50\xe3\x07\x00\x00\x1a\x2c\x10\x91\xe5'
+        b'\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\xac\x14\x1b\xe5'
+        b'\x01\x00\x50\xe1\xf1\xff\xff\x3a\x3d\xfd\xff\xea\x04\x00\x91\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x30\x10\x40\xe2\x0a\x00\x51\xe3'
+        b'\x08\x00\x00\x3a\x61\x10\x40\xe2\x05\x00\x51\xe3\x01\x00\x00\x8a'
+        b'\x57\x10\x40\xe2\x03\x00\x00\xea\x41\x10\x40\xe2\x05\x00\x51\xe3'
+        b'\x2f\xfd\xff\x8a\x37\x10\x40\xe2\x01\xa0\x8a\xe2\x04\x42\x81\xe1'
+        b'\x08\x00\x5a\xe3\xd7\xff\xff\x1a\x06\x00\x54\xe1\x08\x00\x9d\xe5'
+        b'\x04\x00\xa0\x91\x08\x00\x8d\xe5\x25\xfd\xff\xea\x4b\x2e\x4b\xe2'
+        b'\xd8\xfd\xff\xea\x4b\x2e\x4b\xe2\xfc\xfd\xff\xea\x4b\x2e\x4b\xe2'
+        b'\x20\xfe\xff\xea\x4b\x2e\x4b\xe2\x43\xfe\xff\xea\x4b\x2e\x4b\xe2'
+        b'\x64\xfe\xff\xea\x4b\x2e\x4b\xe2\x87\xfe\xff\xea\x4b\x2e\x4b\xe2'
+        b'\xa9\xfe\xff\xea\x4b\x2e\x4b\xe2\xcd\xfe\xff\xea\x4b\x2e\x4b\xe2'
+        b'\xf1\xfe\xff\xea\x4b\x2e\x4b\xe2\x14\xff\xff\xea\x4b\x2e\x4b\xe2'
+        b'\x35\xff\xff\xea\x4b\x2e\x4b\xe2\x59\xff\xff\xea\x00\x00\x5a\xe3'
+        b'\x08\x00\x00\x0a\x08\x00\x9d\xe5\xa8\x44\x0b\xe5\x00\x00\x8a\xe0'
+        b'\x08\x00\x8d\xe5\x0e\xfd\xff\xea\x07\x50\xa0\xe3\xa1\xfc\xff\xea'
+        b'\x04\x80\xa0\xe1\x9b\xfc\xff\xea\x00\x50\xa0\xe3\x9d\xfc\xff\xea'
+        b'\x20\x83\xb8\xed\x7b\x0e\x00\x00\xc4\x0d\x00\x00\x50\x0d\x00\x00'
+        b'\x5f\x0d\x00\x00\x9f\x0c\x00\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x62\x6c\x6f\x63\x6b\x20\x73\x69\x7a\x65\x3a\x20\x25\x73\x0a\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x6c'
+        b'\x65\x6e\x67\x74\x68\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x6d\x65\x6d\x6f\x72\x79\x20\x61\x64\x64\x72\x65\x73'
+        b'\x73\x3a\x20\x25\x73\x0a\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d'
+        b'\x3a\x2d\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x74\x69\x6d\x65\x6f'
+        b'\x75\x74\x3a\x20\x25\x73\x0a\x00',
+}
+
+READ_REGISTERS = {
+    'aarch64':
+        b'\xff\x43\x05\xd1\xfd\x7b\x0f\xa9\xfd\xc3\x03\x91\xfc\x6f\x10\xa9'
+        b'\xfb\x03\x00\x91\xfa\x67\x11\xa9\xf8\x5f\x12\xa9\xf6\x57\x13\xa9'
+        b'\xf4\x4f\x14\xa9\xf4\x03\x12\xaa\x60\x07\x00\xa9\x62\x0f\x01\xa9'
+        b'\x64\x17\x02\xa9\x66\x1f\x03\xa9\x68\x27\x04\xa9\x6a\x2f\x05\xa9'
+        b'\x6c\x37\x06\xa9\x6e\x3f\x07\xa9\x70\x47\x08\xa9\x72\x4f\x09\xa9'
+        b'\x74\x57\x0a\xa9\x76\x5f\x0b\xa9\x78\x67\x0c\xa9\x7a\x6f\x0d\xa9'
+        b'\x7c\x77\x0e\xa9\xf9\x03\x00\x91\xf8\x03\x1e\xaa\x17\x00\x00\x10'
+        b'\x55\x42\x38\xd5\x93\x72\x40\xf9\x53\x0a\x00\xb4\x00\x00\x00\x90'
+        b'\x68\x12\x40\xf9\x00\x3c\x08\x91\x00\x01\x3f\xd6\x68\x06\x40\xf9'
+        b'\x00\x01\x3f\xd6\x1a\x00\x00\x90\xf6\x03\x1f\xaa\x5a\x6f\x08\x91'
+        b'\x62\x7b\x76\xf8\xe0\x03\x1a\xaa\x68\x16\x40\xf9\xe1\x03\x16\x2a'
+        b'\x00\x01\x3f\xd6\xd6\x06\x00\x91\xdf\x7a\x00\xf1\x21\xff\xff\x54'
+        b'\x16\x00\x00\x90\x01\x00\x00\x90\xd6\xb2\x08\x91\x1a\x42\x3b\xd5'
+        b'\x3b\x42\x3b\xd5\x68\x16\x40\xf9\x21\x30\x08\x91\xe0\x03\x16\xaa'
+        b'\xe2\x03\x19\xaa\x00\x01\x3f\xd6\x01\x00\x00\x90\x68\x16\x40\xf9'
+        b'\x21\x24\x08\x91\xe0\x03\x16\xaa\xe2\x03\x18\xaa\x00\x01\x3f\xd6'
+        b'\x01\x00\x00\x90\x68\x16\x40\xf9\x21\x90\x07\x91\xe0\x03\x16\xaa'
+        b'\xe2\x03\x17\xaa\x00\x01\x3f\xd6\x01\x00\x00\x90\x68\x16\x40\xf9'
+        b'\x21\x9c\x08\x91\xe0\x03\x16\xaa\xe2\x03\x1a\xaa\x00\x01\x3f\xd6'
+        b'\x01\x00\x00\x90\x68\x16\x40\xf9\x21\x00\x09\x91\xe0\x03\x16\xaa'
+        b'\xe2\x03\x1b\xaa\x00\x01\x3f\xd6\x01\x00\x00\x90\x68\x16\x40\xf9'
+        b'\x21\x9c\x07\x91\xe0\x03\x16\xaa\xe2\x03\x15\xaa\x00\x01\x3f\xd6'
+        b'\x01\x00\x00\x90\x68\x16\x40\xf9\x21\xdc\x08\x91\xe0\x03\x16\xaa'
+        b'\xe2\x03\x14\xaa\x00\x01\x3f\xd6\x01\x00\x00\x90\x68\x16\x40\xf9'
+        b'\x21\xe8\x08\x91\xe0\x03\x16\xaa\xe2\x03\x13\xaa\x00\x01\x3f\xd6'
+        b'\x01\x00\x00\x90\x68\x16\x40\xf9\x82\x12\x40\xb9\x21\xf4\x07\x91'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x00\x00\x00\x90\x68\x12\x40\xf9'
+        b'\x00\xc4\x07\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\x02\x00\x00\x14'
+        b'\x20\x00\x80\x52\xf4\x4f\x54\xa9\xf6\x57\x53\xa9\xf8\x5f\x52\xa9'
+        b'\xfa\x67\x51\xa9\xfc\x6f\x50\xa9\xfd\x7b\x4f\xa9\xff\x43\x05\x91'
+        b'\xc0\x03\x5f\xd6\x70\x63\x00\x63\x75\x72\x72\x65\x6e\x74\x65\x6c'
+        b'\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x67\x64\x2e'
+        b'\x62\x61\x75\x64\x72\x61\x74\x65\x00\x6c\x72\x00\x73\x70\x00\x2d'
+        b'\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x78\x25\x75\x3a\x25'
+        b'\x30\x31\x36\x6c\x78\x0a\x00\x6e\x7a\x63\x76\x00\x25\x73\x3a\x25'
+        b'\x30\x31\x36\x6c\x78\x0a\x00\x67\x64\x00\x67\x64\x2e\x6a\x74\x00'
+        b'\x64\x61\x69\x66\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x40\xd0\x4d\xe2\x0c\x00\x8d\xe2'
+        b'\x09\x50\xa0\xe1\xff\x1f\x80\xe8\x0d\x80\xa0\xe1\x0e\x10\xa0\xe1'
+        b'\x0f\x00\xa0\xe1\x00\x20\x0f\xe1\x70\x40\x95\xe5\x00\x00\x54\xe3'
+        b'\x94\x00\x00\x0a\x00\x10\x8d\xe5\x04\x00\x8d\xe5\x10\x10\x94\xe5'
+        b'\x54\x02\x9f\xe5\x08\x20\x8d\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x94\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x14\x30\x94\xe5\x0c\x20\x9d\xe5\x30\xa2\x9f\xe5\x00\x10\xa0\xe3'
+        b'\x00\x60\xa0\xe3\x0a\xa0\x8f\xe0\x0a\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x10\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x01\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x14\x20\x9d\xe5\x0a\x00\xa0\xe1\x02\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x18\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x03\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x1c\x20\x9d\xe5\x0a\x00\xa0\xe1\x04\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x20\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x05\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x24\x20\x9d\xe5\x0a\x00\xa0\xe1\x06\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x28\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x07\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x2c\x20\x9d\xe5\x0a\x00\xa0\xe1\x08\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x30\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x09\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x34\x20\x9d\xe5\x0a\x00\xa0\xe1\x0a\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x38\x20\x9d\xe5\x0a\x00\xa0\xe1'
+        b'\x0b\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x3c\x20\x9d\xe5\x0a\x00\xa0\xe1\x0c\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\xf4\x70\x9f\xe5\xf4\x10\x9f\xe5'
+        b'\x08\x20\xa0\xe1\x07\x70\x8f\xe0\x01\x10\x8f\xe0\x07\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5\xd8\x10\x9f\xe5'
+        b'\x00\x20\x9d\xe5\x07\x00\xa0\xe1\x01\x10\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\xc0\x10\x9f\xe5\x04\x20\x9d\xe5'
+        b'\x07\x00\xa0\xe1\x01\x10\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x14\x30\x94\xe5\xa8\x10\x9f\xe5\x08\x20\x9d\xe5\x07\x00\xa0\xe1'
+        b'\x01\x10\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5'
+        b'\x90\x10\x9f\xe5\x07\x00\xa0\xe1\x05\x20\xa0\xe1\x01\x10\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x14\x30\x94\xe5\x78\x10\x9f\xe5'
+        b'\x07\x00\xa0\xe1\x04\x20\xa0\xe1\x01\x10\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x14\x30\x94\xe5\x08\x20\x95\xe5\x5c\x10\x9f\xe5'
+        b'\x07\x00\xa0\xe1\x01\x10\x8f\xe0\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x10\x10\x94\xe5\x48\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x00\x00\xea\x01\x60\xa0\xe3\x06\x00\xa0\xe1'
+        b'\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8\x1e\xff\x2f\xe1\x9e\x02\x00\x00'
+        b'\x91\x02\x00\x00\x3e\x01\x00\x00\x2b\x01\x00\x00\x08\x01\x00\x00'
+        b'\xcc\x00\x00\x00\xb3\x00\x00\x00\xd0\x00\x00\x00\xb7\x00\x00\x00'
+        b'\x70\x00\x00\x00\x50\x00\x00\x00\x70\x63\x00\x63\x70\x73\x72\x00'
+        b'\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x67\x64\x2e\x62'
+        b'\x61\x75\x64\x72\x61\x74\x65\x00\x6c\x72\x00\x73\x70\x00\x2d\x3a'
+        b'\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x25\x73\x3a\x25\x30\x38'
+        b'\x6c\x78\x0a\x00\x67\x64\x00\x67\x64\x2e\x6a\x74\x00\x72\x25\x75'
+        b'\x3a\x25\x30\x38\x6c\x78\x0a\x00',
+}
+
+READ_WORDS = {
+    'aarch64':
+        b'\xfd\x7b\xbb\xa9\x1f\x0c\x00\x71\xf9\x0b\x00\xf9\xf8\x5f\x02\xa9'
+        b'\xfd\x03\x00\x91\xf6\x57\x03\xa9\xf4\x4f\x04\xa9\x6a\x00\x00\x54'
+        b'\x20\x00\x80\x52\x87\x00\x00\x14\x2a\x04\x40\xf9\xf3\x03\x01\xaa'
+        b'\x48\x01\x40\x39\x48\x10\x00\x34\xf4\x03\x00\x2a\xe9\x03\x1f\xaa'
+        b'\x4b\x05\x00\x91\x2c\x05\x00\x91\x6d\x69\x69\x38\xe9\x03\x0c\xaa'
+        b'\xad\xff\xff\x35\x9f\x0d\x00\xf1\x23\x04\x00\x54\x1f\xc1\x00\x71'
+        b'\xe1\x03\x00\x54\x49\x05\x40\x39\x3f\xe1\x01\x71\x81\x03\x00\x54'
+        b'\x49\x09\x40\x39\x49\x0e\x00\x34\xeb\x05\x80\x12\xf7\x03\x1f\xaa'
+        b'\x48\x0d\x00\x91\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1\x07\x00\x00\x14'
+        b'\x29\x1d\x40\x92\xed\xee\x7c\xd3\x8c\x01\x09\x0b\x09\x15\x40\x38'
+        b'\x97\x01\x0d\x8b\x29\x03\x00\x34\xec\x05\x80\x12\x2d\xc1\x00\x51'
+        b'\xbf\x29\x00\x71\xe3\xfe\xff\x54\xec\x03\x0a\xaa\x2d\x85\x01\x51'
+        b'\xbf\x19\x00\x71\x63\xfe\xff\x54\xec\x03\x0b\xaa\x2d\x05\x01\x51'
+        b'\xbf\x15\x00\x71\xe9\xfd\xff\x54\x59\x00\x00\x14\xf7\x03\x1f\xaa'
+        b'\xe9\x05\x80\x12\x4a\x05\x00\x91\x4b\x01\x80\x52\x0c\xc1\x00\x51'
+        b'\x9f\x25\x00\x71\x48\x0a\x00\x54\x28\x01\x28\x0b\xf7\x22\x0b\x9b'
+        b'\x48\x15\x40\x38\x48\xff\xff\x35\xb7\x09\x00\xb4\x9f\x0e\x00\x71'
+        b'\xcb\x03\x00\x54\xe8\x03\x14\x2a\x76\x42\x00\x91\x18\x09\x00\xd1'
+        b'\xe8\x42\x40\xf9\xa1\x63\x00\x91\xc0\x02\x40\xf9\xe2\x03\x1f\x2a'
+        b'\x00\x01\x3f\xd6\xa9\x0f\x40\xf9\xf5\x03\x00\xaa\x28\x01\x40\x39'
+        b'\x1f\xe9\x00\x71\x21\x01\x00\x54\xe8\x42\x40\xf9\x20\x05\x00\x91'
+        b'\xa1\x63\x00\x91\xe2\x03\x1f\x2a\x00\x01\x3f\xd6\xa8\x0f\x40\xf9'
+        b'\x08\x01\x40\x39\x02\x00\x00\x14\x20\x00\x80\x52\x28\x08\x00\x35'
+        b'\x00\x08\x00\xb4\xa8\x06\x40\x92\xc8\x07\x00\xb5\xd6\x22\x00\x91'
+        b'\x18\x07\x00\xf1\xe1\xfc\xff\x54\x00\x00\x00\x90\xe8\x12\x40\xf9'
+        b'\x00\xb8\x0a\x91\x00\x01\x3f\xd6\xe8\x06\x40\xf9\x00\x01\x3f\xd6'
+        b'\x9f\x0e\x00\x71\xab\x05\x00\x54\xf8\x03\x14\x2a\x14\x00\x00\x90'
+        b'\x59\x00\x80\x52\x94\xea\x0a\x91\x07\x00\x00\x14\xe8\x0e\x40\xf9'
+        b'\x40\x01\x80\x52\x00\x01\x3f\xd6\x39\x07\x00\x91\x3f\x03\x18\xeb'
+        b'\x40\x04\x00\x54\x60\x7a\x79\xf8\xa1\x63\x00\x91\xe8\x42\x40\xf9'
+        b'\xe2\x03\x1f\x2a\x00\x01\x3f\xd6\xa8\x0f\x40\xf9\xf5\x03\x00\xaa'
+        b'\x09\x01\x40\x39\x3f\xe9\x00\x71\x21\x01\x00\x54\xe9\x42\x40\xf9'
+        b'\x00\x05\x00\x91\xa1\x63\x00\x91\xe2\x03\x1f\x2a\x20\x01\x3f\xd6'
+        b'\xf6\x03\x00\xaa\x60\x00\x00\xb5\xe9\xff\xff\x17\x36\x00\x80\x52'
+        b'\xe8\x16\x40\xf9\xe0\x03\x14\xaa\xa1\x46\x40\xb8\xd6\x06\x00\xd1'
+        b'\x00\x01\x3f\xd6\x76\xff\xff\xb5\xe1\xff\xff\x17\x40\x00\x80\x52'
+        b'\xf4\x4f\x44\xa9\xf6\x57\x43\xa9\xf8\x5f\x42\xa9\xf9\x0b\x40\xf9'
+        b'\xfd\x7b\xc5\xa8\xc0\x03\x5f\xd6\x00\x00\x00\x90\xe8\x12\x40\xf9'
+        b'\x00\x88\x0a\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\xf5\xff\xff\x17'
+        b'\x00\x00\x00\x90\xe8\x16\x40\xf9\xc1\x02\x40\xf9\x00\x30\x0a\x91'
+        b'\x00\x01\x3f\xd6\x60\x00\x80\x52\xee\xff\xff\x17\x49\x6e\x76\x61'
+        b'\x6c\x69\x64\x20\x61\x72\x67\x75\x6d\x65\x6e\x74\x3a\x20\x25\x73'
+        b'\x0a\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d\x3a'
+        b'\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x25\x30\x38\x78\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x08\xd0\x4d\xe2\x00\x50\xa0\xe1'
+        b'\x01\x00\xa0\xe3\x03\x00\x55\xe3\x9b\x00\x00\xba\x04\x30\x91\xe5'
+        b'\x02\x00\xa0\xe3\x00\x40\xd3\xe5\x00\x00\x54\xe3\x96\x00\x00\x0a'
+        b'\x01\x20\x83\xe2\x00\x70\xa0\xe3\x07\x60\xd2\xe7\x01\x70\x87\xe2'
+        b'\x00\x00\x56\xe3\xfb\xff\xff\x1a\x03\x00\x57\xe3\x03\x00\x00\x3a'
+        b'\x30\x00\x54\xe3\x01\x70\xd3\x05\x78\x00\x57\x03\x63\x00\x00\x0a'
+        b'\x00\x80\xa0\xe3\x30\x30\x44\xe2\x09\x00\x53\xe3\x86\x00\x00\x8a'
+        b'\x08\x31\x88\xe0\x83\x30\x84\xe0\x01\x40\xd2\xe4\x30\x80\x43\xe2'
+        b'\x00\x00\x54\xe3\xf6\xff\xff\x1a\x00\x00\x58\xe3\x7e\x00\x00\x0a'
+        b'\x03\x00\x55\xe3\x00\x10\x8d\xe5\x21\x00\x00\xba\x00\x00\x9d\xe5'
+        b'\x02\x60\x45\xe2\x04\xa0\x8d\xe2\x08\x70\x80\xe2\x00\x00\x97\xe5'
+        b'\x40\x30\x98\xe5\x0a\x10\xa0\xe1\x00\x20\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x40\xa0\xe1\x04\x00\x9d\xe5\x00\x10\xd0\xe5'
+        b'\x3a\x00\x51\xe3\x08\x00\x00\x1a\x40\x30\x98\xe5\x01\x00\x80\xe2'
+        b'\x0a\x10\xa0\xe1\x00\x20\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x04\x10\x9d\xe5\x00\x10\xd1\xe5\x00\x00\x00\xea\x01\x00\xa0\xe3'
+        b'\x00\x00\x51\xe3\x59\x00\x00\x1a\x00\x00\x50\xe3\x57\x00\x00\x0a'
+        b'\x03\x00\x14\xe2\x55\x00\x00\x1a\x01\x60\x56\xe2\x04\x70\x87\xe2'
+        b'\xe1\xff\xff\x1a\x10\x10\x98\xe5\x6c\x01\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x98\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x03\x00\x55\xe3\x41\x00\x00\xba\x4c\x71\x9f\xe5'
+        b'\x02\xa0\xa0\xe3\x07\x70\x8f\xe0\x06\x00\x00\xea\x0c\x10\x98\xe5'
+        b'\x0a\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x01\xa0\x8a\xe2'
+        b'\x05\x00\x5a\xe1\x36\x00\x00\x0a\x00\x00\x9d\xe5\x40\x30\x98\xe5'
+        b'\x04\x10\x8d\xe2\x00\x20\xa0\xe3\x0a\x01\x90\xe7\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x40\xa0\xe1\x04\x00\x9d\xe5\x01\x60\xa0\xe3'
+        b'\x00\x10\xd0\xe5\x3a\x00\x51\xe3\x08\x00\x00\x1a\x40\x30\x98\xe5'
+        b'\x01\x00\x80\xe2\x04\x10\x8d\xe2\x00\x20\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x60\xa0\xe1\x00\x00\x50\xe3\xe2\xff\xff\x0a'
+        b'\x04\x10\x94\xe4\x14\x20\x98\xe5\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x01\x60\x56\xe2\xf8\xff\xff\x1a\xda\xff\xff\xea'
+        b'\x02\x60\xd3\xe5\x00\x00\x56\xe3\x23\x00\x00\x0a\x03\x20\x83\xe2'
+        b'\x00\x80\xa0\xe3\x05\x00\x00\xea\x08\x72\xa0\xe1\x06\x70\x87\xe0'
+        b'\x01\x60\xd2\xe4\x03\x80\x87\xe0\x00\x00\x56\xe3\x99\xff\xff\x0a'
+        b'\x30\x70\x46\xe2\x2f\x30\xe0\xe3\x0a\x00\x57\xe3\xf5\xff\xff\x3a'
+        b'\x61\x70\x46\xe2\x56\x30\xe0\xe3\x06\x00\x57\xe3\xf1\xff\xff\x3a'
+        b'\x41\x70\x46\xe2\x36\x30\xe0\xe3\x05\x00\x57\xe3\xed\xff\xff\x9a'
+        b'\x0d\x00\x00\xea\x10\x10\x98\xe5\x44\x00\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x00\xa0\xe3\x06\x00\x00\xea'
+        b'\x00\x10\x97\xe5\x14\x20\x98\xe5\x18\x00\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x03\x00\xa0\xe3\x18\xd0\x4b\xe2'
+        b'\xf0\x4d\xbd\xe8\x1e\xff\x2f\xe1\x24\x00\x00\x00\x96\x01\x00\x00'
+        b'\x7a\x01\x00\x00\x5a\x00\x00\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x61\x72\x67\x75\x6d\x65\x6e\x74\x3a\x20\x25\x73\x0a\x00\x2d\x3a'
+        b'\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d\x3a\x5b\x53\x54\x41'
+        b'\x52\x54\x5d\x3a\x2d\x00\x25\x30\x38\x78\x00',
 }
 
 RETURN_MEMORY_WORD = {
+    'aarch64':
+        b'\x1f\x04\x00\x71\xe0\x03\x12\xaa\x2d\x07\x00\x54\x2b\x04\x40\xf9'
+        b'\x69\x01\x40\x39\x09\x05\x00\x34\xe8\x03\x1f\xaa\x6a\x05\x00\x91'
+        b'\x0c\x05\x00\x91\x4d\x69\x68\x38\xe8\x03\x0c\xaa\xad\xff\xff\x35'
+        b'\x9f\x0d\x00\xf1\x43\x04\x00\x54\x3f\xc1\x00\x71\x01\x04\x00\x54'
+        b'\x68\x05\x40\x39\x1f\xe1\x01\x71\xa1\x03\x00\x54\x6a\x09\x40\x39'
+        b'\x2a\x03\x00\x34\xec\x05\x80\x12\xe8\x03\x1f\xaa\x69\x0d\x00\x91'
+        b'\x8b\x9d\x00\xd1\x8c\x1d\x00\xd1\x07\x00\x00\x14\x4a\x1d\x40\x92'
+        b'\x08\xed\x7c\xd3\xad\x01\x0a\x0b\x2a\x15\x40\x38\xa8\x01\x08\x8b'
+        b'\x4a\x03\x00\x34\xed\x05\x80\x12\x4e\xc1\x00\x51\xdf\x29\x00\x71'
+        b'\xe3\xfe\xff\x54\xed\x03\x0b\xaa\x4e\x85\x01\x51\xdf\x19\x00\x71'
+        b'\x63\xfe\xff\x54\xed\x03\x0c\xaa\x4e\x05\x01\x51\xdf\x15\x00\x71'
+        b'\xe9\xfd\xff\x54\xe8\x03\x1f\xaa\x0c\x00\x00\x14\xe8\x03\x1f\xaa'
+        b'\xea\x05\x80\x12\x6b\x05\x00\x91\x4c\x01\x80\x52\x2d\xc1\x00\x51'
+        b'\xbf\x25\x00\x71\x08\xff\xff\x54\x49\x01\x29\x0b\x08\x25\x0c\x9b'
+        b'\x69\x15\x40\x38\x49\xff\xff\x35\x00\x01\x40\xf9\xc0\x03\x5f\xd6',
+    'arm':
+        b'\x00\x20\xa0\xe1\x09\x00\xa0\xe1\x01\x00\x52\xe3\x1e\xff\x2f\xd1'
+        b'\x04\xc0\x91\xe5\x00\x10\xdc\xe5\x00\x00\x51\xe3\x2f\x00\x00\x0a'
+        b'\x01\x20\x8c\xe2\x00\x30\xa0\xe3\x03\x00\xd2\xe7\x01\x30\x83\xe2'
+        b'\x00\x00\x50\xe3\xfb\xff\xff\x1a\x03\x00\x53\xe3\x03\x00\x00\x3a'
+        b'\x30\x00\x51\xe3\x01\x00\xdc\x05\x78\x00\x50\x03\x0b\x00\x00\x0a'
+        b'\x00\x00\xa0\xe3\x30\x30\x41\xe2\x09\x00\x53\xe3\x1f\x00\x00\x8a'
+        b'\x00\x01\x80\xe0\x80\x00\x81\xe0\x01\x10\xd2\xe4\x30\x00\x40\xe2'
+        b'\x00\x00\x51\xe3\xf6\xff\xff\x1a\x00\x00\x90\xe5\x1e\xff\x2f\xe1'
+        b'\x02\x10\xdc\xe5\x00\x00\x51\xe3\x14\x00\x00\x0a\x03\x20\x8c\xe2'
+        b'\x00\x00\xa0\xe3\x05\x00\x00\xea\x00\x02\xa0\xe1\x01\x00\x80\xe0'
+        b'\x01\x10\xd2\xe4\x03\x00\x80\xe0\x00\x00\x51\xe3\xf1\xff\xff\x0a'
+        b'\x30\xc0\x41\xe2\x2f\x30\xe0\xe3\x0a\x00\x5c\xe3\xf5\xff\xff\x3a'
+        b'\x61\xc0\x41\xe2\x56\x30\xe0\xe3\x06\x00\x5c\xe3\xf1\xff\xff\x3a'
+        b'\x41\xc0\x41\xe2\x36\x30\xe0\xe3\x05\x00\x5c\xe3\xed\xff\xff\x9a'
+        b'\x00\x00\xa0\xe3\x00\x00\x90\xe5\x1e\xff\x2f\xe1',
+}
+
+SET_BAUDRATE = {
+    'aarch64':
+        b'\xff\x83\x01\xd1\xfd\x7b\x02\xa9\xfd\x83\x00\x91\x08\xfa\x80\x52'
+        b'\x09\x14\x00\x51\x3f\x09\x00\x31\xf7\x1b\x00\xf9\xf6\x57\x04\xa9'
+        b'\xf4\x4f\x05\xa9\xf5\x03\x12\xaa\xa8\x83\x1f\xf8\x62\x00\x00\x54'
+        b'\x20\x00\x80\x52\x6b\x00\x00\x14\x2a\x04\x40\xf9\xf3\x03\x01\xaa'
+        b'\x48\x01\x40\x39\xc8\x0c\x00\x34\xf4\x03\x00\x2a\xe9\x03\x1f\xaa'
+        b'\x4b\x05\x00\x91\x2c\x05\x00\x91\x6d\x69\x69\x38\xe9\x03\x0c\xaa'
+        b'\xad\xff\xff\x35\x9f\x0d\x00\xf1\x23\x04\x00\x54\x1f\xc1\x00\x71'
+        b'\xe1\x03\x00\x54\x49\x05\x40\x39\x3f\xe1\x01\x71\x81\x03\x00\x54'
+        b'\x49\x09\x40\x39\xc9\x0a\x00\x34\xeb\x05\x80\x12\xf6\x03\x1f\xaa'
+        b'\x48\x0d\x00\x91\x6a\x9d\x00\xd1\x6b\x1d\x00\xd1\x07\x00\x00\x14'
+        b'\x29\x1d\x40\x92\xcd\xee\x7c\xd3\x8c\x01\x09\x0b\x09\x15\x40\x38'
+        b'\x96\x01\x0d\x8b\x29\x03\x00\x34\xec\x05\x80\x12\x2d\xc1\x00\x51'
+        b'\xbf\x29\x00\x71\xe3\xfe\xff\x54\xec\x03\x0a\xaa\x2d\x85\x01\x51'
+        b'\xbf\x19\x00\x71\x63\xfe\xff\x54\xec\x03\x0b\xaa\x2d\x05\x01\x51'
+        b'\xbf\x15\x00\x71\xe9\xfd\xff\x54\x3d\x00\x00\x14\xf6\x03\x1f\xaa'
+        b'\xe9\x05\x80\x12\x4a\x05\x00\x91\x4b\x01\x80\x52\x0c\xc1\x00\x51'
+        b'\x9f\x25\x00\x71\xc8\x06\x00\x54\x28\x01\x28\x0b\xd6\x22\x0b\x9b'
+        b'\x48\x15\x40\x38\x48\xff\xff\x35\x36\x06\x00\xb4\xc8\x46\x40\xf9'
+        b'\xa2\x63\x00\x91\x60\x0a\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6'
+        b'\x40\x06\x00\x35\xa8\x0f\x40\xf9\x08\x06\x00\xb4\x9f\x12\x00\x71'
+        b'\x2b\x01\x00\x54\xc8\x46\x40\xf9\xa2\x23\x00\xd1\x60\x0e\x40\xf9'
+        b'\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\xa0\x13\x00\x35\xa8\x83\x5f\xf8'
+        b'\x68\x13\x00\xb4\x08\x00\x00\x90\xea\x03\x1f\xaa\xe9\x03\x1f\x2a'
+        b'\xab\x12\x40\xb9\xec\x33\x00\x91\x08\x61\x11\x91\x08\x00\x00\x14'
+        b'\xad\xc1\x00\x11\x2e\x05\x00\x11\x8d\x49\x29\x38\xe9\x03\x0e\x2a'
+        b'\x4a\x05\x00\x91\x5f\x29\x00\xf1\xe0\x03\x00\x54\x0e\x79\x6a\xb8'
+        b'\x7f\x01\x0e\x6b\x62\x00\x00\x54\xed\x03\x1f\x2a\x06\x00\x00\x14'
+        b'\xed\x03\x1f\x2a\x6b\x01\x0e\x4b\xad\x05\x00\x11\x7f\x01\x0e\x6b'
+        b'\xa2\xff\xff\x54\xed\xfd\xff\x35\xc9\xfd\xff\x35\x5f\x25\x00\xf1'
+        b'\x80\xfd\xff\x54\xe9\x03\x1f\x2a\xee\xff\xff\x17\x40\x00\x80\x52'
+        b'\xf4\x4f\x45\xa9\xf6\x57\x44\xa9\xfd\x7b\x42\xa9\xf7\x1b\x40\xf9'
+        b'\xff\x83\x01\x91\xc0\x03\x5f\xd6\x00\x00\x00\x90\xc8\x16\x40\xf9'
+        b'\x61\x0a\x40\xf9\x00\x8c\x10\x91\x00\x01\x3f\xd6\x60\x00\x80\x52'
+        b'\xf4\xff\xff\x17\xea\x03\x1f\xaa\xeb\x03\x1f\x2a\xac\x1b\x40\xb9'
+        b'\xed\x03\x00\x91\xee\x33\x00\x91\xdf\x49\x29\x38\x08\x00\x00\x14'
+        b'\x29\xc1\x00\x11\x6e\x05\x00\x11\xa9\x49\x2b\x38\xeb\x03\x0e\x2a'
+        b'\x4a\x05\x00\x91\x5f\x29\x00\xf1\x20\x02\x00\x54\x0e\x79\x6a\xb8'
+        b'\x9f\x01\x0e\x6b\x62\x00\x00\x54\xe9\x03\x1f\x2a\x06\x00\x00\x14'
+        b'\xe9\x03\x1f\x2a\x8c\x01\x0e\x4b\x29\x05\x00\x11\x9f\x01\x0e\x6b'
+        b'\xa2\xff\xff\x54\xe9\xfd\xff\x35\xcb\xfd\xff\x35\x5f\x25\x00\xf1'
+        b'\x80\xfd\xff\x54\xeb\x03\x1f\x2a\xee\xff\xff\x17\xe8\x03\x00\x91'
+        b'\x00\x00\x00\x90\x00\x5c\x10\x91\x1f\x49\x2b\x38\xc8\x12\x40\xf9'
+        b'\x00\x01\x3f\xd6\xc8\x06\x40\xf9\x00\x01\x3f\xd6\xc8\x2a\x40\xf9'
+        b'\x00\xe2\x84\x52\x00\x01\x3f\xd6\xa8\x12\x40\xb9\xa9\x0f\x40\xf9'
+        b'\x3f\x01\x08\xeb\xe1\x05\x00\x54\xc8\x2e\x40\xf9\xe0\x03\x1f\xaa'
+        b'\xb7\x83\x5f\xf8\x00\x01\x3f\xd6\xf3\x03\x00\xaa\x00\x00\x00\x90'
+        b'\xc8\x12\x40\xf9\x00\x00\x10\x91\x00\x01\x3f\xd6\xc8\x2e\x40\xf9'
+        b'\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf4\x03\x00\xaa\xc8\x2e\x40\xf9'
+        b'\xe0\x03\x13\xaa\x00\x01\x3f\xd6\x1f\x00\x17\xeb\x22\x05\x00\x54'
+        b'\x15\x00\x00\x90\xb5\x02\x10\x91\x0a\x00\x00\x14\xc8\x06\x40\xf9'
+        b'\x00\x01\x3f\xd6\x1f\xac\x01\x71\x00\x06\x00\x54\xc8\x2e\x40\xf9'
+        b'\xe0\x03\x13\xaa\x00\x01\x3f\xd6\x1f\x00\x17\xeb\xa2\x03\x00\x54'
+        b'\xc8\x0a\x40\xf9\x00\x01\x3f\xd6\xa0\xfe\xff\x35\xc8\x2e\x40\xf9'
+        b'\xe0\x03\x14\xaa\x00\x01\x3f\xd6\x1f\xc8\x00\xf1\x83\xfe\xff\x54'
+        b'\xc8\x12\x40\xf9\xe0\x03\x15\xaa\x00\x01\x3f\xd6\xc8\x2e\x40\xf9'
+        b'\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf4\x03\x00\xaa\xec\xff\xff\x17'
+        b'\x00\x00\x00\x90\xc8\x3e\x40\xf9\x00\xe8\x10\x91\xe1\x03\x00\x91'
+        b'\x00\x01\x3f\xd6\xa0\x00\x00\x35\xa8\x12\x40\xb9\xa9\x0f\x40\xf9'
+        b'\x3f\x01\x08\xeb\x20\xf9\xff\x54\xa0\x00\x80\x52\x8d\xff\xff\x17'
+        b'\x00\x00\x00\x90\xc8\x3e\x40\xf9\x00\xe8\x10\x91\xe1\x33\x00\x91'
+        b'\x00\x01\x3f\xd6\xc0\x00\x80\x52\x86\xff\xff\x17\x00\x00\x00\x90'
+        b'\xc8\x16\x40\xf9\x61\x0e\x40\xf9\x00\x0c\x11\x91\x00\x01\x3f\xd6'
+        b'\x80\x00\x80\x52\x7f\xff\xff\x17\x00\x00\x00\x90\xc8\x12\x40\xf9'
+        b'\x00\x2c\x10\x91\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\x79\xff\xff\x17'
+        b'\x2d\x3a\x5b\x53\x59\x4e\x43\x5d\x3a\x2d\x00\x2d\x3a\x5b\x7c\x45'
+        b'\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d\x3a\x5b\x53\x54\x41\x52\x54\x5d'
+        b'\x3a\x2d\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x61\x75\x64\x20'
+        b'\x72\x61\x74\x65\x3a\x20\x25\x73\x0a\x00\x62\x61\x75\x64\x72\x61'
+        b'\x74\x65\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x74\x69\x6d\x65\x6f'
+        b'\x75\x74\x3a\x20\x25\x73\x0a\x00\x00\xca\x9a\x3b\x00\xe1\xf5\x05'
+        b'\x80\x96\x98\x00\x40\x42\x0f\x00\xa0\x86\x01\x00\x10\x27\x00\x00'
+        b'\xe8\x03\x00\x00\x64\x00\x00\x00\x0a\x00\x00\x00\x01\x00\x00\x00',
+    'arm':
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x20\xd0\x4d\xe2\x00\x50\xa0\xe1'
+        b'\x01\x40\xa0\xe1\x7d\x0e\xa0\xe3\x09\x80\xa0\xe1\x05\x10\x45\xe2'
+        b'\x18\x00\x8d\xe5\x01\x00\xa0\xe3\x02\x00\x71\xe3\x01\x01\x00\x3a'
+        b'\x04\x30\x94\xe5\x02\x00\xa0\xe3\x00\x10\xd3\xe5\x00\x00\x51\xe3'
+        b'\xfc\x00\x00\x0a\x01\x20\x83\xe2\x00\x70\xa0\xe3\x07\x60\xd2\xe7'
+        b'\x01\x70\x87\xe2\x00\x00\x56\xe3\xfb\xff\xff\x1a\x03\x00\x57\xe3'
+        b'\x03\x00\x00\x3a\x30\x00\x51\xe3\x01\x70\xd3\x05\x78\x00\x57\x03'
+        b'\x41\x00\x00\x0a\x00\x70\xa0\xe3\x30\x30\x41\xe2\x09\x00\x53\xe3'
+        b'\xec\x00\x00\x8a\x07\x31\x87\xe0\x83\x10\x81\xe0\x30\x70\x41\xe2'
+        b'\x01\x10\xd2\xe4\x00\x00\x51\xe3\xf6\xff\xff\x1a\x00\x00\x57\xe3'
+        b'\xe4\x00\x00\x0a\x08\x00\x94\xe5\x44\x30\x97\xe5\x1c\x20\x8d\xe2'
+        b'\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x46\x00\x00\x1a\x1c\x00\x9d\xe5\x00\x00\x50\xe3\x43\x00\x00\x0a'
+        b'\x04\x00\x55\xe3\x0a\x00\x00\xba\x0c\x00\x94\xe5\x44\x30\x97\xe5'
+        b'\x18\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\xc1\x00\x00\x1a\x18\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\xbe\x00\x00\x0a\x08\x10\x98\xe5\x3c\x03\x9f\xe5\x00\x50\xa0\xe3'
+        b'\x0d\x20\x8d\xe2\x00\x30\xa0\xe3\x00\x00\x8f\xe0\x09\x00\x00\xea'
+        b'\x00\x00\x54\xe3\x00\x00\x55\x03\x0f\x00\x00\x0a\x30\x60\x84\xe2'
+        b'\x05\x60\xc2\xe7\x01\x60\x85\xe2\x01\x30\x83\xe2\x06\x50\xa0\xe1'
+        b'\x0a\x00\x53\xe3\x2d\x00\x00\x0a\x03\x61\x90\xe7\x00\x40\xa0\xe3'
+        b'\x06\x00\x51\xe1\xf1\xff\xff\x3a\x06\x10\x41\xe0\x01\x40\x84\xe2'
+        b'\x06\x00\x51\xe1\xfb\xff\xff\x2a\xec\xff\xff\xea\x00\x60\xa0\xe3'
+        b'\x09\x00\x53\xe3\xef\xff\xff\x1a\xeb\xff\xff\xea\x02\x10\xd3\xe5'
+        b'\x00\x00\x51\xe3\xab\x00\x00\x0a\x03\x20\x83\xe2\x00\x70\xa0\xe3'
+        b'\x05\x00\x00\xea\x07\x72\xa0\xe1\x01\x10\x87\xe0\x03\x70\x81\xe0'
+        b'\x01\x10\xd2\xe4\x00\x00\x51\xe3\xbb\xff\xff\x0a\x30\x60\x41\xe2'
+        b'\x2f\x30\xe0\xe3\x0a\x00\x56\xe3\xf5\xff\xff\x3a\x61\x60\x41\xe2'
+        b'\x56\x30\xe0\xe3\x06\x00\x56\xe3\xf1\xff\xff\x3a\x41\x60\x41\xe2'
+        b'\x36\x30\xe0\xe3\x05\x00\x56\xe3\xed\xff\xff\x9a\x95\x00\x00\xea'
+        b'\x08\x10\x94\xe5\x14\x20\x97\xe5\x54\x02\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x03\x00\xa0\xe3\x8d\x00\x00\xea'
+        b'\x00\x50\xa0\xe3\x02\x10\x8d\xe2\x00\x30\xa0\xe3\x06\x50\xc2\xe7'
+        b'\x1c\x20\x9d\xe5\x09\x00\x00\xea\x00\x00\x54\xe3\x00\x00\x55\x03'
+        b'\x0f\x00\x00\x0a\x30\x60\x84\xe2\x05\x60\xc1\xe7\x01\x60\x85\xe2'
+        b'\x01\x30\x83\xe2\x06\x50\xa0\xe1\x0a\x00\x53\xe3\x0c\x00\x00\x0a'
+        b'\x03\x61\x90\xe7\x00\x40\xa0\xe3\x06\x00\x52\xe1\xf1\xff\xff\x3a'
+        b'\x06\x20\x42\xe0\x01\x40\x84\xe2\x06\x00\x52\xe1\xfb\xff\xff\x2a'
+        b'\xec\xff\xff\xea\x00\x60\xa0\xe3\x09\x00\x53\xe3\xef\xff\xff\x1a'
+        b'\xeb\xff\xff\xea\x00\x00\xa0\xe3\x06\x00\xc1\xe7\x10\x10\x97\xe5'
+        b'\xc8\x01\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x04\x00\x97\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x28\x10\x97\xe5'
+        b'\x71\x0e\xa0\xe3\x02\x0a\x80\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x08\x00\x98\xe5\x1c\x10\x9d\xe5\x01\x00\x50\xe1\x38\x00\x00\x1a'
+        b'\x2c\x10\x97\xe5\x18\x60\x9d\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x40\xa0\xe1\x10\x10\x97\xe5\x74\x01\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x2c\x10\x97\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x2c\x10\x97\xe5'
+        b'\x00\x50\xa0\xe1\x04\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x06\x00\x50\xe1\x31\x00\x00\x2a\x3c\x81\x9f\xe5\x08\x80\x8f\xe0'
+        b'\x0a\x00\x00\xea\x04\x00\x97\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x6b\x00\x50\xe3\x39\x00\x00\x0a\x2c\x10\x97\xe5\x04\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x06\x00\x50\xe1\x23\x00\x00\x2a'
+        b'\x08\x00\x97\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\xef\xff\xff\x1a\x2c\x10\x97\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x32\x00\x50\xe3\xee\xff\xff\x3a\x10\x10\x97\xe5'
+        b'\x08\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x2c\x10\x97\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\xe4\xff\xff\xea\x3c\x20\x97\xe5\xa4\x00\x9f\xe5\x02\x10\x8d\xe2'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x00\x10\xa0\xe1'
+        b'\x05\x00\xa0\xe3\x00\x00\x51\xe3\x1a\x00\x00\x1a\x08\x10\x98\xe5'
+        b'\x1c\x20\x9d\xe5\x02\x00\x51\xe1\xb8\xff\xff\x0a\x15\x00\x00\xea'
+        b'\x3c\x20\x97\xe5\x78\x00\x9f\xe5\x0d\x10\x8d\xe2\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x06\x00\xa0\xe3\x0d\x00\x00\xea'
+        b'\x0c\x10\x94\xe5\x14\x20\x97\xe5\x38\x00\x9f\xe5\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x04\x00\xa0\xe3\x05\x00\x00\xea'
+        b'\x10\x10\x97\xe5\x34\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x00\xa0\xe3\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8'
+        b'\x1e\xff\x2f\xe1\x97\x02\x00\x00\x97\x00\x00\x00\xa0\x03\x00\x00'
+        b'\xf3\x01\x00\x00\xea\x00\x00\x00\x80\x01\x00\x00\x44\x01\x00\x00'
+        b'\x43\x00\x00\x00\xae\x00\x00\x00\x2d\x3a\x5b\x53\x59\x4e\x43\x5d'
+        b'\x3a\x2d\x00\x2d\x3a\x5b\x7c\x45\x4e\x44\x7c\x5d\x3a\x2d\x00\x2d'
+        b'\x3a\x5b\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x62\x61\x75\x64\x20\x72\x61\x74\x65\x3a\x20\x25\x73'
+        b'\x0a\x00\x62\x61\x75\x64\x72\x61\x74\x65\x00\x49\x6e\x76\x61\x6c'
+        b'\x69\x64\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00'
+        b'\x00\xca\x9a\x3b\x00\xe1\xf5\x05\x80\x96\x98\x00\x40\x42\x0f\x00'
+        b'\xa0\x86\x01\x00\x10\x27\x00\x00\xe8\x03\x00\x00\x64\x00\x00\x00'
+        b'\x0a\x00\x00\x00\x01\x00\x00\x00',
+}
+
+WRITE_MEMORY = {
+    'aarch64':
+        b'\xfd\x7b\xba\xa9\xfc\x6f\x01\xa9\xfd\x03\x00\x91\xfa\x67\x02\xa9'
+        b'\xf8\x5f\x03\xa9\xf6\x57\x04\xa9\xf4\x4f\x05\xa9\xff\x43\x13\xd1'
+        b'\x08\x00\x82\x52\x09\x7d\x80\x52\x0a\x1c\x00\x51\x5f\x0d\x00\x31'
+        b'\xe9\xa3\x00\xa9\x62\x00\x00\x54\x20\x00\x80\x52\x48\x00\x00\x14'
+        b'\x2a\x04\x40\xf9\xf3\x03\x01\xaa\x48\x01\x40\x39\x68\x08\x00\x34'
+        b'\xf4\x03\x00\x2a\xe9\x03\x1f\xaa\x4b\x05\x00\x91\x2c\x05\x00\x91'
+        b'\x6d\x69\x69\x38\xe9\x03\x0c\xaa\xad\xff\xff\x35\x9f\x0d\x00\xf1'
+        b'\x23\x04\x00\x54\x1f\xc1\x00\x71\xe1\x03\x00\x54\x49\x05\x40\x39'
+        b'\x3f\xe1\x01\x71\x81\x03\x00\x54\x49\x09\x40\x39\x69\x06\x00\x34'
+        b'\xeb\x05\x80\x12\xfa\x03\x1f\xaa\x48\x0d\x00\x91\x6a\x9d\x00\xd1'
+        b'\x6b\x1d\x00\xd1\x07\x00\x00\x14\x29\x1d\x40\x92\x4d\xef\x7c\xd3'
+        b'\x8c\x01\x09\x0b\x09\x15\x40\x38\x9a\x01\x0d\x8b\x29\x03\x00\x34'
+        b'\xec\x05\x80\x12\x2d\xc1\x00\x51\xbf\x29\x00\x71\xe3\xfe\xff\x54'
+        b'\xec\x03\x0a\xaa\x2d\x85\x01\x51\xbf\x19\x00\x71\x63\xfe\xff\x54'
+        b'\xec\x03\x0b\xaa\x2d\x05\x01\x51\xbf\x15\x00\x71\xe9\xfd\xff\x54'
+        b'\x1a\x00\x00\x14\xfa\x03\x1f\xaa\xe9\x05\x80\x12\x4a\x05\x00\x91'
+        b'\x4b\x01\x80\x52\x0c\xc1\x00\x51\x9f\x25\x00\x71\x68\x02\x00\x54'
+        b'\x28\x01\x28\x0b\x5a\x23\x0b\x9b\x48\x15\x40\x38\x48\xff\xff\x35'
+        b'\xda\x01\x00\xb4\x48\x47\x40\xf9\xe2\x83\x00\x91\x60\x0a\x40\xf9'
+        b'\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x20\x02\x00\x34\x00\x00\x00\x90'
+        b'\x48\x17\x40\xf9\x61\x0a\x40\xf9\x00\x0c\x20\x91\x00\x01\x3f\xd6'
+        b'\x60\x00\x80\x52\x02\x00\x00\x14\x40\x00\x80\x52\xff\x43\x13\x91'
+        b'\xf4\x4f\x45\xa9\xf6\x57\x44\xa9\xf8\x5f\x43\xa9\xfa\x67\x42\xa9'
+        b'\xfc\x6f\x41\xa9\xfd\x7b\xc6\xa8\xc0\x03\x5f\xd6\x48\x47\x40\xf9'
+        b'\xe2\x63\x00\x91\x60\x0e\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6'
+        b'\x00\x01\x00\x34\x00\x00\x00\x90\x48\x17\x40\xf9\x61\x0e\x40\xf9'
+        b'\x00\xa0\x1f\x91\x00\x01\x3f\xd6\x80\x00\x80\x52\xec\xff\xff\x17'
+        b'\x9f\x16\x00\x71\xab\x02\x00\x54\x48\x47\x40\xf9\xe2\x43\x00\x91'
+        b'\x60\x12\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x60\x2c\x00\x35'
+        b'\xe8\x0b\x40\xf9\x28\x2c\x00\xb4\x1f\x41\x40\xf1\xe2\x2b\x00\x54'
+        b'\x9f\x1a\x00\x71\x23\x01\x00\x54\x48\x47\x40\xf9\xe2\x23\x00\x91'
+        b'\x60\x16\x40\xf9\xe1\x03\x1f\x2a\x00\x01\x3f\xd6\x00\x2c\x00\x35'
+        b'\xe8\x07\x40\xf9\xc8\x2b\x00\xb4\x09\x00\x00\x90\x0b\x64\x90\x52'
+        b'\x0b\xb7\xbd\x72\xea\xa3\x00\x91\x20\x04\x00\x4f\xe8\x03\x1f\xaa'
+        b'\x81\x04\x00\x4f\xfb\x07\x40\xf9\x22\xf1\xc1\x3d\x49\x51\x00\x91'
+        b'\x63\x0d\x04\x4e\xff\x3b\x00\xb9\xfa\xef\x02\xa9\xff\xc3\x04\xb9'
+        b'\x44\x1c\x20\x4e\x45\x04\x3f\x6f\x42\x84\xa1\x4e\x84\x98\xa0\x4e'
+        b'\xa6\x1c\x23\x6e\xa4\x1c\x66\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e'
+        b'\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e\x84\x04\x3f\x6f'
+        b'\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e\x85\x1c\x20\x4e'
+        b'\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e\xc4\x1c\xe5\x6e'
+        b'\x85\x1c\x20\x4e\x84\x04\x3f\x6f\xa5\x98\xa0\x4e\x86\x1c\x23\x6e'
+        b'\xc4\x1c\xe5\x6e\x24\x69\xa8\x3c\x08\x41\x00\x91\x1f\x01\x10\xf1'
+        b'\x81\xfa\xff\x54\x00\x00\x00\x90\x48\x13\x40\xf9\x00\xb4\x20\x91'
+        b'\x00\x01\x3f\xd6\x48\x07\x40\xf9\x00\x01\x3f\xd6\xf5\x03\x1f\x2a'
+        b'\x5c\x63\x01\x91\xf4\x03\x1f\x2a\xf5\x03\x15\x2a\x06\x00\x00\x14'
+        b'\x00\x00\x00\x90\x48\x17\x40\xf9\x00\x38\x21\x91\xe1\x03\x15\x2a'
+        b'\x00\x01\x3f\xd6\xe8\x1b\x40\xb9\xe0\x03\x1f\xaa\xe9\x0b\x40\xf9'
+        b'\x08\x01\x15\x4b\x3f\x01\x08\xeb\x33\x31\x88\x1a\x88\x03\x40\xf9'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\x00\x00\x35\x88\x03\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6'
+        b'\x1f\x00\x1b\xeb\x23\xff\xff\x54\x12\x00\x00\x14\x48\x07\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe0\x01\xf8\x37\xf6\x03\x00\x2a\x88\x03\x40\xf9'
+        b'\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf7\x03\x00\xaa\x48\x0b\x40\xf9'
+        b'\x00\x01\x3f\xd6\x80\x01\x00\x35\x88\x03\x40\xf9\xe0\x03\x17\xaa'
+        b'\x00\x01\x3f\xd6\x1f\x00\x1b\xeb\x23\xff\xff\x54\xc4\x00\x00\x14'
+        b'\x94\x06\x00\x11\x00\x01\x80\x52\x9f\x3e\x00\x71\x49\xfb\xff\x54'
+        b'\x63\xff\xff\x17\x48\x07\x40\xf9\x00\x01\x3f\xd6\x80\x17\xf8\x37'
+        b'\xf7\x03\x00\x2a\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6'
+        b'\xf8\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35'
+        b'\x88\x03\x40\xf9\xe0\x03\x18\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb'
+        b'\x23\xff\xff\x54\xae\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6'
+        b'\x60\x15\xf8\x37\xf8\x03\x00\x2a\x88\x03\x40\xf9\xe0\x03\x1f\xaa'
+        b'\x00\x01\x3f\xd6\xf9\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\x00\x00\x35\x88\x03\x40\xf9\xe0\x03\x19\xaa\x00\x01\x3f\xd6'
+        b'\x1f\x00\x1b\xeb\x23\xff\xff\x54\x9d\x00\x00\x14\x48\x07\x40\xf9'
+        b'\x00\x01\x3f\xd6\x40\x13\xf8\x37\x08\x3f\x10\x53\x08\x21\x17\x2a'
+        b'\x08\x61\x00\x2a\x18\x01\x16\x2a\x1f\x07\x00\x31\xe0\x18\x00\x54'
+        b'\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35\x88\x03\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb\x23\xff\xff\x54'
+        b'\x87\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6\x80\x10\xf8\x37'
+        b'\xf6\x03\x00\x2a\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6'
+        b'\xf7\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35'
+        b'\x88\x03\x40\xf9\xe0\x03\x17\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb'
+        b'\x23\xff\xff\x54\x76\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6'
+        b'\x60\x0e\xf8\x37\xd9\x22\x00\x2a\x88\x03\x40\xf9\xe0\x03\x1f\xaa'
+        b'\x00\x01\x3f\xd6\xf6\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\x00\x00\x35\x88\x03\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6'
+        b'\x1f\x00\x1b\xeb\x23\xff\xff\x54\x65\x00\x00\x14\x48\x07\x40\xf9'
+        b'\x00\x01\x3f\xd6\x40\x0c\xf8\x37\xf6\x03\x00\x2a\x88\x03\x40\xf9'
+        b'\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf7\x03\x00\xaa\x48\x0b\x40\xf9'
+        b'\x00\x01\x3f\xd6\xe0\x00\x00\x35\x88\x03\x40\xf9\xe0\x03\x17\xaa'
+        b'\x00\x01\x3f\xd6\x1f\x00\x1b\xeb\x23\xff\xff\x54\x54\x00\x00\x14'
+        b'\x48\x07\x40\xf9\x00\x01\x3f\xd6\x20\x0a\xf8\x37\xd7\x22\x00\x2a'
+        b'\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35\x88\x03\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb\x23\xff\xff\x54'
+        b'\x43\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6\x00\x08\xf8\x37'
+        b'\xf7\x42\x00\x2a\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6'
+        b'\xf6\x03\x00\xaa\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35'
+        b'\x88\x03\x40\xf9\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb'
+        b'\x23\xff\xff\x54\x32\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6'
+        b'\xe0\x05\xf8\x37\x1f\x03\x15\x6b\xa1\x05\x00\x54\x3f\x03\x13\x6b'
+        b'\x61\x05\x00\x54\xf7\x62\x00\x2a\x13\x05\x00\x34\xe8\x13\x40\xf9'
+        b'\xf9\x03\x1f\xaa\x18\x00\x80\x12\x08\x01\x15\x8b\xe8\x03\x00\xf9'
+        b'\x88\x03\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6\xf6\x03\x00\xaa'
+        b'\x48\x0b\x40\xf9\x00\x01\x3f\xd6\xe0\x00\x00\x35\x88\x03\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x1f\x00\x1b\xeb\x23\xff\xff\x54'
+        b'\x10\x00\x00\x14\x48\x07\x40\xf9\x00\x01\x3f\xd6\xa0\x01\xf8\x37'
+        b'\x08\x00\x18\x4a\xe9\xa3\x00\x91\x08\x1d\x00\x12\x28\x49\x28\x8b'
+        b'\xe9\x03\x40\xf9\x20\x69\x39\x38\x39\x07\x00\x91\x08\x15\x40\xb9'
+        b'\x3f\x03\x13\xeb\x18\x21\x58\x4a\xc1\xfc\xff\x54\xf9\x03\x13\x2a'
+        b'\x3f\x03\x13\x6b\xc1\x00\x00\x54\xe8\x03\x38\x2a\xff\x02\x08\x6b'
+        b'\x61\x00\x00\x54\x1d\x00\x00\x14\xd7\x06\x00\x34\x94\x06\x00\x11'
+        b'\x9f\x3e\x00\x71\x08\x05\x00\x54\x88\x03\x40\xf9\xe0\x03\x1f\xaa'
+        b'\x00\x01\x3f\xd6\x88\x03\x40\xf9\xf6\x03\x00\xaa\x00\x01\x3f\xd6'
+        b'\x1f\x4c\x00\xf1\xe9\x00\x00\x54\x0a\xff\xff\x17\x88\x03\x40\xf9'
+        b'\xe0\x03\x16\xaa\x00\x01\x3f\xd6\x1f\x50\x00\xf1\xa2\xe0\xff\x54'
+        b'\x48\x0b\x40\xf9\x00\x01\x3f\xd6\x20\xff\xff\x34\x48\x07\x40\xf9'
+        b'\x00\x01\x3f\xd6\x48\x2f\x40\xf9\xe0\x03\x1f\xaa\x00\x01\x3f\xd6'
+        b'\xf6\x03\x00\xaa\xf2\xff\xff\x17\x53\x03\x00\x34\x75\x02\x15\x0b'
+        b'\x00\x00\x00\x90\x48\x17\x40\xf9\x00\x7c\x20\x91\xe1\x03\x15\x2a'
+        b'\x00\x01\x3f\xd6\xf0\xfe\xff\x17\x00\x00\x00\x90\x48\x17\x40\xf9'
+        b'\x61\x12\x40\xf9\x00\x40\x1f\x91\x00\x01\x3f\xd6\xa0\x00\x80\x52'
+        b'\x7b\xfe\xff\x17\x00\x01\x80\x52\x79\xfe\xff\x17\x00\x00\x00\x90'
+        b'\x48\x17\x40\xf9\x61\x16\x40\xf9\x00\xe4\x20\x91\x00\x01\x3f\xd6'
+        b'\xc0\x00\x80\x52\x72\xfe\xff\x17\xe0\x00\x80\x52\x70\xfe\xff\x17'
+        b'\x00\x00\x00\x90\x48\x17\x40\xf9\x00\x98\x20\x91\xe1\x03\x15\x2a'
+        b'\x00\x01\x3f\xd6\xe0\x03\x1f\x2a\x69\xfe\xff\x17\x00\x00\x00\x00'
+        b'\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69'
+        b'\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25'
+        b'\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72'
+        b'\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x61'
+        b'\x25\x30\x38\x78\x0a\x00\x64\x25\x30\x38\x78\x0a\x00\x2d\x3a\x5b'
+        b'\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c\x69\x64'
+        b'\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00\x72\x25'
+        b'\x30\x38\x78\x0a\x00',
     'arm':
-        b'\x01\x00\x50\xe3\x1e\x00\x00\xda\x04\x10\x91\xe5\x01\xc0\xa0\xe1'
-        b'\x01\x20\xdc\xe4\x00\x00\x52\xe3\x30\x00\x00\x0a\x00\x42\x2d\xe9'
-        b'\x00\x00\xa0\xe3\x0c\xe0\xa0\xe1\x01\x30\xde\xe4\x00\x00\x53\xe3'
-        b'\x01\x00\x80\xe2\xfb\xff\xff\x1a\x02\x00\x50\xe3\x01\x00\x00\x9a'
-        b'\x30\x00\x52\xe3\x10\x00\x00\x0a\x00\x30\xa0\xe3\x03\x00\x00\xea'
-        b'\x01\x20\xf1\xe5\x00\x00\x52\xe3\x00\x30\x83\xe0\x05\x00\x00\x0a'
-        b'\x30\x00\x42\xe2\x03\x31\x83\xe0\x09\x00\x50\xe3\x83\x30\xa0\xe1'
-        b'\xf6\xff\xff\x9a\x00\x30\xa0\xe3\x00\x00\x93\xe5\x00\x42\xbd\xe8'
-        b'\x1e\xff\x2f\xe1\x09\x00\xa0\xe1\x1e\xff\x2f\xe1\x01\x00\xd1\xe5'
-        b'\x78\x00\x50\xe3\xeb\xff\xff\x1a\x01\x00\x00\xea\x37\x10\x42\xe2'
-        b'\x01\x30\x83\xe0\x01\x20\xfc\xe5\x00\x00\x52\xe3\x30\x10\x42\xe2'
-        b'\x61\x00\x42\xe2\xef\xff\xff\x0a\x09\x00\x51\xe3\x03\x32\xa0\xe1'
-        b'\xf6\xff\xff\x9a\x05\x00\x50\xe3\x41\x10\x42\xe2\x57\x10\x42\x92'
-        b'\xf2\xff\xff\x9a\x05\x00\x51\xe3\xef\xff\xff\x9a\xe4\xff\xff\xea'
-        b'\x00\x00\x92\xe5\x1e\xff\x2f\xe1',
+        b'\xf0\x4d\x2d\xe9\x18\xb0\x8d\xe2\x13\xdd\x4d\xe2\x00\x50\xa0\xe1'
+        b'\x01\x0a\xa0\xe3\x01\x40\xa0\xe1\x1c\x00\x8d\xe5\xfa\x0f\xa0\xe3'
+        b'\x07\x10\x45\xe2\x18\x00\x8d\xe5\x01\x00\xa0\xe3\x03\x00\x71\xe3'
+        b'\x54\x00\x00\x3a\x04\x30\x94\xe5\x02\x00\xa0\xe3\x00\x10\xd3\xe5'
+        b'\x00\x00\x51\xe3\x4f\x00\x00\x0a\x01\x20\x83\xe2\x00\x70\xa0\xe3'
+        b'\x07\x60\xd2\xe7\x01\x70\x87\xe2\x00\x00\x56\xe3\xfb\xff\xff\x1a'
+        b'\x03\x00\x57\xe3\x03\x00\x00\x3a\x30\x00\x51\xe3\x01\x70\xd3\x05'
+        b'\x78\x00\x57\x03\x1b\x00\x00\x0a\x00\xa0\xa0\xe3\x30\x30\x41\xe2'
+        b'\x09\x00\x53\xe3\x3f\x00\x00\x8a\x0a\x31\x8a\xe0\x83\x10\x81\xe0'
+        b'\x30\xa0\x41\xe2\x01\x10\xd2\xe4\x00\x00\x51\xe3\xf6\xff\xff\x1a'
+        b'\x00\x00\x5a\xe3\x37\x00\x00\x0a\x08\x00\x94\xe5\x44\x30\x9a\xe5'
+        b'\x24\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x20\x00\x00\x0a\x08\x10\x94\xe5\x14\x20\x9a\xe5'
+        b'\x38\x08\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1'
+        b'\x03\x00\xa0\xe3\x27\x00\x00\xea\x02\x10\xd3\xe5\x00\x00\x51\xe3'
+        b'\x24\x00\x00\x0a\x03\x20\x83\xe2\x00\xa0\xa0\xe3\x05\x00\x00\xea'
+        b'\x0a\x72\xa0\xe1\x01\x10\x87\xe0\x03\xa0\x81\xe0\x01\x10\xd2\xe4'
+        b'\x00\x00\x51\xe3\xe1\xff\xff\x0a\x30\x70\x41\xe2\x2f\x30\xe0\xe3'
+        b'\x0a\x00\x57\xe3\xf5\xff\xff\x3a\x61\x70\x41\xe2\x56\x30\xe0\xe3'
+        b'\x06\x00\x57\xe3\xf1\xff\xff\x3a\x41\x70\x41\xe2\x36\x30\xe0\xe3'
+        b'\x05\x00\x57\xe3\xed\xff\xff\x9a\x0e\x00\x00\xea\x0c\x00\x94\xe5'
+        b'\x44\x30\x9a\xe5\x20\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\x09\x00\x00\x0a\x0c\x10\x94\xe5'
+        b'\x14\x20\x9a\xe5\x98\x07\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x04\x00\xa0\xe3\x18\xd0\x4b\xe2\xf0\x4d\xbd\xe8'
+        b'\x1e\xff\x2f\xe1\x05\x00\x55\xe3\x19\x00\x00\xba\x10\x00\x94\xe5'
+        b'\x44\x30\x9a\xe5\x1c\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x13\xff\x2f\xe1\x00\x00\x50\xe3\xb7\x01\x00\x1a\x1c\x00\x9d\xe5'
+        b'\x00\x00\x50\xe3\xb4\x01\x00\x0a\x01\x08\x50\xe3\xb2\x01\x00\x2a'
+        b'\x06\x00\x55\xe3\x0a\x00\x00\x3a\x14\x00\x94\xe5\x44\x30\x9a\xe5'
+        b'\x18\x20\x8d\xe2\x00\x10\xa0\xe3\x0f\xe0\xa0\xe1\x13\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\xb2\x01\x00\x1a\x18\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\xaf\x01\x00\x0a\x18\x40\x9d\xe5\xfc\x26\x9f\xe5\x28\x10\x8d\xe2'
+        b'\x00\x00\xa0\xe3\x28\xa0\x8d\xe5\x0c\x10\x81\xe2\xb8\x04\x8d\xe5'
+        b'\x30\x00\x8d\xe5\x2c\x40\x8d\xe5\xa0\x30\x22\xe0\x01\x00\x10\xe3'
+        b'\xa0\x30\xa0\x01\xa3\x70\x22\xe0\x01\x00\x13\xe3\xa3\x70\xa0\x01'
+        b'\xa7\x30\x22\xe0\x01\x00\x17\xe3\xa7\x30\xa0\x01\xa3\x70\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x70\xa0\x01\xa7\x30\x22\xe0\x01\x00\x17\xe3'
+        b'\xa7\x30\xa0\x01\xa3\x70\x22\xe0\x01\x00\x13\xe3\xa3\x70\xa0\x01'
+        b'\xa7\x30\x22\xe0\x01\x00\x17\xe3\xa7\x30\xa0\x01\xa3\x70\x22\xe0'
+        b'\x01\x00\x13\xe3\xa3\x70\xa0\x01\x00\x71\x81\xe7\x01\x00\x80\xe2'
+        b'\x01\x0c\x50\xe3\xe3\xff\xff\x1a\x10\x10\x9a\xe5\x7c\x06\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x2c\x60\x8a\xe2\x00\x70\xa0\xe3'
+        b'\x00\x80\xa0\xe3\x10\x70\x8d\xe5\x05\x00\x00\xea\x14\x20\x9a\xe5'
+        b'\x54\x06\x9f\xe5\x07\x10\xa0\xe1\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x20\x00\x9d\xe5\x07\x10\x40\xe0\x1c\x00\x9d\xe5'
+        b'\x00\x00\x51\xe1\x00\x10\xa0\x81\x00\x00\xa0\xe3\x14\x10\x8d\xe5'
+        b'\x00\x10\x96\xe5\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a\x16\x00\x00\xea'
+        b'\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x11\x00\x00\x4a\x00\x10\x96\xe5\x0c\x00\x8d\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1\x08\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x0b\x00\x00\x1a'
+        b'\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x04\x00\x50\xe1\xf4\xff\xff\x3a\xd1\x00\x00\xea\x01\x80\x88\xe2'
+        b'\x08\x00\xa0\xe3\x0f\x00\x58\xe3\xcd\xff\xff\x9a\x75\xff\xff\xea'
+        b'\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x08\x00\x8d\xe5\xc6\x00\x00\x4a\x00\x10\x96\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1\x08\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x06\x00\x00\x1a'
+        b'\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x04\x00\x50\xe1\xf4\xff\xff\x3a\xb5\x00\x00\xea\x04\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\xb0\x00\x00\x4a'
+        b'\x00\x10\x96\xe5\x00\x50\xa0\xe1\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x70\xa0\xe1\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\x06\x00\x00\x1a\x00\x10\x96\xe5'
+        b'\x07\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x50\xe1'
+        b'\xf4\xff\xff\x3a\x9e\x00\x00\xea\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\x99\x00\x00\x4a\x08\x20\x9d\xe5'
+        b'\x05\x18\xa0\xe1\x02\x14\x81\xe1\x00\x0c\x81\xe1\x0c\x10\x9d\xe5'
+        b'\x01\x00\x80\xe1\x01\x00\x70\xe3\x0c\x00\x8d\xe5\x10\x01\x00\x0a'
+        b'\x00\x10\x96\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x50\xa0\xe1\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a'
+        b'\x7f\x00\x00\xea\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x7a\x00\x00\x4a\x00\x10\x96\xe5\x00\x70\xa0\xe1'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a\x68\x00\x00\xea'
+        b'\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x63\x00\x00\x4a\x00\x10\x96\xe5\x00\x04\x87\xe1\x08\x00\x8d\xe5'
+        b'\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1'
+        b'\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a\x50\x00\x00\xea'
+        b'\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3'
+        b'\x4b\x00\x00\x4a\x00\x10\x96\xe5\x00\x70\xa0\xe1\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1\x08\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x06\x00\x00\x1a'
+        b'\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x04\x00\x50\xe1\xf4\xff\xff\x3a\x39\x00\x00\xea\x04\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x00\x00\x50\xe3\x34\x00\x00\x4a'
+        b'\x00\x10\x96\xe5\x00\x74\x87\xe1\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1'
+        b'\x11\xff\x2f\xe1\x00\x50\xa0\xe1\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\x06\x00\x00\x1a\x00\x10\x96\xe5'
+        b'\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x50\xe1'
+        b'\xf4\xff\xff\x3a\x22\x00\x00\xea\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\x1d\x00\x00\x4a\x00\x10\x96\xe5'
+        b'\x00\x78\x87\xe1\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x50\xa0\xe1\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a'
+        b'\x0b\x00\x00\xea\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x06\x00\x00\x4a\x10\x10\x9d\xe5\x0c\x20\x9d\xe5'
+        b'\x01\x00\x52\xe1\x14\x10\x9d\x05\x08\x20\x9d\x05\x01\x00\x52\x01'
+        b'\x22\x00\x00\x0a\x01\x80\x88\xe2\x0f\x00\x58\xe3\x72\x00\x00\x8a'
+        b'\x00\x10\x96\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x10\x96\xe5\x00\x50\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x10\x70\x9d\xe5\x13\x00\x50\xe3\x06\x00\x00\x9a\xea\xfe\xff\xea'
+        b'\x00\x10\x96\xe5\x05\x00\xa0\xe1\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x14\x00\x50\xe3\xe4\xfe\xff\x2a\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1'
+        b'\x10\xff\x2f\xe1\x00\x00\x50\xe3\xf4\xff\xff\x0a\x04\x00\x9a\xe5'
+        b'\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1\x2c\x10\x9a\xe5\x00\x00\xa0\xe3'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x00\x50\xa0\xe1\xeb\xff\xff\xea'
+        b'\x00\x0c\x87\xe1\x08\x00\x8d\xe5\x14\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x34\x00\x00\x0a\x24\x00\x9d\xe5\x10\x10\x9d\xe5\x00\x70\xa0\xe3'
+        b'\x01\x00\x80\xe0\x04\x00\x8d\xe5\x00\x00\xe0\xe3\x0c\x00\x8d\xe5'
+        b'\x00\x10\x96\xe5\x00\x00\xa0\xe3\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1'
+        b'\x00\x50\xa0\xe1\x08\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x06\x00\x00\x1a\x00\x10\x96\xe5\x05\x00\xa0\xe1'
+        b'\x0f\xe0\xa0\xe1\x11\xff\x2f\xe1\x04\x00\x50\xe1\xf4\xff\xff\x3a'
+        b'\x13\x00\x00\xea\x04\x00\x9a\xe5\x0f\xe0\xa0\xe1\x10\xff\x2f\xe1'
+        b'\x00\x00\x50\xe3\x0e\x00\x00\x4a\x04\x10\x9d\xe5\x07\x00\xc1\xe7'
+        b'\x28\x10\x8d\xe2\x01\x70\x87\xe2\x0c\x20\x9d\xe5\x02\x00\x20\xe0'
+        b'\xff\x00\x00\xe2\x00\x01\x81\xe0\x0c\x00\x90\xe5\x22\x24\x20\xe0'
+        b'\x14\x00\x9d\xe5\x0c\x20\x8d\xe5\x00\x00\x57\xe1\xdb\xff\xff\x1a'
+        b'\x14\x70\x9d\xe5\x14\x00\x9d\xe5\x00\x00\x57\xe1\xa8\xff\xff\x1a'
+        b'\x0c\x00\x9d\xe5\x08\x10\x9d\xe5\x00\x00\xe0\xe1\x00\x00\x51\xe1'
+        b'\xa3\xff\xff\x1a\x03\x00\x00\xea\x08\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x9f\xff\xff\x1a\x20\x00\x00\xea\x14\x00\x9d\xe5\x00\x00\x50\xe3'
+        b'\x1d\x00\x00\x0a\x10\x70\x9d\xe5\x14\x00\x9d\xe5\x14\x20\x9a\xe5'
+        b'\x07\x70\x80\xe0\x9c\x00\x9f\xe5\x07\x10\xa0\xe1\x00\x00\x8f\xe0'
+        b'\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x88\xfe\xff\xea\x10\x10\x94\xe5'
+        b'\x14\x20\x9a\xe5\x6c\x00\x9f\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x05\x00\xa0\xe3\x32\xfe\xff\xea\x08\x00\xa0\xe3'
+        b'\x30\xfe\xff\xea\x14\x10\x94\xe5\x14\x20\x9a\xe5\x48\x00\x9f\xe5'
+        b'\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1\x12\xff\x2f\xe1\x06\x00\xa0\xe3'
+        b'\x28\xfe\xff\xea\x07\x00\xa0\xe3\x26\xfe\xff\xea\x14\x20\x9a\xe5'
+        b'\x2c\x00\x9f\xe5\x10\x10\x9d\xe5\x00\x00\x8f\xe0\x0f\xe0\xa0\xe1'
+        b'\x12\xff\x2f\xe1\x00\x00\xa0\xe3\x1e\xfe\xff\xea\x20\x83\xb8\xed'
+        b'\x87\x08\x00\x00\xc8\x07\x00\x00\x80\x00\x00\x00\xc1\x00\x00\x00'
+        b'\xe5\x06\x00\x00\x86\x00\x00\x00\xeb\x00\x00\x00\xce\x06\x00\x00'
+        b'\x49\x6e\x76\x61\x6c\x69\x64\x20\x62\x6c\x6f\x63\x6b\x20\x73\x69'
+        b'\x7a\x65\x3a\x20\x25\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20'
+        b'\x6d\x65\x6d\x6f\x72\x79\x20\x6c\x65\x6e\x67\x74\x68\x3a\x20\x25'
+        b'\x73\x0a\x00\x49\x6e\x76\x61\x6c\x69\x64\x20\x6d\x65\x6d\x6f\x72'
+        b'\x79\x20\x61\x64\x64\x72\x65\x73\x73\x3a\x20\x25\x73\x0a\x00\x61'
+        b'\x25\x30\x38\x78\x0a\x00\x64\x25\x30\x38\x78\x0a\x00\x2d\x3a\x5b'
+        b'\x53\x54\x41\x52\x54\x5d\x3a\x2d\x00\x49\x6e\x76\x61\x6c\x69\x64'
+        b'\x20\x74\x69\x6d\x65\x6f\x75\x74\x3a\x20\x25\x73\x0a\x00\x72\x25'
+        b'\x30\x38\x78\x0a\x00',
 }
 
 RETURN_REGISTER = {
     'arm':
-        b'\x01\x00\x50\xe3\x18\x00\x00\xda\x04\x00\x91\xe5\x00\x00\xd0\xe5'
-        b'\x61\x00\x40\xe2\x10\x00\x50\xe3\x00\xf1\x8f\x90\x12\x00\x00\xea'
-        b'\x10\x00\x00\xea\x2c\x00\x00\xea\x29\x00\x00\xea\x26\x00\x00\xea'
-        b'\x23\x00\x00\xea\x20\x00\x00\xea\x1d\x00\x00\xea\x1a\x00\x00\xea'
-        b'\x17\x00\x00\xea\x08\x00\x00\xea\x13\x00\x00\xea\x10\x00\x00\xea'
-        b'\x0d\x00\x00\xea\x0a\x00\x00\xea\x07\x00\x00\xea\x04\x00\x00\xea'
-        b'\xff\xff\xff\xea\x00\x00\x0f\xe1\x1e\xff\x2f\xe1\x09\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x0f\x00\xa0\xe1\x1e\xff\x2f\xe1\x0e\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x0d\x00\xa0\xe1\x1e\xff\x2f\xe1\x0c\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x0b\x00\xa0\xe1\x1e\xff\x2f\xe1\x0a\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x08\x00\xa0\xe1\x1e\xff\x2f\xe1\x07\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x06\x00\xa0\xe1\x1e\xff\x2f\xe1\x05\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x04\x00\xa0\xe1\x1e\xff\x2f\xe1\x03\x00\xa0\xe1'
-        b'\x1e\xff\x2f\xe1\x02\x00\xa0\xe1\x1e\xff\x2f\xe1\x01\x00\xa0\xe1'
+        b'\x01\x00\x50\xe3\x01\x00\x00\xca\x09\x00\xa0\xe1\x1e\xff\x2f\xe1'
+        b'\x04\x00\x91\xe5\x00\x00\xd0\xe5\x61\x00\x40\xe2\x10\x00\x50\xe3'
+        b'\x23\x00\x00\x8a\x04\x10\x8f\xe2\x00\x21\x91\xe7\x02\xf0\x81\xe0'
+        b'\xc0\x00\x00\x00\x44\x00\x00\x00\x4c\x00\x00\x00\x54\x00\x00\x00'
+        b'\x5c\x00\x00\x00\x64\x00\x00\x00\x6c\x00\x00\x00\x74\x00\x00\x00'
+        b'\x7c\x00\x00\x00\x84\x00\x00\x00\x8c\x00\x00\x00\x94\x00\x00\x00'
+        b'\x9c\x00\x00\x00\xa4\x00\x00\x00\xac\x00\x00\x00\xb4\x00\x00\x00'
+        b'\xbc\x00\x00\x00\x01\x00\xa0\xe1\x1e\xff\x2f\xe1\x02\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x03\x00\xa0\xe1\x1e\xff\x2f\xe1\x04\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x05\x00\xa0\xe1\x1e\xff\x2f\xe1\x06\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x07\x00\xa0\xe1\x1e\xff\x2f\xe1\x08\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x09\x00\xa0\xe1\x1e\xff\x2f\xe1\x0a\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x0b\x00\xa0\xe1\x1e\xff\x2f\xe1\x0c\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x0d\x00\xa0\xe1\x1e\xff\x2f\xe1\x0e\x00\xa0\xe1'
+        b'\x1e\xff\x2f\xe1\x0f\x00\xa0\xe1\x1e\xff\x2f\xe1\x00\x00\x0f\xe1'
         b'\x1e\xff\x2f\xe1',
 }
@@ -46,6 +46,7 @@ def create_depthcharge_ctx(args, **kwargs):
     * *allow_deploy* - From :py:meth:`ArgumentParser.add_allow_deploy_argument()`
     * *skip_deploy* - From :py:meth:`ArgumentParser.add_skip_deploy_argument()`
     * *allow_reboot* - From :py:meth:`ArgumentParser.add_allow_reboot_argument()`
+    * *read_cache* - From :py:meth:`ArgumentParser.add_read_cache_argument()`
 
     """
     monitor = Monitor.create(args.monitor)
@@ -86,7 +87,7 @@ def create_depthcharge_ctx(args, **kwargs):
         kwargs = {**kwargs, **args.extra}
 
     # Arguments to pass to Depthcharge if non-None or True (for bools)
-    keys = ('arch', 'allow_deploy', 'skip_deploy', 'allow_reboot')
+    keys = ('arch', 'allow_deploy', 'skip_deploy', 'allow_reboot', 'read_cache')
 
     for key in keys:
         if hasattr(args, key) and getattr(args, key):
@@ -221,6 +222,7 @@ class ArgumentParser(argparse.ArgumentParser):
         'allow_deploy',
         'skip_deploy',
         'allow_reboot',
+        'read_cache',
     ]
 
     def _perform_arg_handler_init(self, init_args: list, kwargs_dict: dict):
@@ -565,6 +567,22 @@ class ArgumentParser(argparse.ArgumentParser):
                           help=kwargs.pop('help', help_text),
                           **kwargs)
 
+    def add_read_cache_argument(self, **kwargs):
+        """
+        Add an option to the ArgumentParser to allow memory read results to be cached
+        and re-used, both within the current session and (when a device configuration
+        file is used) in later sessions.
+        """
+        help_text = ('Cache memory reads, alongside the device configuration file, '
+                     'and re-use them in later sessions.')
+
+        self.add_argument('--cache',
+                          dest='read_cache',
+                          action='store_true',
+                          default=kwargs.pop('default', False),
+                          help=kwargs.pop('help', help_text),
+                          **kwargs)
+
     def add_stratagem_argument(self, **kwargs):
         """
         Add an option to the ArgumentParser to allow a user to supply a file
@@ -4,8 +4,14 @@
 Support for devices running the Depthcharge "Companion" firmware
 """
 
+import binascii
+import functools
 import os
 import serial
+import threading
+
+from collections import OrderedDict
+from contextlib import contextmanager
 
 from . import log
 
@@ -24,8 +30,8 @@ class Companion:
     firmware.
 
     Currently, the Companion suport is limited to I2C peripheral functionality.
-    With some simple additions here and in the firmware, it should be capable of acting as
-    a peripheral device on other simple buses (e.g. SPI) as well.
+    Firmware with the *spi_periph* capability can also present itself to the target as a SPI
+    NOR flash device, which allows U-Boot's ``sf`` command to be used to move data.
     This API will update along with official additions to the firmware.
 
     The :py:meth:`get_capabilities()` and :py:meth:`get_version()` methods can be used to
@@ -42,11 +48,28 @@ class Companion:
     * *i2c_speed* - I2C bus speed, in Hz. May be set later via :py:meth:`set_i2c_speed()`.
       Default: *i2c_speed=100000*
 
+    * *spi_bus*, *spi_cs* - SPI bus and chip select the companion device is connected to,
+      as specified in ``sf probe [bus:]cs`` console commands. Default: *spi_bus=0*, *spi_cs=0*
+
+    * *spi_speed* - SPI clock rate, in Hz, that the target should use when communicating
+      with the companion device. Default: *spi_speed=4000000*
+
+    * *protocol* - Host-Companion message framing version to use. By default, the newest
+      version supported by the firmware is used. Version 2 framing supports payloads of several
+      KiB and protects each message with a CRC-16. Specify *protocol=1* to force the
+      use of the original framing.
+
     """
 
     _cmd = {
         'get_version':          0x00,
         'get_capabilities':     0x01,
+        'set_protocol':         0x02,
+        'get_protocol':         0x03,
+        'get_stats':            0x04,
+        'reset_stats':          0x05,
+        'loopback':             0x06,
+        'sink':                 0x07,
 
         'i2c_get_addr':         0x08,
         'i2c_set_addr':         0x09,
@@ -58,14 +81,97 @@ class Companion:
         'i2c_set_mode_flags':   0x0f,
         'i2c_set_read_buffer':  0x10,
         'i2c_get_write_buffer': 0x11,
+        'i2c_drain_write_queue': 0x12,
+        'i2c_get_buffer_size':  0x13,
+        'i2c_queue_read_buffers': 0x14,
+        'i2c_get_periph_count': 0x15,
+
+        'spi_get_info':         0x20,
+        'spi_set_read_buffer':  0x21,
+        'spi_get_write_buffer': 0x22,
+        'spi_get_status':       0x23,
+        'spi_reset':            0x24,
+
+        'console_get_status':   0x30,
+        'console_set_prompt':   0x31,
+        'console_i2c_read_mem': 0x32,
+        'console_read_results': 0x33,
+        'console_abort':        0x34,
+        'console_md_read_mem':  0x35,
     }
 
+    # Counters reported by get_stats, in order, following the timebase.
+    # Those ending in '_time' are 64-bit values in units of the timebase.
+    _stats_counters = (
+        'loop_iterations',
+        'host_rx_bytes', 'host_tx_bytes', 'host_frame_errors',
+        'i2c_writes', 'i2c_write_bytes', 'i2c_write_time',
+        'i2c_reads', 'i2c_read_bytes', 'i2c_read_time',
+        'i2c_oversize', 'i2c_dropped',
+    )
+
+    # Size of each per-command entry in a get_stats response
+    _stats_entry_size = 21
+
+    # Error code returned when a firmware queue lacks sufficient space
+    _status_queue_full = 0xfa
+
+    # Request flag for i2c_queue_read_buffers
+    _read_queue_clear = (1 << 0)
+
+    # Flags returned in the first byte of an i2c_drain_write_queue response
+    _drain_overflow = (1 << 0)
+    _drain_more     = (1 << 1)
+
+    # States and failure reasons reported for on-device console operations
+    _console_states  = ('idle', 'running', 'done', 'error')
+    _console_reasons = ('none', 'timeout', 'unexpected response', 'bad transfer', 'aborted')
+
+    # Flags returned by console_get_status
+    _console_bridge_used = (1 << 0)
+    _console_prompt_set  = (1 << 1)
+
+    # Request flag for console_md_read_mem
+    _console_md_big_endian = (1 << 0)
+
+    # Flags returned by spi_get_status
+    _spi_probed          = (1 << 0)
+    _spi_read_mismatch   = (1 << 1)
+    _spi_unsupported_cmd = (1 << 2)
+
+    # Largest payload representable by the version 1 framing's 1-byte length field
+    _max_payload_v1 = 255
+
+    # Version 2 frames begin with these bytes
+    _v2_magic = b'\xdc\x02'
+
+    # Version 2 flag denoting the presence of a tag following the length field
+    _flag_tagged = (1 << 0)
+
+    # Version 2 request flags field selecting the I2C peripheral instance
+    _flag_periph_shift = 1
+    _flag_periph_max   = 7
+
+    # Version 2 response flag denoting that our request was corrupt or malformed
+    _flag_frame_error = (1 << 7)
+
+    # Firmware only guarantees that it accepts requests of this size, unless
+    # it advertises support for larger I2C transactions.
+    _max_request_default = 64
+
+    # Transaction size imposed by the generic Arduino Wire API
+    _i2c_buffer_size_default = 32
+
     _status_ok = b'\00'
 
     def __init__(self, device='/dev/ttyACM0', baudrate=115200, **kwargs):
         self._i2c_addr  = kwargs.pop('i2c_addr', 0x78)
         self._i2c_speed = kwargs.pop('i2c_speed', 100_000)
         self._i2c_bus   = kwargs.pop('i2c_bus', 0)
+        self._spi_bus   = kwargs.pop('spi_bus', 0)
+        self._spi_cs    = kwargs.pop('spi_cs', 0)
+        self._spi_speed = kwargs.pop('spi_speed', 4_000_000)
+        protocol        = kwargs.pop('protocol', None)
 
         if not isinstance(self._i2c_addr, int):
             raise TypeError('Invalid I2C address: ' + str(self._i2c_addr))
@@ -87,19 +193,57 @@ class Companion:
 
         self._ser = serial.Serial(port=device, baudrate=baudrate, **kwargs)
 
-        #  These two items are populated by the following calls
+        #  These items are populated by the following calls
         self._fw_version = None
         self._fw_capabilities = None
-
+        self._fw_config = None
+        self._protocol = 1
+        self._max_payload = self._max_payload_v1
+        self._max_request = self._max_request_default
+        self._i2c_buffer_size = self._i2c_buffer_size_default
+        self._spi_info = None
+
+        # Index of the I2C peripheral instance that requests are directed to,
+        # and the saved settings of the others. See i2c_handle().
+        self._i2c_periph = 0
+        self._i2c_periph_state = {}
+
+        # Serializes use of the device across CompanionI2CHandle users
+        self._lock = threading.RLock()
+
+        # Pipelined command state. See submit_cmd()
+        self._pipelining = False
+        self._queue_depth = 1
+        self._next_tag = 0
+        self._outstanding = OrderedDict()
+        self._completed = {}
+
+        # The firmware always accepts version 1 framing for this
+        # request, regardless of the framing selected by a prior session.
         self.firmware_verison(cached=False)
         self.firmware_capabilities(cached=False)
 
+        if self._fw_capabilities.get('i2c_large_xfer', False):
+            self._max_request = self._max_payload
+            self.i2c_buffer_size(cached=False)
+
+        if protocol is None:
+            protocol = 2 if self._fw_capabilities.get('framing_v2', False) else 1
+
+        if protocol != 1:
+            self._set_protocol(protocol)
+
         dbg_msg = 'Opened Companion @ {:s}: Firmware Version {:s}. Capabilities:'
         dbg_msg = dbg_msg.format(device, self._fw_version)
         for cap in self._fw_capabilities:
             have_cap = 'Yes' if self._fw_capabilities[cap] else 'No'
             dbg_msg += os.linesep + ' ' * 8 + cap + ': ' + have_cap
 
+        if self._fw_config:
+            dbg_msg += os.linesep + ' ' * 4 + 'Configuration:'
+            for (item, value) in self._fw_config.items():
+                dbg_msg += os.linesep + ' ' * 8 + item + ': ' + str(value)
+
         log.note(dbg_msg)
 
         if self._fw_capabilities.get('i2c_periph', False):
@@ -142,14 +286,221 @@ class Companion:
 
         caps = {}
         resp = self.send_cmd('get_capabilities', b'', 4)
-        capraw = int.from_bytes(resp, 'little')
+        capraw = int.from_bytes(resp[:4], 'little')
 
         caps['i2c_periph'] = (capraw & (1 << 0)) != 0
         caps['spi_periph'] = (capraw & (1 << 1)) != 0
+        caps['i2c_write_queue'] = (capraw & (1 << 2)) != 0
+        caps['i2c_large_xfer']  = (capraw & (1 << 3)) != 0
+        caps['framing_v2']      = (capraw & (1 << 4)) != 0
+        caps['tagged_requests'] = (capraw & (1 << 5)) != 0
+        caps['i2c_read_queue']  = (capraw & (1 << 6)) != 0
+        caps['target_console']  = (capraw & (1 << 7)) != 0
+        caps['i2c_multi']       = (capraw & (1 << 8)) != 0
+        caps['loopback']        = (capraw & (1 << 9)) != 0
+        caps['board_config']    = (capraw & (1 << 10)) != 0
+
+        config = {}
+        if caps['board_config'] and len(resp) >= 27:
+            config['max_data_size']             = int.from_bytes(resp[4:6], 'little')
+            config['request_queue_depth']       = resp[6]
+            config['i2c_max_periphs']           = resp[7]
+            config['i2c_buffer_size']           = int.from_bytes(resp[8:10], 'little')
+            config['i2c_write_queue_size']      = int.from_bytes(resp[10:14], 'little')
+            config['i2c_read_queue_size']       = int.from_bytes(resp[14:18], 'little')
+            config['spi_buffer_size']           = int.from_bytes(resp[18:22], 'little')
+            config['console_output_queue_size'] = int.from_bytes(resp[22:26], 'little')
+            config['i2c_shared_buffer']         = (resp[26] & (1 << 0)) != 0
+            config['large_ram']                 = (resp[26] & (1 << 1)) != 0
 
         self._fw_capabilities = caps
+        self._fw_config = config
         return caps
 
+    def firmware_config(self, cached=True) -> dict:
+        """
+        Return a dict describing the compile-time configuration of the
+        Companion firmware (e.g. its buffer and queue sizes), which is
+        chosen according to the amount of RAM available on the device.
+
+        Sizes are reported in bytes, and are 0 for peripherals that were not
+        compiled into the firmware. The *i2c_shared_buffer* item indicates
+        that a single buffer is used for both I2C reads and writes, such that
+        the current read buffer does not persist across write transactions.
+
+        An empty dict is returned for firmware without the *board_config*
+        capability.
+
+        If *cached=True*, a previously obtained configuration will be returned.
+        Otherwise it will be read from the Companion device.
+        """
+        if not cached or self._fw_config is None:
+            self.firmware_capabilities(cached=False)
+
+        return self._fw_config
+
+    def _set_protocol(self, version: int):
+        """
+        Switch to the specified message framing version and update our
+        payload size limits according to what the firmware reports.
+        """
+        if version != 2 or not self._fw_capabilities.get('framing_v2', False):
+            raise ValueError('Unsupported Companion protocol version: {}'.format(version))
+
+        # Response is returned using the current framing
+        self.send_cmd('set_protocol', version.to_bytes(1, 'little'), 1, self._status_ok)
+        self._protocol = version
+
+        resp = self.send_cmd('get_protocol', b'')
+        if len(resp) < 3 or resp[0] != version:
+            raise IOError('Companion failed to switch to protocol version {:d}'.format(version))
+
+        self._max_payload = int.from_bytes(resp[1:3], 'little')
+        self._max_request = self._max_payload
+
+        # Firmware supporting tagged requests also reports its request queue depth
+        if self._fw_capabilities.get('tagged_requests', False) and len(resp) >= 4 and resp[3] > 0:
+            self._queue_depth = resp[3]
+            self._pipelining = True
+
+        msg = 'Using Companion protocol v{:d}, max payload = {:d}, queue depth = {:d}'
+        log.debug(msg.format(version, self._max_payload, self._queue_depth))
+
+    def protocol(self) -> int:
+        """
+        Host-Companion message framing version currently in use.
+        """
+        return self._protocol
+
+    @property
+    def max_payload(self) -> int:
+        """
+        Largest data payload, in bytes, that the Companion can return in
+        a single response.
+        """
+        return self._max_payload
+
+    @property
+    def max_request(self) -> int:
+        """
+        Largest data payload, in bytes, that the Companion accepts in
+        a single request.
+        """
+        return self._max_request
+
+    def stats(self) -> dict:
+        """
+        Retrieve firmware instrumentation counters, which may be used to determine whether an
+        operation is limited by the target's I2C bus, the host interface, or the firmware itself.
+
+        The returned dictionary contains the following items. Durations are in seconds.
+
+        * *loop_iterations* - Number of passes through the firmware's main event loop
+        * *host_rx_bytes*, *host_tx_bytes* - Bytes received from and sent to the host
+        * *host_frame_errors* - Corrupt or malformed requests received from the host
+        * *i2c_writes*, *i2c_write_bytes* - Write transactions (and their data bytes) performed
+          by the target
+        * *i2c_reads*, *i2c_read_bytes* - Read transactions (and their data bytes) performed
+          by the target
+        * *i2c_write_time*, *i2c_read_time* - Time spent servicing these transactions in ISRs
+        * *i2c_oversize* - Writes exceeding the firmware's transaction buffer
+        * *i2c_dropped* - Writes lost because the firmware's write queue was full
+        * *commands* - A dictionary, keyed by command name, of dictionaries containing
+          the *count* of requests handled along with their *min*, *avg*, and *max* handler
+          durations. The time taken to transmit responses is not included.
+
+        The counters can be cleared using :py:meth:`reset_stats()`.
+        """
+        ret = {}
+        cmd_names = {value: name for (name, value) in self._cmd.items()}
+        header_size = 4 + sum(8 if c.endswith('_time') else 4 for c in self._stats_counters) + 3
+        first = 0
+
+        while True:
+            resp = self.send_cmd('get_stats', bytes([first]))
+            if len(resp) < header_size:
+                if len(resp) == 1:
+                    raise NotImplementedError('This firmware does not support get_stats')
+
+                raise IOError('get_stats / Got truncated {:d}-byte response'.format(len(resp)))
+
+            timebase = int.from_bytes(resp[0:4], 'little')
+            i = 4
+            for name in self._stats_counters:
+                size = 8 if name.endswith('_time') else 4
+                value = int.from_bytes(resp[i:i + size], 'little')
+                ret[name] = value / timebase if size == 8 else value
+                i += size
+
+            total, entry_first, count = resp[i], resp[i + 1], resp[i + 2]
+            i += 3
+
+            if entry_first != first or len(resp) != i + count * self._stats_entry_size:
+                raise IOError('get_stats / Malformed response')
+
+            commands = ret.setdefault('commands', {})
+            for _ in range(count):
+                entry = resp[i:i + self._stats_entry_size]
+                cmd = entry[0]
+                n = int.from_bytes(entry[1:5], 'little')
+                total_time = int.from_bytes(entry[13:21], 'little')
+
+                name = cmd_names.get(cmd, '0x{:02x}'.format(cmd))
+                commands[name] = {
+                    'count': n,
+                    'min':   int.from_bytes(entry[5:9], 'little') / timebase,
+                    'avg':   total_time / n / timebase if n else 0.0,
+                    'max':   int.from_bytes(entry[9:13], 'little') / timebase,
+                }
+                i += self._stats_entry_size
+
+            first += count
+            if first >= total or count == 0:
+                return ret
+
+    def reset_stats(self):
+        """
+        Clear the firmware instrumentation counters reported by :py:meth:`stats()`.
+        """
+        self.send_cmd('reset_stats', b'', 1, self._status_ok)
+
+    def _require_loopback_support(self):
+        if not self._fw_capabilities.get('loopback', False):
+            raise NotImplementedError('This firmware does not implement loopback functionality')
+
+    def loopback(self, data: bytes) -> bytes:
+        """
+        Send *data* to the Companion, which returns it unmodified. This is intended for
+        measuring the latency and throughput of the host interface.
+
+        The length of *data* may not exceed :py:attr:`max_request` or :py:attr:`max_payload`.
+        An :py:exc:`IOError` is raised if the returned data does not match.
+        """
+        self._require_loopback_support()
+
+        if len(data) > self._max_payload:
+            raise ValueError('loopback / Data payload is too large.')
+
+        return self.send_cmd('loopback', data, len(data), data)
+
+    def sink(self, data: bytes = b'', response_size: int = 0) -> bytes:
+        """
+        Send *data* to the Companion, which discards it, and return its *response_size*-byte
+        response. This allows host-to-Companion and Companion-to-host throughput to be
+        measured independently of each other.
+
+        Byte *i* of the response has the value *i & 0xff*. An :py:exc:`IOError` is
+        raised if the response does not match this.
+        """
+        self._require_loopback_support()
+
+        if not 0 <= response_size <= self._max_payload:
+            raise ValueError('Invalid sink response size: {:d}'.format(response_size))
+
+        expected = bytes(i & 0xff for i in range(0, response_size))
+        request = response_size.to_bytes(2, 'little') + data
+        return self.send_cmd('sink', request, response_size, expected)
+
     def _require_i2c_support(self):
         if not self._fw_capabilities['i2c_periph']:
             raise NotImplementedError('This firmware does not implement I2C peripheral functionality')
@@ -224,6 +575,105 @@ class Companion:
         self.send_cmd('i2c_set_speed', speed.to_bytes(4, 'little'), 1, self._status_ok)
         self._i2c_speed = speed
 
+    def i2c_periph_count(self) -> int:
+        """
+        Return the number of I2C peripheral instances the Companion provides, each of which
+        operates on a different I2C bus. Instances other than the first are accessed using
+        handles returned by :py:meth:`i2c_handle()`.
+        """
+        self._require_i2c_support()
+
+        if not self._fw_capabilities.get('i2c_multi', False):
+            return 1
+
+        return self.send_cmd('i2c_get_periph_count', b'', 1)[0]
+
+    def i2c_handle(self, index: int, **kwargs):
+        """
+        Return a :py:class:`CompanionI2CHandle` that directs all I2C operations to the Companion's
+        I2C peripheral instance specified by *index*. Instance 0 is the one configured by this
+        object's own constructor arguments, and is used when this object is accessed directly.
+
+        The *i2c_bus*, *i2c_addr*, and *i2c_speed* keyword arguments are accepted and handled
+        as described for the :py:class:`Companion` constructor.
+
+        This allows a single Companion to serve multiple targets, each with its own
+        :py:class:`~depthcharge.Depthcharge` context, by passing a handle as each context's
+        *companion*. When these contexts are used from different threads, use a handle for
+        every target, including the one connected to instance 0.
+        """
+        self._require_i2c_support()
+
+        if self._protocol == 1 and index != 0:
+            raise ValueError('Version 1 framing cannot select an I2C peripheral instance')
+
+        if not 0 <= index < min(self.i2c_periph_count(), self._flag_periph_max + 1):
+            raise ValueError('Invalid I2C peripheral index: {}'.format(index))
+
+        with self._lock:
+            if index not in self._i2c_periph_state and index != self._i2c_periph:
+                self._i2c_periph_state[index] = {
+                    '_i2c_addr':  0x78,
+                    '_i2c_speed': 100_000,
+                    '_i2c_bus':   0,
+                }
+
+        handle = CompanionI2CHandle(self, index)
+
+        if 'i2c_bus' in kwargs:
+            with self._select_i2c_periph(index):
+                self._i2c_bus = kwargs['i2c_bus']
+
+        handle.set_i2c_addr(kwargs.get('i2c_addr', handle.i2c_addr()))
+        handle.set_i2c_speed(kwargs.get('i2c_speed', handle.i2c_speed()))
+        return handle
+
+    @contextmanager
+    def _select_i2c_periph(self, index: int):
+        """
+        Direct requests to the specified I2C peripheral instance, with its
+        host-side settings loaded, for the duration of the context.
+        """
+        attrs = ('_i2c_addr', '_i2c_speed', '_i2c_bus')
+
+        def swap(new_index):
+            self._i2c_periph_state[self._i2c_periph] = {a: getattr(self, a) for a in attrs}
+            for (attr, value) in self._i2c_periph_state.pop(new_index).items():
+                setattr(self, attr, value)
+            self._i2c_periph = new_index
+
+        with self._lock:
+            prev = self._i2c_periph
+            if index == prev:
+                yield
+                return
+
+            swap(index)
+            try:
+                yield
+            finally:
+                swap(prev)
+
+    def i2c_buffer_size(self, cached=True) -> int:
+        """
+        Retrieve the maximum number of bytes the Companion can send or receive
+        in a single I2C transaction, including any subaddress bytes.
+
+        Firmware without the ``i2c_large_xfer`` capability is limited to
+        32-byte transactions by the generic Arduino Wire API.
+
+        If *cached=True*, the value stored host-side will be returned.
+        Otherwise it will be read from the device.
+        """
+        self._require_i2c_support()
+
+        if cached or not self._fw_capabilities.get('i2c_large_xfer', False):
+            return self._i2c_buffer_size
+
+        resp = self.send_cmd('i2c_get_buffer_size', b'', 2)
+        self._i2c_buffer_size = int.from_bytes(resp, 'little')
+        return self._i2c_buffer_size
+
     def i2c_write_buffer(self) -> bytes:
         """
         Retrieve the contents of the I2C data write buffer
@@ -238,7 +688,51 @@ class Companion:
         preceding call to :py:meth:`set_i2c_read_buffer()`.
         """
         self._require_i2c_support()
-        return self.send_cmd('i2c_get_write_buffer', b'', range(0, 33))
+        return self.send_cmd('i2c_get_write_buffer', b'', range(0, self._i2c_buffer_size + 1))
+
+    def i2c_drain_write_queue(self, clear=False) -> list:
+        """
+        Retrieve all I2C write transactions that the Companion has queued
+        since the last call to this method, oldest first.
+
+        The data for each transaction is returned as a separate ``bytes``
+        entry in the returned list. This allows a caller to issue a number
+        of I2C writes on the target before collecting all of the results,
+        rather than calling :py:meth:`i2c_write_buffer()` after each one.
+
+        Note that calling :py:meth:`i2c_write_buffer()` discards the contents
+        of the queue.
+
+        An :py:exc:`IOError` is raised if the Companion reports that
+        transactions were dropped because its queue was full. The queue
+        is fully drained before this is raised.
+
+        If *clear=True*, the queue is drained without reporting dropped
+        transactions. This may be used to discard anything left over from a
+        prior (e.g. interrupted) operation, along with its overflow status.
+
+        This requires the ``i2c_write_queue`` capability.
+        """
+        self._require_i2c_support()
+        if not self._fw_capabilities.get('i2c_write_queue', False):
+            raise NotImplementedError('This firmware does not implement an I2C write queue')
+
+        ret = []
+        more = True
+        overflow = False
+
+        while more:
+            resp = self.send_cmd('i2c_drain_write_queue', b'', range(1, self._max_payload + 1))
+            flags = resp[0]
+
+            overflow |= (flags & self._drain_overflow) != 0
+            ret += self._split_records(resp[1:], 'I2C write queue')
+            more = (flags & self._drain_more) != 0
+
+        if overflow and not clear:
+            raise IOError('Companion I2C write queue overflowed. Data was lost.')
+
+        return ret
 
     def set_i2c_read_buffer(self, data: bytes):
         """
@@ -255,11 +749,353 @@ class Companion:
 
         # Although enforced silently in firmware, give feedback
         # to the user here.
-        if len(data) > 32:
-            raise ValueError('I2C data buffer exceeds maximum size of 32 bytes')
+        if len(data) > self._i2c_buffer_size:
+            msg = 'I2C data buffer exceeds maximum size of {:d} bytes'
+            raise ValueError(msg.format(self._i2c_buffer_size))
 
         self.send_cmd('i2c_set_read_buffer', data, 1, self._status_ok)
 
+    def i2c_queue_read_buffers(self, blocks: list, clear=False) -> int:
+        """
+        Stage one or more I2C read buffers, each of which will be returned by a
+        single subsequent read performed by the target SoC, in order. Once consumed,
+        the last staged buffer continues to be returned until another is staged.
+        Calling :py:meth:`set_i2c_read_buffer()` discards all staged buffers.
+
+        If *clear=True*, previously staged buffers are discarded first.
+        This may be used with an empty list of *blocks* to reset the queue.
+
+        Returns the remaining queue space, in bytes. Each staged buffer consumes
+        space equal to its length, plus one byte.
+
+        An :py:exc:`IOError` is raised if there is insufficient space for
+        all of the provided *blocks*, in which case none are staged.
+
+        Requires firmware support for the *i2c_read_queue* capability.
+        """
+        tag = self.submit_i2c_read_buffers(blocks, clear)
+        return self.collect_i2c_read_buffers(tag)
+
+    def submit_i2c_read_buffers(self, blocks: list, clear=False) -> int:
+        """
+        Pipelined form of :py:meth:`i2c_queue_read_buffers()`. Returns a tag
+        that must be passed to :py:meth:`collect_i2c_read_buffers()`.
+        """
+        self._require_i2c_support()
+
+        if not self._fw_capabilities.get('i2c_read_queue', False):
+            raise NotImplementedError('This firmware does not implement an I2C read buffer queue')
+
+        data = bytearray([self._read_queue_clear if clear else 0])
+        for block in blocks:
+            if len(block) > self._i2c_buffer_size:
+                msg = 'I2C data buffer exceeds maximum size of {:d} bytes'
+                raise ValueError(msg.format(self._i2c_buffer_size))
+
+            data.append(len(block))
+            data += block
+
+        return self.submit_cmd('i2c_queue_read_buffers', bytes(data))
+
+    def collect_i2c_read_buffers(self, tag: int) -> int:
+        """
+        Retrieve the result of a :py:meth:`submit_i2c_read_buffers()` request.
+        Refer to :py:meth:`i2c_queue_read_buffers()`.
+        """
+        resp = self.collect_cmd(tag)
+        if len(resp) != 3:
+            raise IOError('i2c_queue_read_buffers / Companion returned error code 0x{:02x}'.format(resp[0]))
+
+        if resp[0] == self._status_queue_full:
+            raise IOError('i2c_queue_read_buffers / Insufficient space in Companion I2C read queue')
+
+        if resp[0] != 0:
+            raise IOError('i2c_queue_read_buffers / Companion returned error code 0x{:02x}'.format(resp[0]))
+
+        return int.from_bytes(resp[1:3], 'little')
+
+    @staticmethod
+    def _split_records(data: bytes, what: str) -> list:
+        """
+        Split a sequence of [1-byte length][data] records into a list.
+        """
+        ret = []
+        i = 0
+        while i < len(data):
+            n = data[i]
+            if i + 1 + n > len(data):
+                raise IOError('Truncated record in {:s} response'.format(what))
+
+            ret.append(data[i + 1:i + 1 + n])
+            i += 1 + n
+
+        return ret
+
+    def _require_console_support(self):
+        if not self._fw_capabilities.get('target_console', False):
+            raise NotImplementedError('This firmware does not have a target console attached')
+
+    def console_status(self) -> dict:
+        """
+        Return a dictionary describing the state of the Companion's connection to
+        the target console, which contains the following items.
+
+        * *state* - State of the most recent on-device operation: ``'idle'``,
+          ``'running'``, ``'done'``, or ``'error'``
+        * *reason* - Description of the failure, when *state* is ``'error'``
+        * *bridge_used* - ``True`` if host data has been relayed to the target console
+          through the Companion. This indicates that the Depthcharge console is
+          connected to the Companion's bridge interface, rather than directly to the target.
+        * *prompt_set* - ``True`` if a prompt has been configured via
+          :py:meth:`set_console_prompt()`
+
+        Requires firmware support for the *target_console* capability.
+        """
+        self._require_console_support()
+        resp = self.send_cmd('console_get_status', b'', 3)
+        return {
+            'state':        self._console_state_str(resp[0]),
+            'reason':       self._console_reason_str(resp[1]),
+            'bridge_used':  (resp[2] & self._console_bridge_used) != 0,
+            'prompt_set':   (resp[2] & self._console_prompt_set) != 0,
+        }
+
+    def set_console_prompt(self, prompt: str):
+        """
+        Specify the target's console prompt, which on-device operations use to
+        determine when a command has completed.
+        """
+        self._require_console_support()
+        self.send_cmd('console_set_prompt', prompt.encode('utf-8'), 1, self._status_ok)
+
+    def console_i2c_read_mem(self, addr: int, size: int, chunk_size: int):
+        """
+        Start an on-device memory read of *size* bytes at *addr*, performed by
+        the Companion issuing ``i2c write`` commands of *chunk_size* bytes to
+        the target console itself. The target's I2C bus must already be configured.
+
+        Results are retrieved using :py:meth:`console_read_results()`.
+        """
+        self._require_console_support()
+        self._require_i2c_support()
+
+        data = addr.to_bytes(8, 'little') + size.to_bytes(4, 'little') + bytes([chunk_size])
+        self.send_cmd('console_i2c_read_mem', data, 1, self._status_ok)
+
+    def console_md_read_mem(self, addr: int, size: int, width: int, big_endian: bool):
+        """
+        Start an on-device memory read of *size* bytes at *addr*, performed by the
+        Companion issuing ``md`` commands with a word size of *width* bytes (1, 2, 4, or 8)
+        and parsing the resulting hex dump itself. The Companion converts each word to bytes
+        according to the target's endianness, as specified by *big_endian*.
+
+        Results are retrieved using :py:meth:`console_read_results()`.
+        """
+        self._require_console_support()
+
+        flags = self._console_md_big_endian if big_endian else 0
+        data = addr.to_bytes(8, 'little') + size.to_bytes(4, 'little') + bytes([width, flags])
+        self.send_cmd('console_md_read_mem', data, 1, self._status_ok)
+
+    def console_read_results(self) -> tuple:
+        """
+        Retrieve results produced by an on-device console operation.
+
+        Returns a tuple: *(state, reason, records, more)*. The *state* and *reason*
+        items are as described in :py:meth:`console_status()`. The *records* item is
+        a list of ``bytes`` objects, and *more* is ``True`` if additional records
+        are ready to be retrieved.
+        """
+        self._require_console_support()
+        resp = self.send_cmd('console_read_results', b'', range(3, self._max_payload + 1))
+        records = self._split_records(resp[3:], 'console_read_results')
+        more = (resp[2] & self._drain_more) != 0
+        return (self._console_state_str(resp[0]), self._console_reason_str(resp[1]), records, more)
+
+    def console_bridged(self) -> bool:
+        """
+        Returns ``True`` if the firmware is attached to the target console and the
+        Depthcharge console is connected through its bridge interface. In this case,
+        on-device console operations may be used in place of host-driven commands.
+        """
+        if not self.firmware_capabilities().get('target_console', False):
+            return False
+
+        return self.console_status()['bridge_used']
+
+    def console_collect_results(self, size: int, handle_data):
+        """
+        Pass the data produced by an on-device console operation to *handle_data()*
+        as it becomes available, until the operation completes.
+
+        An :py:exc:`IOError` is raised if the operation fails or does not produce
+        *size* bytes. If an exception occurs, the operation is aborted, returning
+        the console to the bridge.
+        """
+        received = 0
+        try:
+            while True:
+                state, reason, records, more = self.console_read_results()
+                for data in records:
+                    received += len(data)
+                    handle_data(data)
+
+                if more or state == 'running':
+                    continue
+
+                if state != 'done':
+                    raise IOError('On-device console operation failed: ' + reason)
+
+                if received != size:
+                    err = 'Expected {:d} bytes of data, got {:d}'
+                    raise IOError(err.format(size, received))
+
+                return
+        except BaseException:
+            # Return the console to the host (e.g. upon KeyboardInterrupt)
+            self.console_abort()
+            raise
+
+    def console_abort(self):
+        """
+        Abort an on-device console operation, if one is running.
+        """
+        self._require_console_support()
+        self.send_cmd('console_abort', b'', 1, self._status_ok)
+
+    def _console_state_str(self, value: int) -> str:
+        try:
+            return self._console_states[value]
+        except IndexError:
+            return 'unknown (0x{:02x})'.format(value)
+
+    def _console_reason_str(self, value: int) -> str:
+        try:
+            return self._console_reasons[value]
+        except IndexError:
+            return 'unknown (0x{:02x})'.format(value)
+
+    def _require_spi_support(self):
+        if not self._fw_capabilities.get('spi_periph', False):
+            raise NotImplementedError('This firmware does not implement SPI peripheral functionality')
+
+    def spi_bus(self) -> int:
+        """
+        SPI bus number that the companion device is connected to, within U-Boot.
+        """
+        return self._spi_bus
+
+    def spi_cs(self) -> int:
+        """
+        SPI chip select that the companion device is connected to, within U-Boot.
+        """
+        return self._spi_cs
+
+    def spi_speed(self) -> int:
+        """
+        SPI clock rate, in Hz, that the target should use with the companion device.
+        """
+        return self._spi_speed
+
+    def spi_info(self, cached=True) -> dict:
+        """
+        Return a dictionary describing the SPI flash device the Companion presents itself as.
+
+        * *jedec_id* - The 3-byte JEDEC ID (manufacturer, memory type, capacity)
+        * *mode* - The SPI mode that should be specified in ``sf probe`` commands
+        * *buffer_size* - Size of the Companion's read and write buffers, in bytes.
+          Flash offsets wrap modulo this size.
+
+        If *cached=True*, a previously read value will be returned.
+        """
+        self._require_spi_support()
+
+        if cached and self._spi_info is not None:
+            return self._spi_info
+
+        resp = self.send_cmd('spi_get_info', b'', 8)
+        self._spi_info = {
+            'jedec_id':     resp[0:3],
+            'mode':         resp[3],
+            'buffer_size':  int.from_bytes(resp[4:8], 'little')
+        }
+        return self._spi_info
+
+    def set_spi_read_buffer(self, data: bytes, offset=0):
+        """
+        Load *data* into the Companion's SPI read buffer at the specified *offset*.
+
+        This data is returned when a target reads from the emulated flash device
+        and is therefore written to the target's memory by ``sf read``.
+        """
+        self._require_spi_support()
+
+        buffer_size = self.spi_info()['buffer_size']
+        if offset < 0 or offset + len(data) > buffer_size:
+            msg = 'Data exceeds {:d}-byte SPI buffer'.format(buffer_size)
+            raise ValueError(msg)
+
+        chunk_size = self._max_request - 4
+        for i in range(0, len(data), chunk_size):
+            req = (offset + i).to_bytes(4, 'little') + data[i:i + chunk_size]
+            self.send_cmd('spi_set_read_buffer', req, 1, self._status_ok)
+
+    def spi_write_buffer(self, size: int, offset=0) -> bytes:
+        """
+        Retrieve *size* bytes from the Companion's SPI write buffer, starting at *offset*.
+
+        This buffer contains data written (programmed) to the emulated flash device by
+        the target, such as memory contents sent via ``sf write``.
+        """
+        self._require_spi_support()
+
+        buffer_size = self.spi_info()['buffer_size']
+        if offset < 0 or size < 0 or offset + size > buffer_size:
+            msg = 'Requested region exceeds {:d}-byte SPI buffer'.format(buffer_size)
+            raise ValueError(msg)
+
+        ret = b''
+        while len(ret) < size:
+            n = min(size - len(ret), self._max_payload)
+            req = (offset + len(ret)).to_bytes(4, 'little') + n.to_bytes(2, 'little')
+            resp = self.send_cmd('spi_get_write_buffer', req)
+
+            if len(resp) != n:
+                msg = 'Expected {:d} bytes of SPI write buffer data, got {:d}'
+                raise IOError(msg.format(n, len(resp)))
+
+            ret += resp
+
+        return ret
+
+    def spi_status(self) -> dict:
+        """
+        Return a dictionary describing SPI flash activity since the last :py:meth:`spi_reset()`.
+
+        * *probed* - ``True`` if the target has read our JEDEC ID (e.g. via ``sf probe``)
+        * *read_mismatch* - ``True`` if a READ (0x03) command did not begin at the offset
+          the firmware anticipated, in which case the first byte returned was incorrect.
+        * *unsupported_cmd* - ``True`` if the target issued an unrecognized flash command
+        * *programmed* - Number of bytes received via page program commands
+        * *read* - Number of bytes sent in response to read commands
+        """
+        self._require_spi_support()
+        resp = self.send_cmd('spi_get_status', b'', 9)
+        return {
+            'probed':           (resp[0] & self._spi_probed) != 0,
+            'read_mismatch':    (resp[0] & self._spi_read_mismatch) != 0,
+            'unsupported_cmd':  (resp[0] & self._spi_unsupported_cmd) != 0,
+            'programmed':       int.from_bytes(resp[1:5], 'little'),
+            'read':             int.from_bytes(resp[5:9], 'little'),
+        }
+
+    def spi_reset(self):
+        """
+        Clear the SPI status flags and counters reported by :py:meth:`spi_status()`.
+        """
+        self._require_spi_support()
+        self.send_cmd('spi_reset', b'', 1, self._status_ok)
+
     def send_cmd(self, cmd_str: str, data: bytes,
                  expected_resp_size: int = -1, expected_resp=None) -> bytes:
         """
@@ -274,30 +1110,108 @@ class Companion:
         :py:exc:`ValueError` and :py:exc:`TypeError` exceptions are raised when invalid
         arguments are provided.
         """
+        cmd = self._lookup_cmd(cmd_str, data)
+
+        with self._lock:
+            # Responses are returned in order, so collect those we're still
+            # waiting on before our own (untagged) response arrives.
+            self._collect_outstanding()
+
+            self._ser.write(self._frame(cmd, data))
+            rsp = self._read_response(cmd_str)
+
+        return self._check_response(cmd_str, cmd, rsp, expected_resp_size, expected_resp)
+
+    def submit_cmd(self, cmd_str: str, data: bytes) -> int:
+        """
+        Send a raw command to the Companion device without waiting for its response.
+        The returned tag must later be passed to :py:meth:`collect_cmd()` in order to
+        retrieve the response.
+
+        This allows multiple commands to be in flight at once, such that the
+        host-Companion round trip latency is incurred once per batch of commands, rather
+        than once per command. Commands are always executed in the order they are submitted.
+
+        If the firmware does not support tagged requests, the command is
+        executed immediately and its response is retained until collected.
+        """
+        cmd = self._lookup_cmd(cmd_str, data)
+
+        with self._lock:
+            tag = self._next_tag
+            self._next_tag = (self._next_tag + 1) & 0xff
+
+            if tag in self._outstanding or tag in self._completed:
+                raise IOError('Too many uncollected Companion commands')
+
+            if not self._pipelining:
+                self._ser.write(self._frame(cmd, data))
+                self._completed[tag] = (cmd_str, cmd, self._read_response(cmd_str))
+                return tag
+
+            # Do not exceed the number of requests the firmware can queue
+            while len(self._outstanding) >= self._queue_depth:
+                self._collect_next()
+
+            self._ser.write(self._frame(cmd, data, tag))
+            self._outstanding[tag] = (cmd_str, cmd)
+            return tag
+
+    def collect_cmd(self, tag: int, expected_resp_size: int = -1, expected_resp=None) -> bytes:
+        """
+        Retrieve the response to a command sent via :py:meth:`submit_cmd()`.
+        The *expected_resp_size* and *expected_resp* arguments are handled
+        as described in :py:meth:`send_cmd()`.
+        """
+        with self._lock:
+            while tag not in self._completed:
+                if tag not in self._outstanding:
+                    raise ValueError('No outstanding Companion command with tag={:d}'.format(tag))
+                self._collect_next()
+
+            (cmd_str, cmd, rsp) = self._completed.pop(tag)
+
+        return self._check_response(cmd_str, cmd, rsp, expected_resp_size, expected_resp)
+
+    def _lookup_cmd(self, cmd_str: str, data: bytes) -> int:
         try:
             cmd = self._cmd[cmd_str.lower()]
         except KeyError:
             raise ValueError('Invalid command: ' + cmd_str)
 
-        cmd = int(cmd).to_bytes(1, 'big')
-        if len(data) > 64:
+        if len(data) > self._max_request:
             raise ValueError(cmd_str + ' / Data payload is too large.')
 
-        size = len(data).to_bytes(1, 'big')
+        return cmd
 
-        request = cmd + size + data
-        self._ser.write(request)
+    def _collect_next(self):
+        # Responses arrive in the order their requests were sent
+        (tag, (cmd_str, cmd)) = next(iter(self._outstanding.items()))
+        rsp = self._read_response(cmd_str)
+        del self._outstanding[tag]
 
-        header = self._ser.read(2)
+        if rsp[2] != tag:
+            self._outstanding.clear()
+            err = cmd_str + ' / Expected response with tag={:d}, got tag={}'
+            raise IOError(err.format(tag, rsp[2]))
 
-        if header[0] != cmd[0]:
-            err = cmd_str + ' / Sent cmd=0x{:02}, got response for cmd=0x{:02}'
-            raise IOError(cmd, err.format(header[0]))
+        self._completed[tag] = (cmd_str, cmd, rsp)
 
-        size = header[1]
-        if size > 64:
-            err = cmd_str + ' / Received bogus payload size from device: 0x{:02x}'
-            raise IOError(err.format(size))
+    def _collect_outstanding(self):
+        while self._outstanding:
+            self._collect_next()
+
+    @staticmethod
+    def _check_response(cmd_str: str, cmd: int, rsp: tuple, expected_resp_size, expected_resp) -> bytes:
+        (rsp_cmd, flags, _, data) = rsp
+        size = len(data)
+
+        if flags & Companion._flag_frame_error:
+            raise IOError(cmd_str + ' / Companion reported a corrupt or malformed request')
+
+        if rsp_cmd != cmd:
+            err = cmd_str + ' / Sent cmd=0x{:02x}, got response for cmd=0x{:02x}'
+            raise IOError(err.format(cmd, rsp_cmd))
 
         if expected_resp is not None:
             if isinstance(expected_resp_size, int)  and size != expected_resp_size:
@@ -308,16 +1222,79 @@ class Companion:
                 err = cmd_str + ' / Expected {:d} to {:d} byte response, got {:d}-byte payload.'
                 raise IOError(err.format(expected_resp_size.start, expected_resp_size.stop - 1, size))
 
+            if expected_resp != data:
+                err = cmd_str + ' / Expected response = {:s}, got {:s}'
+                raise IOError(err.format(expected_resp.hex(), data.hex()))
+
+        return data
+
+    @staticmethod
+    def _crc16(data: bytes, crc=0xffff) -> int:
+        """
+        CRC-16/CCITT-FALSE, as used by version 2 framing.
+        """
+        return binascii.crc_hqx(data, crc)
+
+    def _frame(self, cmd: int, data: bytes, tag=None) -> bytes:
+        if self._protocol == 1:
+            if self._i2c_periph != 0:
+                raise ValueError('Version 1 framing cannot select an I2C peripheral instance')
+            return bytes([cmd, len(data)]) + data
+
+        flags = self._i2c_periph << self._flag_periph_shift
+        if tag is not None:
+            flags |= self._flag_tagged
+
+        body = bytes([cmd, flags]) + len(data).to_bytes(2, 'little')
+        if tag is not None:
+            body += bytes([tag])
+
+        body += data
+        return self._v2_magic + body + self._crc16(body).to_bytes(2, 'little')
+
+    def _read_exactly(self, size: int, what: str) -> bytes:
         data = self._ser.read(size)
         if len(data) != size:
-            err = cmd_str + ' / Requested {:d} bytes, got {:d}'
-            raise IOError(err.format(len(data), size))
+            err = 'Timed out reading Companion response {:s}. Requested {:d} bytes, got {:d}'
+            raise IOError(err.format(what, size, len(data)))
+        return data
+
+    def _read_response(self, cmd_str: str) -> tuple:
+        """
+        Read a single response and return a (cmd, flags, tag, data) tuple.
+        The tag is None for untagged responses.
+        """
+        tag = None
 
-        if expected_resp is not None and expected_resp != data:
-            err = cmd_str + ' / Expected response = {:s}, got {:s}'
-            raise IOError(err.format(expected_resp.hex(), data.hex()))
+        if self._protocol == 1:
+            header = self._read_exactly(2, 'header')
+            (rsp_cmd, flags, size) = (header[0], 0, header[1])
+        else:
+            magic = self._read_exactly(len(self._v2_magic), 'magic')
+            if magic != self._v2_magic:
+                raise IOError(cmd_str + ' / Invalid Companion response magic: ' + magic.hex())
 
-        return data
+            header = self._read_exactly(4, 'header')
+            (rsp_cmd, flags) = (header[0], header[1])
+            size = int.from_bytes(header[2:4], 'little')
+
+            if flags & self._flag_tagged:
+                header += self._read_exactly(1, 'tag')
+                tag = header[4]
+
+        if size > self._max_payload:
+            err = cmd_str + ' / Received bogus payload size from device: 0x{:02x}'
+            raise IOError(err.format(size))
+
+        data = self._read_exactly(size, 'payload')
+
+        if self._protocol != 1:
+            crc = int.from_bytes(self._read_exactly(2, 'CRC'), 'little')
+            if crc != self._crc16(data, self._crc16(header)):
+                err = cmd_str + ' / Response CRC mismatch (cmd=0x{:02x}, flags=0x{:02x}, len={:d})'
+                raise IOError(err.format(rsp_cmd, flags, size))
+
+        return (rsp_cmd, flags, tag, data)
 
     def close(self):
         """
@@ -325,3 +1302,38 @@ class Companion:
         No further instance methods should be invoked following this call.
         """
         self._ser.close()
+
+
+class CompanionI2CHandle:
+    """
+    Handle to one of the I2C peripheral instances provided by a :py:class:`Companion`,
+    as returned by :py:meth:`Companion.i2c_handle()`.
+
+    This presents the same API as :py:class:`Companion` and can be used anywhere a
+    Companion is accepted, such that I2C memory operations using it are carried out
+    on the corresponding bus. Each method call is performed with exclusive access to
+    the underlying Companion, so handles may be used from multiple threads.
+    """
+
+    def __init__(self, companion: Companion, index: int):
+        self._companion = companion
+        self._index = index
+
+    @property
+    def i2c_periph_index(self) -> int:
+        """
+        Index of the I2C peripheral instance this handle refers to.
+        """
+        return self._index
+
+    def __getattr__(self, name):
+        attr = getattr(self._companion, name)
+        if not callable(attr):
+            return attr
+
+        @functools.wraps(attr)
+        def call_with_periph_selected(*args, **kwargs):
+            with self._companion._select_i2c_periph(self._index):
+                return attr(*args, **kwargs)
+
+        return call_with_periph_selected
@@ -113,9 +113,23 @@ class Console:
     def baudrate(self):
         """
         Serial console's baud rate configuration.
+
+        Assigning a new value reconfigures the host side of the serial
+        connection, after any pending output has been transmitted. This does
+        not affect the target; refer to
+        :py:meth:`Depthcharge.set_baudrate() <depthcharge.Depthcharge.set_baudrate>`.
         """
         return self._baudrate
 
+    @baudrate.setter
+    def baudrate(self, value: int):
+        self._ser.flush()
+        self._ser.baudrate = value
+        self._baudrate = value
+
+        # Retain this across reopen() calls
+        self._kwargs['baudrate'] = value
+
     def send_command(self, cmd: str, read_response=True) -> str:
         """
         Send the provided command (`cmd`) to the attached U-Boot console.
@@ -284,6 +298,24 @@ class Console:
 
         return ret
 
+    def read_raw_partial(self, readlen=64, update_monitor=True) -> bytes:
+        """
+        Perform a single read of up to `readlen` bytes of raw data from the serial console.
+
+        Unlike :py:meth:`read_raw()`, this returns as soon as `readlen` bytes have been
+        received, or the read timeout elapses, rather than continuing until no more data
+        is available. An empty ``bytes`` object is returned if no data was received.
+
+        If `update_monitor` is `True`, this data is recorded by any attached
+        :py:class:`~depthcharge.monitor.Monitor`.
+        """
+        data = self._ser.read(readlen)
+
+        if update_monitor and data:
+            self.monitor.read(data)
+
+        return data
+
     def write(self, data: str, update_monitor=True):
         """
         Write the provided string (`data)` to the serial console.
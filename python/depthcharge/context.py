@@ -70,10 +70,14 @@ even if you're only using provided scripts.
 
 import json
 import os
+import random
 import re
+import time
 
+from contextlib import contextmanager
 from copy import deepcopy
 from datetime import datetime
+from zlib import crc32
 
 from .version import __version__
 
@@ -83,6 +87,7 @@ from . import uboot
 from .arch          import Architecture
 from .console       import Console
 from .executor      import Executor
+from .memory.cache  import MemoryCache
 from .memory.reader import MemoryReader
 from .memory.writer import MemoryWriter
 from .memory.patch  import MemoryPatch, MemoryPatchList
@@ -93,6 +98,15 @@ from .register      import RegisterReader
 from .stratagem     import Stratagem
 
 
+# Used by the SET_BAUDRATE payload
+_BAUD_START_SENTINEL = b'-:[START]:-'
+_BAUD_SYNC_SENTINEL  = b'-:[SYNC]:-'
+_BAUD_END_SENTINEL   = b'-:[|END|]:-'
+
+# Used by payloads that produce textual output (e.g. FIND_PATTERNS)
+_TEXT_START_SENTINEL = '-:[START]:-'
+_TEXT_END_SENTINEL   = '-:[|END|]:-'
+
 _FAILURE_STRINGS = (
     'data abort',
     '## Error',
@@ -143,6 +157,21 @@ class Depthcharge:
         keyword argument.  Alternatively, the offset from the payload base address can
         be provided via *payload_offset*.
 
+    :I2C bus speed: The speed, in Hz, at which the Companion device should operate on the
+        target's I2C bus may be provided via an *i2c_speed* keyword argument. This is
+        primarily used to restore the speed selected by :py:meth:`tune_i2c_speed()` when
+        loading a saved configuration, and takes precedence over the speed the
+        :py:class:`~depthcharge.Companion` was created with.
+
+    :Memory read cache: If *read_cache=True*, data returned by :py:meth:`read_memory()` is cached
+        and re-used by subsequent reads of the same memory, including those performed while
+        the context is created. The cache is stored in a *<config file>.memcache* file by
+        :py:meth:`save()` and :py:meth:`close()`, and loaded by :py:meth:`load()` in later
+        sessions. Alternatively, the name of the cache file may be provided instead of
+        ``True``. Cached data is invalidated by writes performed through this context, by
+        execution of code other than the builtin payloads, and by operations that crash and
+        reboot the platform. Cached data loaded from a file is discarded if the target's version or U-Boot ``bootcount`` has changed.
+
     :Crash/Reboot behavior: Some operations, such as
         :py:class:`~depthcharge.register.DataAbortRegisterReader` subclasses,
         need to crash platform (assuming it will automatically reboot) in order
@@ -163,6 +192,9 @@ class Depthcharge:
     _default_arch = 'generic'  # 32-bit, little endian
     _ver_re   = re.compile(r'^U-Boot\s+[0-9]{4}\.[0-9]{2}')
 
+    # I2C bus speeds attempted by tune_i2c_speed(), in Hz
+    _i2c_tune_speeds = (100_000, 400_000, 1_000_000, 1_700_000, 3_400_000)
+
     def __init__(self, console, companion=None, **kwargs):
         self.args = kwargs
         self.companion = companion
@@ -214,6 +246,21 @@ class Depthcharge:
         # Target device version number
         self._version = kwargs.get('_version', None)
 
+        # Register snapshot obtained by register_snapshot()
+        self._reg_snapshot = None
+
+        # Resident command server (see depthcharge.memory.resident), when running
+        self._cmd_server = None
+
+        # MemoryCache used by read_memory(), if enabled. See _bind_read_cache().
+        self._read_cache = None
+
+        # I2C bus speed selected by tune_i2c_speed()
+        self._i2c_speed = kwargs.get('i2c_speed', None)
+        if self._i2c_speed is not None and companion is not None and \
+                companion.firmware_capabilities().get('i2c_periph', False):
+            companion.set_i2c_speed(self._i2c_speed)
+
         # Our collections of available operations. These are initialized
         # as empty sets, which we will fill later in this constructor.
         #
@@ -224,6 +271,15 @@ class Depthcharge:
         self._memwr = OperationSet(suffix='MemoryWriter')
         self._regrd = OperationSet(suffix='RegisterReader')
 
+        # Throughput measurements obtained by calibrate_operations(),
+        # which are used to break ties between equally ranked operations.
+        op_throughput = kwargs.get('op_throughput', None) or {}
+        for (op_name, value) in op_throughput.get('MemoryReader', {}).items():
+            self._memrd.set_throughput(op_name, value)
+
+        for (op_name, value) in op_throughput.get('MemoryWriter', {}).items():
+            self._memwr.set_throughput(op_name, value)
+
         # Our rough interpretation of the bootloaders' global data structure...
         # or rather, what little of it we're interested in. This will be
         # populated as-needed by operations or when related methods are invoked
@@ -266,8 +322,17 @@ class Depthcharge:
         # Perform initializations involve interaction with the underlying
         # device. This has been split just to afford us an opportunity to
         # suppress or defer this, should such an API change ever be necessary.
+        #
+        # The read cache is created beforehand so that the reads performed here are
+        # cached, but its identity depends upon the version information retrieved below.
+        if kwargs.get('read_cache', False):
+            self._read_cache = MemoryCache(None)
+
         self._perform_active_init(**kwargs)
 
+        if self._read_cache is not None:
+            self._bind_read_cache(kwargs['read_cache'])
+
         # With some future additions, we could either directly determine
         # or deduce the architecture here, if we're still using a Generic* arch.
         #
@@ -324,6 +389,43 @@ class Depthcharge:
         except OperationNotSupported as error:
             log.warning(str(error))
 
+    def _read_cache_identity(self) -> str:
+        """
+        Helper for _bind_read_cache() that describes the target state in which cached
+        data remains valid. The U-Boot "bootcount", when present, is used to detect
+        whether the target has been reset since the data was read.
+        """
+        identity = {
+            'arch': self.arch.name,
+            'version': self._version,
+        }
+
+        if 'bootcount' in self._env:
+            resp = self.send_command('printenv bootcount')
+            try:
+                identity['bootcount'] = uboot.env.parse(resp).get('bootcount', None)
+            except ValueError:
+                log.debug('Failed to parse bootcount: ' + resp)
+
+        return json.dumps(identity, sort_keys=True)
+
+    def _bind_read_cache(self, read_cache):
+        """
+        Helper for __init__() that assigns the identity of the MemoryCache used by
+        read_memory(), once active initialization has completed. If *read_cache* is a
+        filename, previously cached data is loaded from it.
+        """
+        filename = read_cache if isinstance(read_cache, str) else None
+        self._read_cache.bind(self._read_cache_identity(), filename)
+
+    def _invalidate_read_cache(self, address=None, size=None):
+        """
+        Discard cached memory contents for the *size* bytes at *address*, or all of it
+        if these are not specified. No action is taken if the read cache is not enabled.
+        """
+        if self._read_cache is not None:
+            self._read_cache.invalidate(address, size)
+
     def _resolve_payload_base(self):
         """
         Resolve self._payload_base string based upon environment vars, if needed.
@@ -363,20 +465,38 @@ class Depthcharge:
         Usage elsewhere may have unintended side-effects.
         """
         log.note('Enumerating available MemoryWriter implementations...')
+        payload_writers = []
+
         for cls in MemoryWriter.implementations():
             try:
                 writer = cls(self, **kwargs)
                 if len(writer.required['payloads']) != 0:
-                    # TODO: Check if we have a dep-less writer to bootstrap a
-                    # payload-based writer. If we have a lot of data to write,
-                    # but only a limited write primitive, this might make sense
-                    # to add. Not doing this until there's a clear
-                    # need or use-case, though...
-                    err = 'A memory writer with a payload requirement is not currently supported'
-                    raise OperationNotSupported(writer, err)
+                    # Requires a payload-free writer to deploy its payload.
+                    # Defer until we know whether we have one.
+                    payload_writers.append(writer)
+                    continue
+
+                self._memwr.add(writer)
+                log.note('  Available: ' + writer.name)
+            except OperationNotSupported as e:
+                self._log_not_supported(e)
+
+        for writer in payload_writers:
+            try:
+                if len(self._memwr) == 0:
+                    msg = 'No MemoryWriter available to deploy required payload(s)'
+                    raise OperationNotSupported(writer, msg)
+
+                if not self._allow_deploy_exec:
+                    msg = 'Payload deployment+execution opt-in not specified'
+                    raise OperationNotSupported(writer, msg)
+
+                for payload in writer.required['payloads']:
+                    self._payloads.mark_required_by(payload, writer)
 
                 self._memwr.add(writer)
                 log.note('  Available: ' + writer.name)
+                log.debug('    Requires payloads: ' + str(writer.required['payloads']))
             except OperationNotSupported as e:
                 self._log_not_supported(e)
 
@@ -500,6 +620,10 @@ class Depthcharge:
         Create and return a Depthcharge object from the JSON data included in the
         specified file, previously generated by :py:meth:`save()`.
         """
+        # Keep cached memory contents alongside the device configuration
+        if kwargs.get('read_cache', False) is True:
+            kwargs['read_cache'] = filename + '.memcache'
+
         with open(filename, 'r') as infile:
             return Depthcharge.from_json(infile.read(), console, **kwargs)
 
@@ -518,6 +642,12 @@ class Depthcharge:
         if 'payload_offset' not in kwargs and 'payload_offset' in ctx:
             kwargs['payload_offset'] = ctx['payload_offset']
 
+        if 'i2c_speed' not in kwargs and ctx.get('i2c_speed') is not None:
+            kwargs['i2c_speed'] = ctx['i2c_speed']
+
+        if 'op_throughput' not in kwargs and ctx.get('op_throughput') is not None:
+            kwargs['op_throughput'] = ctx['op_throughput']
+
         return cls(console,
                    arch=kwargs.pop('arch', ctx['arch']),
                    _version=ctx['version'],
@@ -544,6 +674,17 @@ class Depthcharge:
             'gd': self._gd,
         }
 
+        if self._i2c_speed is not None:
+            output['i2c_speed'] = self._i2c_speed
+
+        op_throughput = {
+            'MemoryReader': self._memrd.throughput(),
+            'MemoryWriter': self._memwr.throughput(),
+        }
+
+        if any(op_throughput.values()):
+            output['op_throughput'] = op_throughput
+
         if timestamp:
             output['depthcharge_timestamp'] = datetime.now().isoformat()
 
@@ -562,12 +703,37 @@ class Depthcharge:
         """
         Serialize the current configuration of the current Depthcharge context
         to a JSON object and write it to the provided filename.
+
+        If the memory read cache is enabled and was not created with a filename, its
+        contents are written to *<filename>.memcache*, from which :py:meth:`load()`
+        will restore them.
         """
         log.note('Saving depthcharge configuration state to ' + filename)
         s = self.to_json(timestamp, comment)
         with open(filename, 'w') as outfile:
             outfile.write(s)
 
+        if self._read_cache is not None and self._read_cache.filename is None:
+            self._read_cache.filename = filename + '.memcache'
+
+        self.close()
+
+    def close(self):
+        """
+        Return the target to its console prompt by stopping the resident
+        :py:class:`~depthcharge.memory.CommandServer` payload, if it is running.
+        The contents of the memory read cache are written to its file, if it has one.
+
+        This is performed by :py:meth:`save()`, and should otherwise be invoked once a
+        script is done using the target. The context remains usable afterwards; the
+        payload will be started again if it is needed by a subsequent operation.
+        """
+        if self._cmd_server is not None:
+            self._cmd_server.exit()
+
+        if self._read_cache is not None and self._read_cache.filename is not None:
+            self._read_cache.save()
+
     @property
     def prompt(self) -> str:
         """
@@ -617,6 +783,9 @@ class Depthcharge:
         check = kwargs.pop('check', False)
         expected = kwargs.pop('expected', None)
 
+        # The console prompt isn't available while the resident command server is running
+        self.close()
+
         resp = self.console.send_command(*args, **kwargs)
         if resp is not None:
             if check:
@@ -647,6 +816,9 @@ class Depthcharge:
         """
         self.console.interrupt(interrupt_str, timeout)
 
+        # The resident command server returns upon receipt of a Ctrl-C
+        self._cmd_server = None
+
     def commands(self, cached=True, detailed=False) -> dict:
         """
         Return a dictionary containing information about commands supported by
@@ -888,6 +1060,52 @@ class Depthcharge:
         impl = self._reg_rd_impl(kwargs)
         return impl.read(register)
 
+    def register_snapshot(self, cached=True) -> dict:
+        """
+        Return a dictionary containing the values of all registers, along with select fields of
+        U-Boot's global data structure, as captured by a single execution of the READ_REGISTERS
+        payload via the "go" command.
+
+        Registers are keyed by the names used by :py:meth:`Architecture.registers()
+        <depthcharge.Architecture.registers>`. The global data structure pointer, jump table
+        pointer, and baud rate are keyed as ``'gd'``, ``'gd.jt'``, and ``'gd.baudrate'``.
+
+        By default, the previously obtained snapshot is returned for the remainder of the session.
+        Specify *cached=False* in order to obtain a new snapshot from the target. Bear in mind that
+        registers used to pass arguments to the payload are inherently tainted; this is primarily
+        useful for retrieving values that remain constant across invocations, such as *gd*.
+
+        Raises :py:exc:`~depthcharge.OperationNotSupported` if the payload cannot be executed.
+        """
+        if self._reg_snapshot is not None and cached:
+            return deepcopy(self._reg_snapshot)
+
+        self._check_go_payload('READ_REGISTERS')
+        resp = self._execute_text_payload('READ_REGISTERS')
+
+        snapshot = {}
+        for line in resp.splitlines():
+            try:
+                name, value = line.strip().split(':')
+                value = int(value, 16)
+            except ValueError:
+                log.debug('Ignoring unexpected READ_REGISTERS output: ' + line)
+                continue
+
+            if not name.startswith('gd'):
+                try:
+                    name, _ = self.arch.register(name)
+                except ValueError:
+                    pass  # Report it as-is
+
+            snapshot[name] = value
+
+        if 'gd' not in snapshot:
+            raise OperationFailed('Incomplete READ_REGISTERS output:\n' + resp.strip())
+
+        self._reg_snapshot = snapshot
+        return deepcopy(snapshot)
+
     @property
     def memory_readers(self):
         """
@@ -934,9 +1152,28 @@ class Depthcharge:
         If *impl* is not specified, or if a specified implementation is not available,
         one will be selected using :py:meth:`default_memory_reader` and the requested read size.
 
+        If a *baudrate* keyword argument is provided, the console is switched to this
+        baud rate for the duration of the read. See :py:meth:`temporary_baudrate()`.
+
+        When the context was created with *read_cache=True*, only the portions of the
+        requested region that are not already cached are read from the target. Specify
+        *cached=False* to read the entire region from the target and update the cache.
         """
         impl = self._read_memory_impl(size, kwargs)
-        return impl.read(address, size, **kwargs)
+        baudrate = kwargs.pop('baudrate', None)
+        cached = kwargs.pop('cached', True)
+
+        def read(address, size):
+            if baudrate:
+                with self.temporary_baudrate(baudrate):
+                    return impl.read(address, size, **kwargs)
+
+            return impl.read(address, size, **kwargs)
+
+        if self._read_cache is None:
+            return read(address, size)
+
+        return self._read_cache.read(address, size, read, cached)
 
     def read_memory_to_file(self, address: int, size: int, filename: str, **kwargs):
         """
@@ -944,11 +1181,267 @@ class Depthcharge:
         to a file named *filename*.
 
         Refer to :py:meth:`read_memory()` regarding the use of the optional *impl*
-        keyword argument.
+        and *baudrate* keyword arguments. An interrupted read may be continued by
+        repeating the call with *resume=True*. Refer to
+        :py:meth:`MemoryReader.read_to_file() <depthcharge.memory.MemoryReader.read_to_file>`.
         """
         impl = self._read_memory_impl(size, kwargs)
+        baudrate = kwargs.pop('baudrate', None)
+
+        if baudrate:
+            with self.temporary_baudrate(baudrate):
+                return impl.read_to_file(address, size, filename, **kwargs)
+
         return impl.read_to_file(address, size, filename, **kwargs)
 
+    def _check_go_payload(self, name: str):
+        """
+        Confirm that the builtin payload identified by *name* can be executed via the "go" command.
+
+        Raises :py:exc:`~depthcharge.OperationNotSupported` if this is not the case.
+        """
+        if name not in self._payloads:
+            raise OperationNotSupported(None, name + ' payload is not available')
+
+        if 'go' not in self.commands():
+            raise OperationNotSupported(None, 'The "go" command is required to execute ' + name)
+
+    def _go_payload_jt_addr(self, name: str) -> int:
+        """
+        Confirm that the builtin payload identified by *name* can be executed via the "go" command
+        and return the address of the U-Boot jump table, which these payloads require.
+
+        Raises :py:exc:`~depthcharge.OperationNotSupported` if this is not the case.
+        """
+        self._check_go_payload(name)
+
+        try:
+            return self._gd['jt']['address']
+        except KeyError:
+            raise OperationNotSupported(None, 'U-Boot jump table location is unknown')
+
+    def _execute_text_payload(self, name: str, *args, timeout=30.0) -> str:
+        """
+        Execute a payload that prints textual output between start and end sentinels,
+        and return this output.
+
+        An :py:exc:`~depthcharge.OperationFailed` exception is raised if the end sentinel
+        is not received within *timeout* seconds.
+        """
+        self.execute_payload(name, *args, read_response=False)
+
+        console = self.console
+        resp = console.read()
+        if not resp.endswith(_TEXT_START_SENTINEL):
+            raise OperationFailed('Did not receive expected start sentinel')
+
+        console.write('\n')
+
+        # The payload may take a while, so the console can go quiet for a bit.
+        # Stop waiting if we're back at a prompt without having seen the end sentinel.
+        resp = ''
+        t_start = time.time()
+        while _TEXT_END_SENTINEL not in resp:
+            if console.prompt and resp.endswith(console.prompt):
+                raise OperationFailed(name + ' did not complete:\n' + resp.strip())
+
+            if (time.time() - t_start) >= timeout:
+                msg = '{:s} did not complete within {:.1f} seconds:\n{:s}'
+                raise OperationFailed(msg.format(name, timeout, resp.strip()))
+
+            resp += console.read()
+
+        # Consume the remaining output (i.e. return code and prompt),
+        # if it did not arrive along with the end sentinel.
+        if not (console.prompt and resp.endswith(console.prompt)):
+            console.read()
+
+        return resp[:resp.index(_TEXT_END_SENTINEL)]
+
+    def find_patterns(self, address: int, size: int, patterns: list, alignment=1,
+                      timeout=30.0) -> list:
+        """
+        Search *size* bytes of memory at *address* for any of the specified byte *patterns*,
+        on the target itself, and return a sorted list of *(address, pattern index)* tuples.
+
+        This uses the FIND_PATTERNS payload (deployed and executed via the "go" command), such that
+        only the locations of matches are transferred over the console, rather than the entire
+        memory region. Only addresses that are a multiple of *alignment* bytes from *address*
+        are checked.
+
+        Up to 4096 matches are reported. The total number and length of the patterns is constrained
+        by the maximum number of arguments (``CONFIG_SYS_MAXARGS``) and command length
+        (``CONFIG_SYS_CBSIZE``) supported by U-Boot. Shorter, more selective patterns are better.
+
+        This is most useful in conjunction with :py:meth:`Hunter.prefilter()
+        <depthcharge.hunter.Hunter.prefilter>`.
+
+        An :py:exc:`~depthcharge.OperationFailed` exception is raised if the search
+        does not complete within *timeout* seconds.
+        """
+        jt_addr = self._go_payload_jt_addr('FIND_PATTERNS')
+
+        if not patterns:
+            raise ValueError('At least one pattern must be specified')
+
+        args = [
+            '0x{:08x}'.format(jt_addr),
+            '0x{:08x}'.format(address),
+            '0x{:08x}'.format(size),
+            '0x{:x}'.format(alignment)
+        ]
+        args += [pattern.hex() for pattern in patterns]
+
+        resp = self._execute_text_payload('FIND_PATTERNS', *args, timeout=timeout)
+
+        ret = []
+        for line in resp.splitlines():
+            try:
+                index, match_addr = line.strip().split(':')
+                ret.append((int(match_addr, 16), int(index)))
+            except ValueError:
+                log.debug('Ignoring unexpected FIND_PATTERNS output: ' + line)
+
+        return sorted(ret)
+
+    def block_crc32(self, address: int, size: int, block_size=65536, timeout=30.0) -> list:
+        """
+        Compute the CRC32 checksum of each *block_size* region within the *size* bytes
+        of memory located at *address*, and return these as a list of integers.
+        The final block may be smaller than *block_size*.
+
+        The BLOCK_CRC32 payload is used if it can be executed. Otherwise, the U-Boot
+        ``crc32`` console command is invoked for each block, if available. An
+        :py:exc:`~depthcharge.OperationFailed` exception is raised if the payload does
+        not complete within *timeout* seconds.
+
+        These checksums can be compared against those of a previously obtained image in
+        order to determine which regions have changed. Refer to the *incremental* keyword
+        argument of :py:meth:`read_memory_to_file()`.
+        """
+        n_blocks = (size + block_size - 1) // block_size
+
+        try:
+            jt_addr = self._go_payload_jt_addr('BLOCK_CRC32')
+            resp = self._execute_text_payload('BLOCK_CRC32',
+                                              '0x{:08x}'.format(jt_addr),
+                                              '0x{:08x}'.format(address),
+                                              '0x{:08x}'.format(size),
+                                              '0x{:x}'.format(block_size),
+                                              timeout=timeout)
+
+            ret = [int(line, 16) for line in resp.split()]
+
+        except OperationNotSupported as error:
+            if 'crc32' not in self.commands():
+                raise error
+
+            log.debug('Using crc32 command to compute block checksums: ' + str(error))
+
+            ret = []
+            progress = self.create_progress_indicator(self, n_blocks, 'Computing block CRC32s')
+            try:
+                for offset in range(0, size, block_size):
+                    block_len = min(block_size, size - offset)
+                    resp = self.send_command('crc32 {:x} {:x}'.format(address + offset, block_len))
+
+                    match = re.search(r'==>\s+(?P<result>[0-9a-fA-F]+)', resp)
+                    if not match:
+                        raise OperationFailed('Unexpected crc32 command output: ' + resp)
+
+                    ret.append(int(match.group('result'), 16))
+                    progress.update()
+            finally:
+                self.close_progress_indicator(progress)
+
+        if len(ret) != n_blocks:
+            msg = 'Expected {:d} block checksums, received {:d}'
+            raise OperationFailed(msg.format(n_blocks, len(ret)))
+
+        return ret
+
+    def read_words(self, addresses, jt_addr=None) -> list:
+        """
+        Read the 32-bit word located at each of the specified *addresses* and return a list
+        of their values, in the same order.
+
+        This is intended for retrieving many scattered values (e.g. pointers in tables or
+        structures) with as few round trips as possible. The READ_WORDS payload is used to
+        read up to 12 runs of consecutive words per invocation. If this payload cannot be
+        executed, each run is instead read using :py:meth:`read_memory()`.
+
+        The payload requires the address of U-Boot's jump table. Unless *jt_addr* is specified,
+        the location obtained by :py:meth:`uboot_global_data()` is used.
+
+        All addresses must be 4-byte aligned.
+        """
+        addresses = list(addresses)
+        for address in addresses:
+            if address & 0x3:
+                raise ValueError('Address is not word-aligned: 0x{:08x}'.format(address))
+
+        # Coalesce consecutive words into (start, count) runs
+        runs = []
+        for address in sorted(set(addresses)):
+            if runs and (runs[-1][0] + 4 * runs[-1][1]) == address:
+                runs[-1][1] += 1
+            else:
+                runs.append([address, 1])
+
+        values = {}
+
+        try:
+            if jt_addr is None:
+                jt_addr = self._go_payload_jt_addr('READ_WORDS')
+            else:
+                self._check_go_payload('READ_WORDS')
+        except OperationNotSupported as error:
+            log.debug('Using read_memory() to read words: ' + str(error))
+            jt_addr = None
+
+        if jt_addr is None:
+            for start, count in runs:
+                data = self.read_memory(start, 4 * count, show_progress=False)
+                for i in range(0, count):
+                    word = data[4 * i:4 * i + 4]
+                    values[start + 4 * i] = int.from_bytes(word, self.arch.endianness)
+
+            return [values[address] for address in addresses]
+
+        # Remain well within typical CONFIG_SYS_MAXARGS (16) and CONFIG_SYS_CBSIZE (256) values
+        max_args, max_arg_len = 12, 160
+
+        i = 0
+        while i < len(runs):
+            batch = []
+            arg_len = 0
+            while i < len(runs) and len(batch) < max_args:
+                start, count = runs[i]
+                arg = '0x{:x}'.format(start) if count == 1 else '0x{:x}:{:d}'.format(start, count)
+                if batch and (arg_len + len(arg) + 1) > max_arg_len:
+                    break
+
+                batch.append(arg)
+                arg_len += len(arg) + 1
+                i += 1
+
+            resp = self._execute_text_payload('READ_WORDS', '0x{:08x}'.format(jt_addr), *batch)
+            lines = resp.split()
+
+            batch_runs = runs[i - len(batch):i]
+            if len(lines) != len(batch_runs):
+                msg = 'Expected {:d} lines of READ_WORDS output, received {:d}'
+                raise OperationFailed(msg.format(len(batch_runs), len(lines)))
+
+            for (start, count), line in zip(batch_runs, lines):
+                if len(line) != 8 * count:
+                    raise OperationFailed('Unexpected READ_WORDS output: ' + line)
+
+                for j in range(0, count):
+                    values[start + 4 * j] = int(line[8 * j:8 * j + 8], 16)
+
+        return [values[address] for address in addresses]
+
     @property
     def memory_writers(self):
         """
@@ -999,6 +1492,11 @@ class Depthcharge:
         else:
             impl = self._write_memory_impl(len(data), kwargs)
 
+        if data is None:
+            self._invalidate_read_cache()
+        else:
+            self._invalidate_read_cache(address, len(data))
+
         impl.write(address, data, **kwargs)
 
     def write_memory_from_file(self, address: int, filename: str, **kwargs):
@@ -1015,13 +1513,272 @@ class Depthcharge:
         if kwargs.get('stratagem', False):
             stratagem = Stratagem.from_json(filename)
             impl = self._memwr.find(stratagem.operation_name)
+            self._invalidate_read_cache()
             impl.write(address, None, stratagem=stratagem)
         else:
             with open(filename, 'rb') as infile:
-                file_size = os.fstat(infile.fileno().st_size)
+                file_size = os.fstat(infile.fileno()).st_size
                 impl = self._write_memory_impl(file_size, kwargs)
+                self._invalidate_read_cache(address, file_size)
                 impl.write_from_file(address, infile)
 
+    def tune_i2c_speed(self, address=None, size=1024, speeds=None, trials=2) -> int:
+        """
+        Determine the fastest I2C bus speed at which the target can reliably transfer data
+        to and from the :py:class:`~depthcharge.Companion` device, and configure the Companion
+        to use it.
+
+        Starting at 100 kHz, a known pattern of *size* bytes is written to *address* using
+        :py:class:`~depthcharge.memory.I2CMemoryWriter` and read back using
+        :py:class:`~depthcharge.memory.I2CMemoryReader`. The CRC32 checksums of the pattern
+        and the data read back must match for each of the *trials* performed at a given speed.
+        The next faster speed in *speeds* is then attempted, until one fails or all have passed.
+
+        If *address* is not specified, the payload base address (``${loadaddr}``, by default)
+        is used, without the payload offset. The contents of this memory region are clobbered.
+
+        The selected speed is returned and stored in this context, such that it is included
+        in the output of :py:meth:`save()` and applied to the Companion when the configuration
+        is later loaded.
+        """
+        if speeds is None:
+            speeds = self._i2c_tune_speeds
+
+        try:
+            reader = self._memrd.find('I2CMemoryReader')
+            writer = self._memwr.find('I2CMemoryWriter')
+        except ValueError:
+            msg = 'I2CMemoryReader and I2CMemoryWriter are required in order to tune the I2C bus speed'
+            raise OperationNotSupported(None, msg)
+
+        if address is None:
+            address = self._payload_base
+            if not isinstance(address, int):
+                raise ValueError('Payload base address is unavailable. An address must be specified.')
+
+        companion = self.companion
+        initial_speed = companion.i2c_speed()
+        best = None
+
+        progress = self.create_progress_indicator(self, len(speeds) * trials, 'Tuning I2C speed')
+
+        try:
+            for speed in sorted(speeds):
+                companion.set_i2c_speed(speed)
+
+                try:
+                    for trial in range(0, trials):
+                        rng = random.Random(speed * trials + trial)
+                        pattern = rng.getrandbits(8 * size).to_bytes(size, 'little')
+
+                        writer.write(address, pattern)
+                        data = reader.read(address, size)
+
+                        if crc32(data) != crc32(pattern):
+                            msg = 'CRC32 mismatch at {:d} Hz: expected 0x{:08x}, got 0x{:08x}'
+                            raise IOError(msg.format(speed, crc32(pattern), crc32(data)))
+
+                        progress.update()
+
+                except (IOError, ValueError, OperationFailed) as error:
+                    log.note('I2C transfers failed at {:d} Hz: {:s}'.format(speed, str(error)))
+                    break
+
+                log.note('I2C transfers succeeded at {:d} Hz'.format(speed))
+                best = speed
+        finally:
+            self.close_progress_indicator(progress)
+
+            # Leave the Companion at the best speed found, or where it started
+            companion.set_i2c_speed(best or initial_speed)
+
+        if best is None:
+            raise OperationFailed('I2C transfers failed at all attempted speeds')
+
+        self._i2c_speed = best
+        return best
+
+    def _measure_throughput(self, op_set, op, size: int, fn):
+        """
+        Time a single invocation of *fn*, following an untimed invocation that allows
+        any required payloads to be deployed. The resulting throughput is recorded in
+        *op_set* and returned. If *op* fails, any previous measurement is discarded and
+        ``None`` is returned.
+        """
+        try:
+            fn()
+
+            t_start = time.perf_counter()
+            fn()
+            elapsed = time.perf_counter() - t_start
+
+        except (IOError, ValueError, OperationFailed, OperationNotSupported) as error:
+            log.note('Failed to calibrate {:s}: {:s}'.format(op.name, str(error)))
+            op_set.set_throughput(op, None)
+            return None
+
+        bytes_per_sec = size / max(elapsed, 1e-6)
+        op_set.set_throughput(op, bytes_per_sec)
+
+        log.note('{:s}: {:.1f} bytes/s'.format(op.name, bytes_per_sec))
+        return bytes_per_sec
+
+    def calibrate_operations(self, address=None, size=256, write=True) -> dict:
+        """
+        Measure the throughput of each available :py:class:`~depthcharge.memory.MemoryReader`
+        and, if *write=True*, each :py:class:`~depthcharge.memory.MemoryWriter`, using
+        *size* bytes of memory at *address*.
+
+        This allows the fastest of the operations that are equally suitable for a given task,
+        according to their :py:meth:`~depthcharge.Operation.rank()` values, to be selected
+        on this particular target. The results are stored in this context, such that they
+        are included in the output of :py:meth:`save()` and used when the configuration
+        is later loaded.
+
+        The memory writers re-write the original contents of the memory region, which are first
+        read using the default memory reader. Operations that require a
+        :py:class:`~depthcharge.Stratagem` or that crash or reboot the target are not measured.
+
+        If *address* is not specified, the payload base address (``${loadaddr}``, by default)
+        is used, without the payload offset.
+
+        Returns a dictionary containing the measured bytes/s of each operation, keyed by
+        operation name, in ``'MemoryReader'`` and ``'MemoryWriter'`` dictionaries.
+        Operations that failed are omitted.
+        """
+        if address is None:
+            address = self._payload_base
+            if not isinstance(address, int):
+                raise ValueError('Payload base address is unavailable. An address must be specified.')
+
+        def measurable(op):
+            req = op.required
+            return op.get_stratagem_spec() is None and not req.get('crash_or_reboot', False)
+
+        readers = [op for op in self._memrd if measurable(op)]
+        writers = [op for op in self._memwr if measurable(op)] if write else []
+
+        ret = {'MemoryReader': {}, 'MemoryWriter': {}}
+        progress = self.create_progress_indicator(self, len(readers) + len(writers),
+                                                  'Calibrating operations')
+
+        try:
+            for reader in readers:
+                def read(reader=reader):
+                    reader.read(address, size, show_progress=False)
+
+                bytes_per_sec = self._measure_throughput(self._memrd, reader, size, read)
+                if bytes_per_sec is not None:
+                    ret['MemoryReader'][reader.name] = bytes_per_sec
+
+                progress.update()
+
+            if writers:
+                data = self.read_memory(address, size, show_progress=False)
+
+            for writer in writers:
+                def write_data(writer=writer):
+                    writer.write(address, data, show_progress=False)
+
+                bytes_per_sec = self._measure_throughput(self._memwr, writer, size, write_data)
+                if bytes_per_sec is not None:
+                    ret['MemoryWriter'][writer.name] = bytes_per_sec
+
+                progress.update()
+
+        finally:
+            self.close_progress_indicator(progress)
+
+        return ret
+
+    def set_baudrate(self, baudrate: int, timeout=2.0):
+        """
+        Switch both the target's console UART and the host's :py:class:`~depthcharge.Console`
+        to the specified *baudrate*.
+
+        This is performed using the SET_BAUDRATE payload, which requires the "go"
+        command and the location of the U-Boot jump table. After both sides have switched,
+        the payload confirms that it can communicate with the host at the new rate. If this
+        handshake does not complete within *timeout* seconds, both sides revert to the original
+        rate and an :py:exc:`~depthcharge.OperationFailed` exception is raised.
+
+        Note that U-Boot will reject rates not present in its ``CONFIG_SYS_BAUDRATE_TABLE``,
+        and that the stable rates ultimately depend upon the target's UART clock configuration
+        and the host's serial adapter.
+
+        Refer to :py:meth:`temporary_baudrate()` for a means to automatically restore
+        the original baud rate after performing some operations.
+        """
+        console = self.console
+        orig_baudrate = console.baudrate
+
+        if baudrate == orig_baudrate:
+            return
+
+        jt_addr = self._go_payload_jt_addr('SET_BAUDRATE')
+
+        log.note('Switching baud rate from {:d} to {:d}'.format(orig_baudrate, baudrate))
+
+        self.execute_payload('SET_BAUDRATE',
+                             '0x{:08x}'.format(jt_addr),
+                             '{:d}'.format(baudrate),
+                             '{:d}'.format(int(timeout * 1000)),
+                             read_response=False)
+
+        resp = console.read_raw()
+        if not resp.endswith(_BAUD_START_SENTINEL):
+            raise OperationFailed('Did not receive expected start sentinel')
+
+        console.write('\n')
+        console.baudrate = baudrate
+
+        # Expect junk as the target's UART is reconfigured. We're only
+        # looking for the periodically sent sync sentinel.
+        data = b''
+        t_start = time.time()
+        while (time.time() - t_start) < timeout:
+            data += console.read_raw_partial()
+            if _BAUD_SYNC_SENTINEL in data:
+                console.write('k')
+
+                resp = console.read_raw()
+                if _BAUD_END_SENTINEL in resp:
+                    return
+
+                break
+
+        # The payload restores the original baud rate after its timeout
+        # elapses. Wait for this before attempting to resume communication.
+        time.sleep(max(0, timeout - (time.time() - t_start)) + 0.250)
+
+        console.baudrate = orig_baudrate
+        self.interrupt()
+
+        msg = 'Failed to establish communication at {:d} baud. Reverted to {:d} baud.'
+        raise OperationFailed(msg.format(baudrate, orig_baudrate))
+
+    @contextmanager
+    def temporary_baudrate(self, baudrate: int, timeout=2.0):
+        """
+        Returns a context manager that uses :py:meth:`set_baudrate()` to switch to the
+        specified *baudrate* upon entry, and then restore the current baud rate upon exit.
+
+        This is intended to speed up bulk transfers through the console, such as those
+        performed by :py:class:`~depthcharge.memory.GoMemoryReader`.
+
+        .. code:: python
+
+            with ctx.temporary_baudrate(921600):
+                ctx.read_memory_to_file(0x8780_0000, 16 * 1024 * 1024, 'dump.bin')
+        """
+        orig_baudrate = self.console.baudrate
+        self.set_baudrate(baudrate, timeout)
+
+        try:
+            yield self
+        finally:
+            self.set_baudrate(orig_baudrate, timeout)
+
     def patch_memory(self, patch_list, dry_run=False, **kwargs):
         """
         Patch a series of memory locations, as described in the provided *patch_list*.
@@ -1105,6 +1862,7 @@ class Depthcharge:
                 no_teardown = i < (len(patch_list) - 1)
                 kwargs['suppress_teardown'] = no_teardown
 
+                self._invalidate_read_cache(patch.address, len(patch.value))
                 write_impl.write(patch.address, patch.value, **kwargs)
                 progress.update()
         finally:
@@ -1143,7 +1901,12 @@ class Depthcharge:
 
         if not deployed or force:
             log.note('Deploying payload \"{:s}\" @ 0x{:08x}'.format(name, addr))
-            self.write_memory(addr, payload['data'])
+
+            # Payload-based writers can't be used to deploy payloads
+            data = payload['data']
+            writer = self._memwr.default(data_len=len(data), exclude_reqts=('stratagem', 'payloads'))
+            self._invalidate_read_cache(addr, len(data))
+            writer.write(addr, data)
             self._payloads.mark_deployed(name)
 
     def execute_payload(self, name: str, *args, **kwargs):
@@ -1177,7 +1940,8 @@ class Depthcharge:
         # Used by deploy. Don't pass to Executor.
         _ = kwargs.pop('force', False)
 
-        return self.execute_at(payload['address'], *args, **kwargs)
+        entry = payload['address'] + payload['entry_offset']
+        return self.execute_at(entry, *args, thumb=payload['thumb'], **kwargs)
 
     def execute_at(self, address: int, *args, **kwargs):
         """
@@ -1188,8 +1952,17 @@ class Depthcharge:
 
         **Important:** This method does not perform any pre-requisite validation before
         attempting to begin execution. Favor the use of :py:meth:`execute_payload()`.
+
+        Unless *address* is the entry point of a builtin payload, any cached memory contents
+        are discarded, as the executed code may have modified memory.
         """
         impl = self._exec_impl(kwargs)
+
+        is_payload = any(address == p['address'] + p['entry_offset']
+                         for p in map(self._payloads.__getitem__, self._payloads))
+        if not is_payload:
+            self._invalidate_read_cache()
+
         return impl.execute_at(address, *args, **kwargs)
 
     def _check_patch_expectations(self, read_impl, patch_list, **kwargs):
@@ -1363,5 +2136,12 @@ class Depthcharge:
         if memory_reader is None:
             memory_reader = self._memrd.default()
 
-        self._gd['jt'] = uboot.jump_table.find(self._gd['address'], memory_reader, self.arch)
+        kwargs = {}
+        try:
+            self._check_go_payload('READ_WORDS')
+            kwargs['read_words'] = self.read_words
+        except OperationNotSupported:
+            pass
+
+        self._gd['jt'] = uboot.jump_table.find(self._gd['address'], memory_reader, self.arch, **kwargs)
         return self._gd['jt']
@@ -20,6 +20,9 @@ class Executor(Operation):
         Any additional positional and keyword arguments are passed to the
         underlying :py:class:`~depthcharge.executor.Executor` implementation.
 
+        On ARM targets, the keyword argument *thumb=True* indicates that the code
+        at *address* consists of Thumb instructions, rather than ARM instructions.
+
         **Note**: This method does not perform any pre-requisite validation before
         attempting to begin execution. Use the
         :py:func:`Depthcharge.execute_payload() <depthcharge.Depthcharge.execute_payload>`
@@ -28,6 +28,11 @@ class GoExecutor(Executor):
         return 90
 
     def execute_at(self, address: int, *args, **kwargs):
+        # U-Boot branches to the "go" address via BLX, so setting bit 0
+        # results in a switch to Thumb state.
+        if kwargs.get('thumb', False):
+            address |= 1
+
         cmd = 'go 0x{:08x} '.format(address) + ' '.join(args)
 
         read_response = kwargs.get('read_response', True)
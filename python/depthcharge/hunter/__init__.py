@@ -19,4 +19,5 @@ from .env import EnvironmentHunter
 from .fdt import FDTHunter
 from .hunter import Hunter, HunterResultNotFound
 from .revcrc32 import ReverseCRC32Hunter
+from .scan import find_patterns, scan_image
 from .string import StringHunter
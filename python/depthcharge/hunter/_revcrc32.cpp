@@ -0,0 +1,822 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+//
+// Optional native implementation of the reverse CRC32 lookup table (RLUT)
+// and preimage search used by ReverseCRC32Hunter. Refer to revcrc32.py for
+// a description of the algorithm; this module produces identical results.
+//
+// The RLUT is stored as a flat array of CRC32 values, sorted in ascending
+// order, alongside a parallel array of (offset, length) locations. A
+// directory indexed by the upper 16 bits of a CRC32 value narrows each lookup
+// to a small, contiguous span of the table.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__ARM_FEATURE_CRC32)
+#   include <arm_acle.h>
+#endif
+
+namespace {
+
+const uint32_t CRC32_POLY       = 0xedb88320;
+const uint32_t CRC32_INVPOLY    = 0x5b358fd3;
+const uint32_t CRC32_XOR        = 0xffffffff;
+
+// Number of RLUT entries generated by a single unit of work during construction
+const size_t CHUNK_ENTRIES      = 1 << 22;
+
+// Number of CRC32 value ranges that chunks are merged across, in parallel
+const unsigned int MERGE_BITS   = 8;
+
+const unsigned int INDEX_BITS   = 16;
+const size_t INDEX_SIZE         = 1 << INDEX_BITS;
+
+uint32_t crc32_table[256];
+
+void init_crc32_table()
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t value = i;
+        for (int bit = 0; bit < 8; bit++) {
+            value = (value & 1) ? ((value >> 1) ^ CRC32_POLY) : (value >> 1);
+        }
+        crc32_table[i] = value;
+    }
+}
+
+// Advance the (non-inverted) CRC32 register by one byte. The ARMv8 CRC32B
+// instruction implements the same polynomial used by U-Boot and zlib.
+inline uint32_t crc32_update(uint32_t reg, uint8_t byte)
+{
+#if defined(__ARM_FEATURE_CRC32)
+    return __crc32b(reg, byte);
+#else
+    return crc32_table[(reg ^ byte) & 0xff] ^ (reg >> 8);
+#endif
+}
+
+// Equivalent to depthcharge.revcrc32.reverse_crc32_4bytes()
+inline uint32_t reverse_crc32_4bytes(uint32_t crc)
+{
+    uint32_t tcrcreg = crc ^ CRC32_XOR;
+    uint32_t data = 0;
+
+    for (int i = 0; i < 32; i++) {
+        data = (data & 1) ? ((data >> 1) ^ CRC32_POLY) : (data >> 1);
+
+        if (tcrcreg & 1) {
+            data ^= CRC32_INVPOLY;
+        }
+
+        tcrcreg >>= 1;
+    }
+
+    return data ^ CRC32_XOR;
+}
+
+struct Entry {
+    uint32_t crc;
+    uint32_t length;
+    uint32_t offset;
+};
+
+// Entries for the same CRC32 value are ordered such that the preferred one
+// (i.e. shortest input, followed by lowest offset) comes first
+inline bool operator<(const Entry &a, const Entry &b)
+{
+    if (a.crc != b.crc) {
+        return a.crc < b.crc;
+    }
+
+    if (a.length != b.length) {
+        return a.length < b.length;
+    }
+
+    return a.offset < b.offset;
+}
+
+// Retain only the first entry for each CRC32 value in a sorted vector
+void remove_duplicates(std::vector<Entry> &entries)
+{
+    auto same_crc = [](const Entry &a, const Entry &b) { return a.crc == b.crc; };
+    entries.erase(std::unique(entries.begin(), entries.end(), same_crc), entries.end());
+}
+
+// Stable LSD radix sort of entries by CRC32 value only
+void radix_sort(std::vector<Entry> &entries)
+{
+    std::vector<Entry> tmp(entries.size());
+
+    for (unsigned int shift = 0; shift < 32; shift += 8) {
+        size_t start[257] = { 0 };
+
+        for (const auto &entry : entries) {
+            start[((entry.crc >> shift) & 0xff) + 1]++;
+        }
+
+        for (unsigned int i = 1; i < 257; i++) {
+            start[i] += start[i - 1];
+        }
+
+        for (const auto &entry : entries) {
+            tmp[start[(entry.crc >> shift) & 0xff]++] = entry;
+        }
+
+        entries.swap(tmp);
+    }
+}
+
+// Merge the consecutive sorted runs delimited by bounds (which includes 0 and
+// entries.size()), then remove all but the preferred entry for each CRC32 value
+void merge_runs(std::vector<Entry> &entries, std::vector<size_t> bounds)
+{
+    while (bounds.size() > 2) {
+        std::vector<size_t> merged;
+
+        for (size_t i = 0; i + 2 < bounds.size(); i += 2) {
+            std::inplace_merge(entries.begin() + bounds[i],
+                               entries.begin() + bounds[i + 1],
+                               entries.begin() + bounds[i + 2]);
+            merged.push_back(bounds[i]);
+        }
+
+        // Odd run out
+        if (bounds.size() % 2 == 0) {
+            merged.push_back(bounds[bounds.size() - 2]);
+        }
+
+        merged.push_back(bounds.back());
+        bounds.swap(merged);
+    }
+
+    remove_duplicates(entries);
+}
+
+struct Location {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct Result {
+    bool found;
+    Location location;
+    uint32_t iterations;
+};
+
+// Input data offsets [start, stop) from which CRC32 operations may be performed.
+// No operation may extend beyond stop.
+struct Segment {
+    size_t start;
+    size_t stop;
+};
+
+unsigned int default_thread_count()
+{
+    unsigned int n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+// Invoke fn(i) for each i in [0, n) using up to num_threads threads.
+// The first exception thrown by fn() is re-thrown to the caller.
+template <typename Fn>
+void parallel_for(size_t n, unsigned int num_threads, Fn fn)
+{
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_lock;
+
+    auto worker = [&]() {
+        try {
+            for (size_t i = next++; i < n; i = next++) {
+                fn(i);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_lock);
+            if (!error) {
+                error = std::current_exception();
+            }
+
+            // Prevent remaining work from being started
+            next = n;
+        }
+    };
+
+    if (num_threads > n) {
+        num_threads = static_cast<unsigned int>(n);
+    }
+
+    if (num_threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < num_threads; i++) {
+            threads.emplace_back(worker);
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+class ReverseLUT {
+public:
+    void build(const uint8_t *data, const std::vector<Segment> &segments,
+               uint32_t maxlen, unsigned int num_threads);
+
+    bool lookup(uint32_t crc, Location &location) const
+    {
+        auto first = m_crcs.begin() + m_index[crc >> (32 - INDEX_BITS)];
+        auto last  = m_crcs.begin() + m_index[(crc >> (32 - INDEX_BITS)) + 1];
+        auto it    = std::lower_bound(first, last, crc);
+
+        if (it == last || *it != crc) {
+            return false;
+        }
+
+        location = m_locations[it - m_crcs.begin()];
+        return true;
+    }
+
+    // Walk backwards through up to max_iterations 4-byte CRC32 operations
+    // until an input present in the RLUT is found.
+    Result find(uint32_t target, uint32_t max_iterations) const
+    {
+        Result result;
+        result.found = false;
+
+        for (uint32_t i = 1; i <= max_iterations; i++) {
+            if (lookup(target, result.location)) {
+                result.found = true;
+                result.iterations = i;
+                break;
+            }
+
+            target = reverse_crc32_4bytes(target);
+        }
+
+        return result;
+    }
+
+    size_t size() const
+    {
+        return m_crcs.size();
+    }
+
+private:
+    std::vector<uint32_t> m_crcs;
+    std::vector<Location> m_locations;
+
+    // m_index[i] is the position of the first entry whose upper CRC32 bits are >= i
+    std::vector<size_t> m_index;
+};
+
+// Produce the sorted, de-duplicated RLUT entries for the operations starting
+// at offsets [start, stop), each of which may extend no further than limit.
+std::vector<Entry> generate_entries(const uint8_t *data, size_t start, size_t stop,
+                                    size_t limit, uint32_t maxlen)
+{
+    std::vector<uint32_t> regs(stop - start, CRC32_XOR);
+    std::vector<Entry> entries;
+    entries.reserve((stop - start) * std::min<size_t>(maxlen, limit - start));
+
+    // Entries are generated in order of ascending length, then offset. Each
+    // operation extends the previous one at the same offset by a byte, and
+    // the computations for successive offsets are independent of one another.
+    for (size_t len = 1; len <= maxlen && len <= (limit - start); len++) {
+        const size_t end = std::min(stop, limit - len + 1);
+
+        for (size_t offset = start; offset < end; offset++) {
+            uint32_t &reg = regs[offset - start];
+            reg = crc32_update(reg, data[offset + len - 1]);
+
+            Entry entry;
+            entry.crc    = reg ^ CRC32_XOR;
+            entry.length = static_cast<uint32_t>(len);
+            entry.offset = static_cast<uint32_t>(offset);
+            entries.push_back(entry);
+        }
+    }
+
+    // Stability preserves the preferred (length, offset) order for each CRC32 value
+    radix_sort(entries);
+    remove_duplicates(entries);
+
+    entries.shrink_to_fit();
+    return entries;
+}
+
+void ReverseLUT::build(const uint8_t *data, const std::vector<Segment> &segments,
+                       uint32_t maxlen, unsigned int num_threads)
+{
+    struct Chunk {
+        size_t start;
+        size_t stop;
+        size_t limit;
+    };
+
+    const size_t chunk_offsets = std::max<size_t>(1, CHUNK_ENTRIES / maxlen);
+    std::vector<Chunk> chunks;
+
+    for (const auto &segment : segments) {
+        for (size_t start = segment.start; start < segment.stop; start += chunk_offsets) {
+            Chunk chunk;
+            chunk.start = start;
+            chunk.stop  = std::min(start + chunk_offsets, segment.stop);
+            chunk.limit = segment.stop;
+            chunks.push_back(chunk);
+        }
+    }
+
+    // Each chunk yields a sorted run of entries, unique only within that chunk
+    std::vector<std::vector<Entry>> runs(chunks.size());
+
+    parallel_for(chunks.size(), num_threads, [&](size_t i) {
+        runs[i] = generate_entries(data, chunks[i].start, chunks[i].stop,
+                                   chunks[i].limit, maxlen);
+    });
+
+    // Merge the portion of every run that falls within each CRC32 value range
+    const size_t n_ranges = 1 << MERGE_BITS;
+    std::vector<std::vector<Entry>> ranges(n_ranges);
+
+    parallel_for(n_ranges, num_threads, [&](size_t r) {
+        const uint64_t lo = static_cast<uint64_t>(r) << (32 - MERGE_BITS);
+        const uint64_t hi = static_cast<uint64_t>(r + 1) << (32 - MERGE_BITS);
+        auto crc_less = [](const Entry &e, uint64_t value) { return e.crc < value; };
+
+        std::vector<Entry> &merged = ranges[r];
+        std::vector<size_t> bounds(1, 0);
+
+        for (const auto &run : runs) {
+            auto first = std::lower_bound(run.begin(), run.end(), lo, crc_less);
+            auto last  = std::lower_bound(first, run.end(), hi, crc_less);
+            if (first != last) {
+                merged.insert(merged.end(), first, last);
+                bounds.push_back(merged.size());
+            }
+        }
+
+        if (bounds.size() == 1) {
+            bounds.push_back(0);
+        }
+
+        merge_runs(merged, bounds);
+    });
+
+    runs.clear();
+    runs.shrink_to_fit();
+
+    std::vector<size_t> range_start(n_ranges + 1, 0);
+    for (size_t r = 0; r < n_ranges; r++) {
+        range_start[r + 1] = range_start[r] + ranges[r].size();
+    }
+
+    m_crcs.resize(range_start[n_ranges]);
+    m_locations.resize(range_start[n_ranges]);
+
+    parallel_for(n_ranges, num_threads, [&](size_t r) {
+        size_t i = range_start[r];
+
+        for (const auto &entry : ranges[r]) {
+            m_crcs[i] = entry.crc;
+            m_locations[i].offset = entry.offset;
+            m_locations[i].length = entry.length;
+            i++;
+        }
+
+        std::vector<Entry>().swap(ranges[r]);
+    });
+
+    m_index.assign(INDEX_SIZE + 1, 0);
+
+    size_t i = 0;
+    for (size_t h = 0; h < INDEX_SIZE; h++) {
+        while (i < m_crcs.size() && (m_crcs[i] >> (32 - INDEX_BITS)) < h) {
+            i++;
+        }
+        m_index[h] = i;
+    }
+    m_index[INDEX_SIZE] = m_crcs.size();
+}
+
+// Convert a C++ exception into a Python exception
+void set_python_error()
+{
+    try {
+        throw;
+    } catch (const std::bad_alloc &) {
+        PyErr_NoMemory();
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    } catch (...) {
+        PyErr_SetString(PyExc_RuntimeError, "Unexpected error in native ReverseLUT");
+    }
+}
+
+bool parse_crc32(PyObject *obj, uint32_t &value)
+{
+    unsigned long long tmp = PyLong_AsUnsignedLongLong(obj);
+    if (PyErr_Occurred()) {
+        return false;
+    }
+
+    if (tmp > 0xffffffffULL) {
+        PyErr_SetString(PyExc_OverflowError, "CRC32 value exceeds 32 bits");
+        return false;
+    }
+
+    value = static_cast<uint32_t>(tmp);
+    return true;
+}
+
+bool parse_thread_count(int requested, unsigned int &num_threads)
+{
+    if (requested < 0) {
+        PyErr_SetString(PyExc_ValueError, "num_threads must be >= 0");
+        return false;
+    }
+
+    num_threads = requested == 0 ? default_thread_count() : static_cast<unsigned int>(requested);
+    return true;
+}
+
+PyObject *location_tuple(const Location &location)
+{
+    return Py_BuildValue("(II)", location.offset, location.length);
+}
+
+PyObject *result_tuple(const Result &result)
+{
+    if (!result.found) {
+        Py_RETURN_NONE;
+    }
+
+    return Py_BuildValue("(III)", result.location.offset,
+                         result.location.length, result.iterations);
+}
+
+struct ReverseLUTObject {
+    PyObject_HEAD
+    ReverseLUT *lut;
+};
+
+PyObject *ReverseLUT_new(PyTypeObject *type, PyObject *, PyObject *)
+{
+    ReverseLUTObject *self = reinterpret_cast<ReverseLUTObject *>(type->tp_alloc(type, 0));
+    if (self != nullptr) {
+        self->lut = nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(self);
+}
+
+void ReverseLUT_dealloc(ReverseLUTObject *self)
+{
+    delete self->lut;
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject *>(self));
+}
+
+int ReverseLUT_init(ReverseLUTObject *self, PyObject *args, PyObject *kwargs)
+{
+    static const char *kwlist[] = { "data", "segments", "maxlen", "num_threads", nullptr };
+
+    Py_buffer data;
+    PyObject *segment_seq;
+    unsigned int maxlen;
+    int requested_threads = 0;
+    unsigned int num_threads;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "y*OI|i", const_cast<char **>(kwlist),
+                                     &data, &segment_seq, &maxlen, &requested_threads)) {
+        return -1;
+    }
+
+    std::vector<Segment> segments;
+    PyObject *seq = nullptr;
+    int ret = -1;
+
+    if (maxlen < 1) {
+        PyErr_SetString(PyExc_ValueError, "maxlen must be > 0");
+        goto out;
+    }
+
+    if (static_cast<unsigned long long>(data.len) > 0xffffffffULL) {
+        PyErr_SetString(PyExc_ValueError, "Input data must be less than 4 GiB");
+        goto out;
+    }
+
+    if (!parse_thread_count(requested_threads, num_threads)) {
+        goto out;
+    }
+
+    seq = PySequence_Fast(segment_seq, "segments must be a sequence of (start, stop) tuples");
+    if (seq == nullptr) {
+        goto out;
+    }
+
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        Py_ssize_t start, stop;
+        if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i), "nn", &start, &stop)) {
+            goto out;
+        }
+
+        if (start < 0 || stop < start || stop > data.len) {
+            PyErr_Format(PyExc_ValueError, "Invalid segment: [%zd, %zd)", start, stop);
+            goto out;
+        }
+
+        Segment segment;
+        segment.start = static_cast<size_t>(start);
+        segment.stop  = static_cast<size_t>(stop);
+        segments.push_back(segment);
+    }
+
+    try {
+        ReverseLUT *lut = new ReverseLUT();
+        std::exception_ptr error;
+
+        Py_BEGIN_ALLOW_THREADS
+        try {
+            lut->build(static_cast<const uint8_t *>(data.buf), segments, maxlen, num_threads);
+        } catch (...) {
+            // Reported once we hold the GIL again
+            error = std::current_exception();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (error) {
+            delete lut;
+            std::rethrow_exception(error);
+        }
+
+        delete self->lut;
+        self->lut = lut;
+        ret = 0;
+    } catch (...) {
+        set_python_error();
+    }
+
+out:
+    Py_XDECREF(seq);
+    PyBuffer_Release(&data);
+    return ret;
+}
+
+bool check_initialized(ReverseLUTObject *self)
+{
+    if (self->lut == nullptr) {
+        PyErr_SetString(PyExc_RuntimeError, "ReverseLUT is not initialized");
+        return false;
+    }
+
+    return true;
+}
+
+Py_ssize_t ReverseLUT_len(ReverseLUTObject *self)
+{
+    if (!check_initialized(self)) {
+        return -1;
+    }
+
+    return static_cast<Py_ssize_t>(self->lut->size());
+}
+
+PyObject *ReverseLUT_getitem(ReverseLUTObject *self, PyObject *key)
+{
+    uint32_t crc;
+    Location location;
+
+    if (!check_initialized(self)) {
+        return nullptr;
+    }
+
+    if (!parse_crc32(key, crc)) {
+        if (PyErr_ExceptionMatches(PyExc_OverflowError)) {
+            PyErr_SetObject(PyExc_KeyError, key);
+        }
+        return nullptr;
+    }
+
+    if (!self->lut->lookup(crc, location)) {
+        PyErr_SetObject(PyExc_KeyError, key);
+        return nullptr;
+    }
+
+    return location_tuple(location);
+}
+
+int ReverseLUT_contains(ReverseLUTObject *self, PyObject *key)
+{
+    uint32_t crc;
+    Location location;
+
+    if (!check_initialized(self)) {
+        return -1;
+    }
+
+    if (!parse_crc32(key, crc)) {
+        if (PyErr_ExceptionMatches(PyExc_OverflowError)) {
+            PyErr_Clear();
+            return 0;
+        }
+        return -1;
+    }
+
+    return self->lut->lookup(crc, location) ? 1 : 0;
+}
+
+PyDoc_STRVAR(ReverseLUT_find_doc,
+"find(target, max_iterations) -> (offset, length, iterations) or None\n\n"
+"Search for a sequence of up to *max_iterations* CRC32 operations that\n"
+"produces the CRC32 value *target*.");
+
+PyObject *ReverseLUT_find(ReverseLUTObject *self, PyObject *args)
+{
+    PyObject *target_obj;
+    unsigned int max_iterations;
+    uint32_t target;
+
+    if (!check_initialized(self)) {
+        return nullptr;
+    }
+
+    if (!PyArg_ParseTuple(args, "OI", &target_obj, &max_iterations) ||
+            !parse_crc32(target_obj, target)) {
+        return nullptr;
+    }
+
+    return result_tuple(self->lut->find(target, max_iterations));
+}
+
+PyDoc_STRVAR(ReverseLUT_find_all_doc,
+"find_all(targets, max_iterations, num_threads=0) -> list\n\n"
+"Perform find() for each CRC32 value in *targets*, using up to *num_threads*\n"
+"threads (default: CPU count). Results are returned in the order of *targets*.");
+
+PyObject *ReverseLUT_find_all(ReverseLUTObject *self, PyObject *args, PyObject *kwargs)
+{
+    static const char *kwlist[] = { "targets", "max_iterations", "num_threads", nullptr };
+
+    PyObject *target_seq;
+    unsigned int max_iterations;
+    int requested_threads = 0;
+    unsigned int num_threads;
+
+    if (!check_initialized(self)) {
+        return nullptr;
+    }
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OI|i", const_cast<char **>(kwlist),
+                                     &target_seq, &max_iterations, &requested_threads) ||
+            !parse_thread_count(requested_threads, num_threads)) {
+        return nullptr;
+    }
+
+    PyObject *seq = PySequence_Fast(target_seq, "targets must be a sequence of integers");
+    if (seq == nullptr) {
+        return nullptr;
+    }
+
+    const Py_ssize_t n = PySequence_Fast_GET_SIZE(seq);
+    PyObject *ret = nullptr;
+
+    try {
+        std::vector<uint32_t> targets(n);
+        std::vector<Result> results(n);
+        std::exception_ptr error;
+
+        for (Py_ssize_t i = 0; i < n; i++) {
+            if (!parse_crc32(PySequence_Fast_GET_ITEM(seq, i), targets[i])) {
+                Py_DECREF(seq);
+                return nullptr;
+            }
+        }
+
+        const ReverseLUT *lut = self->lut;
+
+        Py_BEGIN_ALLOW_THREADS
+        try {
+            parallel_for(targets.size(), num_threads, [&](size_t i) {
+                results[i] = lut->find(targets[i], max_iterations);
+            });
+        } catch (...) {
+            // Reported once we hold the GIL again
+            error = std::current_exception();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        ret = PyList_New(n);
+        for (Py_ssize_t i = 0; ret != nullptr && i < n; i++) {
+            PyObject *item = result_tuple(results[i]);
+            if (item == nullptr) {
+                Py_CLEAR(ret);
+                break;
+            }
+            PyList_SET_ITEM(ret, i, item);
+        }
+    } catch (...) {
+        set_python_error();
+        Py_CLEAR(ret);
+    }
+
+    Py_DECREF(seq);
+    return ret;
+}
+
+PyMethodDef ReverseLUT_methods[] = {
+    { "find", reinterpret_cast<PyCFunction>(ReverseLUT_find),
+      METH_VARARGS, ReverseLUT_find_doc },
+
+    { "find_all", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(ReverseLUT_find_all)),
+      METH_VARARGS | METH_KEYWORDS, ReverseLUT_find_all_doc },
+
+    { nullptr, nullptr, 0, nullptr }
+};
+
+PyMappingMethods ReverseLUT_as_mapping;
+PySequenceMethods ReverseLUT_as_sequence;
+
+PyDoc_STRVAR(ReverseLUT_doc,
+"ReverseLUT(data, segments, maxlen, num_threads=0)\n\n"
+"Reverse CRC32 lookup table mapping each CRC32 value produced by an operation\n"
+"of 1 to *maxlen* bytes over *data* to the (offset, length) of the shortest\n"
+"such operation. Operations begin within, and do not extend beyond, each of\n"
+"the (start, stop) offset ranges in *segments*.\n\n"
+"The table is constructed using up to *num_threads* threads (default: CPU count).");
+
+PyTypeObject ReverseLUTType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+PyDoc_STRVAR(module_doc,
+"Native reverse CRC32 lookup table and search used by ReverseCRC32Hunter.\n"
+"Not part of the Depthcharge API; subject to change.");
+
+PyModuleDef revcrc32_module = {
+    PyModuleDef_HEAD_INIT,
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit__revcrc32(void)
+{
+    init_crc32_table();
+
+    ReverseLUT_as_mapping.mp_length     = reinterpret_cast<lenfunc>(ReverseLUT_len);
+    ReverseLUT_as_mapping.mp_subscript  = reinterpret_cast<binaryfunc>(ReverseLUT_getitem);
+
+    ReverseLUT_as_sequence.sq_length    = reinterpret_cast<lenfunc>(ReverseLUT_len);
+    ReverseLUT_as_sequence.sq_contains  = reinterpret_cast<objobjproc>(ReverseLUT_contains);
+
+    ReverseLUTType.tp_name          = "depthcharge.hunter._revcrc32.ReverseLUT";
+    ReverseLUTType.tp_basicsize     = sizeof(ReverseLUTObject);
+    ReverseLUTType.tp_flags         = Py_TPFLAGS_DEFAULT;
+    ReverseLUTType.tp_doc           = ReverseLUT_doc;
+    ReverseLUTType.tp_new           = ReverseLUT_new;
+    ReverseLUTType.tp_init          = reinterpret_cast<initproc>(ReverseLUT_init);
+    ReverseLUTType.tp_dealloc       = reinterpret_cast<destructor>(ReverseLUT_dealloc);
+    ReverseLUTType.tp_methods       = ReverseLUT_methods;
+    ReverseLUTType.tp_as_mapping    = &ReverseLUT_as_mapping;
+    ReverseLUTType.tp_as_sequence   = &ReverseLUT_as_sequence;
+
+    revcrc32_module.m_name  = "depthcharge.hunter._revcrc32";
+    revcrc32_module.m_doc   = module_doc;
+    revcrc32_module.m_size  = -1;
+
+    if (PyType_Ready(&ReverseLUTType) < 0) {
+        return nullptr;
+    }
+
+    PyObject *module = PyModule_Create(&revcrc32_module);
+    if (module == nullptr) {
+        return nullptr;
+    }
+
+    Py_INCREF(&ReverseLUTType);
+    if (PyModule_AddObject(module, "ReverseLUT", reinterpret_cast<PyObject *>(&ReverseLUTType)) < 0) {
+        Py_DECREF(&ReverseLUTType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+
+    return module;
+}
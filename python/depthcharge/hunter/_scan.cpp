@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Depthcharge: <https://github.com/nccgroup/depthcharge>
+//
+// Optional native multi-pattern scanner used by depthcharge.hunter.scan.
+//
+// All patterns are located in a single pass over the data. Candidate
+// locations are identified, 16 bytes at a time, by comparing against the
+// first two bytes of each pattern using SSE2 (x86-64) or NEON (AArch64)
+// instructions. Each candidate is then verified against the patterns
+// beginning with its first byte.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <vector>
+
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#   define HAVE_SIMD_SCAN 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#   include <arm_neon.h>
+#   define HAVE_SIMD_SCAN 1
+#endif
+
+namespace {
+
+// Beyond this number of distinct leading byte pairs, a table-driven scan is used
+const size_t MAX_SIMD_ANCHORS = 8;
+
+const size_t BLOCK_SIZE = 16;
+
+struct Pattern {
+    const uint8_t *data;
+    size_t len;
+    size_t alignment;
+};
+
+struct Match {
+    size_t offset;
+    uint32_t index;
+};
+
+// Leading byte(s) of a pattern. Single-byte patterns only use the first.
+struct Anchor {
+    uint8_t first;
+    uint8_t second;
+    bool single;
+};
+
+class Scanner {
+public:
+    explicit Scanner(const std::vector<Pattern> &patterns) :
+        m_patterns(patterns)
+    {
+        for (uint32_t i = 0; i < m_patterns.size(); i++) {
+            const Pattern &p = m_patterns[i];
+            m_by_first[p.data[0]].push_back(i);
+
+            Anchor anchor;
+            anchor.first  = p.data[0];
+            anchor.second = (p.len > 1) ? p.data[1] : 0;
+            anchor.single = (p.len == 1);
+            add_anchor(anchor);
+        }
+    }
+
+    void scan(const uint8_t *data, size_t start, size_t end, std::vector<Match> &matches) const
+    {
+        size_t i = start;
+
+#if defined(HAVE_SIMD_SCAN)
+        if (m_anchors.size() <= MAX_SIMD_ANCHORS) {
+            // Each block also reads the byte following it
+            for (; i + BLOCK_SIZE + 1 <= end; i += BLOCK_SIZE) {
+                uint32_t mask = candidate_mask(data + i);
+                while (mask != 0) {
+                    const unsigned int bit = __builtin_ctz(mask);
+                    verify(data, i + bit, end, matches);
+                    mask &= mask - 1;
+                }
+            }
+        }
+#endif
+
+        for (; i < end; i++) {
+            if (!m_by_first[data[i]].empty()) {
+                verify(data, i, end, matches);
+            }
+        }
+    }
+
+private:
+    void add_anchor(const Anchor &anchor)
+    {
+        for (const auto &a : m_anchors) {
+            if (a.first == anchor.first && a.single == anchor.single &&
+                    (a.single || a.second == anchor.second)) {
+                return;
+            }
+        }
+
+        m_anchors.push_back(anchor);
+    }
+
+    void verify(const uint8_t *data, size_t offset, size_t end, std::vector<Match> &matches) const
+    {
+        for (uint32_t index : m_by_first[data[offset]]) {
+            const Pattern &p = m_patterns[index];
+
+            if ((offset % p.alignment) == 0 && p.len <= (end - offset) &&
+                    std::memcmp(data + offset, p.data, p.len) == 0) {
+                Match match;
+                match.offset = offset;
+                match.index  = index;
+                matches.push_back(match);
+            }
+        }
+    }
+
+#if defined(__SSE2__)
+    // Returns a bitmask of the positions within the 16-byte block at p that
+    // match the leading byte(s) of at least one pattern
+    uint32_t candidate_mask(const uint8_t *p) const
+    {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 1));
+        __m128i m = _mm_setzero_si128();
+
+        for (const auto &a : m_anchors) {
+            __m128i eq = _mm_cmpeq_epi8(v0, _mm_set1_epi8(static_cast<char>(a.first)));
+            if (!a.single) {
+                eq = _mm_and_si128(eq, _mm_cmpeq_epi8(v1, _mm_set1_epi8(static_cast<char>(a.second))));
+            }
+            m = _mm_or_si128(m, eq);
+        }
+
+        return static_cast<uint32_t>(_mm_movemask_epi8(m));
+    }
+#elif defined(HAVE_SIMD_SCAN)
+    uint32_t candidate_mask(const uint8_t *p) const
+    {
+        const uint8x16_t v0 = vld1q_u8(p);
+        const uint8x16_t v1 = vld1q_u8(p + 1);
+        uint8x16_t m = vdupq_n_u8(0);
+
+        for (const auto &a : m_anchors) {
+            uint8x16_t eq = vceqq_u8(v0, vdupq_n_u8(a.first));
+            if (!a.single) {
+                eq = vandq_u8(eq, vceqq_u8(v1, vdupq_n_u8(a.second)));
+            }
+            m = vorrq_u8(m, eq);
+        }
+
+        // Candidates are uncommon; only build a bitmask when there are any
+        if (vmaxvq_u8(m) == 0) {
+            return 0;
+        }
+
+        uint8_t lanes[BLOCK_SIZE];
+        vst1q_u8(lanes, m);
+
+        uint32_t mask = 0;
+        for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+            mask |= static_cast<uint32_t>(lanes[i] & 1) << i;
+        }
+
+        return mask;
+    }
+#endif
+
+    const std::vector<Pattern> &m_patterns;
+    std::vector<Anchor> m_anchors;
+
+    // Indices of patterns, by their first byte
+    std::vector<uint32_t> m_by_first[256];
+};
+
+PyDoc_STRVAR(find_patterns_doc,
+"find_patterns(data, patterns, alignments, start, end) -> list\n\n"
+"Search data[start:end] for each of the bytes in *patterns*, in a single pass,\n"
+"and return a sorted list of (offset, pattern index) tuples. Matches of each\n"
+"pattern are only reported at offsets that are a multiple of the corresponding\n"
+"entry in *alignments*. *data* may be any object supporting the buffer protocol.");
+
+PyObject *find_patterns(PyObject *, PyObject *args)
+{
+    Py_buffer data;
+    PyObject *pattern_seq;
+    PyObject *alignment_seq;
+    Py_ssize_t start, end;
+
+    if (!PyArg_ParseTuple(args, "y*OOnn", &data, &pattern_seq, &alignment_seq, &start, &end)) {
+        return nullptr;
+    }
+
+    PyObject *patterns_fast = nullptr;
+    PyObject *alignments_fast = nullptr;
+    PyObject *ret = nullptr;
+    std::vector<Pattern> patterns;
+    std::vector<Match> matches;
+    Py_ssize_t n;
+
+    if (start < 0 || end < start || end > data.len) {
+        PyErr_Format(PyExc_ValueError, "Invalid search range: [%zd, %zd)", start, end);
+        goto out;
+    }
+
+    patterns_fast = PySequence_Fast(pattern_seq, "patterns must be a sequence of bytes");
+    if (patterns_fast == nullptr) {
+        goto out;
+    }
+
+    alignments_fast = PySequence_Fast(alignment_seq, "alignments must be a sequence of integers");
+    if (alignments_fast == nullptr) {
+        goto out;
+    }
+
+    n = PySequence_Fast_GET_SIZE(patterns_fast);
+    if (PySequence_Fast_GET_SIZE(alignments_fast) != n) {
+        PyErr_SetString(PyExc_ValueError, "Expected one alignment per pattern");
+        goto out;
+    }
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(patterns_fast, i);
+        if (!PyBytes_Check(item) || PyBytes_GET_SIZE(item) == 0) {
+            PyErr_SetString(PyExc_ValueError, "Patterns must be non-empty bytes");
+            goto out;
+        }
+
+        const Py_ssize_t alignment = PyLong_AsSsize_t(PySequence_Fast_GET_ITEM(alignments_fast, i));
+        if (alignment == -1 && PyErr_Occurred()) {
+            goto out;
+        }
+
+        if (alignment < 1) {
+            PyErr_SetString(PyExc_ValueError, "Alignment must be >= 1");
+            goto out;
+        }
+
+        // The pattern objects remain referenced by patterns_fast
+        Pattern pattern;
+        pattern.data      = reinterpret_cast<const uint8_t *>(PyBytes_AS_STRING(item));
+        pattern.len       = static_cast<size_t>(PyBytes_GET_SIZE(item));
+        pattern.alignment = static_cast<size_t>(alignment);
+        patterns.push_back(pattern);
+    }
+
+    try {
+        std::exception_ptr error;
+
+        if (!patterns.empty()) {
+            const Scanner scanner(patterns);
+
+            Py_BEGIN_ALLOW_THREADS
+            try {
+                scanner.scan(static_cast<const uint8_t *>(data.buf),
+                             static_cast<size_t>(start), static_cast<size_t>(end), matches);
+            } catch (...) {
+                // Reported once we hold the GIL again
+                error = std::current_exception();
+            }
+            Py_END_ALLOW_THREADS
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::bad_alloc &) {
+        PyErr_NoMemory();
+        goto out;
+    } catch (...) {
+        PyErr_SetString(PyExc_RuntimeError, "Unexpected error in native pattern scan");
+        goto out;
+    }
+
+    ret = PyList_New(static_cast<Py_ssize_t>(matches.size()));
+    for (size_t i = 0; ret != nullptr && i < matches.size(); i++) {
+        PyObject *item = Py_BuildValue("(nI)", static_cast<Py_ssize_t>(matches[i].offset),
+                                       matches[i].index);
+        if (item == nullptr) {
+            Py_CLEAR(ret);
+            break;
+        }
+        PyList_SET_ITEM(ret, static_cast<Py_ssize_t>(i), item);
+    }
+
+out:
+    Py_XDECREF(alignments_fast);
+    Py_XDECREF(patterns_fast);
+    PyBuffer_Release(&data);
+    return ret;
+}
+
+PyMethodDef scan_methods[] = {
+    { "find_patterns", find_patterns, METH_VARARGS, find_patterns_doc },
+    { nullptr, nullptr, 0, nullptr }
+};
+
+PyDoc_STRVAR(module_doc,
+"Native multi-pattern scanner used by depthcharge.hunter.scan.\n"
+"Not part of the Depthcharge API; subject to change.");
+
+PyModuleDef scan_module = {
+    PyModuleDef_HEAD_INIT,
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit__scan(void)
+{
+    scan_module.m_name      = "depthcharge.hunter._scan";
+    scan_module.m_doc       = module_doc;
+    scan_module.m_size      = -1;
+    scan_module.m_methods   = scan_methods;
+
+    return PyModule_Create(&scan_module);
+}
@@ -16,7 +16,8 @@ class ConstantHunter(Hunter):
     interest.
 
     Its constructor and methods are implemented according to the descriptions in
-    :py:class:`.Hunter`.
+    :py:class:`.Hunter`. The *patterns* argument must be provided to :py:meth:`~.Hunter.prefilter()`,
+    and will usually consist of the target value itself.
     """
 
     def _search_at(self, target, start, end, **_kwargs):
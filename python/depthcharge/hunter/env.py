@@ -30,8 +30,14 @@ class EnvironmentHunter(Hunter):
     * *min_entries* (default: 5)
     * *max_entries* (default: ``None``)
 
+    When used with :py:meth:`~.Hunter.prefilter()`, the target is searched for a few
+    variable definitions that are present in nearly all environments, and 64 KiB
+    on either side of these are retrieved by default.
     """
 
+    _prefilter_patterns = [b'bootdelay=', b'baudrate=', b'bootcmd=']
+    _prefilter_window = (64 * 1024, 64 * 1024)
+
     def __init__(self, data: bytes, address: int, start_offset=-1, end_offset=-1, gaps=None, **kwargs):
         super().__init__(data, address, start_offset, end_offset, gaps, **kwargs)
 
@@ -110,7 +116,7 @@ class EnvironmentHunter(Hunter):
 
     def _search_at(self, target, start, end, **kwargs):
 
-        match = self._env.search(self._data[start:end])
+        match = self._env.search(self._data, start, end)
         if not match:
             raise HunterResultNotFound()
 
@@ -124,7 +130,7 @@ class EnvironmentHunter(Hunter):
         #        the size of the env_t structure changes on us by one byte.
 
         span = match.span()
-        offset = start + span[0]
+        offset = span[0]
         size = span[1] - span[0]
 
         # struct environment_s (env_t) has a char flags field only
@@ -23,8 +23,15 @@ class FDTHunter(Hunter):
 
     If the Device Tree Compiler (dtc) is installed, results will include both the binary
     representation of the device tree (dtb) as well as a source representation (dts).
+
+    When used with :py:meth:`~.Hunter.prefilter()`, up to 128 KiB following each
+    FDT magic value is retrieved by default.
     """
 
+    _prefilter_patterns = [b'\xd0\x0d\xfe\xed']
+    _prefilter_window = (0, 128 * 1024)
+    _prefilter_alignment = 4
+
     def __init__(self, data: bytes, address: int, start_offset=-1, end_offset=-1, gaps=None, **kwargs):
         super().__init__(data, address, start_offset, end_offset, gaps, **kwargs)
 
@@ -45,7 +52,8 @@ class FDTHunter(Hunter):
             b'(?P<last_comp_version>.{4})' +
             b'(?P<boot_cpuid_phys>.{4})' +
             b'(?P<size_dt_strings>.{4})' +
-            b'(?P<size_dt_struct>.{4})'
+            b'(?P<size_dt_struct>.{4})',
+            re.DOTALL
         )
 
     def _device_tree(self, match, offset, end):
@@ -132,10 +140,9 @@ class FDTHunter(Hunter):
     def _search_at(self, target, start, end, **kwargs):
         match = True
         while match is not None and start < end:
-            match = self._regex.search(self._data[start:end])
+            match = self._regex.search(self._data, start, end)
             if match:
-                span = match.span()
-                offset = start + span[0]
+                offset = match.start()
 
                 dtb = self._device_tree(match, offset, end)
                 if dtb:
@@ -159,6 +166,6 @@ class FDTHunter(Hunter):
 
                 # We had a false positive or an invalid FDT.
                 # Skip past its "magic" word so we can continue our search.
-                start += offset + 4
+                start = offset + 4
 
         raise HunterResultNotFound()
@@ -23,6 +23,26 @@ class HunterResultNotFound(Exception):
     """
 
 
+def _coalesce_windows(matches, before: int, after: int, lower: int, upper: int) -> list:
+    """
+    Not part of the Depthcharge API - do not use external to this package.
+
+    Coalesce the overlapping windows surrounding each of the (sorted) *(position, index)*
+    entries in *matches* into a list of [start, end) regions, bounded by [lower, upper).
+    """
+    regions = []
+    for position, _ in matches:
+        start = max(lower, position - before)
+        end   = min(upper, position + after)
+
+        if regions and start <= regions[-1][1]:
+            regions[-1][1] = max(regions[-1][1], end)
+        else:
+            regions.append([start, end])
+
+    return regions
+
+
 class _GappedRangeIter:
     """
     Not part of the Depthcharge API - do not use external to this file.
@@ -113,6 +133,13 @@ class Hunter:
     # for use in search progress status updates
     _target_desc = None
 
+    # Subclasses may define these to support prefilter(). The patterns are
+    # values indicative of a search target, and the window denotes the number
+    # of bytes (before, after) the start of a pattern match to retrieve.
+    _prefilter_patterns = None
+    _prefilter_window = (0, 0)
+    _prefilter_alignment = 1
+
     def _describe_search(self, start, **_kwargs):
         address = self._address + start
 
@@ -185,6 +212,61 @@ class Hunter:
         # See _init_progress() and _deinit_progress()
         self._progress = None
 
+    @classmethod
+    def prefilter(cls, ctx, address: int, size: int, patterns=None, window=None, alignment=None,
+                  **kwargs) -> list:
+        """
+        Rather than reading an entire memory region to the host before searching it, use
+        :py:meth:`Depthcharge.find_patterns() <depthcharge.Depthcharge.find_patterns>` to
+        search *size* bytes at *address* on the target for values indicative of this Hunter's
+        search target. Only the memory surrounding each match is then read, and a list of
+        Hunter instances is returned, one for each (coalesced) region.
+
+        The *patterns* argument is a ``list`` of ``bytes`` values to search for. The *window*
+        argument is a *(before, after)* tuple that specifies how many bytes before and after
+        the start of each match should be read. Target memory is only checked for matches
+        at multiples of *alignment* bytes from *address*. If these are not specified,
+        Hunter-specific defaults are used, where available. (Note that some Hunters, such
+        as the :py:class:`~depthcharge.hunter.ConstantHunter`, require that *patterns*
+        be specified.)
+
+        Any additional keyword arguments are passed to both :py:meth:`Depthcharge.read_memory()
+        <depthcharge.Depthcharge.read_memory>` and the Hunter's constructor.
+
+        **Example:**
+
+        .. code:: python
+
+            for hunter in FDTHunter.prefilter(ctx, 0x8000_0000, 256 * 1024 * 1024):
+                for result in hunter.finditer(None):
+                    print('Found DTB @ 0x{:08x}'.format(result['src_addr']))
+
+        """
+        patterns = patterns or cls._prefilter_patterns
+        if not patterns:
+            msg = '{:s} requires that prefilter patterns be specified'
+            raise ValueError(msg.format(cls.__name__))
+
+        if window is None:
+            window = cls._prefilter_window
+
+        # Always retrieve at least the matched data
+        before = window[0]
+        after  = max(window[1], max(len(p) for p in patterns))
+
+        if alignment is None:
+            alignment = cls._prefilter_alignment
+
+        matches = ctx.find_patterns(address, size, patterns, alignment)
+        regions = _coalesce_windows(matches, before, after, address, address + size)
+
+        ret = []
+        for start, end in regions:
+            data = ctx.read_memory(start, end - start, **kwargs)
+            ret.append(cls(data, start, **kwargs))
+
+        return ret
+
     def _gapped_range_iter(self, target, start=-1, end=-1):
         """
         Non-API internal method; subject to change.
@@ -317,7 +399,7 @@ class Hunter:
                 # Ends within gap
                 return True
 
-            if offset <= gap.start and end_offset >= (gap.stop - 11):
+            if offset <= gap.start and end_offset >= (gap.stop - 1):
                 # Passes through gap
                 return True
 
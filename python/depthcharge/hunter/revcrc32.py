@@ -20,6 +20,11 @@ from ..progress import Progress
 from ..revcrc32 import reverse_crc32_4bytes
 from ..stratagem import Stratagem, StratagemCreationFailed
 
+try:
+    from ._revcrc32 import ReverseLUT as _NativeReverseLUT
+except ImportError:
+    _NativeReverseLUT = None
+
 
 class ReverseCRC32Hunter(Hunter):
     """
@@ -36,7 +41,7 @@ class ReverseCRC32Hunter(Hunter):
     **Constructor**
 
     The constructor conforms the :py:class:`~depthcharge.hunter.Hunter` definition and
-    supports two additional keyword arguments.
+    supports three additional keyword arguments.
 
     The *endianness* keyword argument specifies the byte order of the target
     device. It defaults to ``sys.byteorder``, which may not match your target. It
@@ -51,6 +56,12 @@ class ReverseCRC32Hunter(Hunter):
     *data*. Continue reading to get a better understanding of what exactly this
     parameter controls.
 
+    The *native* keyword argument controls whether Depthcharge's optional native extension
+    is used to construct the RLUT and perform searches, if the extension was built when
+    Depthcharge was installed. This is substantially faster and requires far less host memory.
+    It defaults to ``True``. Specify *native=False* to use the pure-Python implementation
+    instead. The results produced by both are identical.
+
 
     **Implementation Details**
 
@@ -120,7 +131,8 @@ class ReverseCRC32Hunter(Hunter):
     to exclude memory regions as needed. Under these assumptions, each 4-byte word in the produced
     output can be computed in parallel.  Depthcharge uses Python's ``multiprocessing`` module
     to distribute tasks to multiple workers, with a default worker count equal to the system's
-    CPU count.
+    CPU count. When the native extension is used, RLUT construction and these searches are
+    instead performed by native threads that share a single RLUT.
 
     Finally, one additional optimization is used to reduce the total number of CRC32 operations
     that the need to be performed on a target device at runtime. Envision a case where a 4-byte
@@ -210,6 +222,9 @@ class ReverseCRC32Hunter(Hunter):
         # Just for error reporting later
         self._revlut_maxlen = revlut_maxlen
 
+        # Use the native RLUT implementation, if it's available
+        self._native = kwargs.get('native', True) and _NativeReverseLUT is not None
+
         # Range of CRC32 operation sizes we'll include in our reverse LUT
         self._revlut_range = list(range(1, revlut_maxlen + 1))
 
@@ -224,6 +239,10 @@ class ReverseCRC32Hunter(Hunter):
     # the interest of reducing redundant CRC32 computations. This is achieved
     # through the use of zlib.crc32()'s second `value` argument.
     def _build_revlut(self):
+        if self._native:
+            self._build_native_revlut()
+            return
+
         self._revlut = {}
 
         progress = Progress.create(len(self._data_range), desc='Creating Reverse CRC32 LUTs')
@@ -259,6 +278,28 @@ class ReverseCRC32Hunter(Hunter):
 
         progress.close()
 
+    # The native RLUT is equivalent to the above, given the data offset ranges
+    # (excluding gaps) from which operations may be performed.
+    def _build_native_revlut(self):
+        start = self._data_range.start
+        stop  = self._data_range.stop
+
+        segments = []
+        for segment in self._split_data_offsets():
+            seg_start = max(segment.start, start)
+            seg_stop  = min(segment.stop, stop)
+            if seg_start < seg_stop:
+                segments.append((seg_start, seg_stop))
+
+        log.note('Creating Reverse CRC32 LUT')
+        self._revlut = _NativeReverseLUT(self._data, segments, self._revlut_maxlen)
+        log.debug('Reverse CRC32 LUT contains {:d} entries'.format(len(self._revlut)))
+
+    def _not_found_msg(self, target, iterations) -> str:
+        msg  = 'No results for target=0x{:08x}, revlut_maxlen={:d} after {:d} iterations. '
+        msg += 'Try increasing revlut_maxlen and/or max_iterations.'
+        return msg.format(target, self._revlut_maxlen, iterations)
+
     def find(self, target, start=-1, end=-1, **kwargs) -> dict:
         """
         Search for a sequence of CRC32 operations, performed over the *data* provided to the
@@ -303,6 +344,20 @@ class ReverseCRC32Hunter(Hunter):
             err = 'Target CRC32 output must be an int or bytes, got {:s}'
             raise TypeError(err.format(type(target).__name__))
 
+        if self._native:
+            result = self._revlut.find(target, max_iterations)
+            if result is None:
+                raise HunterResultNotFound(self._not_found_msg(target, max_iterations))
+
+            (offset, length, iterations) = result
+
+            return {
+                'src_off': offset,
+                'src_addr': self._address + offset,
+                'src_size': length,
+                'iterations': iterations,
+            }
+
         for curr_iter in range(1, max_iterations + 1):
             result = self._do_search(target, start, end, curr_iter, max_iterations)
             if isinstance(result, dict):
@@ -310,9 +365,7 @@ class ReverseCRC32Hunter(Hunter):
 
             target = result
 
-        err  = 'No results for target=0x{:08x}, revlut_maxlen={:d} after {:d} iterations. '
-        err += 'Try increasing revlut_maxlen and/or max_iterations.'
-        raise HunterResultNotFound(err.format(target, self._revlut_maxlen, curr_iter))
+        raise HunterResultNotFound(self._not_found_msg(target, curr_iter))
 
     def _do_search(self, target, _start, _end, curr_iter, _max_iterations):
         try:
@@ -357,7 +410,7 @@ class ReverseCRC32Hunter(Hunter):
         * *max_iterations* - Maximum number of CRC32 operations to allow per 4-byte word.
           Default: 4096
 
-        * *num_procs* - Number of concurrent processes to use during search.
+        * *num_procs* - Number of concurrent processes (or native threads) to use during search.
           Default: System's CPU count
 
 
@@ -402,6 +455,53 @@ class ReverseCRC32Hunter(Hunter):
         crc32_writer = import_module('..memory.crc32', 'depthcharge.memory')
         stratagem = Stratagem(crc32_writer.CRC32MemoryWriter)
 
+        if self._native:
+            self._native_stratagem_work(stratagem, workload, max_iterations, num_procs, progress)
+        else:
+            self._pool_stratagem_work(stratagem, workload, start, end,
+                                      max_iterations, num_procs, progress)
+
+        progress.close()
+
+        n_entries = len(stratagem)
+        iterations = [entry['iterations'] for entry in stratagem]
+        total_ops = sum(iterations)
+        max_iter = max(iterations)
+
+        t_stop = datetime.now()
+        t_elapsed = t_stop - t_start
+
+        msg = 'CRC32Writer Stratagem created{:s} in {:s}\n\t'
+        msg += '{:d} entries, {:d} total operations, largest operation is {:d} iterations'
+        payload_name = ' from ' + kwargs.get('payload_name') if 'payload_name' in kwargs else ''
+        msg = msg.format(payload_name, str(t_elapsed), n_entries, total_ops, max_iter)
+        log.note(msg)
+
+        stratagem.comment = msg
+        return stratagem
+
+    def _native_stratagem_work(self, stratagem, workload, max_iterations, num_threads, progress):
+        words = list(workload.keys())
+        targets = [int.from_bytes(word, self._endianness) for word in words]
+
+        results = self._revlut.find_all(targets, max_iterations, num_threads)
+
+        for word, target, result in zip(words, targets, results):
+            if result is None:
+                raise HunterResultNotFound(self._not_found_msg(target, max_iterations))
+
+            entry = {
+                'src_addr': self._address + result[0],
+                'src_size': result[1],
+                'iterations': result[2],
+            }
+
+            self._append_stratagem_entries(stratagem, workload[word], entry)
+            progress.update(1)
+
+    def _pool_stratagem_work(self, stratagem, workload, start, end, max_iterations, num_procs, progress):
+        total_workload = len(workload)
+
         with multiprocessing.Manager() as manager:
             results = manager.Queue()
             dbg_msg = 'Posted work for dst_off={:s}, max_iterations={:d}'
@@ -440,92 +540,82 @@ class ReverseCRC32Hunter(Hunter):
                     # This is not part of the CRC32Writer Stratagem spec.
                     del entry['src_off']
 
-                    if len(dst_offsets) == 1:
-                        # Target word occurs once in our payload.
-                        # Nothing special to do here.
-                        entry['dst_off'] = dst_offsets[0]
-                        stratagem.append(entry)
-
-                    elif entry['iterations'] == 1:
-                        # Easily handled special case: word occurs multiple time
-                        # in target payload, but there's only 1 iteration.
-                        # Just update the destination offset.
-                        for dst_offset in dst_offsets:
-                            e = copy(entry)
-                            e['dst_off'] = dst_offset
-                            stratagem.append(e)
-                    else:
-                        # Otherwise, we have multiple occurrences of the same word
-                        # in our payload, for which we have an optimization.
-                        #
-                        # The naive implementation here is to simply do what
-                        # we did above, but that means we'd burn a lot of time
-                        # performing unnecessary CRC32 operations when writing
-                        # to a target device (over a slow serial port).
-                        #
-                        # We can significantly reduce the number of
-                        # deployment-time operations here.
-                        #
-                        # Consider a word value `w` that occurs multiple times
-                        # in the target payload at address `A`, `B`, `C`, ...
-                        #
-                        # Instead of performing N iterations of CRC32 every
-                        # time we want to write to a target offset, we can
-                        # instead perform N-1 operations for the first
-                        # occurrence of `w`, whose output is located at some
-                        # address `A`.
-                        #
-                        # Then, for all other locations containing this
-                        # duplicate word (e.g. address `X`), we can perform just 1
-                        # CRC32 operation: *X = CRC32(*A)
-                        #
-                        # Finally, we perform the last iteration `A`:
-                        #   *A = CRC32(*A)
-                        #
-                        for i, dst_off in enumerate(dst_offsets):
-                            e = copy(entry)
-
-                            if i == 0:  # Perform N-1 iterations at first occurrence
-                                e['iterations'] -= 1
-                            else:       # Address `X`
-                                e['src_addr'] = -1
-                                e['tsrc_off'] = dst_offsets[0]
-                                e['src_size'] = 4
-                                e['iterations'] = 1
-
-                            e['dst_off'] = dst_off
-                            stratagem.append(e)
-
-                        # Finalize the result at our occurrence (`A`)
-                        e = copy(entry)
-                        e['src_addr'] = -1
-                        e['tsrc_off'] = dst_offsets[0]
-                        e['src_size'] = 4
-                        e['iterations'] = 1
-                        e['dst_off'] = dst_offsets[0]
-                        stratagem.append(e)
+                    self._append_stratagem_entries(stratagem, dst_offsets, entry)
 
                     results_gathered += 1
                     progress.update(1)
                 pool.join()
-        progress.close()
-
-        n_entries = len(stratagem)
-        iterations = [entry['iterations'] for entry in stratagem]
-        total_ops = sum(iterations)
-        max_iter = max(iterations)
-
-        t_stop = datetime.now()
-        t_elapsed = t_stop - t_start
-
-        msg = 'CRC32Writer Stratagem created{:s} in {:s}\n\t'
-        msg += '{:d} entries, {:d} total operations, largest operation is {:d} iterations'
-        payload_name = ' from ' + kwargs.get('payload_name') if 'payload_name' in kwargs else ''
-        msg = msg.format(payload_name, str(t_elapsed), n_entries, total_ops, max_iter)
-        log.note(msg)
 
-        stratagem.comment = msg
-        return stratagem
+    @staticmethod
+    def _append_stratagem_entries(stratagem, dst_offsets, entry):
+        """
+        Append the Stratagem entries required to write the word produced by *entry*
+        to each of the specified offsets within the target payload.
+        """
+        if len(dst_offsets) == 1:
+            # Target word occurs once in our payload.
+            # Nothing special to do here.
+            entry['dst_off'] = dst_offsets[0]
+            stratagem.append(entry)
+
+        elif entry['iterations'] == 1:
+            # Easily handled special case: word occurs multiple time
+            # in target payload, but there's only 1 iteration.
+            # Just update the destination offset.
+            for dst_offset in dst_offsets:
+                e = copy(entry)
+                e['dst_off'] = dst_offset
+                stratagem.append(e)
+        else:
+            # Otherwise, we have multiple occurrences of the same word
+            # in our payload, for which we have an optimization.
+            #
+            # The naive implementation here is to simply do what
+            # we did above, but that means we'd burn a lot of time
+            # performing unnecessary CRC32 operations when writing
+            # to a target device (over a slow serial port).
+            #
+            # We can significantly reduce the number of
+            # deployment-time operations here.
+            #
+            # Consider a word value `w` that occurs multiple times
+            # in the target payload at address `A`, `B`, `C`, ...
+            #
+            # Instead of performing N iterations of CRC32 every
+            # time we want to write to a target offset, we can
+            # instead perform N-1 operations for the first
+            # occurrence of `w`, whose output is located at some
+            # address `A`.
+            #
+            # Then, for all other locations containing this
+            # duplicate word (e.g. address `X`), we can perform just 1
+            # CRC32 operation: *X = CRC32(*A)
+            #
+            # Finally, we perform the last iteration `A`:
+            #   *A = CRC32(*A)
+            #
+            for i, dst_off in enumerate(dst_offsets):
+                e = copy(entry)
+
+                if i == 0:  # Perform N-1 iterations at first occurrence
+                    e['iterations'] -= 1
+                else:       # Address `X`
+                    e['src_addr'] = -1
+                    e['tsrc_off'] = dst_offsets[0]
+                    e['src_size'] = 4
+                    e['iterations'] = 1
+
+                e['dst_off'] = dst_off
+                stratagem.append(e)
+
+            # Finalize the result at our occurrence (`A`)
+            e = copy(entry)
+            e['src_addr'] = -1
+            e['tsrc_off'] = dst_offsets[0]
+            e['src_size'] = 4
+            e['iterations'] = 1
+            e['dst_off'] = dst_offsets[0]
+            stratagem.append(e)
 
     def _do_stratagem_work(self, target, offsets, start, end, max_iter, work_queue):
         try:
@@ -0,0 +1,149 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+"""
+Implements host-side prefiltering of flash and memory dumps for Hunters
+"""
+
+import mmap
+
+from .hunter import Hunter, _coalesce_windows
+from .. import log
+
+try:
+    from ._scan import find_patterns as _native_find_patterns
+except ImportError:
+    _native_find_patterns = None
+
+
+def find_patterns(data, patterns: list, alignment=1, start=0, end=-1) -> list:
+    """
+    Search *data* (e.g. ``bytes`` or an ``mmap`` object) for any of the specified byte *patterns*
+    and return a sorted list of *(offset, pattern index)* tuples.
+
+    This is the host-side counterpart to :py:meth:`Depthcharge.find_patterns()
+    <depthcharge.Depthcharge.find_patterns>`. Only offsets that are a multiple of *alignment*
+    bytes are checked. The *alignment* argument may also be a list, specifying the alignment of
+    each pattern. The search may be restricted to *data[start:end]*.
+
+    If Depthcharge's optional native extension is available, all patterns are located
+    in a single pass over the data. Otherwise, each pattern is searched for in turn.
+    """
+    if not patterns:
+        raise ValueError('At least one pattern must be specified')
+
+    if isinstance(alignment, int):
+        alignment = [alignment] * len(patterns)
+
+    if end < 0:
+        end = len(data)
+
+    if _native_find_patterns is not None:
+        return _native_find_patterns(data, patterns, alignment, start, end)
+
+    matches = []
+    for index, pattern in enumerate(patterns):
+        offset = data.find(pattern, start, end)
+        while offset >= 0:
+            if offset % alignment[index] == 0:
+                matches.append((offset, index))
+            offset = data.find(pattern, offset + 1, end)
+
+    return sorted(matches)
+
+
+def _prefilter_hunters() -> list:
+    ret = []
+    subclasses = Hunter.__subclasses__()
+    while subclasses:
+        cls = subclasses.pop(0)
+        if cls._prefilter_patterns:
+            ret.append(cls)
+        subclasses += cls.__subclasses__()
+
+    return ret
+
+
+def scan_image(image, address=0, hunters=None, **kwargs) -> dict:
+    """
+    Search a flash or memory dump for values indicative of multiple Hunters' search targets,
+    in a single pass, and return a dictionary that maps each Hunter class to a list of instances
+    of it. As with :py:meth:`Hunter.prefilter() <depthcharge.hunter.Hunter.prefilter>`, each
+    instance covers only the (coalesced) data surrounding the matches for that Hunter, and
+    its :py:meth:`~depthcharge.hunter.Hunter.find()` and
+    :py:meth:`~depthcharge.hunter.Hunter.finditer()` methods validate these candidates.
+
+    The *image* may either be the name of a file, which is memory-mapped rather than loaded
+    in its entirety, or a bytes-like object. The *address* argument specifies the address
+    corresponding to the start of *image*.
+
+    By default, every Hunter that defines prefilter patterns (e.g.
+    :py:class:`~depthcharge.hunter.EnvironmentHunter` and
+    :py:class:`~depthcharge.hunter.FDTHunter`) is included. A *hunters* list may be provided
+    instead. Its entries may be either Hunter classes or *(class, patterns)* tuples. The latter is
+    required for Hunters without default patterns, such as the
+    :py:class:`~depthcharge.hunter.ConstantHunter`. Hunters that do not search for byte patterns
+    (e.g. :py:class:`~depthcharge.hunter.StringHunter`) cannot be used with this function.
+
+    Any additional keyword arguments are passed to each Hunter's constructor.
+
+    **Example:**
+
+    .. code:: python
+
+        results = scan_image('flash_dump.bin', 0x0000_0000, arch='arm')
+
+        for hunter in results[FDTHunter]:
+            for result in hunter.finditer(None, no_dts=True):
+                print('Found DTB @ 0x{:08x}'.format(result['src_addr']))
+
+    """
+    if hunters is None:
+        hunters = _prefilter_hunters()
+
+    # Flattened list of all patterns, and the index of the Hunter each is associated with
+    patterns = []
+    alignments = []
+    owners = []
+    entries = []
+
+    for i, entry in enumerate(hunters):
+        (cls, cls_patterns) = entry if isinstance(entry, tuple) else (entry, entry._prefilter_patterns)
+        if not cls_patterns:
+            msg = '{:s} requires that prefilter patterns be specified'
+            raise ValueError(msg.format(cls.__name__))
+
+        entries.append((cls, cls_patterns))
+        for pattern in cls_patterns:
+            patterns.append(pattern)
+            alignments.append(cls._prefilter_alignment)
+            owners.append(i)
+
+    if isinstance(image, str):
+        with open(image, 'rb') as infile:
+            try:
+                data = mmap.mmap(infile.fileno(), 0, access=mmap.ACCESS_READ)
+            except ValueError:
+                # Empty file
+                data = b''
+    else:
+        data = image
+
+    try:
+        matches = find_patterns(data, patterns, alignments) if len(data) > 0 else []
+        log.debug('Found {:d} prefilter pattern matches'.format(len(matches)))
+
+        ret = {}
+        for i, (cls, cls_patterns) in enumerate(entries):
+            cls_matches = [(offset, index) for (offset, index) in matches if owners[index] == i]
+
+            before = cls._prefilter_window[0]
+            after  = max(cls._prefilter_window[1], max(len(p) for p in cls_patterns))
+
+            regions = _coalesce_windows(cls_matches, before, after, 0, len(data))
+            ret[cls] = [cls(data[start:end], address + start, **kwargs) for (start, end) in regions]
+
+        return ret
+
+    finally:
+        if isinstance(data, mmap.mmap):
+            data.close()
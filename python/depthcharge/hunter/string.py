@@ -57,9 +57,15 @@ class StringHunter(Hunter):
 
         match_only  = kwargs.get('match', False)
 
+        # User-supplied patterns may contain anchors or lookbehind assertions, which must
+        # only consider the data within the search range. Our default pattern contains
+        # neither, so it can be applied to the data in place rather than to a copy.
+        data, pos, endpos = self._data[start:end], 0, end - start
+
         if target is None or len(target) == 0:
             # Default to searching for (an optionally length-limited) string
             regexp = _str_regex(None, min_len, max_len)
+            data, pos, endpos = self._data, start, end
         elif isinstance(target, str):
             target = target.encode('ascii')
             regexp = _str_regex(pat=target)
@@ -71,17 +77,17 @@ class StringHunter(Hunter):
 
         if match_only:
             # Don't search starting here, match only at this location
-            m = regexp.match(self._data[start:end])
+            m = regexp.match(data, pos, endpos)
             if m is None:
                 return None
         else:
-            m = regexp.search(self._data[start:end])
+            m = regexp.search(data, pos, endpos)
             if m is None:
                 # We covered the full range in this case
                 raise HunterResultNotFound()
 
         found_offset, found_end_offset = m.span()
-        return (found_offset + start, found_end_offset - found_offset)
+        return (found_offset + start - pos, found_end_offset - found_offset)
 
     def string_at(self, address, min_len=-1, max_len=-1, allow_empty=False) -> str:
         """
@@ -27,7 +27,7 @@ or introduce new implementations atop of vendor-specific commands.
 
 from .cp            import CpCrashMemoryReader, CpMemoryWriter
 from .crc32         import CRC32MemoryReader, CRC32MemoryWriter
-from .go            import GoMemoryReader
+from .go            import GoMemoryReader, GoBlockMemoryReader, GoRLEMemoryReader, GoMemoryWriter
 from .i2c           import I2CMemoryReader, I2CMemoryWriter
 from .itest         import ItestMemoryReader
 from .load          import LoadbMemoryWriter, LoadxMemoryWriter, LoadyMemoryWriter
@@ -35,7 +35,10 @@ from .memcmds       import MdMemoryReader
 from .memcmds       import MmMemoryReader, MmMemoryWriter
 from .memcmds       import MwMemoryWriter
 from .memcmds       import NmMemoryReader, NmMemoryWriter
+from .resident      import CommandServer
+from .resident      import ResidentPayloadMemoryReader, ResidentPayloadMemoryWriter
 from .setexpr       import SetexprMemoryReader
+from .spi           import SPIMemoryReader, SPIMemoryWriter
 
 from .reader        import MemoryReader, MemoryWordReader
 from .data_abort    import DataAbortMemoryReader
@@ -0,0 +1,271 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+"""
+Implements the :py:class:`.MemoryCache` used by
+:py:meth:`Depthcharge.read_memory() <depthcharge.Depthcharge.read_memory>`
+"""
+
+import struct
+
+from bisect import bisect_right
+
+from .. import log
+
+
+class MemoryCache:
+    """
+    Address-keyed cache of previously read target memory.
+
+    Cached data is tracked as non-overlapping extents, such that a read only needs
+    to retrieve the portions of the requested region that are not already cached.
+    Reads larger than *max_read_size* bytes bypass the cache, as this is intended for
+    the small structures (e.g. *gd*, the jump table, the environment, and command tables)
+    that are repeatedly read by different operations.
+
+    The *identity* string describes the target that the cached data was read from.
+    When loaded from a file, via :py:meth:`load()`, previously cached data is discarded
+    if its identity does not match that of the current target. A cache may also be created
+with an *identity* of ``None`` before this is known, and be assigned one later via
+:py:meth:`bind()`.
+
+    This class is not usually used directly. Instead, provide a *read_cache* keyword
+    argument to the :py:class:`~depthcharge.Depthcharge` constructor.
+    """
+
+    _MAGIC = b'DCMC'
+
+    # Magic, identity length
+    _HEADER = struct.Struct('<4sI')
+
+    # Address, size
+    _EXTENT = struct.Struct('<QQ')
+
+    def __init__(self, identity, filename=None, max_read_size=1024 * 1024):
+        self.identity = identity
+        self.filename = filename
+        self.max_read_size = max_read_size
+
+        # Sorted extent start addresses, and the data at each
+        self._starts = []
+        self._data = {}
+
+        # (address, size) of invalidations performed before bind()
+        self._unbound_invalidations = []
+
+    @classmethod
+    def load(cls, filename: str, identity: str, **kwargs):
+        """
+        Create a :py:class:`.MemoryCache` from the contents of *filename*, previously
+        written by :py:meth:`save()`. An empty cache is returned if the file does not exist,
+        or was created for another target. In either case, later calls to :py:meth:`save()`
+        will write to *filename*.
+        """
+        cache = cls(identity, filename, **kwargs)
+
+        try:
+            with open(filename, 'rb') as infile:
+                (magic, id_len) = cls._HEADER.unpack(infile.read(cls._HEADER.size))
+                if magic != cls._MAGIC:
+                    raise ValueError('Invalid memory cache file: ' + filename)
+
+                if infile.read(id_len).decode('utf-8') != identity:
+                    log.note('Discarding memory cache created for different target state')
+                    return cache
+
+                while True:
+                    header = infile.read(cls._EXTENT.size)
+                    if not header:
+                        break
+
+                    (address, size) = cls._EXTENT.unpack(header)
+                    data = infile.read(size)
+                    if len(data) != size:
+                        raise ValueError('Truncated memory cache file: ' + filename)
+
+                    cache._insert(address, data)
+
+        except FileNotFoundError:
+            return cache
+
+        except (struct.error, UnicodeDecodeError, ValueError) as error:
+            log.warning('Discarding memory cache: ' + str(error))
+            return cls(identity, filename, **kwargs)
+
+        log.note('Loaded {:d} bytes of cached memory from {:s}'.format(cache.size, filename))
+        return cache
+
+    def bind(self, identity: str, filename=None):
+        """
+        Assign an *identity* to a cache created without one. If *filename* is specified,
+        previously cached data is first loaded from it, as per :py:meth:`load()`. Data
+        cached and invalidations performed by this object take precedence over the
+        file's contents.
+        """
+        if self.identity is not None:
+            raise ValueError('Memory cache identity has already been assigned')
+
+        if filename is not None:
+            loaded = self.load(filename, identity, max_read_size=self.max_read_size)
+
+            for (address, size) in self._unbound_invalidations:
+                loaded.invalidate(address, size)
+
+            for start in self._starts:
+                loaded._insert(start, self._data[start])
+
+            self._starts = loaded._starts
+            self._data = loaded._data
+            self.filename = filename
+
+        self.identity = identity
+        self._unbound_invalidations = []
+
+    def save(self, filename=None):
+        """
+        Write the cache contents to *filename*, or to the file that the cache was
+        created with if this is not specified.
+        """
+        filename = filename or self.filename
+        if filename is None:
+            raise ValueError('No memory cache filename specified')
+
+        if self.identity is None:
+            raise ValueError('Memory cache identity has not been assigned')
+
+        identity = self.identity.encode('utf-8')
+
+        with open(filename, 'wb') as outfile:
+            outfile.write(self._HEADER.pack(self._MAGIC, len(identity)))
+            outfile.write(identity)
+
+            for start in self._starts:
+                data = self._data[start]
+                outfile.write(self._EXTENT.pack(start, len(data)))
+                outfile.write(data)
+
+    @property
+    def size(self) -> int:
+        """
+        Total number of cached bytes
+        """
+        return sum(len(data) for data in self._data.values())
+
+    def read(self, address: int, size: int, read_fn, cached=True) -> bytes:
+        """
+        Return *size* bytes at *address*, using *read_fn(address, size)* to retrieve
+        any portions of this region that are not cached. If *cached=False*, the entire
+        region is read using *read_fn* and the cache is updated with the result.
+        """
+        if size > self.max_read_size:
+            return read_fn(address, size)
+
+        end = address + size
+        ret = bytearray(size)
+
+        # Copy cached data before reading anything, as reads may invalidate it
+        gaps = []
+        pos = address
+
+        if cached:
+            i = max(bisect_right(self._starts, address) - 1, 0)
+            while i < len(self._starts) and self._starts[i] < end:
+                start = self._starts[i]
+                data = self._data[start]
+                i += 1
+
+                if start + len(data) <= pos:
+                    continue
+
+                if start > pos:
+                    gaps.append((pos, start))
+                    pos = start
+
+                n = min(start + len(data), end) - pos
+                ret[pos - address:pos - address + n] = data[pos - start:pos - start + n]
+                pos += n
+
+        if pos < end:
+            gaps.append((pos, end))
+
+        if not gaps:
+            log.debug('Memory cache hit: 0x{:08x}, {:d} bytes'.format(address, size))
+
+        for (start, stop) in gaps:
+            ret[start - address:stop - address] = read_fn(start, stop - start)
+
+        ret = bytes(ret)
+        self._insert(address, ret)
+        return ret
+
+    def invalidate(self, address=None, size=None):
+        """
+        Discard cached data for the *size* bytes at *address*.
+        If these are not specified, all cached data is discarded.
+        """
+        if self.identity is None:
+            self._unbound_invalidations.append((address, size))
+
+        if address is None:
+            if self._starts:
+                log.debug('Invalidating memory cache')
+            self._starts = []
+            self._data = {}
+            return
+
+        end = address + size
+        for (start, data) in self._remove_overlapping(address, end):
+            if start < address:
+                self._add(start, data[:address - start])
+
+            if start + len(data) > end:
+                self._add(end, data[end - start:])
+
+    def _remove_overlapping(self, address: int, end: int, adjacent=False) -> list:
+        """
+        Remove and return the *(start, data)* extents overlapping with [address, end),
+        and optionally, those immediately adjacent to it.
+        """
+        i = max(bisect_right(self._starts, address) - 1, 0)
+        ret = []
+
+        while i < len(self._starts):
+            start = self._starts[i]
+            stop = start + len(self._data[start])
+
+            if start > end or (start == end and not adjacent):
+                break
+
+            if stop > address or (stop == address and adjacent):
+                ret.append((start, self._data.pop(start)))
+                self._starts.pop(i)
+            else:
+                i += 1
+
+        return ret
+
+    def _add(self, start: int, data: bytes):
+        self._starts.insert(bisect_right(self._starts, start), start)
+        self._data[start] = data
+
+    def _insert(self, address: int, data: bytes):
+        """
+        Insert *data* read from *address*, merging it with any existing extents
+        that it overlaps or abuts. The new data takes precedence.
+        """
+        if not data:
+            return
+
+        end = address + len(data)
+        extents = self._remove_overlapping(address, end, adjacent=True)
+
+        if extents and extents[0][0] < address:
+            (start, prefix) = extents[0]
+            data = prefix[:address - start] + data
+            address = start
+
+        if extents:
+            (start, suffix) = extents[-1]
+            if start + len(suffix) > end:
+                data = data + suffix[end - start:]
+
+        self._add(address, data)
@@ -79,6 +79,9 @@ class DataAbortMemoryReader(MemoryWordReader):
         da_text = self._trigger_data_abort(addr)
 
 
+        # Memory contents cannot be assumed to have survived the reboot
+        self._ctx._invalidate_read_cache()
+
         # Run user-provided post-reboot callback, if configured
         if self._ctx._post_reboot_cb is not None:
             # Callback is responsible for interrupt() call, if they want it.
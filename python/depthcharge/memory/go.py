@@ -1,12 +1,19 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Depthcharge: <https://github.com/nccgroup/depthcharge>
 """
-Implements GoMemoryReader
+Implements GoMemoryReader, GoBlockMemoryReader, GoRLEMemoryReader, and GoMemoryWriter
 """
 
+import re
+import struct
+import time
+
+from zlib import crc32
+
 from .reader import MemoryReader, MemoryWordReader
+from .writer import MemoryWriter
 from .. import log
-from ..operation import Operation, OperationNotSupported
+from ..operation import Operation, OperationFailed, OperationNotSupported
 
 _START_SENTINEL = b'-:[START]:-'
 _END_SENTINEL   = b'-:[|END|]:-'
@@ -33,6 +40,23 @@ class _GoMemoryWordReader(MemoryWordReader):
     def rank(cls, **_kwargs):
         return 0
 
+    def _read(self, addr: int, size: int, handle_data):
+        # Once the jump table location is known, aligned words can be batched
+        # into far fewer READ_WORDS invocations.
+        try:
+            self._ctx._go_payload_jt_addr('READ_WORDS')
+            batch = (addr & 0x3) == 0 and (size & 0x3) == 0
+        except OperationNotSupported:
+            batch = False
+
+        if not batch:
+            super()._read(addr, size, handle_data)
+            return
+
+        words = self._ctx.read_words(range(addr, addr + size, 4))
+        endianness = self._ctx.arch.endianness
+        handle_data(b''.join(word.to_bytes(4, endianness) for word in words))
+
     def _read_word(self, addr: int, size: int, handle_data):
         (rc, _) = self._ctx.execute_payload('RETURN_MEMORY_WORD', '0x{:08x}'.format(addr))
         data = self._ctx.arch.int_to_bytes(rc)
@@ -61,6 +85,9 @@ class GoMemoryReader(MemoryReader):
         'gd_jt': True
     }
 
+    # Payload used to perform reads once the jump table location is known
+    _read_payload = 'READ_MEMORY'
+
     @classmethod
     def rank(cls, **kwargs):
         # Loading a payload incurs quite a bit of overhead.
@@ -94,7 +121,7 @@ class GoMemoryReader(MemoryReader):
         try:
             self._jt_addr = self._ctx._gd['jt']['address']
             msg += 'Using payload-based read implementation'
-            self._ctx.deploy_payload('READ_MEMORY')
+            self._ctx.deploy_payload(self._read_payload)
         except KeyError:
             msg += 'U-Boot jump table location unknown. Using fallback reader.'
             try:
@@ -159,5 +186,479 @@ class GoMemoryReader(MemoryReader):
         handle_data(data.replace(b'\r\n', b'\n'))
 
 
-# Register declared Operation
-Operation.register(GoMemoryReader)
+def _rle_decode(data: bytes) -> bytes:
+    """
+    Decode block data sent by the READ_MEMORY_RLE payload.
+    Refer to payloads/src/read_memory_rle.c for a description of the format.
+    """
+    ret = bytearray()
+    i = 0
+
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+
+        if ctrl < 0x80:
+            count = ctrl + 1
+            if i + count > len(data):
+                raise ValueError('Truncated literal run')
+            ret += data[i:i + count]
+            i += count
+        else:
+            if i >= len(data):
+                raise ValueError('Truncated repeated run')
+            ret += data[i:i + 1] * (ctrl - 0x80 + 3)
+            i += 1
+
+    return bytes(ret)
+
+
+class _BlockFrameDecoder:
+    """
+    Decodes the frames sent by the READ_MEMORY_BLOCKS and READ_MEMORY_RLE payloads.
+    Refer to payloads/include/block_xfer.h for a description of the format.
+    """
+
+    FLAG        = 0x7e
+    ESCAPE      = 0x7d
+    ESCAPE_XOR  = 0x20
+    XOR_MASK    = 0x55
+    HEADER_LEN  = 12
+
+    def __init__(self):
+        self.frames = []
+        self._in_frame = False
+        self._escaped = False
+        self._hdr = bytearray()
+        self._data = bytearray()
+        self._data_len = None
+
+    def _start_frame(self):
+        self._in_frame = True
+        self._escaped = False
+        self._hdr.clear()
+        self._data = bytearray()
+        self._data_len = None
+
+    def bytes_needed(self) -> int:
+        """
+        Minimum number of raw bytes required to complete the current frame.
+        Reading exactly this many never consumes data beyond the frame's end.
+        """
+        if not self._in_frame:
+            return 1 + self.HEADER_LEN
+
+        # A pending escape is completed by the next byte, which
+        # will be counted as one of those remaining below.
+        if self._data_len is None:
+            return self.HEADER_LEN - len(self._hdr)
+
+        return self._data_len - len(self._data)
+
+    def feed(self, raw: bytes):
+        """
+        Process raw console data. Each completed frame is appended to
+        :py:attr:`frames` as an *(offset, length, crc32, data)* tuple, where *data*
+        is still in its payload-specific encoding.
+        """
+        for b in raw:
+            if b == self.FLAG:
+                # A frame interrupted by the start of another was corrupt.
+                # Its (truncated) content is simply discarded.
+                self._start_frame()
+                continue
+
+            if not self._in_frame:
+                continue
+
+            if self._escaped:
+                b ^= self.ESCAPE_XOR
+                self._escaped = False
+            elif b == self.ESCAPE:
+                self._escaped = True
+                continue
+
+            b ^= self.XOR_MASK
+
+            if self._data_len is None:
+                self._hdr.append(b)
+                if len(self._hdr) == self.HEADER_LEN:
+                    self._data_len = int.from_bytes(self._hdr[10:12], 'little')
+            else:
+                self._data.append(b)
+
+            if self._data_len is not None and len(self._data) == self._data_len:
+                offset = int.from_bytes(self._hdr[0:4], 'little')
+                length = int.from_bytes(self._hdr[4:6], 'little')
+                crc    = int.from_bytes(self._hdr[6:10], 'little')
+
+                self.frames.append((offset, length, crc, bytes(self._data)))
+                self._in_frame = False
+
+
+class GoBlockMemoryReader(GoMemoryReader):
+    """
+    The GoBlockMemoryReader is a variant of the :py:class:`GoMemoryReader` intended for reads
+    of multiple megabytes, leveraging a payload that sends memory contents in fixed size blocks.
+
+    Each block is accompanied by its offset, length, and a CRC32 checksum. The host
+    acknowledges each valid block and requests that the payload resend data, starting from
+    the first missing offset, when a block is corrupted or lost. Thus, noise on the
+    serial line (or a dropped byte) only costs a single block, rather than the entire transfer.
+
+    The same requirements as the :py:class:`GoMemoryReader` apply.
+    """
+
+    _required = {
+        'commands': ['go'],
+        'payloads': ['RETURN_MEMORY_WORD', 'READ_MEMORY_BLOCKS'],
+        'gd': True,
+        'gd_jt': True
+    }
+
+    _read_payload = 'READ_MEMORY_BLOCKS'
+
+    # Block size (bytes) requested of the payload
+    _block_size = 4096
+
+    # Duration (ms) the payload waits for a response before resending a block.
+    _payload_timeout_ms = 1000
+
+    # Duration (s) the host waits for data before requesting a resend.
+    # This is kept shorter than the above to avoid both sides resending at once.
+    _resend_timeout = 0.400
+
+    # Maximum number of consecutive resend requests before giving up
+    _max_resends = 16
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # Slightly preferred over the GoMemoryReader for larger reads,
+        # given that it can recover from transmission errors.
+        data_len = kwargs.get('data_len', 0)
+        if data_len >= 65536:
+            return 95
+
+        if data_len >= 16384:
+            return 80
+
+        if data_len >= 4096:
+            return 20
+
+        return 4
+
+    def _read(self, addr: int, size: int, handle_data):
+        if self._jt_addr is None:
+            super()._read(addr, size, handle_data)
+        else:
+            self._block_read(addr, size, handle_data)
+
+    def _decode_block(self, data: bytes) -> bytes:
+        """
+        Convert block data from the payload's encoding. Raises :py:exc:`ValueError`
+        if it is malformed.
+        """
+        return data
+
+    def _next_frame(self, decoder):
+        """
+        Returns the next *(offset, length, crc32, data)* frame, or ``None``
+        if no further data was received before the resend timeout elapsed.
+        """
+        console = self._ctx.console
+        t_last = time.time()
+
+        while not decoder.frames:
+            data = console.read_raw_partial(decoder.bytes_needed())
+            if data:
+                decoder.feed(data)
+                t_last = time.time()
+            elif (time.time() - t_last) >= self._resend_timeout:
+                return None
+
+        return decoder.frames.pop(0)
+
+    def _block_read(self, addr: int, size: int, handle_data):
+        log.debug('Block-based read of {:d} bytes @ 0x{:08x}'.format(size, addr))
+        console = self._ctx.console
+
+        self._ctx.execute_payload(self._read_payload,
+                                  '0x{:08x}'.format(self._jt_addr),
+                                  '0x{:08x}'.format(addr),
+                                  '0x{:08x}'.format(size),
+                                  '0x{:x}'.format(self._block_size),
+                                  '{:d}'.format(self._payload_timeout_ms),
+                                  read_response=False)
+
+        resp = console.read_raw()
+        if not resp.endswith(_START_SENTINEL):
+            raise ValueError('Did not receive expected start sentinel')
+
+        console.write('\n')
+
+        decoder = _BlockFrameDecoder()
+        offset = 0
+        resends = 0
+
+        while True:
+            frame = self._next_frame(decoder)
+            expected_len = min(self._block_size, size - offset)
+            data = None
+
+            if frame is None:
+                msg = 'Timed out waiting for block @ offset 0x{:x}'.format(offset)
+            elif frame[0] != offset or frame[1] != expected_len:
+                msg = 'Received unexpected block @ offset 0x{:x}, expected 0x{:x}'
+                msg = msg.format(frame[0], offset)
+            else:
+                try:
+                    data = self._decode_block(frame[3])
+                    msg = None
+                except ValueError as error:
+                    msg = 'Malformed block @ offset 0x{:x} ({:s})'.format(offset, str(error))
+
+                if msg is None and (len(data) != expected_len or crc32(data) != frame[2]):
+                    msg = 'CRC32 mismatch for block @ offset 0x{:x}'.format(offset)
+
+            if msg is not None:
+                resends += 1
+                if resends > self._max_resends:
+                    console.write('q')
+                    console.read_raw()
+                    raise IOError(msg + '. Maximum resend attempts exceeded.')
+
+                # Stale frames still in flight are either duplicates of the
+                # block we want, or are rejected above. No need to flush them.
+                log.debug(msg + '. Requesting resend.')
+                console.write('r{:08x}'.format(offset))
+                continue
+
+            resends = 0
+
+            # Let the payload get started on the next block while we
+            # process this one.
+            console.write('a')
+
+            if expected_len == 0:
+                break
+
+            handle_data(data)
+            offset += expected_len
+
+        # Consume trailing output (i.e. return code and prompt)
+        console.read_raw()
+
+
+class GoRLEMemoryReader(GoBlockMemoryReader):
+    """
+    The GoRLEMemoryReader is a variant of the :py:class:`GoBlockMemoryReader` whose payload
+    run-length encodes each block before sending it.
+
+    This significantly reduces the time required to dump memory containing large regions of
+    erased flash (0xff), zeroed RAM, or padding, which is common in firmware images.
+    For incompressible data, the overhead is less than 1%.
+
+    The same requirements as the :py:class:`GoMemoryReader` apply.
+    """
+
+    _required = {
+        'commands': ['go'],
+        'payloads': ['RETURN_MEMORY_WORD', 'READ_MEMORY_RLE'],
+        'gd': True,
+        'gd_jt': True
+    }
+
+    _read_payload = 'READ_MEMORY_RLE'
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # Preferred over the GoBlockMemoryReader, given that it's
+        # no slower in the worst case.
+        data_len = kwargs.get('data_len', 0)
+        if data_len >= 65536:
+            return 97
+
+        if data_len >= 16384:
+            return 82
+
+        return super().rank(**kwargs)
+
+    def _decode_block(self, data: bytes) -> bytes:
+        return _rle_decode(data)
+
+
+class GoMemoryWriter(MemoryWriter):
+    """
+    The GoMemoryWriter leverages a payload, invoked with U-Boot's "go" command, that receives
+    raw binary data over the console and stores it directly to memory. This allows large
+    amounts of data (e.g. a second stage image) to be written in a single streamed transfer,
+    rather than one word per console command.
+
+    Data is sent in fixed size blocks, each accompanied by a CRC32 checksum. The payload
+    acknowledges each valid block and requests a resend of corrupted or lost blocks.
+
+    A different memory writer is required to deploy the payload itself, and the location of
+    U-Boot's jump table must be known. Otherwise, writes are performed using the best available
+    alternative.
+    """
+
+    _required = {
+        'commands': ['go'],
+        'payloads': ['WRITE_MEMORY'],
+        'gd': True,
+        'gd_jt': True
+    }
+
+    # Block size (bytes) used for transfers
+    _xfer_block_size = 4096
+
+    # Duration (ms) the payload waits for data before requesting a resend
+    _payload_timeout_ms = 1000
+
+    # Maximum number of resends before giving up
+    _max_resends = 16
+
+    _RESPONSE_RE = re.compile(rb'(?P<type>[adr])(?P<offset>[0-9a-fA-F]{8})\r?\n')
+
+    _QUIT_OFFSET = 0xffffffff
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # Loading a payload incurs some overhead, but the transfer itself
+        # is limited only by the UART's speed.
+        data_len = kwargs.get('data_len', 0)
+        if data_len <= 256:
+            return 20
+
+        if data_len <= 1024:
+            return 50
+
+        if data_len <= 4095:
+            return 70
+
+        if data_len <= 16384:
+            return 82
+
+        return 92
+
+    def _response_timeout(self, block_len: int) -> float:
+        """
+        Duration (s) to wait for a response after sending a block of *block_len* bytes,
+        accounting for the time required to transmit it. This is kept longer than
+        the payload's timeout so that its resend requests are not missed.
+        """
+        xfer_time = (block_len + 10) * 10 / self._ctx.console.baudrate
+        return xfer_time + (self._payload_timeout_ms / 1000) + 0.5
+
+    def _read_response(self, timeout: float):
+        """
+        Returns a *(type, offset)* tuple, or ``None`` if no valid response
+        was received within the timeout period. A type of ``b'p'`` indicates
+        that the console prompt was observed instead.
+        """
+        console = self._ctx.console
+        prompt = console.prompt.encode('latin-1') if console.prompt else None
+        t_start = time.time()
+        resp = b''
+
+        while (time.time() - t_start) < timeout:
+            resp += console.read_raw_partial()
+
+            m = self._RESPONSE_RE.search(resp)
+            if m is not None:
+                return (m.group('type'), int(m.group('offset'), 16))
+
+            if prompt and resp.endswith(prompt):
+                return (b'p', 0)
+
+        return None
+
+    def write(self, addr: int, data: bytes, **kwargs):
+        try:
+            jt_addr = self._ctx._gd['jt']['address']
+        except KeyError:
+            msg = '({:s}) U-Boot jump table location unknown. Using fallback writer.'
+            log.debug(msg.format(self.name))
+            fallback = self._ctx._memwr.default(data_len=len(data),
+                                                exclude_reqts=('stratagem', 'payloads'))
+            fallback.write(addr, data, **kwargs)
+            return
+
+        size = len(data)
+        block_size = self._xfer_block_size
+        console = self._ctx.console
+
+        desc = '({:s}) Writing {:d} bytes @ 0x{:08x}'.format(self.name, size, addr)
+        show = kwargs.get('show_progress', True)
+        progress = self._ctx.create_progress_indicator(self, size, desc, unit='B', show=show)
+
+        try:
+            self._ctx.execute_payload('WRITE_MEMORY',
+                                      '0x{:08x}'.format(jt_addr),
+                                      '0x{:08x}'.format(addr),
+                                      '0x{:08x}'.format(size),
+                                      '0x{:x}'.format(block_size),
+                                      '{:d}'.format(self._payload_timeout_ms),
+                                      read_response=False)
+
+            resp = console.read_raw()
+            if not resp.endswith(_START_SENTINEL):
+                raise OperationFailed('Did not receive expected start sentinel')
+
+            console.write('\n')
+
+            offset = 0
+            resends = 0
+
+            while True:
+                block = data[offset:offset + block_size]
+                hdr = struct.pack('<IHI', offset, len(block), crc32(block))
+                console.write_raw(hdr + block)
+
+                resp = self._read_response(self._response_timeout(len(block)))
+
+                if resp is not None and resp[0] == b'd':
+                    # Consume trailing output (i.e. return code and prompt)
+                    console.read_raw()
+                    break
+
+                if resp is not None and resp[0] == b'p':
+                    if offset == size:
+                        # Payload returned after all data was ACK'd, but we
+                        # missed its final response. Discard our resent block.
+                        self._ctx.interrupt()
+                        break
+
+                    raise OperationFailed('WRITE_MEMORY payload exited prematurely')
+
+                if resp is not None and resp[0] == b'a' and offset < resp[1] <= size:
+                    progress.update(resp[1] - offset)
+                    offset = resp[1]
+                    resends = 0
+                    continue
+
+                resends += 1
+                if resends > self._max_resends:
+                    console.write_raw(struct.pack('<I', self._QUIT_OFFSET))
+                    self._ctx.interrupt()
+                    raise IOError('Maximum resend attempts exceeded @ offset 0x{:x}'.format(offset))
+
+                if resp is None:
+                    msg = 'Timed out waiting for response'
+                elif resp[0] == b'r' and resp[1] <= size:
+                    # Progress may have been made if an ACK was lost
+                    if resp[1] > offset:
+                        progress.update(resp[1] - offset)
+                    offset = resp[1]
+                    msg = 'Resend requested'
+                else:
+                    msg = 'Invalid response'
+
+                log.debug('{:s} @ offset 0x{:x}. Resending.'.format(msg, offset))
+
+        finally:
+            self._ctx.close_progress_indicator(progress)
+
+
+# Register declared Operations
+Operation.register(GoMemoryReader, GoBlockMemoryReader, GoRLEMemoryReader, GoMemoryWriter)
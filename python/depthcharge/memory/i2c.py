@@ -6,6 +6,8 @@ Implements I2CMemoryReader and I2CMemoryWriter
 
 import re
 
+from collections import deque
+
 from .reader import MemoryReader
 from .writer import MemoryWriter
 
@@ -65,6 +67,10 @@ class I2CMemoryReader(MemoryReader):
     .. image:: ../../images/i2c-read.png
         :align: center
 
+    If the Companion is attached to the target's console UART and the Depthcharge console is
+    connected through the Companion's console bridge interface, the Companion issues the
+    ``i2c write`` commands itself. The host then only needs to retrieve the results,
+    removing its per-command round-trip latency from the read loop.
     """
 
     _required = {
@@ -128,33 +134,99 @@ class I2CMemoryReader(MemoryReader):
     # A read is performed by having U-Boot write the contents
     # of a memory location to our fake I2C peripheral .
     def _read(self, addr: int, size: int, handle_data):
-
+        companion = self._ctx.companion
+
+        # Each `i2c write` transaction begins with a 1-byte subaddress,
+        # which counts against the Companion's transaction size limit.
+        chunk_size = companion.i2c_buffer_size() - 1
+        caps = companion.firmware_capabilities()
+
+        if self._ctx.console.prompt and companion.console_bridged():
+            # Each result record must fit within a single response,
+            # alongside its length and the response's 3-byte header.
+            chunk_size = min(chunk_size, companion.max_payload - 4)
+            self._read_on_device(addr, size, chunk_size, handle_data)
+        elif caps.get('i2c_write_queue', False):
+            # Each queued transaction must fit within a single response,
+            # alongside its length and the response's flags byte.
+            chunk_size = min(chunk_size, companion.max_payload - 2)
+            self._read_queued(addr, size, chunk_size, handle_data)
+        else:
+            self._read_single(addr, size, chunk_size, handle_data)
+
+    # Number of `i2c write` commands issued before retrieving their results
+    # from the Companion's write queue, when supported by its firmware.
+    _queue_batch_size = 32
+
+    def _check_chunk(self, data: bytes, to_read: int) -> bytes:
+        if len(data) != to_read and len(data) != (to_read + 1):
+            # Companion firmware <= 0.1.0 includes an extra junk byte, as it
+            # does not account for the subaddress byte in the write length.
+            err = 'Expected {:d} bytes of data, got {:d}'
+            raise IOError(err.format(to_read, len(data)))
+
+        # Neeed to trim extra junk per above
+        return data[0:to_read]
+
+    def _read_single(self, addr: int, size: int, chunk_size: int, handle_data):
         i2c_addr = self._ctx.companion.i2c_addr()
         fmt = 'i2c write 0x{:08x} 0x{:02x} 0 0x{:02x} -s'
 
         while size > 0:
-            # FIXME: want 32, but we're losing a byte to a subaddress
-            #        and picking up a NACK? Seems like the Kinetis TwoWire
-            #        is hittin a 32-bit limit, perhaps to conform to some
-            #        implicit Arduino API limitations re: 32-byte buffers.
-            to_read = 31 if size > 31 else size
+            to_read = chunk_size if size > chunk_size else size
             cmd = fmt.format(addr, i2c_addr, to_read)
             resp = self._ctx.send_command(cmd)
             self._validate_response(resp)
 
             data = self._ctx.companion.i2c_write_buffer()
-            if len(data) != to_read and len(data) != (to_read + 1):
-                # FIXME: +1 is an extra byte coming in on the I2C stop
-                # condition or our NACK?
-                err = 'Expected {:d} bytes of data, got {:d}'
-                raise IOError(err.format(to_read, len(data)))
-
-            # Neeed to trim extra junk per above
-            handle_data(data[0:to_read])
+            handle_data(self._check_chunk(data, to_read))
 
             addr += to_read
             size -= to_read
 
+    def _read_queued(self, addr: int, size: int, chunk_size: int, handle_data):
+        """
+        Issue a batch of `i2c write` commands and then collect all of their
+        data from the Companion at once, rather than after each command.
+        """
+        companion = self._ctx.companion
+        i2c_addr = companion.i2c_addr()
+        fmt = 'i2c write 0x{:08x} 0x{:02x} 0 0x{:02x} -s'
+
+        # Discard anything left over from a prior (e.g. interrupted) operation,
+        # such that only overflows occurring during this read are reported.
+        companion.i2c_drain_write_queue(clear=True)
+
+        while size > 0:
+            pending = []
+            while size > 0 and len(pending) < self._queue_batch_size:
+                to_read = chunk_size if size > chunk_size else size
+                cmd = fmt.format(addr, i2c_addr, to_read)
+                resp = self._ctx.send_command(cmd)
+                self._validate_response(resp)
+
+                pending.append(to_read)
+                addr += to_read
+                size -= to_read
+
+            records = companion.i2c_drain_write_queue()
+            if len(records) != len(pending):
+                err = 'Expected {:d} I2C transactions, Companion queued {:d}'
+                raise IOError(err.format(len(pending), len(records)))
+
+            for (to_read, data) in zip(pending, records):
+                handle_data(self._check_chunk(data, to_read))
+
+    def _read_on_device(self, addr: int, size: int, chunk_size: int, handle_data):
+        """
+        Have the Companion issue the `i2c write` commands and validate their
+        responses, while we just retrieve the resulting data.
+        """
+        companion = self._ctx.companion
+        companion.set_console_prompt(self._ctx.console.prompt)
+        companion.console_i2c_read_mem(addr, size, chunk_size)
+        companion.console_collect_results(size, handle_data)
+
 
 class I2CMemoryWriter(MemoryWriter):
     """
@@ -170,6 +242,9 @@ class I2CMemoryWriter(MemoryWriter):
     .. image:: ../../images/i2c-write.png
         :align: center
 
+    If the Companion firmware supports an I2C read buffer queue, upcoming blocks are staged on the
+    device ahead of the corresponding ``i2c read`` commands. In this case, the target's console is
+    the only bottleneck, as the host no longer waits on the Companion between each block.
     """
 
     _required = {
@@ -177,6 +252,9 @@ class I2CMemoryWriter(MemoryWriter):
         'commands': ['i2c']
     }
 
+    # Upper bound on the number of blocks staged in a single request
+    _stage_batch_size = 16
+
     _usage_err = 'U-Boot responded to I2C command with usage text.\n' + \
                  ' ' * 6 + \
                  'Does it not support the subcommands we are using? ' + \
@@ -192,10 +270,21 @@ class I2CMemoryWriter(MemoryWriter):
 
         # This is dictacted by Companion firmware restrictions,
         # courtesy of (arbitrary?) Arduino library limitations.
-        self._block_size = 32
+        self._block_size = self._ctx.companion.i2c_buffer_size()
+
+        # Staging blocks ahead of time requires that we know how write()
+        # will divide up the payload.
+        self._allow_block_size_override = False
 
         self._backup_state = (None, None)
 
+        # Read buffer queue state. See _stage()
+        self._queued = False
+        self._pending = deque()     # Blocks not yet sent to the Companion
+        self._in_flight = deque()   # (tag, block count) of uncollected requests
+        self._staged = 0            # Blocks confirmed staged, not yet consumed
+        self._queue_space = 0       # Remaining queue space, in bytes
+
     def _validate_response(self, resp, expected=''):
         resp = resp.strip()
         if resp != expected:
@@ -222,12 +311,87 @@ class I2CMemoryWriter(MemoryWriter):
         expected = 'Setting bus speed to {:d} Hz'.format(bus_speed)
         self._validate_response(resp, expected)
 
+        # A staging request must be able to carry at least one full block,
+        # along with its flags and length bytes.
+        companion = self._ctx.companion
+        self._queued = companion.firmware_capabilities().get('i2c_read_queue', False) and \
+            companion.max_payload >= self._block_size + 2
+
+        if self._queued:
+            bs = self._block_size
+            self._pending = deque(data[i:i + bs] for i in range(0, len(data), bs))
+            self._in_flight.clear()
+            self._staged = 0
+            self._queue_space = companion.i2c_queue_read_buffers([], clear=True)
+            self._stage()
+
     def _teardown(self):
-        _restore_i2c_bus_state(self._ctx, self._backup_state)
+        try:
+            if self._queued:
+                companion = self._ctx.companion
+                while self._in_flight:
+                    companion.collect_i2c_read_buffers(self._in_flight.popleft()[0])
+                companion.i2c_queue_read_buffers([], clear=True)
+        finally:
+            self._queued = False
+            self._pending.clear()
+            _restore_i2c_bus_state(self._ctx, self._backup_state)
+
+    def _stage(self):
+        """
+        Send as many pending blocks to the Companion as its read queue has
+        room for, without waiting for the corresponding response.
+        """
+        companion = self._ctx.companion
+        max_request = companion.max_payload - 1
+
+        batch = []
+        batch_size = 0
+
+        while self._pending and len(batch) < self._stage_batch_size:
+            cost = len(self._pending[0]) + 1
+            if cost > self._queue_space or (batch_size + cost) > max_request:
+                break
+
+            batch.append(self._pending.popleft())
+            batch_size += cost
+            self._queue_space -= cost
+
+        if batch:
+            tag = companion.submit_i2c_read_buffers(batch)
+            self._in_flight.append((tag, len(batch)))
+
+    def _write_queued(self, addr: int, data: bytes):
+        companion = self._ctx.companion
+
+        # The block we're about to have the target read must be confirmed staged.
+        while self._staged == 0:
+            if not self._in_flight:
+                raise IOError('Bug: I2C read queue state is inconsistent')
+
+            (tag, count) = self._in_flight.popleft()
+            companion.collect_i2c_read_buffers(tag)
+            self._staged += count
+
+        # Keep the Companion busy receiving upcoming blocks while the
+        # target works through the current one.
+        self._stage()
+
+        i2c_addr = companion.i2c_addr()
+        cmd = 'i2c read 0x{:02x} 0 0x{:02x} 0x{:08x}'.format(i2c_addr, len(data), addr)
+        resp = self._ctx.send_command(cmd)
+        self._validate_response(resp)
+
+        self._staged -= 1
+        self._queue_space += len(data) + 1
 
     # A memory write is performed by reading out payload from out
     # companion device, into the target's memory space
     def _write(self, addr: int, data: bytes, **kwargs):
+        if self._queued:
+            self._write_queued(addr, data)
+            return
+
         i2c_addr = self._ctx.companion.i2c_addr()
         fmt = 'i2c read 0x{:02x} 0 0x{:02x} 0x{:08x}'
         to_write = len(data)
@@ -44,6 +44,10 @@ class MdMemoryReader(MemoryReader):
     """
     Reads memory using the U-Boot console command `md` (memory display),
     which outputs a textual hex dump.
+
+    If the Depthcharge console is connected through a :py:class:`~depthcharge.Companion`
+    device's target console bridge, the Companion issues the `md` commands and parses
+    their output itself, returning only the resulting binary data to the host.
     """
 
     _required = {
@@ -99,6 +103,14 @@ class MdMemoryReader(MemoryReader):
 
         endianness = self._ctx.arch.endianness
 
+        companion = self._ctx.companion
+        if companion is not None and self._ctx.console.prompt and companion.console_bridged():
+            width = {'.q': 8, '.l': 4, '.w': 2, '.b': 1}[mode]
+            companion.set_console_prompt(self._ctx.console.prompt)
+            companion.console_md_read_mem(addr, size, width, endianness == 'big')
+            companion.console_collect_results(size, handle_data)
+            return
+
         cmd = 'md{:s} {:x} {:x}'.format(mode, addr, count)
         self._ctx.send_command(cmd, read_response=False)
 
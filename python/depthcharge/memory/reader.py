@@ -4,10 +4,173 @@
 Provides MemoryReader base class
 """
 
+import mmap
 import os
+import struct
+
+from zlib import crc32
 
 from .. import log
-from ..operation import Operation
+from ..operation import Operation, OperationFailed, OperationNotSupported
+
+
+class _MappedOutputFile:
+    """
+    Memory-mapped output file used by :py:meth:`MemoryReader.read_to_file()`.
+
+    Data may be written at any offset, in any order. The blocks that have been completely
+    written are tracked in a sidecar bitmap file (*<filename>.progress*), allowing
+    an interrupted read to be resumed. The sidecar is removed once every block is complete.
+    """
+
+    _MAGIC = b'DCRP'
+
+    # Magic, address, size, block size
+    _HEADER = struct.Struct('<4sQQI')
+
+    def __init__(self, filename: str, addr: int, size: int, block_size: int, resume=False):
+        if block_size <= 0:
+            raise ValueError('Invalid block size: {:d}'.format(block_size))
+
+        self._addr = addr
+        self._size = size
+        self._block_size = block_size
+        self._n_blocks = (size + block_size - 1) // block_size
+        self._pos = 0
+
+        # Bytes written to each incomplete block
+        self._written = [0] * self._n_blocks
+
+        self.progress_file = filename + '.progress'
+
+        bitmap = self._load_bitmap(filename) if resume else None
+        if bitmap is None:
+            bitmap = bytearray((self._n_blocks + 7) // 8)
+            mode = 'w+b'
+        else:
+            mode = 'r+b'
+
+        self._bitmap = bitmap
+
+        self._file = open(filename, mode)
+        self._file.truncate(size)  # Sparse, where supported
+        self._mmap = mmap.mmap(self._file.fileno(), size) if size > 0 else None
+
+        self._progress = open(self.progress_file, 'w+b')
+        self._progress.write(self._HEADER.pack(self._MAGIC, addr, size, block_size))
+        self._progress.write(self._bitmap)
+        self._progress.flush()
+
+    def _load_bitmap(self, filename: str):
+        """
+        Load the bitmap from an existing sidecar file, if it corresponds to this read.
+        """
+        try:
+            if os.path.getsize(filename) != self._size:
+                raise OSError
+
+            with open(self.progress_file, 'rb') as infile:
+                header = infile.read(self._HEADER.size)
+                bitmap = bytearray(infile.read())
+
+        except OSError:
+            log.note('No partial read to resume. Reading entire region.')
+            return None
+
+        expected = (self._MAGIC, self._addr, self._size, self._block_size)
+        if len(header) != self._HEADER.size or self._HEADER.unpack(header) != expected or \
+                len(bitmap) != (self._n_blocks + 7) // 8:
+            msg = '{:s} does not correspond to this read. Reading entire region.'
+            log.note(msg.format(self.progress_file))
+            return None
+
+        return bitmap
+
+    def _block_complete(self, index: int) -> bool:
+        return (self._bitmap[index >> 3] & (1 << (index & 7))) != 0
+
+    def _mark_complete(self, index: int):
+        byte_idx = index >> 3
+        self._bitmap[byte_idx] |= 1 << (index & 7)
+
+        self._progress.seek(self._HEADER.size + byte_idx)
+        self._progress.write(self._bitmap[byte_idx:byte_idx + 1])
+        self._progress.flush()
+
+    @property
+    def complete(self) -> bool:
+        """
+        ``True`` if all blocks have been written.
+        """
+        return all(self._block_complete(i) for i in range(0, self._n_blocks))
+
+    def pending_regions(self) -> list:
+        """
+        Return a list of coalesced *[offset, length]* regions that have yet to be written.
+        """
+        regions = []
+        for i in range(0, self._n_blocks):
+            if self._block_complete(i):
+                continue
+
+            offset = i * self._block_size
+            length = min(self._block_size, self._size - offset)
+
+            if regions and (regions[-1][0] + regions[-1][1]) == offset:
+                regions[-1][1] += length
+            else:
+                regions.append([offset, length])
+
+        return regions
+
+    def seek(self, offset: int):
+        """
+        Set the offset at which the next :py:meth:`write()` without an offset occurs.
+        """
+        self._pos = offset
+
+    def write(self, data: bytes, offset=None):
+        """
+        Write *data* at the specified *offset*, or following the previously written data.
+        """
+        if offset is None:
+            offset = self._pos
+
+        end = offset + len(data)
+        if offset < 0 or end > self._size:
+            msg = 'Received data (offset={:d}, length={:d}) outside of {:d}-byte read'
+            raise ValueError(msg.format(offset, len(data), self._size))
+
+        self._mmap[offset:end] = data
+        self._pos = end
+
+        # Account for the data written in each block it spans
+        block_size = self._block_size
+        for i in range(offset // block_size, (end + block_size - 1) // block_size):
+            if self._block_complete(i):
+                continue
+
+            block_start = i * block_size
+            block_end = min(block_start + block_size, self._size)
+
+            self._written[i] += min(end, block_end) - max(offset, block_start)
+            if self._written[i] >= block_end - block_start:
+                self._mark_complete(i)
+
+    def close(self):
+        """
+        Flush and close the output file. The sidecar file is removed if all blocks
+        have been written, and retained otherwise.
+        """
+        if self._mmap is not None:
+            self._mmap.flush()
+            self._mmap.close()
+
+        self._file.close()
+        self._progress.close()
+
+        if self.complete:
+            os.remove(self.progress_file)
 
 
 class MemoryReader(Operation):
@@ -66,6 +229,10 @@ class MemoryReader(Operation):
         the provided ``handle_data()`` handler. This will take care of either
         buffering the data in memory or writing it to disk, depending upon
         which API function was invoked.
+
+        Data is expected to be provided in order, unless the optional *address*
+        keyword argument is passed to the handler to specify where the data was
+        read from. This permits implementations to provide data out of order.
         """
         raise NotImplementedError('Subclass does not implement required method _read()')
 
@@ -88,16 +255,24 @@ class MemoryReader(Operation):
         desc = self._describe_op(addr, size)
         show = kwargs.get('show_progress', True)
         progress = self._ctx.create_progress_indicator(self, size, desc, unit='B', show=show)
+        num_read = 0
+
+        def _update_progress(data: bytes, address=None):
+            nonlocal num_read
+            offset = len(ret) if address is None else address - addr
+            end = offset + len(data)
+            if end > len(ret):
+                ret.extend(bytes(end - len(ret)))
 
-        def _update_progress(data: bytes):
-            ret.extend(data)
+            ret[offset:end] = data
+            num_read += len(data)
             progress.update(len(data))
 
         try:
             self._read(addr, size, _update_progress)
         except KeyboardInterrupt:
             msg = 'Read operation interrupted. {:d} / {:d} bytes read.'
-            log.warning(msg.format(len(ret), size))
+            log.warning(msg.format(num_read, size))
         finally:
             self._ctx.close_progress_indicator(progress)
 
@@ -117,31 +292,154 @@ class MemoryReader(Operation):
         Specify a *show_progress=False* keyword argument to disable the
         progress bar printed during the read operation.
 
+        Data is written to a memory-mapped file, at its corresponding offset, as it is received.
+        Until the read completes, the blocks of *resume_block_size* (default: 65536) bytes
+        that have been written are tracked in a *<filename>.progress* sidecar file.
+        If the read is interrupted or fails, specifying *resume=True* in a subsequent call
+        with the same arguments will read only the remaining blocks.
+
         If interrupted by a *KeyboardInterrupt* exception, this method will
         finish writing any received data, cleanly close the file, and
         present a warning about a partial read.
+
+        If *incremental=True* is specified and *filename* is an existing file of *size* bytes,
+        such as one produced by a previous read of the same region, only the portions of it
+        that differ from target memory are re-read. These are determined by comparing
+        CRC32 checksums of each *incremental_block_size* (default: 65536) byte block,
+        obtained via :py:meth:`Depthcharge.block_crc32() <depthcharge.Depthcharge.block_crc32>`.
+        If this is not possible, the entire region is read.
         """
+        resume = kwargs.get('resume', False)
+
+        if kwargs.get('incremental', False):
+            if resume:
+                raise ValueError('The incremental and resume options are mutually exclusive')
+
+            block_size = kwargs.get('incremental_block_size', 65536)
+            regions = self._changed_regions(addr, size, filename, block_size)
+            if regions is not None:
+                self._read_regions_to_file(addr, regions, filename, **kwargs)
+                return
+
+        block_size = kwargs.get('resume_block_size', 65536)
+        output = _MappedOutputFile(filename, addr, size, block_size, resume)
+
+        regions = output.pending_regions()
+        total = sum(region[1] for region in regions)
+
+        if resume and total != size:
+            log.note('Resuming read. {:d} of {:d} bytes remain.'.format(total, size))
+
+        if total == 0:
+            output.close()
+            return
 
         if not kwargs.get('suppress_setup', False):
-            self._setup(addr, size)
+            self._setup(addr, total)
 
-        desc = self._describe_op(addr, size)
+        desc = self._describe_op(addr, total)
         show = kwargs.get('show_progress', True)
-        progress = self._ctx.create_progress_indicator(self, size, desc, unit='B', show=show)
+        progress = self._ctx.create_progress_indicator(self, total, desc, unit='B', show=show)
+        num_read = 0
+
+        def _update_progress(data: bytes, address=None):
+            nonlocal num_read
+            output.write(data, None if address is None else address - addr)
+            num_read += len(data)
+            progress.update(len(data))
+
+        try:
+            try:
+                for offset, length in regions:
+                    output.seek(offset)
+                    self._read(addr + offset, length, _update_progress)
+            except KeyboardInterrupt:
+                msg = 'Read operation interrupted. {:d} / {:d} bytes read.'
+                log.warning(msg.format(num_read, total))
+        finally:
+            self._ctx.close_progress_indicator(progress)
+            output.close()
+
+            if not output.complete:
+                msg = 'Read of {:s} is incomplete. Specify resume=True to continue it.'
+                log.note(msg.format(filename))
+
+        if not kwargs.get('suppress_teardown'):
+            self._teardown()
+
+    def _changed_regions(self, addr: int, size: int, filename: str, block_size: int):
+        """
+        Compare the block checksums of an existing file with those of target memory.
 
+        Returns a list of coalesced *[offset, length]* regions that differ, or ``None``
+        if an incremental read cannot be performed.
+        """
         try:
-            with open(filename, 'wb') as outfile:
-                def _update_progress(data: bytes):
+            file_size = os.path.getsize(filename)
+        except OSError:
+            log.note('No existing {:s} to update. Reading entire region.'.format(filename))
+            return None
+
+        if file_size != size:
+            msg = 'Size of {:s} ({:d} bytes) does not match read size. Reading entire region.'
+            log.note(msg.format(filename, file_size))
+            return None
+
+        try:
+            remote_crcs = self._ctx.block_crc32(addr, size, block_size)
+        except (OperationNotSupported, OperationFailed) as error:
+            log.warning('Unable to perform incremental read: ' + str(error))
+            return None
+
+        regions = []
+        with open(filename, 'rb') as infile:
+            for i, remote_crc in enumerate(remote_crcs):
+                data = infile.read(block_size)
+                if crc32(data) == remote_crc:
+                    continue
+
+                offset = i * block_size
+                if regions and (regions[-1][0] + regions[-1][1]) == offset:
+                    regions[-1][1] += len(data)
+                else:
+                    regions.append([offset, len(data)])
+
+        changed = sum(region[1] for region in regions)
+        log.note('{:d} of {:d} bytes have changed since {:s} was written'.format(changed, size, filename))
+
+        return regions
+
+    def _read_regions_to_file(self, addr: int, regions: list, filename: str, **kwargs):
+        """
+        Update the specified *[offset, length]* regions of the existing file *filename*
+        with the contents of memory at *addr + offset*.
+        """
+        total = sum(region[1] for region in regions)
+        if total == 0:
+            return
+
+        if not kwargs.get('suppress_setup', False):
+            self._setup(addr, total)
+
+        desc = self._describe_op(addr, total)
+        show = kwargs.get('show_progress', True)
+        progress = self._ctx.create_progress_indicator(self, total, desc, unit='B', show=show)
+
+        try:
+            with open(filename, 'r+b') as outfile:
+                def _update_progress(data: bytes, address=None):
+                    if address is not None:
+                        outfile.seek(address - addr)
                     outfile.write(data)
                     progress.update(len(data))
+
                 try:
-                    self._read(addr, size, _update_progress)
+                    for offset, length in regions:
+                        outfile.seek(offset)
+                        self._read(addr + offset, length, _update_progress)
                 except KeyboardInterrupt:
-                    outfile.flush()
-                    num_written = os.fstat(outfile.fileno()).st_size
-                    msg = 'Read operation interrupted. {:d} / {:d} bytes read.'
-                    log.warning(msg.format(num_written, size))
-
+                    msg = 'Read operation interrupted. {:s} is only partially updated.'
+                    log.warning(msg.format(filename))
         finally:
             self._ctx.close_progress_indicator(progress)
 
@@ -0,0 +1,330 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+"""
+Implements ResidentPayloadMemoryReader and ResidentPayloadMemoryWriter
+"""
+
+import struct
+import time
+
+from zlib import crc32
+
+from .go import _BlockFrameDecoder
+from .reader import MemoryReader
+from .writer import MemoryWriter
+from .. import log
+from ..operation import Operation, OperationFailed, OperationNotSupported
+
+_START_SENTINEL = b'-:[START]:-'
+
+
+class CommandServer:
+    """
+    Host-side interface to the COMMAND_SERVER payload, which remains resident after a single "go"
+    invocation and services binary requests until it is instructed to exit. Refer to
+    *payloads/src/command_server.c* for a description of the protocol.
+
+    At most one instance is active per :py:class:`~depthcharge.Depthcharge` context, and is
+    obtained via :py:meth:`get()`. The server is stopped automatically before the next console
+    command is sent, when the console is interrupted, or when :py:meth:`Depthcharge.close()
+    <depthcharge.Depthcharge.close>` or :py:meth:`~depthcharge.Depthcharge.save()` is invoked.
+
+    Request arguments, including addresses, are 32 bits wide. On AArch64 targets, only
+    the lower 4 GiB of the address space can therefore be accessed.
+    """
+
+    CMD_READ        = 0x10
+    CMD_WRITE       = 0x11
+    CMD_READ_WORD   = 0x12
+    CMD_CRC32       = 0x13
+    CMD_CALL        = 0x14
+    CMD_EXIT        = 0x1f
+
+    STATUS_OK       = 0
+    STATUS_BAD_CRC  = 1
+    STATUS_BAD_ARGS = 2
+
+    # Maximum amount of data transferred per request, in bytes.
+    # Kept small so that a retransmission does not cost much.
+    BLOCK_SIZE = 4096
+
+    # Duration (ms) after which the payload discards an incomplete request
+    _payload_timeout_ms = 250
+
+    # Duration (s) the host waits for a response before retrying
+    _response_timeout = 0.500
+
+    # Maximum number of retries per request
+    _max_retries = 8
+
+    # Exclusive upper bound of addresses representable in requests
+    ADDR_LIMIT = 1 << 32
+
+    def __init__(self, ctx):
+        self._ctx = ctx
+        self._seq = 0
+        self._decoder = _BlockFrameDecoder()
+
+    @classmethod
+    def get(cls, ctx):
+        """
+        Return the running :py:class:`CommandServer` for the provided context,
+        starting the COMMAND_SERVER payload first, if necessary.
+        """
+        if ctx._cmd_server is None:
+            server = cls(ctx)
+            server._start()
+            ctx._cmd_server = server
+
+        return ctx._cmd_server
+
+    @classmethod
+    def check_range(cls, op, addr: int, size: int):
+        """
+        Raise :py:exc:`~depthcharge.OperationNotSupported` on behalf of the operation *op*
+        if the specified memory range cannot be accessed via COMMAND_SERVER requests.
+        """
+        if addr + size > cls.ADDR_LIMIT:
+            msg = 'COMMAND_SERVER requests are limited to 32-bit addresses'
+            raise OperationNotSupported(op, msg)
+
+    def _start(self):
+        try:
+            jt_addr = self._ctx._gd['jt']['address']
+        except KeyError:
+            # Payload will use gd->jt
+            jt_addr = 0
+
+        log.debug('Starting resident command server')
+
+        console = self._ctx.console
+        self._ctx.execute_payload('COMMAND_SERVER',
+                                  '0x{:08x}'.format(jt_addr),
+                                  '{:d}'.format(self._payload_timeout_ms),
+                                  read_response=False)
+
+        resp = console.read_raw()
+        if not resp.endswith(_START_SENTINEL):
+            raise OperationFailed('Did not receive expected start sentinel from COMMAND_SERVER')
+
+        console.write('\n')
+
+    def _next_frame(self, timeout: float):
+        """
+        Returns the next *(sequence, status, crc32, data)* frame, or ``None``
+        if no further data was received within *timeout* seconds.
+        """
+        console = self._ctx.console
+        decoder = self._decoder
+        t_last = time.time()
+
+        while not decoder.frames:
+            data = console.read_raw_partial(decoder.bytes_needed())
+            if data:
+                decoder.feed(data)
+                t_last = time.time()
+            elif (time.time() - t_last) >= timeout:
+                return None
+
+        return decoder.frames.pop(0)
+
+    def request(self, cmd: int, *args, data=b'', timeout=None) -> bytes:
+        """
+        Send a request comprised of the command *cmd*, up to four integer arguments, and any
+        associated *data*. Returns the response data once a valid response is received.
+
+        Corrupted or lost requests and responses are retried. Raises :py:exc:`IOError` if the
+        maximum number of retries is exceeded, and :py:exc:`~depthcharge.OperationFailed`
+        if the payload rejects the request's arguments.
+
+        The *timeout* argument specifies the maximum duration of silence (in seconds) while
+        awaiting a response. This should be increased for long-running requests.
+        """
+        if timeout is None:
+            timeout = self._response_timeout
+
+        args = list(args) + [0] * (4 - len(args))
+        console = self._ctx.console
+
+        for _ in range(0, self._max_retries + 1):
+            self._seq = (self._seq + 1) & 0xffffffff
+
+            req = struct.pack('<B5I', cmd, self._seq, *args) + data
+            req += struct.pack('<I', crc32(req))
+            console.write_raw(req)
+
+            # Discard stale responses to previous attempts
+            frame = self._next_frame(timeout)
+            while frame is not None and frame[0] != self._seq:
+                frame = self._next_frame(timeout)
+
+            if frame is None:
+                msg = 'Timed out waiting for response'
+
+                # Ensure the payload has discarded any partial request before retrying
+                time.sleep(self._payload_timeout_ms / 1000)
+                console.read_raw()
+
+            elif frame[1] == self.STATUS_BAD_ARGS:
+                msg = 'COMMAND_SERVER rejected arguments for command 0x{:02x}: {}'
+                raise OperationFailed(msg.format(cmd, args))
+
+            elif frame[1] != self.STATUS_OK:
+                msg = 'Request was corrupted (status={:d})'.format(frame[1])
+
+            elif crc32(frame[3]) != frame[2]:
+                msg = 'CRC32 mismatch in response'
+
+            else:
+                return frame[3]
+
+            log.debug(msg + '. Retrying request.')
+
+        raise IOError(msg + '. Maximum retry attempts exceeded.')
+
+    def read(self, addr: int, size: int) -> bytes:
+        """
+        Read and return up to :py:attr:`BLOCK_SIZE` bytes of memory at *addr*.
+        """
+        data = self.request(self.CMD_READ, addr, size)
+        if len(data) != size:
+            raise IOError('Expected {:d} bytes, got {:d}'.format(size, len(data)))
+        return data
+
+    def write(self, addr: int, data: bytes):
+        """
+        Write up to :py:attr:`BLOCK_SIZE` bytes of *data* to memory at *addr*.
+        """
+        self.request(self.CMD_WRITE, addr, len(data), data=data)
+
+    def read_word(self, addr: int, size: int) -> int:
+        """
+        Read a *size*-byte value from *addr*, using a single memory access of that width.
+        """
+        data = self.request(self.CMD_READ_WORD, addr, size)
+        return int.from_bytes(data, 'little')
+
+    def crc32(self, addr: int, size: int) -> int:
+        """
+        Return the CRC32 checksum of *size* bytes of memory located at *addr*,
+        as computed by the target.
+        """
+        # Allow roughly 1 second per 4 MiB, in case the target is slow
+        timeout = self._response_timeout + size / (4 * 1024 * 1024)
+        data = self.request(self.CMD_CRC32, addr, size, timeout=timeout)
+        return int.from_bytes(data, 'little')
+
+    def call(self, index: int, *args) -> int:
+        """
+        Call the function at the specified *index* within U-Boot's jump table,
+        with up to three integer arguments. Returns the function's return value.
+        """
+        if len(args) > 3:
+            raise ValueError('At most 3 arguments are supported')
+
+        data = self.request(self.CMD_CALL, index, *args)
+        return int.from_bytes(data, 'little')
+
+    def exit(self):
+        """
+        Instruct the payload to return, and consume the resulting console output
+        (i.e. return code and prompt).
+        """
+        log.debug('Stopping resident command server')
+
+        self._ctx._cmd_server = None
+
+        try:
+            self.request(self.CMD_EXIT)
+            self._ctx.console.read()
+        except IOError:
+            # A Ctrl-C returns from the payload as well
+            self._ctx.interrupt()
+
+
+class ResidentPayloadMemoryReader(MemoryReader):
+    """
+    The ResidentPayloadMemoryReader performs reads through a :py:class:`CommandServer` that remains
+    resident on the target. Once it has been started, each read requires only a short binary request
+    and response, rather than a console command (and text parsing) per operation.
+
+    Each block of data is sent with a CRC32 checksum, and corrupted blocks are re-requested.
+
+    As with the :py:class:`GoMemoryReader`, a memory write primitive is required to deploy
+    the payload, and the "go" command must be present.
+    """
+
+    _required = {
+        'commands': ['go'],
+        'payloads': ['COMMAND_SERVER'],
+    }
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # Once running, per-operation overhead is minimal. However, deploying
+        # the payload is only worthwhile once there's a fair bit of data to read.
+        data_len = kwargs.get('data_len', 0)
+        if data_len >= 65536:
+            return 85
+
+        if data_len >= 16384:
+            return 78
+
+        if data_len >= 4096:
+            return 70
+
+        return 30
+
+    def _setup(self, addr, size):
+        CommandServer.check_range(self, addr, size)
+        self._server = CommandServer.get(self._ctx)
+
+    def _read(self, addr: int, size: int, handle_data):
+        block_size = CommandServer.BLOCK_SIZE
+        for offset in range(0, size, block_size):
+            to_read = min(block_size, size - offset)
+            handle_data(self._server.read(addr + offset, to_read))
+
+
+class ResidentPayloadMemoryWriter(MemoryWriter):
+    """
+    The ResidentPayloadMemoryWriter is the :py:class:`~depthcharge.memory.MemoryWriter`
+    counterpart to the :py:class:`ResidentPayloadMemoryReader`. Its payload is deployed
+    using one of the other available memory writers.
+    """
+
+    _required = {
+        'commands': ['go'],
+        'payloads': ['COMMAND_SERVER'],
+    }
+
+    @classmethod
+    def rank(cls, **kwargs):
+        data_len = kwargs.get('data_len', 0)
+        if data_len <= 256:
+            return 30
+
+        if data_len <= 4095:
+            return 60
+
+        if data_len <= 16384:
+            return 80
+
+        return 90
+
+    def __init__(self, ctx, **kwargs):
+        super().__init__(ctx, **kwargs)
+
+        # Limited by the payload's request buffer
+        self._block_size = CommandServer.BLOCK_SIZE
+        self._allow_block_size_override = False
+
+    def _setup(self, addr, data):
+        CommandServer.check_range(self, addr, len(data))
+        self._server = CommandServer.get(self._ctx)
+
+    def _write(self, addr: int, data: bytes, **kwargs):
+        self._server.write(addr, data)
+
+
+Operation.register(ResidentPayloadMemoryReader, ResidentPayloadMemoryWriter)
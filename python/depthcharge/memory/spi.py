@@ -0,0 +1,193 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+"""
+Implements SPIMemoryReader and SPIMemoryWriter
+"""
+
+from .reader import MemoryReader
+from .writer import MemoryWriter
+
+from .. import log
+from ..operation import Operation, OperationNotSupported
+
+
+def _check_spi_requirements(cls, ctx):
+    if not ctx.companion.firmware_capabilities().get('spi_periph', False):
+        err = 'Companion firmware does not support SPI peripheral functionality.'
+        raise OperationNotSupported(cls, err)
+
+
+def _validate_sf_response(resp: str):
+    """
+    Raise a :py:exc:`ValueError` if an ``sf`` command reported an error.
+
+    Depending upon the U-Boot version, successful reads and writes either
+    print nothing, or a summary line ending in "OK".
+    """
+    if 'Usage:' in resp:
+        raise ValueError('U-Boot responded to sf command with usage text')
+
+    lower = resp.lower()
+    if 'error' in lower or 'fail' in lower:
+        raise ValueError('Unexpected response:\n' + resp.strip())
+
+
+def _probe(ctx):
+    """
+    Have the target probe the Companion's emulated SPI flash, and confirm
+    that it actually communicated with our device.
+
+    This matters because ``sf write`` is used to perform memory reads. If
+    the bus and chip select instead correspond to a real flash device
+    on the target, its contents would be overwritten.
+    """
+    companion = ctx.companion
+    info = companion.spi_info()
+
+    companion.spi_reset()
+
+    cmd = 'sf probe {:d}:{:d} {:d} {:d}'
+    cmd = cmd.format(companion.spi_bus(), companion.spi_cs(), companion.spi_speed(), info['mode'])
+    resp = ctx.send_command(cmd)
+
+    if 'Detected' not in resp:
+        raise ValueError('Target did not detect SPI flash device:\n' + resp.strip())
+
+    status = companion.spi_status()
+    if not status['probed']:
+        msg = 'A SPI flash was detected, but it was not the Companion. Refusing to continue.\n' + \
+              'Verify that the spi_bus and spi_cs Companion settings are correct.'
+        raise ValueError(msg)
+
+    if status['unsupported_cmd']:
+        # Newer U-Boot versions may attempt to read SFDP parameters, which
+        # we don't implement. The built-in flash table is used instead.
+        log.debug('Target issued an unsupported command while probing SPI flash')
+
+    companion.spi_reset()
+
+
+class SPIMemoryReader(MemoryReader):
+    """
+    The SPIMemoryReader leverages a Depthcharge :py:class:`~depthcharge.Companion` device
+    to achieve a memory read operation using U-Boot's ``sf write`` console command.
+
+    The Companion presents itself to the target as a SPI NOR flash device. After the target
+    probes it via ``sf probe``, each ``sf write`` sends a region of the target's memory to the
+    Companion in page program commands, from which it is then retrieved by the host.
+
+    This requires that the Companion be connected to a SPI bus and chip select on the
+    target that is not already used by another flash device. Refer to the *spi_bus*,
+    *spi_cs*, and *spi_speed* :py:class:`~depthcharge.Companion` constructor
+    keyword arguments.
+    """
+
+    _required = {
+        'companion': True,
+        'commands': ['sf']
+    }
+
+    @classmethod
+    def check_requirements(cls, ctx):
+        ret = super().check_requirements(ctx)
+        _check_spi_requirements(cls, ctx)
+        return ret
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # Requires companion device, but is far faster than I2C
+        # once the per-transfer command overhead is amortized.
+        data_len = kwargs.get('data_len', 0)
+        if data_len >= 16384:
+            return 60
+
+        return 10
+
+    def _setup(self, addr, size):
+        _probe(self._ctx)
+
+    def _read(self, addr: int, size: int, handle_data):
+        companion = self._ctx.companion
+        chunk_size = companion.spi_info()['buffer_size']
+
+        while size > 0:
+            to_read = min(size, chunk_size)
+
+            companion.spi_reset()
+            resp = self._ctx.send_command('sf write 0x{:08x} 0 0x{:x}'.format(addr, to_read))
+            _validate_sf_response(resp)
+
+            status = companion.spi_status()
+            if status['programmed'] != to_read:
+                msg = 'Expected {:d} bytes to be programmed, Companion received {:d}'
+                raise IOError(msg.format(to_read, status['programmed']))
+
+            handle_data(companion.spi_write_buffer(to_read))
+
+            addr += to_read
+            size -= to_read
+
+
+class SPIMemoryWriter(MemoryWriter):
+    """
+    The SPIMemoryWriter leverages a Depthcharge :py:class:`~depthcharge.Companion` device
+    to achieve a memory write operation using U-Boot's ``sf read`` console command.
+
+    The Companion presents itself to the target as a SPI NOR flash device. Each block of the
+    payload is loaded into the Companion's read buffer, and then copied into the target's
+    memory by an ``sf read`` command.
+
+    The same bus requirements described for :py:class:`SPIMemoryReader` apply here.
+    """
+
+    _required = {
+        'companion': True,
+        'commands': ['sf']
+    }
+
+    @classmethod
+    def check_requirements(cls, ctx):
+        ret = super().check_requirements(ctx)
+        _check_spi_requirements(cls, ctx)
+        return ret
+
+    @classmethod
+    def rank(cls, **kwargs):
+        # See SPIMemoryReader.rank()
+        data_len = kwargs.get('data_len', 0)
+        if data_len >= 16384:
+            return 60
+
+        return 10
+
+    def __init__(self, ctx, **kwargs):
+        super().__init__(ctx, **kwargs)
+
+        # Each block must fit within the Companion's read buffer
+        self._block_size = self._ctx.companion.spi_info()['buffer_size']
+        self._allow_block_size_override = False
+
+    def _setup(self, addr, data):
+        _probe(self._ctx)
+
+    def _write(self, addr: int, data: bytes, **kwargs):
+        companion = self._ctx.companion
+
+        # This also resets the offset the firmware expects the next READ to begin at
+        companion.spi_reset()
+        companion.set_spi_read_buffer(data)
+
+        resp = self._ctx.send_command('sf read 0x{:08x} 0 0x{:x}'.format(addr, len(data)))
+        _validate_sf_response(resp)
+
+        status = companion.spi_status()
+        if status['read_mismatch']:
+            raise IOError('Target read from an unexpected SPI flash offset')
+
+        if status['read'] < len(data):
+            msg = 'Expected target to read {:d} bytes, Companion sent {:d}'
+            raise IOError(msg.format(len(data), status['read']))
+
+
+# Register declared Operations
+Operation.register(SPIMemoryReader, SPIMemoryWriter)
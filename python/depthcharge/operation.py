@@ -364,6 +364,9 @@ class OperationSet:
         self._obj = {}
         self._suffix = suffix
 
+        # Measured throughput (bytes/s), keyed by operation name
+        self._throughput = {}
+
     def __len__(self):
         return len(self._obj)
 
@@ -387,6 +390,37 @@ class OperationSet:
             self._names.append(op.name)
             self._obj[op.name] = op
 
+    def set_throughput(self, op, bytes_per_sec: float):
+        """
+        Record the measured throughput of an operation, specified by name or instance,
+        in bytes per second. When :py:meth:`default()` selects between operations with
+        equal :py:meth:`Operation.rank() <depthcharge.Operation.rank>` values, the one with
+        the highest measured throughput is favored.
+
+        A value of ``None`` removes a previously recorded measurement.
+        """
+        if isinstance(op, Operation):
+            op = op.name
+
+        if bytes_per_sec is None:
+            self._throughput.pop(op, None)
+        else:
+            self._throughput[op] = float(bytes_per_sec)
+
+    def throughput(self, op=None):
+        """
+        Return the measured throughput (bytes/s) of an operation, specified by name or instance,
+        or ``None`` if no measurement is available. If no operation is specified, a dictionary
+        of all measurements, keyed by operation name, is returned.
+        """
+        if op is None:
+            return dict(self._throughput)
+
+        if isinstance(op, Operation):
+            op = op.name
+
+        return self._throughput.get(op, None)
+
     def _find_by_name(self, op_name, try_suffix):
         op_name_lower = op_name.lower()
 
@@ -503,13 +537,17 @@ class OperationSet:
           ``exclude_reqts=('stratagem', 'payloads', 'companion')`` implies that any options that require
           the use of a :py:class:`Stratagem`, depend upon already-deployed payloads, or need to use a
           :py:class:`Companion` device should be excluded. The default value is
-          ``exclude_reqts=('stratage')``.
+          ``exclude_reqts=('stratagem',)``.
         * An *exclude_op* keyword can be used to exclude specific instances of
           :py:class:`~depthcharge.Operation` from being returned. If an :py:class:`Operation` uses
           another to bootstrap itself, this can be used to exclude itself from the available
           options. A single object, list, or set may be provided. The default value is ``None``.
+
+        Ties between equally ranked operations are broken using any throughput measurements
+        recorded via :py:meth:`set_throughput()`. Operations without a measurement are
+        treated as the slowest.
         """
-        exclude_reqts  = kwargs.pop('exclude_reqts', ('stratagem'))
+        exclude_reqts  = kwargs.pop('exclude_reqts', ('stratagem',))
         exclude_op     = kwargs.pop('exclude', None)
 
         if exclude_op is None:
@@ -524,14 +562,8 @@ class OperationSet:
                 continue
 
             # Enforce exclusion of Operations based upon their requirements
-            for item in exclude_reqts:
-                try:
-                    value = op._required.get(item)
-                    if value:  # True or a non-empty list/dict
-                        continue
-                except KeyError:
-                    # This is fine. It implies no requirement.
-                    pass
+            if any(op._required.get(item) for item in exclude_reqts):
+                continue  # True or a non-empty list/dict
 
             candidates.append(op)
 
@@ -544,5 +576,8 @@ class OperationSet:
 
             raise OperationNotSupported(None, msg)
 
-        candidates = sorted(candidates, key=lambda c: c.rank(**kwargs), reverse=True)
+        def sort_key(op):
+            return (op.rank(**kwargs), self._throughput.get(op.name, 0.0))
+
+        candidates = sorted(candidates, key=sort_key, reverse=True)
         return candidates[0]
@@ -18,6 +18,10 @@ def _load_builtins(arch, payloads: list, exclude: set):
     """
     Load built-in payloads into `payloads`, excluding any whose
     names appear in the `exclude` set.
+
+    A built-in payload is either the payload's bytes, or a dictionary
+    additionally containing its entry point offset and instruction set mode.
+    (See payloads/create-payload-src.py)
     """
     for attr in dir(builtin_payloads):
         if not isinstance(attr, str) or attr.startswith('_'):
@@ -29,7 +33,10 @@ def _load_builtins(arch, payloads: list, exclude: set):
         payload_dict = getattr(builtin_payloads, attr)
         try:
             payload = payload_dict[arch.name.lower()]
-            payloads.append((attr, payload))
+            if isinstance(payload, dict):
+                payloads.append((attr, payload['data'], payload))
+            else:
+                payloads.append((attr, payload))
         except KeyError:
             msg = 'Payload "{:s}" not implemented for {:s}'
             log.warning(msg.format(attr, arch.name))
@@ -66,9 +73,12 @@ class PayloadMap:
 
         # Assign each payload to its corresponding location
         for payload in payloads:
-            self.insert(payload[0], payload[1])
+            metadata = payload[2] if len(payload) > 2 else {}
+            self.insert(payload[0], payload[1],
+                        entry_offset=metadata.get('entry_offset', 0),
+                        thumb=metadata.get('thumb', False))
 
-    def insert(self, name: str, payload: bytes, required_by=None):
+    def insert(self, name: str, payload: bytes, required_by=None, **kwargs):
         """
         Insert a `payload`, identified by `name`, into the PayloadMap.
         This will assign it the next available address in the map.
@@ -77,6 +87,10 @@ class PayloadMap:
         :py:class:`depthcharge.Operation` subclass will be recorded. This
         information can be provided later via :py:meth:`mark_required_by`.
 
+        The `entry_offset` keyword argument specifies the offset of the payload's
+        entry point, relative to its start address. This defaults to 0. For ARM
+        targets, `thumb=True` denotes that the entry point is Thumb code.
+
         Returns `True` if the payload added. If a payload with the same
         name is already present, then `False` is returned. In this latter case,
         The `required_by` information is still added to the corresponding
@@ -98,6 +112,8 @@ class PayloadMap:
                 'skip_deploy':  self._skip_deploy,
                 'data':         payload,
                 'size':         size,
+                'entry_offset': kwargs.get('entry_offset', 0),
+                'thumb':        kwargs.get('thumb', False),
                 'required_by':  set()
             }
         else:
@@ -2,10 +2,10 @@
 # Depthcharge: <https://github.com/nccgroup/depthcharge>
 
 """
-Implements GoRegisterReader
+Implements GoRegisterReader and GoRegisterSnapshotReader
 """
 
-from ..operation import Operation
+from ..operation import Operation, OperationFailed
 from .reader import RegisterReader
 
 
@@ -32,4 +32,31 @@ class GoRegisterReader(RegisterReader):
         return rc
 
 
-Operation.register(GoRegisterReader)
+class GoRegisterSnapshotReader(RegisterReader):
+    """
+    Uses the "go" console command to execute a payload that reports the contents of the entire
+    register file at once, via :py:meth:`Depthcharge.register_snapshot()
+    <depthcharge.Depthcharge.register_snapshot>`.
+
+    The snapshot is cached for the remainder of the session, such that subsequent reads do not
+    require any further payload executions. The same caveat regarding tainted registers that
+    applies to :py:class:`GoRegisterReader` applies here.
+    """
+    _required = {
+        'commands': ['go'],
+        'payloads': ['READ_REGISTERS'],
+    }
+
+    @classmethod
+    def rank(cls, **_kwargs):
+        # Still requires a payload deployment, but only a single execution
+        return 15
+
+    def _read(self, register: str, info) -> int:
+        try:
+            return self._ctx.register_snapshot()[register]
+        except KeyError:
+            raise OperationFailed(register + ' is not included in the register snapshot')
+
+
+Operation.register(GoRegisterReader, GoRegisterSnapshotReader)
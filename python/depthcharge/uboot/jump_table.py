@@ -202,6 +202,11 @@ def find(gd_address, memory_reader, arch, **kwargs) -> dict:
     If you already have a `Depthcharge` handle, consider instead invoking its
     :py:meth:`~depthcharge.Depthcharge.uboot_global_data()` method, which will take care of finding
     the location of `gd` and calling this function.
+
+    On targets with 32-bit pointers, a *read_words* keyword argument may be provided in order to
+    read the jump table's entries with fewer operations than *memory_reader* requires. This must be
+    a callable with the same signature as :py:meth:`~depthcharge.Depthcharge.read_words()`, and
+    is only used once the jump table address has passed the address mask check.
     """
 
     # This seems to be "good enough" for a majority of devices.
@@ -241,7 +246,8 @@ def find(gd_address, memory_reader, arch, **kwargs) -> dict:
     log.debug('Exported jumptable potentially @ 0x{:08x}'.format(jt_addr))
 
     # Sanity-check the exlorted jumptable through a naive address mask
-    if jt_addr & jt_addr_mask != expected_masked_addr:
+    jt_addr_ok = jt_addr & jt_addr_mask == expected_masked_addr
+    if not jt_addr_ok:
         msg = 'Address mask suggests our gd->jt guess (0x{:08x}) may be incorrect.'
         msg += os.linesep
         msg += '    ' + '(We may crash the device when we dereference it.)'
@@ -252,10 +258,16 @@ def find(gd_address, memory_reader, arch, **kwargs) -> dict:
     jt['entries'] = []
     jt['extras'] = extras
 
-    jump_table_entries = exports(**kwargs)
+    jump_table_entries = exports(kwargs.get('sys_malloc_simple', False))
     table_size_bytes = len(jump_table_entries) * arch.word_size
 
-    jump_table_data = memory_reader.read(jt_addr, table_size_bytes)
+    read_words = kwargs.get('read_words', None)
+    if read_words is not None and jt_addr_ok and arch.word_size == 4:
+        addresses = range(jt_addr, jt_addr + table_size_bytes, 4)
+        words = read_words(addresses, jt_addr=jt_addr)
+        jump_table_data = b''.join(arch.int_to_bytes(word) for word in words)
+    else:
+        jump_table_data = memory_reader.read(jt_addr, table_size_bytes)
 
     mask_failures = 0
     for entry in jump_table_entries:
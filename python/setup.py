@@ -7,7 +7,7 @@ import os
 import re
 
 from os.path import dirname, join, realpath
-from setuptools import setup, find_packages
+from setuptools import setup, find_packages, Extension
 
 THIS_DIR = realpath(dirname(__file__))
 
@@ -43,6 +43,25 @@ def get_scripts() -> list:
     return ret
 
 
+def get_ext_modules() -> list:
+    # The native ReverseCRC32Hunter engine and image scanner are optional.
+    # Pure-Python implementations are used if the extensions cannot be built.
+    revcrc32 = Extension('depthcharge.hunter._revcrc32',
+                         sources=['depthcharge/hunter/_revcrc32.cpp'],
+                         language='c++',
+                         extra_compile_args=['-std=c++11', '-pthread'],
+                         extra_link_args=['-pthread'],
+                         optional=True)
+
+    scan = Extension('depthcharge.hunter._scan',
+                     sources=['depthcharge/hunter/_scan.cpp'],
+                     language='c++',
+                     extra_compile_args=['-std=c++11'],
+                     optional=True)
+
+    return [revcrc32, scan]
+
+
 def get_description() -> str:
     with open('.Depthcharge.readme', 'r') as infile:
         return infile.read()
@@ -66,6 +85,7 @@ setup(
 
     packages=find_packages(),
     scripts=get_scripts(),
+    ext_modules=get_ext_modules(),
 
     install_requires=['pyserial >= 3.4', 'tqdm >= 4.30.0'],
 
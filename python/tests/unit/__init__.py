@@ -12,10 +12,28 @@ from .checker import (
 from .hunter import (
     TestConstantHunter,
     TestGappedRangeIter,
+    TestIsInGap,
     TestReverseCRC32Hunter,
+    TestScanImage,
+    TestSplitDataOffsets,
     TestStringHunter
 )
 
+from .context import TestReadWords, TestReadCachePersistence
+
+from .memory_cache import TestMemoryCache
+
+from .memory_reader import TestMappedOutputFile, TestMemoryReaderOutput
+
+from .memory_go import (
+    TestBlockFrameDecoder,
+    TestGoBlockMemoryReader,
+    TestGoRLEMemoryReader,
+    TestRLEDecode
+)
+
+from .memory_i2c import TestI2CMemoryReaderQueue
+
 from .operation import (
     TestOperation,
     TestOperationSet,
@@ -30,5 +48,6 @@ from .string import TestXxd
 
 
 # TODO: Implement tests for the rest of this subpackage:
-#           board, cmd_table, jump_table
+#           board, cmd_table
 from .uboot import env
+from .uboot.jump_table import TestJumpTableFind
@@ -0,0 +1,196 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# pylint: disable=missing-function-docstring, missing-class-docstring, too-few-public-methods
+# pylint: disable=super-init-not-called
+
+"""
+Unit tests for depthcharge.Depthcharge methods that do not require a target
+"""
+
+import os
+import tempfile
+
+from unittest import TestCase
+
+from depthcharge import Depthcharge, log
+from depthcharge.arch import Architecture
+from depthcharge.memory.cache import MemoryCache
+from depthcharge.memory.go import _GoMemoryWordReader
+
+from .test_utils import random_data
+
+
+class _ReadWordsCtx(Depthcharge):
+    """
+    Emulates the READ_WORDS payload's output, or the read_memory() fallback,
+    atop of a buffer representing target memory.
+    """
+    def __init__(self, mem: bytes, base: int, payload=True, jt=True):
+        self.arch = Architecture.get('arm')
+        self.mem = mem
+        self.base = base
+        self.invocations = []
+        self.memory_reads = []
+
+        self.companion = None
+        self._env = {}
+        self._cmds = {'go': {'summary': 'start application at address \'addr\''}}
+        self._payloads = ['READ_WORDS', 'RETURN_MEMORY_WORD'] if payload else ['RETURN_MEMORY_WORD']
+        self._gd = {'jt': {'address': 0x87f8_0000}} if jt else {}
+
+    def _word(self, address: int) -> str:
+        offset = address - self.base
+        value = int.from_bytes(self.mem[offset:offset + 4], self.arch.endianness)
+        return '{:08x}'.format(value)
+
+    def _execute_text_payload(self, name: str, *args, timeout=30.0) -> str:
+        self.invocations.append((name, args))
+
+        lines = []
+        for arg in args[1:]:
+            fields = arg.split(':')
+            address = int(fields[0], 0)
+            count = int(fields[1]) if len(fields) > 1 else 1
+            lines.append(''.join(self._word(address + 4 * i) for i in range(0, count)))
+
+        return '\r\n'.join(lines) + '\r\n'
+
+    def read_memory(self, address: int, size: int, **kwargs) -> bytes:
+        self.memory_reads.append((address, size))
+        offset = address - self.base
+        return self.mem[offset:offset + size]
+
+
+class TestReadWords(TestCase):
+
+    _base = 0x8000_0000
+
+    def _ctx(self, **kwargs):
+        return _ReadWordsCtx(random_data(4096, ret_bytes=True), self._base, **kwargs)
+
+    def _expected(self, ctx, addresses):
+        return [int(ctx._word(address), 16) for address in addresses]
+
+    def test_run_coalescing(self):
+        ctx = self._ctx()
+        base = self._base
+        addresses = [base + 0x100, base + 0x104, base + 0x108, base + 0x200, base + 0x10c]
+
+        self.assertEqual(ctx.read_words(addresses), self._expected(ctx, addresses))
+        self.assertEqual(ctx.invocations, [
+            ('READ_WORDS', ('0x87f80000', '0x80000100:4', '0x80000200'))
+        ])
+
+    def test_order_and_duplicates(self):
+        ctx = self._ctx()
+        base = self._base
+        addresses = [base + 0x20, base, base + 0x20, base + 0x4, base]
+
+        # Values are returned in the order requested, but each word is read once
+        self.assertEqual(ctx.read_words(addresses), self._expected(ctx, addresses))
+        self.assertEqual(ctx.invocations, [('READ_WORDS', ('0x87f80000', '0x80000000:2', '0x80000020'))])
+
+    def test_batching(self):
+        ctx = self._ctx()
+        addresses = [self._base + 16 * i for i in range(0, 30)]
+
+        self.assertEqual(ctx.read_words(addresses), self._expected(ctx, addresses))
+        self.assertEqual([len(args) - 1 for (_, args) in ctx.invocations], [12, 12, 6])
+
+        for (_, args) in ctx.invocations:
+            self.assertLessEqual(sum(len(arg) + 1 for arg in args[1:]), 160)
+
+    def test_jt_addr(self):
+        ctx = self._ctx(jt=False)
+        addresses = [self._base + 0x40, self._base + 0x44]
+
+        self.assertEqual(ctx.read_words(addresses, jt_addr=0x9000_0000), self._expected(ctx, addresses))
+        self.assertEqual(ctx.invocations, [('READ_WORDS', ('0x90000000', '0x80000040:2'))])
+
+    def test_unaligned(self):
+        ctx = self._ctx()
+        with self.assertRaises(ValueError):
+            ctx.read_words([self._base, self._base + 2])
+
+        self.assertEqual(ctx.invocations, [])
+
+    def test_fallback(self):
+        base = self._base
+        addresses = [base + 0x10, base + 0x14, base + 0x80]
+
+        for kwargs in ({'payload': False}, {'jt': False}):
+            ctx = self._ctx(**kwargs)
+            self.assertEqual(ctx.read_words(addresses), self._expected(ctx, addresses))
+            self.assertEqual(ctx.invocations, [])
+            self.assertEqual(ctx.memory_reads, [(base + 0x10, 8), (base + 0x80, 4)])
+
+    def test_word_reader(self):
+        ctx = self._ctx()
+        reader = _GoMemoryWordReader(ctx)
+
+        data = bytearray()
+        reader._read(self._base + 0x10, 12, data.extend)
+
+        self.assertEqual(bytes(data), ctx.mem[0x10:0x1c])
+        self.assertEqual(ctx.invocations, [('READ_WORDS', ('0x87f80000', '0x80000010:3'))])
+
+
+class _ReadCacheCtx(Depthcharge):
+    """
+    Provides just enough state for save() and close()
+    """
+    def __init__(self, read_cache):
+        self._cmd_server = None
+        self._read_cache = read_cache
+
+    def to_json(self, timestamp=True, comment=None, **kwargs) -> str:
+        return '{}'
+
+
+class TestReadCachePersistence(TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls._old_log_level = log.get_level()
+        # Set to ERROR (unless there's an env override) to hide save() notes
+        log.set_level(os.getenv('DEPTHCHARGE_LOG_LEVEL', log.ERROR))
+
+    @classmethod
+    def tearDownClass(cls):
+        log.set_level(cls._old_log_level)
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.cache = MemoryCache('test')
+        self.cache.read(0x8000_0000, 16, lambda address, size: b'\xaa' * size)
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def _path(self, name):
+        return os.path.join(self.tmpdir.name, name)
+
+    def test_save_default_filename(self):
+        ctx = _ReadCacheCtx(self.cache)
+        ctx.save(self._path('dev.cfg'))
+
+        cache = MemoryCache.load(self._path('dev.cfg.memcache'), 'test')
+        self.assertEqual(cache.size, 16)
+
+    def test_save_filename(self):
+        self.cache.filename = self._path('other.memcache')
+
+        ctx = _ReadCacheCtx(self.cache)
+        ctx.save(self._path('dev.cfg'))
+
+        self.assertFalse(os.path.exists(self._path('dev.cfg.memcache')))
+        self.assertEqual(MemoryCache.load(self._path('other.memcache'), 'test').size, 16)
+
+    def test_close(self):
+        ctx = _ReadCacheCtx(self.cache)
+        ctx.close()
+
+        self.cache.filename = self._path('dev.cfg.memcache')
+        ctx.close()
+        self.assertEqual(MemoryCache.load(self.cache.filename, 'test').size, 16)
@@ -4,6 +4,6 @@ from .constant import TestConstantHunter
 from .cp import TestCpHunter
 from .env import TestEnvironmentHunter
 from .fdt import TestFDTHunter
-from .hunter import TestGappedRangeIter, TestSplitDataOffsets
+from .hunter import TestGappedRangeIter, TestIsInGap, TestSplitDataOffsets, TestScanImage
 from .string import TestStringHunter
 from .revcrc32 import TestReverseCRC32Hunter
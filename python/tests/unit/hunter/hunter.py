@@ -4,16 +4,22 @@
 # pylint: disable=missing-function-docstring, missing-class-docstring
 
 """
-Unit tests for depthcharge.Hunter's private utility class, _GappedRangeIter.
+Unit tests for depthcharge.Hunter's private utility class, _GappedRangeIter,
+its gap-handling helpers, and the depthcharge.hunter.scan functions.
 
 Hunter is further exercised implicitly through its subclasses' tests.
 """
 
+import os
 import sys
+import tempfile
 
-from unittest import TestCase
+from unittest import TestCase, skipIf
 
-from depthcharge.hunter import Hunter
+from depthcharge.hunter import Hunter, ConstantHunter, scan_image
+from depthcharge.hunter import scan
+
+from ..test_utils import random_data
 
 
 class TestGappedRangeIter(TestCase):
@@ -86,6 +92,33 @@ class TestGappedRangeIter(TestCase):
         self.assertEqual(self.result(target='AB', start=16, end=24, gaps=gaps), b'QRSTUVW')
 
 
+class TestIsInGap(TestCase):
+    def setUp(self):
+        self.data = bytearray(26)
+        self.addr = 0x8180_0000
+
+        # Gap covers offsets 10-16, inclusive
+        self.hunter = Hunter(self.data, self.addr, gaps=[(self.addr + 10, 7)])
+
+    def test_outside(self):
+        self.assertFalse(self.hunter._is_in_gap(0, 10))
+        self.assertFalse(self.hunter._is_in_gap(17, 9))
+
+    def test_ends_before(self):
+        # These end shortly before the gap, and must not be rejected
+        for length in range(1, 10):
+            with self.subTest(length):
+                self.assertFalse(self.hunter._is_in_gap(0, length))
+                self.assertFalse(self.hunter._is_in_gap(10 - length, length))
+
+    def test_overlapping(self):
+        self.assertTrue(self.hunter._is_in_gap(0, 11))    # Ends within
+        self.assertTrue(self.hunter._is_in_gap(16, 4))    # Starts within
+        self.assertTrue(self.hunter._is_in_gap(12, 2))    # Entirely within
+        self.assertTrue(self.hunter._is_in_gap(9, 9))     # Passes through
+        self.assertTrue(self.hunter._is_in_gap(10, 7))    # Exactly covers
+
+
 class TestSplitDataOffsets(TestCase):
     def setUp(self):
         self.data = bytearray(26)
@@ -164,3 +197,65 @@ class TestSplitDataOffsets(TestCase):
             hunter = Hunter(self.data, self.addr, gaps=gaps)
             split_data = hunter._split_data_offsets()
             self.assertEqual(split_data, expected)
+
+
+class TestScanImage(TestCase):
+
+    def setUp(self):
+        self.data = random_data(256 * 1024, ret_bytes=True)
+        self.patterns = [b'\x00\x01', b'\xff', b'\xde\xad\xbe', self.data[1000:1008]]
+
+    def expected(self, alignment, start, end):
+        ret = []
+        for i in range(start, end):
+            for index, pattern in enumerate(self.patterns):
+                if i % alignment[index] == 0 and self.data[i:i + len(pattern)] == pattern \
+                        and i + len(pattern) <= end:
+                    ret.append((i, index))
+        return ret
+
+    def _test_find_patterns(self):
+        alignment = [1, 2, 4, 8]
+        for (start, end) in ((0, len(self.data)), (1000, 1008), (3, 63 * 1024 + 5)):
+            with self.subTest(start=start, end=end):
+                result = scan.find_patterns(self.data, self.patterns, alignment, start, end)
+                self.assertEqual(result, self.expected(alignment, start, end))
+
+    def test_find_patterns(self):
+        saved = scan._native_find_patterns
+        try:
+            scan._native_find_patterns = None
+            self._test_find_patterns()
+        finally:
+            scan._native_find_patterns = saved
+
+    @skipIf(scan._native_find_patterns is None, 'Native extension is not available')
+    def test_find_patterns_native(self):
+        self._test_find_patterns()
+
+    def test_scan_image(self):
+        target = b'\xd0\x0d\xfe\xed\xca\xfe\xba\xbe'
+        data = bytearray(self.data)
+        locs = (100, 4000, 4008, 200 * 1024)
+        for loc in locs:
+            data[loc:loc + len(target)] = target
+
+        with tempfile.NamedTemporaryFile(delete=False) as outfile:
+            outfile.write(data)
+            filename = outfile.name
+
+        try:
+            hunter_cls = (ConstantHunter, [target])
+            results = scan_image(filename, 0x8000_0000, hunters=[hunter_cls])
+        finally:
+            os.remove(filename)
+
+        # The adjacent 2nd and 3rd occurrences are coalesced into a single region
+        hunters = results[ConstantHunter]
+        self.assertEqual(len(hunters), 3)
+
+        found = [r['src_addr'] for h in hunters for r in h.finditer(target)]
+        self.assertEqual(found, [0x8000_0000 + loc for loc in locs])
+
+        with self.assertRaises(ValueError):
+            scan_image(bytes(data), hunters=[ConstantHunter])
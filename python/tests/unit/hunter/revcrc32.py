@@ -6,11 +6,12 @@ Unit tests for depthcharge.hunter.ReverseCRC32Hunter
 import os
 import sys
 
-from unittest import TestCase
+from unittest import TestCase, skipIf
 from zlib import crc32
 
 import depthcharge
 from depthcharge.hunter import ReverseCRC32Hunter, HunterResultNotFound
+from depthcharge.hunter.revcrc32 import _NativeReverseLUT
 
 from ..test_utils import random_data
 
@@ -146,6 +147,33 @@ class TestReverseCRC32Hunter(TestCase):
 
                 self.assertTrue(matches[i], msg=msg)
 
+    @skipIf(_NativeReverseLUT is None, 'Native extension is not built')
+    def test_native_revlut(self):
+        data = random_data(2048, seed=7)
+        data[100:164] = b'\x00' * 64
+        data = bytes(data)
+
+        base = 0x80000000
+        gaps = [(base + 13, 4), (base + 500, 1)]
+
+        for kwargs in ({}, {'gaps': gaps}, {'gaps': gaps, 'start_offset': 7, 'end_offset': 1800}):
+            with self.subTest(str(kwargs)):
+                py_hunter = ReverseCRC32Hunter(data, base, revlut_maxlen=64, native=False, **kwargs)
+                native_hunter = ReverseCRC32Hunter(data, base, revlut_maxlen=64, **kwargs)
+
+                self.assertEqual(len(native_hunter._revlut), len(py_hunter._revlut))
+                for crc, location in py_hunter._revlut.items():
+                    self.assertEqual(native_hunter._revlut[crc], location)
+
+                for target in (0x2144df1c, 0xdeadbeef, 0x00000000, 0xffffffff):
+                    try:
+                        expected = py_hunter.find(target, max_iterations=100)
+                    except HunterResultNotFound:
+                        with self.assertRaises(HunterResultNotFound):
+                            native_hunter.find(target, max_iterations=100)
+                    else:
+                        self.assertEqual(native_hunter.find(target, max_iterations=100), expected)
+
     def _validate_crc32_stratagem(self, target, src_data, stratagem):
         buf = bytearray(len(target))
         self.assertTrue(stratagem is not None)
@@ -120,6 +120,24 @@ class TestStringHunter(TestCase):
                 result = hunter.find(None)
                 self._validate_entry(result, self.expected[1])
 
+    def test_anchored_pattern(self):
+        hunter = StringHunter(self.data, self.addr)
+
+        # Anchors and lookbehinds in user-supplied patterns apply to the searched range
+        with self.subTest('Start anchor'):
+            result = hunter.find(b'^So[^\x00]+', start=309)
+            self._validate_entry(result, self.expected[3])
+
+            with self.assertRaises(HunterResultNotFound):
+                hunter.find(b'^So[^\x00]+', start=300)
+
+        with self.subTest('Lookbehind'):
+            result = hunter.find(b'(?<!\x00)Back[^\x00]+', start=309 + 23)
+            self._validate_entry(result, self.expected[4])
+
+            with self.assertRaises(HunterResultNotFound):
+                hunter.find(b'(?<!\x00)Back[^\x00]+', start=300)
+
     def test_string_at(self):
         hunter = StringHunter(self.data, self.addr)
         result = hunter.string_at(self.addr + 501)
@@ -0,0 +1,134 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# pylint: disable=missing-function-docstring, missing-class-docstring
+
+"""
+Unit tests for depthcharge.memory.cache.MemoryCache
+"""
+
+import os
+import tempfile
+
+from unittest import TestCase
+
+from depthcharge.memory.cache import MemoryCache
+
+from .test_utils import random_data
+
+
+class TestMemoryCache(TestCase):
+
+    def setUp(self):
+        self.base = 0x8780_0000
+        self.mem = random_data(8192)
+        self.reads = []
+        self.cache = MemoryCache('test', max_read_size=4096)
+
+    def read_fn(self, address, size):
+        self.reads.append((address, size))
+        offset = address - self.base
+        return bytes(self.mem[offset:offset + size])
+
+    def read(self, offset, size, **kwargs):
+        return self.cache.read(self.base + offset, size, self.read_fn, **kwargs)
+
+    def expected(self, offset, size):
+        return bytes(self.mem[offset:offset + size])
+
+    def test_partial_hits(self):
+        self.assertEqual(self.read(100, 100), self.expected(100, 100))
+        self.assertEqual(self.read(300, 100), self.expected(300, 100))
+        self.reads.clear()
+
+        # Only the gaps surrounding cached data are read
+        self.assertEqual(self.read(50, 400), self.expected(50, 400))
+        self.assertEqual(self.reads, [(self.base + 50, 50),
+                                      (self.base + 200, 100),
+                                      (self.base + 400, 50)])
+        self.reads.clear()
+
+        self.assertEqual(self.read(60, 380), self.expected(60, 380))
+        self.assertEqual(self.reads, [])
+
+        self.assertEqual(self.read(60, 380, cached=False), self.expected(60, 380))
+        self.assertEqual(self.reads, [(self.base + 60, 380)])
+        self.assertEqual(self.cache.size, 400)
+
+    def test_invalidate(self):
+        self.read(0, 1024)
+        self.mem[500:510] = b'\xff' * 10
+        self.cache.invalidate(self.base + 500, 10)
+        self.reads.clear()
+
+        self.assertEqual(self.read(0, 1024), self.expected(0, 1024))
+        self.assertEqual(self.reads, [(self.base + 500, 10)])
+
+        self.cache.invalidate()
+        self.assertEqual(self.cache.size, 0)
+
+    def test_large_reads(self):
+        self.assertEqual(self.read(0, 4097), self.expected(0, 4097))
+        self.assertEqual(self.cache.size, 0)
+
+    def test_save_load(self):
+        self.read(0, 16)
+        self.read(1000, 24)
+
+        with tempfile.NamedTemporaryFile(delete=False) as outfile:
+            filename = outfile.name
+
+        try:
+            self.cache.save(filename)
+
+            cache = MemoryCache.load(filename, 'test')
+            self.assertEqual(cache.size, 40)
+            self.assertEqual(cache.read(self.base + 1000, 24, None), self.expected(1000, 24))
+
+            # Cached data from another target (state) is discarded
+            cache = MemoryCache.load(filename, 'other')
+            self.assertEqual(cache.size, 0)
+            self.assertEqual(cache.filename, filename)
+        finally:
+            os.remove(filename)
+
+    def test_bind(self):
+        self.read(0, 64)
+        self.read(1000, 24)
+
+        with tempfile.NamedTemporaryFile(delete=False) as outfile:
+            filename = outfile.name
+
+        try:
+            self.cache.save(filename)
+
+            # Reads and invalidations made before the identity is known
+            # are applied atop of the previously saved data
+            self.mem[40:56] = b'\xff' * 16
+            cache = MemoryCache(None, max_read_size=4096)
+            cache.read(self.base + 32, 64, self.read_fn)
+            cache.invalidate(self.base + 1008, 4)
+            self.reads.clear()
+
+            cache.bind('test', filename)
+            self.assertEqual(cache.filename, filename)
+            self.assertEqual(cache.size, 64 + 32 + 20)
+
+            self.assertEqual(cache.read(self.base + 0, 96, self.read_fn), self.expected(0, 96))
+            self.assertEqual(cache.read(self.base + 1000, 24, self.read_fn), self.expected(1000, 24))
+            self.assertEqual(self.reads, [(self.base + 1008, 4)])
+
+            with self.assertRaises(ValueError):
+                cache.bind('test')
+
+            # Only data read before binding is retained for another target (state)
+            cache = MemoryCache(None)
+            cache.read(self.base + 32, 64, self.read_fn)
+            cache.bind('other', filename)
+            self.assertEqual(cache.size, 64)
+        finally:
+            os.remove(filename)
+
+    def test_save_unbound(self):
+        with self.assertRaises(ValueError):
+            MemoryCache(None).save('unused.memcache')
@@ -0,0 +1,303 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# pylint: disable=missing-function-docstring, missing-class-docstring, too-few-public-methods
+
+"""
+Unit tests for the host-side protocol handling in depthcharge.memory.go
+"""
+
+from unittest import TestCase
+from zlib import crc32
+
+from depthcharge.arch import Architecture
+from depthcharge.memory.go import _BlockFrameDecoder, _START_SENTINEL, _rle_decode
+from depthcharge.memory.go import GoBlockMemoryReader, GoRLEMemoryReader
+
+from .test_utils import random_data
+
+
+def _encode_frame(offset: int, length: int, crc: int, data: bytes) -> bytes:
+    """
+    Encode a frame as the block_xfer.h payload code does.
+    """
+    raw = offset.to_bytes(4, 'little') + length.to_bytes(2, 'little')
+    raw += crc.to_bytes(4, 'little') + len(data).to_bytes(2, 'little') + data
+
+    ret = bytearray([_BlockFrameDecoder.FLAG])
+    for b in raw:
+        b ^= _BlockFrameDecoder.XOR_MASK
+        if b in (0x00, 0x0a, 0x0d, _BlockFrameDecoder.FLAG, _BlockFrameDecoder.ESCAPE):
+            ret += bytes([_BlockFrameDecoder.ESCAPE, b ^ _BlockFrameDecoder.ESCAPE_XOR])
+        else:
+            ret.append(b)
+
+    return bytes(ret)
+
+
+def _rle_encode(data: bytes) -> bytes:
+    """
+    Run-length encode data as the read_memory_rle payload does.
+    """
+    ret = bytearray()
+    i = 0
+
+    while i < len(data):
+        run = 1
+        while (i + run) < len(data) and run < 130 and data[i + run] == data[i]:
+            run += 1
+
+        if run >= 3:
+            ret += bytes([0x80 + run - 3, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and (i - start) < 128:
+            if data[i:i + 3] == data[i:i + 1] * 3:
+                break
+            i += 1
+
+        ret.append(i - start - 1)
+        ret += data[start:i]
+
+    return bytes(ret)
+
+
+def _block_frame(offset: int, data: bytes, encode=None) -> bytes:
+    payload_data = encode(data) if encode else data
+    return _encode_frame(offset, len(data), crc32(data), payload_data)
+
+
+class TestBlockFrameDecoder(TestCase):
+
+    def test_escaping(self):
+        # These encode to FLAG, ESCAPE, NUL, LF, and CR, respectively
+        data = bytes([0x2b, 0x28, 0x55, 0x5f, 0x58]) * 4 + b'\x00\xff'
+        frame = _block_frame(0x1000, data)
+
+        self.assertEqual(frame.count(_BlockFrameDecoder.FLAG), 1)
+        self.assertNotIn(b'\x00', frame)
+        self.assertNotIn(b'\n', frame)
+        self.assertNotIn(b'\r', frame)
+
+        decoder = _BlockFrameDecoder()
+        decoder.feed(frame)
+        self.assertEqual(decoder.frames, [(0x1000, len(data), crc32(data), data)])
+
+    def test_resync(self):
+        data = random_data(64, ret_bytes=True)
+        good = _block_frame(0x40, data)
+
+        # Leading noise is ignored, and a truncated frame is discarded
+        # upon the start of the next.
+        decoder = _BlockFrameDecoder()
+        decoder.feed(b'## Noise\r\n' + _block_frame(0, data)[:-10] + good)
+        self.assertEqual(decoder.frames, [(0x40, 64, crc32(data), data)])
+
+    def test_partial_reads(self):
+        # The first block is sent entirely as escaped bytes
+        blocks = [bytes([0x28]) * 16]
+        blocks += [random_data(300, seed=i, ret_bytes=True) for i in range(0, 3)]
+        stream = b''.join(_block_frame(i * 300, b) for i, b in enumerate(blocks))
+
+        decoder = _BlockFrameDecoder()
+        self.assertEqual(decoder.bytes_needed(), 1 + _BlockFrameDecoder.HEADER_LEN)
+
+        pos = 0
+        while pos < len(stream):
+            n = decoder.bytes_needed()
+            self.assertGreater(n, 0)
+
+            n_frames = len(decoder.frames)
+            decoder.feed(stream[pos:pos + n])
+            pos += n
+
+            # Reading exactly the number of bytes needed must never
+            # consume data beyond the end of the current frame.
+            if len(decoder.frames) != n_frames:
+                self.assertTrue(pos == len(stream) or stream[pos] == _BlockFrameDecoder.FLAG)
+
+        self.assertEqual(pos, len(stream))
+        self.assertEqual([f[3] for f in decoder.frames], blocks)
+
+    def test_pending_escape(self):
+        data = bytes([0x2b]) * 8
+        frame = _block_frame(0, data)
+        split = frame.rindex(_BlockFrameDecoder.ESCAPE) + 1
+
+        decoder = _BlockFrameDecoder()
+        decoder.feed(frame[:split])
+
+        # Only the byte following the escape remains
+        self.assertEqual(decoder.bytes_needed(), 1)
+        self.assertEqual(len(frame) - split, 1)
+        decoder.feed(frame[split:])
+        self.assertEqual(decoder.frames[0][3], data)
+
+
+class TestRLEDecode(TestCase):
+
+    def test_round_trip(self):
+        patterns = [
+            b'',
+            b'\x00',
+            b'\xff' * 2,
+            b'\xff' * 3,
+            b'ab' * 100,
+            b'\x00' * 7 + b'abc' + b'\x00' * 2 + b'd',
+            random_data(2048, ret_bytes=True),
+            bytes(random_data(4096, seed=1)[i] & 0x3 for i in range(0, 4096)),
+        ]
+
+        for data in patterns:
+            encoded = _rle_encode(data)
+            self.assertEqual(_rle_decode(encoded), data)
+
+    def test_run_limits(self):
+        # Repeated and literal runs exceeding their maximum lengths are split
+        self.assertEqual(_rle_encode(b'\xff' * 130), b'\xff\xff')
+        self.assertEqual(_rle_encode(b'\xff' * 131), b'\xff\xff\x00\xff')
+        self.assertEqual(_rle_encode(b'\xff' * 133), b'\xff\xff\x80\xff')
+
+        literal = bytes(range(0, 129))
+        self.assertEqual(_rle_encode(literal), b'\x7f' + literal[:128] + b'\x00\x80')
+
+        for data in (b'\x5a' * 1000, literal * 5, b'\x00' * 129 + literal + b'\x11' * 131):
+            self.assertEqual(_rle_decode(_rle_encode(data)), data)
+
+    def test_literal_contents(self):
+        # Literal bytes that look like control bytes, or that require escaping
+        # within a frame, are not interpreted.
+        data = bytes([0x80, 0xff, 0x7e, 0x7d, 0x2b, 0x28, 0x00, 0x0a, 0x0d, 0x7f])
+        encoded = bytes([len(data) - 1]) + data
+        self.assertEqual(_rle_encode(data), encoded)
+        self.assertEqual(_rle_decode(encoded), data)
+
+        decoder = _BlockFrameDecoder()
+        decoder.feed(_block_frame(0, data, _rle_encode))
+        self.assertEqual(decoder.frames[0][3], encoded)
+        self.assertEqual(_rle_decode(decoder.frames[0][3]), data)
+
+    def test_truncated(self):
+        with self.assertRaises(ValueError):
+            _rle_decode(b'\x03abc')
+
+        with self.assertRaises(ValueError):
+            _rle_decode(b'\x01ab\x85')
+
+
+class _PayloadConsole:
+    """
+    Models the READ_MEMORY_BLOCKS and READ_MEMORY_RLE payloads' behavior from the host's
+    perspective. Blocks listed in *corrupt* are damaged the first time they are sent.
+    """
+    def __init__(self, mem: bytes, block_size: int, corrupt=None, chunk_size=7, encode=None):
+        self.mem = mem
+        self.encode = encode
+        self.block_size = block_size
+        self.corrupt = set(corrupt or [])
+        self.chunk_size = chunk_size
+        self.pending = bytearray()
+        self.writes = []
+        self.started = False
+        self.offset = 0
+
+    def _send(self, offset: int):
+        block = self.mem[offset:offset + self.block_size]
+        frame = bytearray(_block_frame(offset, block, self.encode))
+        if offset in self.corrupt:
+            self.corrupt.remove(offset)
+            frame[-1] ^= 0x01
+        self.pending += frame
+
+    def read_raw(self):
+        if not self.started:
+            self.started = True
+            return b'## Starting application at 0x87f00000 ...\r\n' + _START_SENTINEL
+        return b''
+
+    def read_raw_partial(self, readlen=64):
+        n = min(readlen, self.chunk_size)
+        ret = bytes(self.pending[:n])
+        del self.pending[:n]
+        return ret
+
+    def write(self, data: str):
+        self.writes.append(data)
+        if data == '\n':
+            self.offset = 0
+            self._send(0)
+        elif data == 'a':
+            # The final, zero-length block denotes the end of the transfer
+            if self.offset < len(self.mem):
+                self.offset = min(self.offset + self.block_size, len(self.mem))
+                self._send(self.offset)
+        elif data.startswith('r'):
+            self.offset = int(data[1:], 16)
+            self._send(self.offset)
+
+
+class _DummyCtx:
+    def __init__(self, console):
+        self.arch = Architecture.get('arm')
+        self.companion = None
+        self.console = console
+        self.executed = []
+
+        self._allow_reboot = False
+        self._cmds = ['go']
+        self._env = []
+        self._payloads = ['READ_MEMORY_BLOCKS', 'READ_MEMORY_RLE', 'RETURN_MEMORY_WORD']
+        self._gd = {'jt': {'address': 0x87f8_0000}}
+
+    def execute_payload(self, name, *args, **kwargs):
+        self.executed.append((name, args, kwargs))
+
+
+class TestGoBlockMemoryReader(TestCase):
+
+    _reader = GoBlockMemoryReader
+    _encode = None
+
+    def _read(self, mem: bytes, **kwargs):
+        console = _PayloadConsole(mem, self._reader._block_size, encode=self._encode, **kwargs)
+        ctx = _DummyCtx(console)
+
+        reader = self._reader(ctx)
+        reader._jt_addr = ctx._gd['jt']['address']
+
+        data = bytearray()
+        reader._block_read(0x8000_0000, len(mem), data.extend)
+
+        self.assertEqual(ctx.executed[0][0], self._reader._read_payload)
+        return (bytes(data), console.writes)
+
+    def test_read(self):
+        mem = random_data(10000, ret_bytes=True)
+        data, writes = self._read(mem)
+
+        self.assertEqual(data, mem)
+        self.assertEqual(writes, ['\n', 'a', 'a', 'a', 'a'])
+
+    def test_crc_mismatch(self):
+        mem = random_data(10000, ret_bytes=True)
+        data, writes = self._read(mem, corrupt=[0x1000])
+
+        # A resend is requested, starting from the corrupted block
+        self.assertEqual(data, mem)
+        self.assertEqual(writes, ['\n', 'a', 'r00001000', 'a', 'a', 'a'])
+
+
+class TestGoRLEMemoryReader(TestGoBlockMemoryReader):
+
+    _reader = GoRLEMemoryReader
+    _encode = staticmethod(_rle_encode)
+
+    def test_block_boundary(self):
+        # Each block is encoded independently, so runs spanning blocks are split
+        mem = random_data(4000, ret_bytes=True) + b'\xff' * 5000 + random_data(100, ret_bytes=True)
+        data, writes = self._read(mem)
+
+        self.assertEqual(data, mem)
+        self.assertEqual(writes, ['\n', 'a', 'a', 'a', 'a'])
@@ -0,0 +1,117 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# pylint: disable=missing-function-docstring, missing-class-docstring, too-few-public-methods
+# pylint: disable=super-init-not-called
+
+"""
+Unit tests for the Companion write queue handling in depthcharge.memory.i2c
+"""
+
+from unittest import TestCase
+
+from depthcharge import Companion
+from depthcharge.arch import Architecture
+from depthcharge.memory.i2c import I2CMemoryReader
+
+from .test_utils import random_data
+
+
+class _QueueCompanion(Companion):
+    """
+    Emulates the firmware's I2C write queue and its drain request.
+    """
+    def __init__(self, stale_overflow=False):
+        self._fw_capabilities = {'i2c_periph': True, 'i2c_write_queue': True}
+        self._max_payload = 64
+        self._i2c_addr = 0x78
+
+        self.queue = []
+        self.overflow = stale_overflow
+
+    def send_cmd(self, cmd: str, data: bytes, resp_len, status=None) -> bytes:
+        assert cmd == 'i2c_drain_write_queue'
+
+        flags = self._drain_overflow if self.overflow else 0
+        self.overflow = False
+
+        resp = bytearray()
+        while self.queue and 1 + len(resp) + 1 + len(self.queue[0]) <= self._max_payload:
+            record = self.queue.pop(0)
+            resp.append(len(record))
+            resp += record
+
+        if self.queue:
+            flags |= self._drain_more
+
+        return bytes([flags]) + bytes(resp)
+
+
+class _I2CCtx:
+    def __init__(self, mem: bytes, base: int, companion, overflow_at=None):
+        self.arch = Architecture.get('arm')
+        self.companion = companion
+        self.mem = mem
+        self.base = base
+        self.commands = 0
+        self.overflow_at = overflow_at
+
+        self._allow_reboot = False
+        self._cmds = {'i2c': {}}
+
+    def send_command(self, cmd: str) -> str:
+        fields = cmd.split()
+        address = int(fields[2], 0)
+        count = int(fields[5], 0)
+
+        if self.commands == self.overflow_at:
+            self.companion.overflow = True
+        else:
+            offset = address - self.base
+            self.companion.queue.append(self.mem[offset:offset + count])
+
+        self.commands += 1
+        return ''
+
+
+class TestI2CMemoryReaderQueue(TestCase):
+
+    _base = 0x8000_0000
+
+    def _read(self, **kwargs):
+        mem = random_data(512, ret_bytes=True)
+        companion = _QueueCompanion(kwargs.pop('stale_overflow', False))
+
+        # Left over from an earlier, interrupted read
+        companion.queue.append(b'\x00' * 8)
+
+        ctx = _I2CCtx(mem, self._base, companion, **kwargs)
+        reader = I2CMemoryReader(ctx)
+
+        data = bytearray()
+        reader._read_queued(self._base, len(mem), 31, data.extend)
+        return (mem, bytes(data))
+
+    def test_read(self):
+        (mem, data) = self._read()
+        self.assertEqual(data, mem)
+
+    def test_stale_overflow(self):
+        # Overflows prior to the read are discarded along with the stale data
+        (mem, data) = self._read(stale_overflow=True)
+        self.assertEqual(data, mem)
+
+    def test_overflow(self):
+        with self.assertRaises(IOError):
+            self._read(overflow_at=3)
+
+    def test_drain_after_overflow(self):
+        companion = _QueueCompanion(stale_overflow=True)
+        companion.queue = [b'\xaa' * 40, b'\xbb' * 40]
+
+        # The entire queue is drained before the overflow is reported
+        with self.assertRaises(IOError):
+            companion.i2c_drain_write_queue()
+
+        self.assertEqual(companion.queue, [])
+        self.assertEqual(companion.i2c_drain_write_queue(), [])
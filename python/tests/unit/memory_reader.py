@@ -0,0 +1,192 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# pylint: disable=missing-function-docstring, missing-class-docstring, too-few-public-methods
+
+"""
+Unit tests for depthcharge.memory.reader.MemoryReader file output
+"""
+
+import os
+import struct
+import tempfile
+
+from unittest import TestCase
+
+from depthcharge.memory.reader import MemoryReader, _MappedOutputFile
+
+from .test_utils import random_data
+
+
+class _DummyProgress:
+    def update(self, _count):
+        pass
+
+
+class _DummyCtx:
+    def __init__(self):
+        self.companion = None
+        self._cmds = []
+        self._env = []
+        self._payloads = []
+
+    def create_progress_indicator(self, *_args, **_kwargs):
+        return _DummyProgress()
+
+    def close_progress_indicator(self, _progress):
+        pass
+
+
+class _DummyReader(MemoryReader):
+    """
+    Provides data in reverse order, in chunks of *chunk_size* bytes. Raises a
+    KeyboardInterrupt once *interrupt_after* bytes have been provided, if specified.
+    """
+    def __init__(self, ctx, base: int, mem: bytes, chunk_size=1000, interrupt_after=None):
+        super().__init__(ctx)
+        self.base = base
+        self.mem = mem
+        self.chunk_size = chunk_size
+        self.interrupt_after = interrupt_after
+        self.reads = []
+
+    @classmethod
+    def rank(cls, **_kwargs):
+        return 0
+
+    def _read(self, addr: int, size: int, handle_data):
+        self.reads.append((addr, size))
+
+        end = addr + size
+        while end > addr:
+            if self.interrupt_after is not None and self.interrupt_after <= 0:
+                raise KeyboardInterrupt
+
+            start = max(addr, end - self.chunk_size)
+            offset = start - self.base
+            handle_data(self.mem[offset:offset + end - start], address=start)
+
+            if self.interrupt_after is not None:
+                self.interrupt_after -= end - start
+
+            end = start
+
+
+class TestMappedOutputFile(TestCase):
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.filename = os.path.join(self.tmpdir.name, 'dump.bin')
+        self.base = 0x8000_0000
+        self.mem = random_data(10000, ret_bytes=True)
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def test_sidecar(self):
+        output = _MappedOutputFile(self.filename, self.base, len(self.mem), 1024)
+        output.write(self.mem[:1024], 0)
+        output.write(self.mem[3072:5000], 3072)
+        output.close()
+
+        # Blocks 0 and 3 are complete. Block 4 is only partially written.
+        with open(output.progress_file, 'rb') as infile:
+            sidecar = infile.read()
+
+        header = struct.pack('<4sQQI', b'DCRP', self.base, len(self.mem), 1024)
+        self.assertEqual(sidecar, header + bytes([0x09, 0x00]))
+
+        output = _MappedOutputFile(self.filename, self.base, len(self.mem), 1024, resume=True)
+        self.assertEqual(output.pending_regions(), [[1024, 2048], [4096, 10000 - 4096]])
+        self.assertFalse(output.complete)
+
+        output.write(self.mem[1024:3072], 1024)
+        output.seek(4096)
+        output.write(self.mem[4096:])
+        self.assertTrue(output.complete)
+        output.close()
+
+        self.assertFalse(os.path.exists(output.progress_file))
+        with open(self.filename, 'rb') as infile:
+            self.assertEqual(infile.read(), self.mem)
+
+    def test_header_mismatch(self):
+        output = _MappedOutputFile(self.filename, self.base, len(self.mem), 1024)
+        output.write(self.mem[:4096], 0)
+        output.close()
+
+        # A different address, block size, or corrupted header restarts the read
+        mismatches = [
+            (self.base + 1024, 1024),
+            (self.base, 2048),
+        ]
+
+        for addr, block_size in mismatches:
+            output = _MappedOutputFile(self.filename, addr, len(self.mem), block_size, resume=True)
+            self.assertEqual(output.pending_regions(), [[0, len(self.mem)]])
+            output.close()
+
+        output = _MappedOutputFile(self.filename, self.base, len(self.mem), 1024)
+        output.write(self.mem[:4096], 0)
+        output.close()
+
+        with open(output.progress_file, 'r+b') as outfile:
+            outfile.write(b'XXXX')
+
+        output = _MappedOutputFile(self.filename, self.base, len(self.mem), 1024, resume=True)
+        self.assertEqual(output.pending_regions(), [[0, len(self.mem)]])
+        output.close()
+
+    def test_out_of_bounds(self):
+        output = _MappedOutputFile(self.filename, self.base, 100, 16)
+        with self.assertRaises(ValueError):
+            output.write(b'\x00' * 8, 96)
+        output.close()
+
+
+class TestMemoryReaderOutput(TestCase):
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.filename = os.path.join(self.tmpdir.name, 'dump.bin')
+        self.base = 0x8000_0000
+        self.mem = random_data(300000, ret_bytes=True)
+
+    def tearDown(self):
+        self.tmpdir.cleanup()
+
+    def _reader(self, **kwargs):
+        return _DummyReader(_DummyCtx(), self.base, self.mem, **kwargs)
+
+    def _file_data(self):
+        with open(self.filename, 'rb') as infile:
+            return infile.read()
+
+    def test_read_out_of_order(self):
+        reader = self._reader()
+        self.assertEqual(reader.read(self.base + 10, 5000), self.mem[10:5010])
+
+    def test_resume(self):
+        size = len(self.mem)
+        reader = self._reader(chunk_size=8192, interrupt_after=150000)
+        reader.read_to_file(self.base, size, self.filename)
+        self.assertTrue(os.path.exists(self.filename + '.progress'))
+
+        # Only the first three blocks were incomplete when the read was interrupted
+        reader = self._reader(chunk_size=8192)
+        reader.read_to_file(self.base, size, self.filename, resume=True)
+        self.assertEqual(reader.reads, [(self.base, 3 * 65536)])
+
+        self.assertEqual(self._file_data(), self.mem)
+        self.assertFalse(os.path.exists(self.filename + '.progress'))
+
+    def test_resume_mismatch(self):
+        size = len(self.mem)
+        reader = self._reader(interrupt_after=150000)
+        reader.read_to_file(self.base, size, self.filename)
+
+        # A different read of the same size restarts from the beginning
+        reader = self._reader()
+        reader.read_to_file(self.base, size, self.filename, resume=True, resume_block_size=4096)
+        self.assertEqual(reader.reads, [(self.base, size)])
+        self.assertEqual(self._file_data(), self.mem)
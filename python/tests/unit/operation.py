@@ -130,6 +130,68 @@ class TestOperationSet(TestCase):
         op = s.find('_DummyOperation')
         self.assertTrue(op is s['_DummyOperation'])
 
+    def test_default_exclude_reqts(self):
+        class _LowRankOperation(_DummyOperation):
+            _required = {}
+
+            @classmethod
+            def rank(cls, **kwargs):
+                return 10
+
+        class _HighRankOperation(_DummyOperation):
+            _required = {'payloads': ['PAYLOAD']}
+
+            @classmethod
+            def rank(cls, **kwargs):
+                return 90
+
+        ctx = _DummyCtx(payloads=['PAYLOAD'])
+        s = OperationSet(suffix='Operation')
+        s.add(_LowRankOperation(ctx))
+        s.add(_HighRankOperation(ctx))
+
+        self.assertTrue(s.default() is s['_HighRankOperation'])
+
+        op = s.default(exclude_reqts=('payloads',))
+        self.assertTrue(op is s['_LowRankOperation'])
+
+        with self.assertRaises(OperationNotSupported):
+            s.default(exclude_reqts=('payloads',), exclude=op)
+
+    def test_default_throughput_tiebreak(self):
+        class _SlowOperation(_DummyOperation):
+            _required = {}
+
+            @classmethod
+            def rank(cls, **kwargs):
+                return 50
+
+        class _FastOperation(_SlowOperation):
+            pass
+
+        class _BestOperation(_SlowOperation):
+            @classmethod
+            def rank(cls, **kwargs):
+                return 60
+
+        ctx = _DummyCtx()
+        s = OperationSet(suffix='Operation')
+        s.add(_SlowOperation(ctx))
+        s.add(_FastOperation(ctx))
+
+        s.set_throughput('_FastOperation', 100.0)
+        s.set_throughput(s['_SlowOperation'], 10.0)
+        self.assertTrue(s.default() is s['_FastOperation'])
+        self.assertEqual(s.throughput('_SlowOperation'), 10.0)
+
+        s.set_throughput('_FastOperation', None)
+        self.assertTrue(s.default() is s['_SlowOperation'])
+        self.assertEqual(s.throughput(), {'_SlowOperation': 10.0})
+
+        # Measurements do not override rank
+        s.add(_BestOperation(ctx))
+        self.assertTrue(s.default() is s['_BestOperation'])
+
 
 class TestOperationNotSupported(TestCase):
 
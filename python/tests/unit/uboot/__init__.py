@@ -1 +1,2 @@
+from .jump_table import TestJumpTableFind
 from .version import TestUbootVersion
@@ -0,0 +1,125 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Depthcharge: <https://github.com/nccgroup/depthcharge>
+#
+# Relax style and documentation requirements for unit tests.
+# pylint: disable=missing-function-docstring, missing-class-docstring
+#
+
+"""
+Unit tests for depthcharge.uboot.jump_table.find()
+"""
+
+import os
+
+from unittest import TestCase
+
+from depthcharge import log
+from depthcharge.arch import Architecture
+from depthcharge.operation import OperationFailed
+from depthcharge.uboot import jump_table
+
+
+class _ImageReader:
+    """
+    Minimal stand-in for a MemoryReader, serving reads from a memory image
+    """
+    def __init__(self, image: dict):
+        self.image = image
+        self.reads = []
+
+    def data(self, address: int, size: int) -> bytes:
+        return bytes(self.image.get(addr, 0xff) for addr in range(address, address + size))
+
+    def read(self, address: int, size: int) -> bytes:
+        self.reads.append((address, size))
+        return self.data(address, size)
+
+
+class TestJumpTableFind(TestCase):
+
+    GD_ADDR = 0x8ff0_0000
+    JT_ADDR = 0x8ffd_0000
+    FN_BASE = 0x8fe0_0000
+
+    # Offsets of gd->new_gd and gd->env_buf[32] within the global data structure
+    NEW_GD_OFFSET  = 0x40
+    ENV_BUF_OFFSET = 0x80
+
+    @classmethod
+    def setUpClass(cls):
+        cls._old_log_level = log.get_level()
+        # Set to ERROR (unless there's an env override) to hide expected warnings
+        log.set_level(os.getenv('DEPTHCHARGE_LOG_LEVEL', log.ERROR))
+
+    @classmethod
+    def tearDownClass(cls):
+        log.set_level(cls._old_log_level)
+
+    def setUp(self):
+        self.arch = Architecture.get('arm')
+        self.entries = jump_table.exports()
+
+        image = {}
+
+        def put(address, data):
+            for i, b in enumerate(data):
+                image[address + i] = b
+
+        # gd is filled with non-ASCII bytes, so that env_buf is the only
+        # candidate for its 32 bytes of printable characters.
+        put(self.GD_ADDR, b'\xa5' * 256)
+        put(self.GD_ADDR + self.NEW_GD_OFFSET, self.arch.int_to_bytes(self.GD_ADDR))
+        put(self.GD_ADDR + self.ENV_BUF_OFFSET - 4, self.arch.int_to_bytes(self.JT_ADDR))
+        put(self.GD_ADDR + self.ENV_BUF_OFFSET, b'bootcmd=run distro_bootcmd'.ljust(32, b'\0'))
+
+        for i in range(0, len(self.entries)):
+            put(self.JT_ADDR + 4 * i, self.arch.int_to_bytes(self.FN_BASE + 0x100 * i))
+
+        self.reader = _ImageReader(image)
+        self.read_words_calls = []
+
+    def read_words(self, addresses, jt_addr=None):
+        self.read_words_calls.append((list(addresses), jt_addr))
+        return [self.arch.to_uint(self.reader.data(addr, 4)) for addr in addresses]
+
+    def _check_result(self, jt):
+        self.assertEqual(jt['address'], self.JT_ADDR)
+        self.assertEqual(len(jt['entries']), len(self.entries))
+
+        for i, (entry, expected) in enumerate(zip(jt['entries'], self.entries)):
+            self.assertEqual(entry['name'], expected[0])
+            self.assertEqual(entry['address'], self.FN_BASE + 0x100 * i)
+
+    def test_memory_reader(self):
+        jt = jump_table.find(self.GD_ADDR, self.reader, self.arch)
+        self._check_result(jt)
+        self.assertIn((self.JT_ADDR, 4 * len(self.entries)), self.reader.reads)
+
+    def test_read_words(self):
+        jt = jump_table.find(self.GD_ADDR, self.reader, self.arch, read_words=self.read_words)
+        self._check_result(jt)
+
+        # Only the global data structure is read via the MemoryReader
+        self.assertEqual(self.reader.reads, [(self.GD_ADDR, 256)])
+
+        expected = list(range(self.JT_ADDR, self.JT_ADDR + 4 * len(self.entries), 4))
+        self.assertEqual(self.read_words_calls, [(expected, self.JT_ADDR)])
+
+    def test_read_words_mask_failure(self):
+        # The jump table address fails the address mask check, so read_words
+        # is not trusted with it.
+        jt_addr_mask = 0xffff_0000
+        with self.assertRaises(OperationFailed):
+            jump_table.find(self.GD_ADDR, self.reader, self.arch,
+                            read_words=self.read_words, jt_addr_mask=jt_addr_mask)
+
+        self.assertEqual(self.read_words_calls, [])
+
+    def test_find_kwargs(self):
+        jt = jump_table.find(self.GD_ADDR, self.reader, self.arch, read_words=self.read_words,
+                             gd_read_size=192, jt_addr_mask=0xf000_0000, sys_malloc_simple=True)
+
+        names = [entry['name'] for entry in jt['entries']]
+        self.assertNotIn('free', names)
+        self.assertEqual(len(names), len(self.entries) - 1)
+        self.assertEqual(self.reader.reads, [(self.GD_ADDR, 192)])